@@ -75,12 +75,14 @@ if (CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /FS")
     set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} /FS")
 
+    # Only the kernels of each instruction set are compiled with these flags
+    # (see Sources/Sapphire/CMakeLists.txt), and they are selected at runtime
     if (USE_AVX2 AND NOT MSVC_VERSION LESS 1800)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX /arch:AVX2")
+        set(AVX2_COMPILE_OPTIONS /arch:AVX2)
         add_compile_definitions(WITH_AVX2)
     endif ()
     if (USE_AVX512 AND NOT MSVC_VERSION LESS 1800)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /arch:AVX512")
+        set(AVX512_COMPILE_OPTIONS /arch:AVX512)
         add_compile_definitions(WITH_AVX512)
     endif ()
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /openmp")
@@ -143,13 +145,32 @@ if (CMAKE_CXX_COMPILER_ID MATCHES "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES "Clang"
         set(DEFAULT_COMPILE_OPTIONS ${DEFAULT_COMPILE_OPTIONS}  -Wall)
      endif()
 
+    # Only the kernels of each instruction set are compiled with these flags
+    # (see Sources/Sapphire/CMakeLists.txt), and they are selected at runtime
     if (USE_AVX2)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx -mavx2")
+        set(AVX2_COMPILE_OPTIONS -mavx -mavx2 -mfma -mf16c)
         add_compile_definitions(WITH_AVX2)
     endif ()
     if (USE_AVX512)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mavx512")
+        set(AVX512_COMPILE_OPTIONS -mavx -mavx2 -mfma -mf16c -mavx512f)
         add_compile_definitions(WITH_AVX512)
+
+        # Bfloat16 conversion instructions are used only if the cpu has them
+        include(CheckCXXCompilerFlag)
+        check_cxx_compiler_flag(-mavx512bf16 COMPILER_SUPPORTS_AVX512BF16)
+        if (COMPILER_SUPPORTS_AVX512BF16)
+            set(AVX512BF16_COMPILE_OPTIONS ${AVX512_COMPILE_OPTIONS}
+                    -mavx512bf16)
+            add_compile_definitions(WITH_AVX512BF16)
+        endif ()
+
+        # Int8 dot products are used only if the cpu has them
+        check_cxx_compiler_flag(-mavx512vnni COMPILER_SUPPORTS_AVX512VNNI)
+        if (COMPILER_SUPPORTS_AVX512VNNI)
+            set(AVX512VNNI_COMPILE_OPTIONS ${AVX512_COMPILE_OPTIONS}
+                    -mavx512vnni)
+            add_compile_definitions(WITH_AVX512VNNI)
+        endif ()
     endif ()
 endif ()
 
@@ -11,8 +11,11 @@
 #include <Sapphire/tensor/Tensor.hpp>
 #include <Sapphire/tensor/TensorDescriptor.hpp>
 #include <Sapphire/operations/optimizers/Optimizer.hpp>
+#include <Sapphire/util/SlotVector.hpp>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 
 namespace Sapphire
@@ -43,24 +46,26 @@ public:
 
     //! Creates and registers tensor descriptor
     //! Assigns new key to the given tensorDesc
-    int RegisterTensorDescriptor(const Shape& shape, Type type,
-                                 bool preserve = false);
+    std::int64_t RegisterTensorDescriptor(const Shape& shape, Type type,
+                                          bool preserve = false);
 
     //! Creates and registers tensor descriptor
     //! Assigns new key to the given tensorDesc
-    int RegisterTensorDescriptor(const Shape& shape, Type type,
-                                 const CudaDevice& device,
-                                 bool preserve = false);
+    std::int64_t RegisterTensorDescriptor(const Shape& shape, Type type,
+                                          const CudaDevice& device,
+                                          bool preserve = false);
 
     //! Registers back propagation wrapper
     //! \param backPropWrapper :  back propagation wrapper to register
     //! \return : key of the back propagation wrapper
-        int RegisterBackPropWrapper(BackProp::BackPropWrapper* backPropWrapper);
+    std::int64_t RegisterBackPropWrapper(
+        BackProp::BackPropWrapper* backPropWrapper);
 
     //! Returns descriptor using the descKey
     //! \param descKey : key of the descriptor
     //! \return : tensor descriptor of given key
-    [[nodiscard]] TensorUtil::TensorDescriptor& GetDescriptor(int descKey);
+    [[nodiscard]] TensorUtil::TensorDescriptor& GetDescriptor(
+        std::int64_t descKey);
 
     [[nodiscard]] Optimizer::Optimizer* GetOptimizer() const
     {
@@ -75,7 +80,59 @@ public:
         m_optimizer = optimizer;
     }
 
+    //! Sets whether memory of intermediate tensors is released during back
+    //! propagation. Enabled by default
+    void SetReleaseOnBackProp(bool release)
+    {
+        m_releaseOnBackProp = release;
+    }
+
+    //! Starts checkpoint region
+    //! Units called inside the region compute their outputs without saving
+    //! history, and tensors registered inside the region are released when it
+    //! ends. Regions cannot be nested
+    void BeginCheckpointRegion();
+
+    //! Ends checkpoint region, releasing every non-preserved tensor registered
+    //! inside the region except the output
+    //! \param outputKey : descriptor key of the output of the region
+    void EndCheckpointRegion(std::int64_t outputKey);
+
+    //! Returns true if the given descriptor was registered inside the current
+    //! checkpoint region
+    [[nodiscard]] bool IsInCheckpointRegion(std::int64_t descKey) const;
+
+    //! Returns false inside checkpoint region
+    [[nodiscard]] bool IsRecordingHistory() const
+    {
+        return !m_inCheckpointRegion;
+    }
+
+    //! Sets whether a checkpoint region is being computed again for back
+    //! propagation. Set by back propagation of checkpoint regions
+    void SetRecomputing(bool recomputing)
+    {
+        m_recomputing = recomputing;
+    }
+
+    //! Returns true while a checkpoint region is computed again
+    //! Units with state updated by forward propagation, such as running
+    //! statistics of BatchNorm2D, keep it as is, since it was already updated
+    //! when the region was first computed
+    [[nodiscard]] bool IsRecomputing() const
+    {
+        return m_recomputing;
+    }
+
+    //! Releases memory of the tensor and removes its descriptor unless it is
+    //! preserved. The tensor cannot be used afterwards
+    void ReleaseTensor(const Tensor& tensor);
+
     //! Starts back propagation from the given tensor
+    //! If release on back propagation is enabled, forward and backward data
+    //! of every tensor computed by units go back to the free pool as soon as
+    //! its gradient is propagated, and the tensor cannot be used afterwards.
+    //! Tensors created by the user and preserved tensors are kept
     //! \param tensor : tensor to start back propagation
     void BackProp(Tensor tensor);
 
@@ -90,25 +147,41 @@ private:
     //! Automatically calculates gradient
     //! \param tensorKey : tensor key to the descriptor to start back
     //! propagation
-    void m_autoGrad(int tensorKey);
+    void m_autoGrad(std::int64_t tensorKey);
 
-    class TensorDescriptorPool
+    struct DescriptorEntry
     {
-    public:
-        std::unordered_map<int, TensorUtil::TensorDescriptor> TensorDescMap;
-        int Counter = 0;
+        TensorUtil::TensorDescriptor Descriptor;
+        bool Preserved;
     };
 
-    void m_removeDescriptor(int descKey);
+    void m_removeDescriptor(std::int64_t descKey);
+
+    //! Releases memory of the descriptor and removes it unless it is
+    //! preserved
+    void m_releaseDescriptor(std::int64_t descKey);
 
     std::string m_name;
     Optimizer::Optimizer* m_optimizer;
-    TensorDescriptorPool m_tensorDescriptorPool;
-    TensorDescriptorPool m_preservedDescriptorPool;
-    std::unordered_map<int, BackProp::BackPropWrapper*> m_backPropWrapperPool;
+    //! Descriptors and wrappers are indexed by their keys directly
+    Util::SlotVector<DescriptorEntry> m_descriptorPool;
+    Util::SlotVector<BackProp::BackPropWrapper*> m_backPropWrapperPool;
+    bool m_releaseOnBackProp = true;
+    //! Descriptors waiting for the wrapper of the key to be invoked before
+    //! they are released. Wrappers with multiple outputs are invoked after
+    //! gradients of all outputs are ready
+    std::unordered_map<std::int64_t, std::vector<std::int64_t>>
+    m_pendingRelease;
+    bool m_inCheckpointRegion = false;
+    bool m_recomputing = false;
+    //! Keys of descriptors registered inside current checkpoint region
+    std::vector<std::int64_t> m_checkpointRegionKeys;
 };
 
 //! Singleton class for model management
+//! Current model is kept per thread, so each thread can drive its own model
+//! in parallel. Ops resolve it without any lookup or lock, while registering
+//! and looking up models by name is synchronized
 class ModelManager
 {
 public:
@@ -116,22 +189,48 @@ public:
     //! \param modelName : name of the model to get
     static Model& GetModel(const std::string& modelName);
 
-    //! Returns currently active model
+    //! Returns currently active model of the calling thread
     //! \return : current model
     static Model& CurModel();
 
-    //! Sets current model to the given modelName
+    //! Returns true if the calling thread has current model
+    [[nodiscard]] static bool HasCurModel();
+
+    //! Sets current model of the calling thread to the given modelName
     //! \param modelName : name of the model to be set
     static void SetCurrentModel(const std::string& modelName);
 
+    //! Sets current model of the calling thread to the given model
+    //! \param model : model to be set. Must outlive its use as current model
+    static void SetCurrentModel(Model& model);
+
     //! Adds a new model to the ModelManager
+    //! Model of existing name is kept
     //! \param modelName : name of the model
-    static void AddModel(const std::string& modelName);
+    //! \return : model of the given name
+    static Model& AddModel(const std::string& modelName);
 
 private:
-    static std::string m_currentModel;
+    static std::mutex m_mutex;
     static std::unordered_map<std::string, Model> m_modelMap;
 };
+
+//! Sets current model of this thread while it is alive, and restores the
+//! previous one on destruction
+//! Worker threads use it to drive their own model
+class ModelScope
+{
+public:
+    explicit ModelScope(Model& model);
+    explicit ModelScope(const std::string& modelName);
+    ~ModelScope();
+
+    ModelScope(const ModelScope& scope) = delete;
+    ModelScope& operator=(const ModelScope& scope) = delete;
+
+private:
+    Model* m_previous;
+};
 } // namespace Sapphire
 
 #endif
@@ -9,14 +9,25 @@
 
 #include <Sapphire/Model.hpp>
 #include <Sapphire/util/ResourceManager.hpp>
-#include <Sapphire/Tensor/Tensor.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
 #include <Sapphire/util/FileManager.hpp>
+#include <Sapphire/util/Checkpoint.hpp>
 #include <Sapphire/util/DataLoader/BinaryLoader.hpp>
 #include <Sapphire/util/DataLoader/CsvLoader.hpp>
+#include <Sapphire/util/DataLoader/CsvCache.hpp>
+#include <Sapphire/util/DataLoader/Prefetcher.hpp>
+#include <Sapphire/util/Serving/InferenceServer.hpp>
+#include <Sapphire/util/Serving/UnixSocketServer.hpp>
 #include <Sapphire/operations/Forward/Linear.hpp>
 #include <Sapphire/operations/Forward/Conv2D.hpp>
+#include <Sapphire/operations/Forward/BatchNorm2D.hpp>
+#include <Sapphire/operations/Forward/LayerNorm.hpp>
+#include <Sapphire/operations/Forward/LSTM.hpp>
+#include <Sapphire/operations/Forward/GRU.hpp>
+#include <Sapphire/operations/Forward/Embedding.hpp>
 #include <Sapphire/operations/Forward/Functional/ReLU.hpp>
 #include <Sapphire/operations/Forward/Functional/Softmax.hpp>
+#include <Sapphire/operations/Forward/Functional/Attention.hpp>
 #include <Sapphire/operations/Forward/Functional/MaxPool2D.hpp>
 #include <Sapphire/operations/Loss/CrossEntropy.hpp>
 #include <Sapphire/operations/Loss/MSE.hpp>
@@ -0,0 +1,39 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_ATTENTION_OPS_HPP
+#define SAPPHIRE_COMPUTE_ATTENTION_OPS_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+
+//! Scaled dot product attention fused into a single pass over tiles of keys
+//! and values, with online softmax
+//! Neither forward nor back propagation stores the score matrix of
+//! (queryLength, keyLength), so memory grows linearly with the sequence
+//! length. Only available in host mode
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! y = softmax(query * key^T * scale) * value
+//! query : (*, queryLength, depth), key : (*, keyLength, depth)
+//! value : (*, keyLength, valueDepth), y : (*, queryLength, valueDepth)
+//! logSumExp receives queryLength elements of each matrix, which are given to
+//! AttentionBackward
+//! If causal, query i attends to keys up to i + keyLength - queryLength
+void AttentionForward(TensorData& y, TensorData& logSumExp,
+                      const TensorData& query, const TensorData& key,
+                      const TensorData& value, float scale, bool causal);
+
+//! dQuery, dKey and dValue += gradients of query, key and value
+void AttentionBackward(TensorData& dQuery, TensorData& dKey,
+                       TensorData& dValue, const TensorData& dy,
+                       const TensorData& query, const TensorData& key,
+                       const TensorData& value, const TensorData& y,
+                       const TensorData& logSumExp, float scale, bool causal);
+} // namespace Sapphire::Compute
+
+#endif
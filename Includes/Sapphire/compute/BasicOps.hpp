@@ -8,6 +8,7 @@
 #define SAPPHIRE_COMPUTE_COMPUTE_DECL_HPP
 
 #include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/compute/sparse/SparseMatrix.hpp>
 
 namespace Sapphire::Compute
 {
@@ -17,6 +18,12 @@ using namespace TensorUtil;
 //! These operations does not check validity of the inputs
 //! If input data condition does not meet, it will cause unhandled errors
 //! All operations requires TensorData on the same device! (This should be checked previously before calling the function)
+//! Outputs must be contiguous, and std::invalid_argument is thrown otherwise
+//! Inputs that are not contiguous are copied into contiguous data before
+//! calling the kernel, unless noted otherwise
+//! Float16 and BFloat16 data is read and written in place by Add, Sub, Dot,
+//! Scale, ReLU and b of Gemm on host. Other operations receive Float32 copy
+//! of it, and require outputs stored in Float32
 
 //! Performs y = a + b
 void Add(TensorData& y, const TensorData& a, const TensorData& b);
@@ -28,12 +35,18 @@ void Sub(TensorData& y, const TensorData& a, const TensorData& b);
 void Dot(TensorData& y, const TensorData& a, const TensorData& b);
 
 //! Performs GEMM (y = a*b + c)
+//! a and b can be given as TransposeView of contiguous data without copying
 void Gemm(TensorData& y, const TensorData& a, const TensorData& b);
 
+//! Performs GEMM (y = a*b + y) where b is block sparse matrix on the host
+//! a is treated as (numUnits x K) matrix, and y as (numUnits x N) matrix
+void Gemm(TensorData& y, const TensorData& a, const BlockSparseMatrix& b);
+
 //! Performs y = x*factor
 void Scale(TensorData& y, const TensorData& x, float factor);
 
 //! Performs y = TransposeKernel(x)
+//! Use TensorData::TransposeView() if copy is not required
 void Transpose(TensorData& y, const TensorData& x);
 
 //! Performs y = x^factor for each element
@@ -52,38 +52,42 @@ void BroadcastWith3Inputs(const Shape& yShape, const Shape& aShape,
         return;
     }
 
-    //! ChunkSize represents the total size of the leftover parts to be calculated for each tensor
-    const auto chunkSizeA = chunkSize * aShape.At(shapeIdx);
-    const auto chunkSizeB = chunkSize * bShape.At(shapeIdx);
-    const auto chunkSizeC = chunkSize * cShape.At(shapeIdx);
-    const auto chunkSizeOut = chunkSize * yShape.At(shapeIdx);
-
-    const auto strideA = totalSizeA / chunkSizeA;
-    const auto strideB = totalSizeB / chunkSizeB;
-    const auto strideC = totalSizeC / chunkSizeC;
-    const auto strideOut = totalSizeOut / chunkSizeOut;
-
-    const auto maxChunkSize =
-        std::max({ chunkSizeOut, chunkSizeA, chunkSizeB, chunkSizeC });
-
-    //! Broadcasting happens here by incrementing tensors with dimension 1 with smaller chinkSize
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
-    {
-        BroadcastWith3Inputs(yShape, aShape, bShape, cShape, strideOut,
-                             strideA, strideB, strideC,
-                             out + (chunkIdx % chunkSizeOut) * strideOut,
-                             A + (chunkIdx % chunkSizeA) * strideA,
-                             B + (chunkIdx % chunkSizeB) * strideB,
-                             C + (chunkIdx % chunkSizeC) * strideC,
-                             shapeIdx + 1, minimumRequiredDim, func, params...);
-    }
+    //! ChunkSize represents the number of chunks of the dimensions merged
+    //! above, which is same for every tensor
+    const auto dimA = static_cast<unsigned int>(aShape.At(shapeIdx));
+    const auto dimB = static_cast<unsigned int>(bShape.At(shapeIdx));
+    const auto dimC = static_cast<unsigned int>(cShape.At(shapeIdx));
+    const auto dimOut = static_cast<unsigned int>(yShape.At(shapeIdx));
+
+    const auto strideA = totalSizeA / (chunkSize * dimA);
+    const auto strideB = totalSizeB / (chunkSize * dimB);
+    const auto strideC = totalSizeC / (chunkSize * dimC);
+    const auto strideOut = totalSizeOut / (chunkSize * dimOut);
+
+    const auto maxDim = std::max({ dimOut, dimA, dimB, dimC });
+
+    //! Broadcasting happens here by repeating dimension of size 1 in each chunk
+    for (unsigned int chunkIdx = 0; chunkIdx < chunkSize; chunkIdx++)
+        for (unsigned int dimIdx = 0; dimIdx < maxDim; dimIdx++)
+        {
+            BroadcastWith3Inputs(
+                yShape, aShape, bShape, cShape, strideOut, strideA, strideB,
+                strideC,
+                out + (chunkIdx * dimOut + dimIdx % dimOut) * strideOut,
+                A + (chunkIdx * dimA + dimIdx % dimA) * strideA,
+                B + (chunkIdx * dimB + dimIdx % dimB) * strideB,
+                C + (chunkIdx * dimC + dimIdx % dimC) * strideC, shapeIdx + 1,
+                minimumRequiredDim, func, params...);
+        }
 }
 
-template <typename Func, typename... Params>
+//! B may point to elements of other type for kernels that read B in reduced
+//! precision
+template <typename Func, typename ElementB, typename... Params>
 void BroadcastWith2Inputs(const Shape& yShape, const Shape& aShape,
                           const Shape& bShape, unsigned int totalSizeOut,
                           unsigned int totalSizeA, unsigned int totalSizeB,
-                          float* out, const float* A, const float* B,
+                          float* out, const float* A, const ElementB* B,
                           unsigned int shapeIdx,
                           unsigned int minimumRequiredDim, Func func,
                           Params ... params)
@@ -110,26 +114,26 @@ void BroadcastWith2Inputs(const Shape& yShape, const Shape& aShape,
         return;
     }
 
-    const auto chunkSizeA = chunkSize * aShape.At(shapeIdx);
-    const auto chunkSizeB = chunkSize * bShape.At(shapeIdx);
-    const auto chunkSizeOut = chunkSize * yShape.At(shapeIdx);
-
-    const auto strideA = totalSizeA / chunkSizeA;
-    const auto strideB = totalSizeB / chunkSizeB;
-    const auto strideOut = totalSizeOut / chunkSizeOut;
-
-    const auto maxChunkSize =
-        std::max({ chunkSizeOut, chunkSizeA, chunkSizeB });
-
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
-    {
-        BroadcastWith2Inputs(yShape, aShape, bShape, strideOut, strideA,
-                             strideB,
-                             out + (chunkIdx % chunkSizeOut) * strideOut,
-                             A + (chunkIdx % chunkSizeA) * strideA,
-                             B + (chunkIdx % chunkSizeB) * strideB,
-                             shapeIdx + 1, minimumRequiredDim, func, params...);
-    }
+    const auto dimA = static_cast<unsigned int>(aShape.At(shapeIdx));
+    const auto dimB = static_cast<unsigned int>(bShape.At(shapeIdx));
+    const auto dimOut = static_cast<unsigned int>(yShape.At(shapeIdx));
+
+    const auto strideA = totalSizeA / (chunkSize * dimA);
+    const auto strideB = totalSizeB / (chunkSize * dimB);
+    const auto strideOut = totalSizeOut / (chunkSize * dimOut);
+
+    const auto maxDim = std::max({ dimOut, dimA, dimB });
+
+    for (unsigned int chunkIdx = 0; chunkIdx < chunkSize; chunkIdx++)
+        for (unsigned int dimIdx = 0; dimIdx < maxDim; dimIdx++)
+        {
+            BroadcastWith2Inputs(
+                yShape, aShape, bShape, strideOut, strideA, strideB,
+                out + (chunkIdx * dimOut + dimIdx % dimOut) * strideOut,
+                A + (chunkIdx * dimA + dimIdx % dimA) * strideA,
+                B + (chunkIdx * dimB + dimIdx % dimB) * strideB, shapeIdx + 1,
+                minimumRequiredDim, func, params...);
+        }
 }
 
 template <typename Func, typename... Params>
@@ -162,28 +166,27 @@ void BroadcastBackwardWith2Inputs(
         return;
     }
 
-    const auto chunkSizeA = chunkSize * aShape.At(shapeIdx);
-    const auto chunkSizeB = chunkSize * bShape.At(shapeIdx);
-    const auto chunkSizeOut = chunkSize * yShape.At(shapeIdx);
-
-    const auto strideA = totalSizeA / chunkSizeA;
-    const auto strideB = totalSizeB / chunkSizeB;
-    const auto strideOut = totalSizeOut / chunkSizeOut;
-
-    const auto maxChunkSize =
-        std::max({ chunkSizeOut, chunkSizeA, chunkSizeB });
-
-    for (unsigned int chunkIdx = 0; chunkIdx < maxChunkSize; chunkIdx++)
-    {
-        BroadcastBackwardWith2Inputs(
-            yShape, aShape, bShape, strideOut, strideA, strideB,
-            dy + (chunkIdx % chunkSizeOut) * strideOut,
-            da + (chunkIdx % chunkSizeA) * strideA,
-            db + (chunkIdx % chunkSizeB) * strideB,
-            a + (chunkIdx % chunkSizeA) * strideA,
-            b + (chunkIdx % chunkSizeB) * strideB, shapeIdx + 1,
-            minimumRequiredDim, func, params...);
-    }
+    const auto dimA = static_cast<unsigned int>(aShape.At(shapeIdx));
+    const auto dimB = static_cast<unsigned int>(bShape.At(shapeIdx));
+    const auto dimOut = static_cast<unsigned int>(yShape.At(shapeIdx));
+
+    const auto strideA = totalSizeA / (chunkSize * dimA);
+    const auto strideB = totalSizeB / (chunkSize * dimB);
+    const auto strideOut = totalSizeOut / (chunkSize * dimOut);
+
+    const auto maxDim = std::max({ dimOut, dimA, dimB });
+
+    for (unsigned int chunkIdx = 0; chunkIdx < chunkSize; chunkIdx++)
+        for (unsigned int dimIdx = 0; dimIdx < maxDim; dimIdx++)
+        {
+            const auto offsetA = (chunkIdx * dimA + dimIdx % dimA) * strideA;
+            const auto offsetB = (chunkIdx * dimB + dimIdx % dimB) * strideB;
+            BroadcastBackwardWith2Inputs(
+                yShape, aShape, bShape, strideOut, strideA, strideB,
+                dy + (chunkIdx * dimOut + dimIdx % dimOut) * strideOut,
+                da + offsetA, db + offsetB, a + offsetA, b + offsetB,
+                shapeIdx + 1, minimumRequiredDim, func, params...);
+        }
 }
 }
 
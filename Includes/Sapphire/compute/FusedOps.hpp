@@ -0,0 +1,69 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_FUSED_OPS_HPP
+#define SAPPHIRE_COMPUTE_FUSED_OPS_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+
+//! Operations that apply bias and activation in the same pass as the
+//! operation producing their input, instead of running each of them as a
+//! separate pass over memory with its own output
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! Activation applied in the epilogue of fused operations
+enum class Activation
+{
+    None,
+    ReLU,
+};
+
+//! y = activation(y + bias) in a single pass over y
+//! bias must be broadcastable to y along one axis of it, as (1, N) for
+//! (M, N) output of Linear or (1, C, 1, 1) for (N, C, H, W) output of Conv2D
+void BiasActivation(TensorData& y, const TensorData& bias,
+                    Activation activation);
+
+//! y = activation(x * weight + bias). y is overwritten
+//! x : (*, K), weight : (K, N), bias : (1, N), y : (*, N)
+//! On host, rows of y are computed in blocks small enough to stay in cache,
+//! and bias and activation are applied to each block right after its gemm
+void LinearActivation(TensorData& y, const TensorData& x,
+                      const TensorData& weight, const TensorData& bias,
+                      Activation activation);
+
+//! y = activation(conv(x, filter) + bias). y is overwritten
+//! x : (N, C, H, W), filter : (F, C, fH, fW), bias : (1, F, 1, 1),
+//! y : (N, F, yH, yW)
+//! On host, units of the batch are lowered and multiplied one at a time, and
+//! bias and activation are applied to each of them right after its gemm
+void Conv2DActivation(TensorData& y, const TensorData& x,
+                      const TensorData& filter, const TensorData& bias,
+                      Activation activation, int strideRow, int strideCol,
+                      int dilationRow, int dilationCol, int rowPadding,
+                      int colPadding);
+
+//! Conv2DActivation without bias
+void Conv2DActivation(TensorData& y, const TensorData& x,
+                      const TensorData& filter, Activation activation,
+                      int strideRow, int strideCol, int dilationRow,
+                      int dilationCol, int rowPadding, int colPadding);
+
+//! y = activation(a + b) in a single pass
+//! a and b are broadcast as Compute::Add if their shapes differ from y
+void AddActivation(TensorData& y, const TensorData& a, const TensorData& b,
+                   Activation activation);
+
+//! dx += dy * derivative of activation, computed from output y of it
+//! Output of ReLU is positive if and only if its input is, so input of the
+//! activation does not need to be kept for back propagation
+void ActivationBackward(TensorData& dx, const TensorData& dy,
+                        const TensorData& y, Activation activation);
+} // namespace Sapphire::Compute
+
+#endif
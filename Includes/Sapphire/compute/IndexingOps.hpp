@@ -8,11 +8,30 @@
 #define SAPPHIRE_COMPUTE_INDEXING_HPP
 
 #include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/tensor/RowSparseData.hpp>
 
 namespace Sapphire::Compute
 {
 using namespace TensorUtil;
 void Flatten(TensorData& tensorData);
+
+//! Gathers rows of weight indexed by indices (Host only)
+//! Indices are stored as float values, and are grouped into bags of bagSize
+//! Rows in each bag are summed (or averaged if mean is true) into single row
+//! of y. Bag size of 1 performs plain lookup
+//! \param y : output with (number of indices / bagSize) rows of weight.Cols()
+//! \param weight : (numEmbeddings x embeddingDim) table
+//! \param indices : indices to look up
+void EmbeddingForward(TensorData& y, const TensorData& weight,
+                      const TensorData& indices, int bagSize, bool mean);
+
+//! Computes row sparse gradient of the weight used in EmbeddingForward
+//! Gradients for the same index are accumulated into single row, so number of
+//! stored rows never exceeds number of indices (Host only)
+//! \param dWeight : row sparse gradient to write the result
+//! \param dy : gradient of y given in EmbeddingForward
+void EmbeddingBackward(RowSparseData& dWeight, const TensorData& dy,
+                       const TensorData& indices, int bagSize, bool mean);
 }
 
 #endif
@@ -0,0 +1,63 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_NORMALIZATION_OPS_HPP
+#define SAPPHIRE_COMPUTE_NORMALIZATION_OPS_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+
+//! Batch and layer normalization
+//! Statistics are computed in a single pass over the input with Welford's
+//! algorithm, and normalization, scale and shift are applied in the same
+//! kernel. Back propagation computes gradients of the input, scale and shift
+//! together, normalizing the input again from the saved statistics instead
+//! of keeping the normalized input
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! Batch normalization in training
+//! x, y : (N, C, *), gamma, beta, runningMean, runningVar : C elements
+//! savedMean and savedInvStd receive mean and 1 / sqrt(variance + epsilon) of
+//! each channel of the batch, which are given to BatchNormBackward
+//! Running statistics are updated as running = (1 - momentum) * running +
+//! momentum * statistics, with unbiased variance. They are left unchanged if
+//! momentum is 0
+void BatchNormForward(TensorData& y, TensorData& savedMean,
+                      TensorData& savedInvStd, TensorData& runningMean,
+                      TensorData& runningVar, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      float momentum, float epsilon);
+
+//! Batch normalization with running statistics
+void BatchNormInference(TensorData& y, const TensorData& x,
+                        const TensorData& gamma, const TensorData& beta,
+                        const TensorData& runningMean,
+                        const TensorData& runningVar, float epsilon);
+
+//! dx += gradient of x, and dGamma and dBeta are overwritten
+void BatchNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const TensorData& savedMean,
+                       const TensorData& savedInvStd);
+
+//! Layer normalization over the last dimensions of x whose size is the size
+//! of gamma
+//! x, y : (*, D), gamma, beta : D elements
+//! savedMean and savedInvStd receive statistics of each of (*) rows
+void LayerNormForward(TensorData& y, TensorData& savedMean,
+                      TensorData& savedInvStd, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      float epsilon);
+
+//! dx += gradient of x, and dGamma and dBeta are overwritten
+void LayerNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const TensorData& savedMean,
+                       const TensorData& savedInvStd);
+} // namespace Sapphire::Compute
+
+#endif
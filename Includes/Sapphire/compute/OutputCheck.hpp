@@ -0,0 +1,48 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_OUTPUT_CHECK_HPP
+#define SAPPHIRE_COMPUTE_OUTPUT_CHECK_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Compute
+{
+//! Throws if kernels of the operation cannot write to the output
+//! Outputs are written contiguously in Float32 by the kernels. Float16 and
+//! BFloat16 outputs are accepted if allowReduced is true, for operations that
+//! compute in Float32 and convert the result
+//! \param name : name of the operation used in the exception message
+inline void CheckOutput(const std::string& name,
+                        const TensorUtil::TensorData& output,
+                        bool allowReduced = false)
+{
+    if (allowReduced && output.IsContiguous())
+        return;
+    if (!output.IsContiguousFloat())
+        throw std::invalid_argument(
+            "Compute::" + name + " - Outputs must be contiguous Float32 data");
+}
+
+//! CheckOutput for every output, which must be in given mode as well
+inline void CheckOutputs(
+    const std::string& name, ComputeMode mode,
+    std::initializer_list<const TensorUtil::TensorData*> outputs)
+{
+    for (const auto* output : outputs)
+    {
+        CheckOutput(name, *output);
+        if (output->Mode() != mode)
+            throw std::invalid_argument("Compute::" + name +
+                                        " - Mode mismatch");
+    }
+}
+} // namespace Sapphire::Compute
+
+#endif
@@ -0,0 +1,140 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_QUANTIZE_OPS_HPP
+#define SAPPHIRE_COMPUTE_QUANTIZE_OPS_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+#include <cstdint>
+#include <vector>
+
+//! Int8 post training quantization for inference on host
+//! Activations are quantized with parameters calibrated by RangeObserver,
+//! and weights are quantized per output channel by Int8Weight. Products are
+//! accumulated in int32, and converted back to Float32 with bias and ReLU
+//! while they are stored
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! Maps quantized value q to real value Scale * (q - ZeroPoint)
+struct QuantizationParams
+{
+    float Scale = 1.0f;
+    int ZeroPoint = 0;
+};
+
+//! Records range of activations given over calibration batches
+class RangeObserver
+{
+public:
+    //! Extends the range with elements of x
+    //! Only available in host mode
+    void Observe(const TensorData& x);
+
+    [[nodiscard]] bool Empty() const
+    {
+        return m_empty;
+    }
+
+    //! Parameters that map the observed range to quantized activations
+    //! The range is extended to include zero, so zero padding is exact
+    [[nodiscard]] QuantizationParams GetParams() const;
+
+private:
+    float m_min = 0.0f;
+    float m_max = 0.0f;
+    bool m_empty = true;
+};
+
+//! Weight quantized to int8 per output channel and packed for int8 gemm
+class Int8Weight
+{
+public:
+    Int8Weight() = default;
+
+    //! \param weight : (K x N) matrix whose columns are output channels as
+    //! weight of NN::Linear. If outputChannelFirst is true, weight has shape
+    //! of (N, *) and each of N units is an output channel as filter of
+    //! NN::Conv2D
+    Int8Weight(const TensorData& weight, bool outputChannelFirst);
+
+    //! Shape of the weight this was created from
+    [[nodiscard]] Shape GetShape() const
+    {
+        return m_shape;
+    }
+
+    [[nodiscard]] int Inputs() const
+    {
+        return m_inputs;
+    }
+
+    [[nodiscard]] int Outputs() const
+    {
+        return m_outputs;
+    }
+
+    [[nodiscard]] const std::int8_t* Data() const
+    {
+        return m_packed.data();
+    }
+
+    //! Scale of each output channel
+    [[nodiscard]] const std::vector<float>& GetScales() const
+    {
+        return m_scales;
+    }
+
+    //! Sum of quantized weights of each output channel
+    [[nodiscard]] const std::vector<std::int32_t>& GetColumnSums() const
+    {
+        return m_columnSums;
+    }
+
+    //! Size of packed weight in bytes
+    [[nodiscard]] std::size_t ByteSize() const
+    {
+        return m_packed.size();
+    }
+
+private:
+    Shape m_shape;
+    int m_inputs = 0;
+    int m_outputs = 0;
+    std::vector<std::int8_t> m_packed;
+    std::vector<float> m_scales;
+    std::vector<std::int32_t> m_columnSums;
+};
+
+//! y = x * weight (+ bias) computed in int8
+//! x is quantized with inputParams, and y is overwritten
+//! x : (*, K), y : (*, N), bias : (N) or (1, N)
+//! Only available in host mode
+//! \param relu : applies ReLU to y
+void GemmInt8(TensorData& y, const TensorData& x, const Int8Weight& weight,
+              QuantizationParams inputParams, bool relu = false);
+
+void GemmInt8(TensorData& y, const TensorData& x, const Int8Weight& weight,
+              const TensorData& bias, QuantizationParams inputParams,
+              bool relu = false);
+
+//! Same as Conv2DForward (+ bias) computed in int8, with filter quantized by
+//! Int8Weight(filter, true). y is overwritten
+//! x : (N, C, H, W), y : (N, yC, yH, yW), bias : (yC) or (1, yC)
+//! Only available in host mode
+void Conv2DInt8(TensorData& y, const TensorData& x, const Int8Weight& filter,
+                QuantizationParams inputParams, int strideRow, int strideCol,
+                int dilationRow, int dilationCol, int rowPadding,
+                int columnPadding, bool relu = false);
+
+void Conv2DInt8(TensorData& y, const TensorData& x, const Int8Weight& filter,
+                const TensorData& bias, QuantizationParams inputParams,
+                int strideRow, int strideCol, int dilationRow, int dilationCol,
+                int rowPadding, int columnPadding, bool relu = false);
+} // namespace Sapphire::Compute
+
+#endif
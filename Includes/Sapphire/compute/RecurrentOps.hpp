@@ -0,0 +1,62 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_RECURRENT_OPS_HPP
+#define SAPPHIRE_COMPUTE_RECURRENT_OPS_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+
+//! LSTM and GRU layers over a whole sequence
+//! Weights of every gate are concatenated, so the input projection of the
+//! whole sequence is a single gemm before the recurrence, and each time step
+//! performs a single gemm of the hidden state followed by a single kernel
+//! that applies every gate nonlinearity and the state update.
+//! Back propagation reuses gate activations saved by forward propagation, and
+//! computes gradients of the weights with a single gemm over the sequence
+//! after the recurrence
+namespace Sapphire::Compute
+{
+using namespace TensorUtil;
+
+//! LSTM with zero initial state, with gates in order of input, forget, cell
+//! and output
+//! x : (T, N, inputSize), y : (T, N, hiddenSize) receives hidden states
+//! weightIh : (inputSize, 4 * hiddenSize)
+//! weightHh : (hiddenSize, 4 * hiddenSize), bias : 4 * hiddenSize elements
+//! gates : (T, N, 4 * hiddenSize) and cells : (T, N, hiddenSize) receive
+//! gate activations and cell states, which are given to LstmBackward
+void LstmForward(TensorData& y, TensorData& gates, TensorData& cells,
+                 const TensorData& x, const TensorData& weightIh,
+                 const TensorData& weightHh, const TensorData& bias);
+
+//! dx += gradient of x, and gradients of weights and bias are overwritten
+void LstmBackward(TensorData& dx, TensorData& dWeightIh,
+                  TensorData& dWeightHh, TensorData& dBias,
+                  const TensorData& dy, const TensorData& x,
+                  const TensorData& y, const TensorData& weightIh,
+                  const TensorData& weightHh, const TensorData& gates,
+                  const TensorData& cells);
+
+//! GRU with zero initial state, with gates in order of reset, update and new
+//! x : (T, N, inputSize), y : (T, N, hiddenSize) receives hidden states
+//! weightIh : (inputSize, 3 * hiddenSize)
+//! weightHh : (hiddenSize, 3 * hiddenSize)
+//! biasIh, biasHh : 3 * hiddenSize elements
+//! gates : (T, N, 4 * hiddenSize) receives gate activations and projection
+//! of the hidden state for the new gate, which are given to GruBackward
+void GruForward(TensorData& y, TensorData& gates, const TensorData& x,
+                const TensorData& weightIh, const TensorData& weightHh,
+                const TensorData& biasIh, const TensorData& biasHh);
+
+//! dx += gradient of x, and gradients of weights and biases are overwritten
+void GruBackward(TensorData& dx, TensorData& dWeightIh, TensorData& dWeightHh,
+                 TensorData& dBiasIh, TensorData& dBiasHh,
+                 const TensorData& dy, const TensorData& x,
+                 const TensorData& y, const TensorData& weightIh,
+                 const TensorData& weightHh, const TensorData& gates);
+} // namespace Sapphire::Compute
+
+#endif
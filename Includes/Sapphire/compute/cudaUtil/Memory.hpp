@@ -8,7 +8,11 @@
 #define Sapphire_COMPUTE_CUDA_MEMORY_CUH
 
 #include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+#include <cstddef>
 
+//! If Sapphire was built without cuda, functions accessing the device throw
+//! std::runtime_error. CudaMallocHost and CudaFreeHost fall back to pageable
+//! host memory, and CudaDeviceSynchronize does nothing
 namespace Sapphire::Compute::Cuda
 {
 void CudaSetDevice(int deviceId);
@@ -17,14 +21,24 @@ void CudaSetDevice(int deviceId);
 
  void CudaFree(void* ptr);
 
+//! Allocates page-locked host memory for faster host to device transfer
+void CudaMallocHost(void** ptr, std::size_t byteSize);
+
+void CudaFreeHost(void* ptr);
+
+//! Waits until every queued work on the current device is finished
+void CudaDeviceSynchronize();
+
 void CopyHostToDevice(void* devicePtr, void* hostPtr, unsigned int byteSize);
 
 void CopyDeviceToHost(void* hostPtr, void* devicePtr, unsigned int byteSize);
 
 void CopyDeviceToDevice(void* dst, const void* src, unsigned int byteSize);
 
+#ifdef WITH_CUDA
 void CopyDeviceToDeviceAsync(void* dst, const void* src,
                                 unsigned int byteSize, cudaStream_t stream);
+#endif
 
 void CopyDeviceToDeviceBroadcast(void* dst, const void* src,
                                     unsigned int byteSize, unsigned int srcStrideByteSize);
@@ -0,0 +1,27 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_STRIDED_LAYOUT_HPP
+#define SAPPHIRE_COMPUTE_DENSE_STRIDED_LAYOUT_HPP
+
+namespace Sapphire::Compute::Dense
+{
+//! Describes where each element of the shape is placed in source and
+//! destination memory. Strides are given in number of elements, outermost
+//! dimension first
+//! This is passed by value, so same layout can be given to cuda kernels
+struct StridedLayout
+{
+    static constexpr int MaxDim = 8;
+
+    int Dim = 0;
+    int Shape[MaxDim] = {};
+    int DstStrides[MaxDim] = {};
+    int SrcStrides[MaxDim] = {};
+};
+} // namespace Sapphire::Compute::Dense
+
+#endif
@@ -20,6 +20,15 @@ __host__ void LeakyReLU(float* y, const float* x, float a,
 __host__ void SoftMax(float* y, const float* x, unsigned int totalSize,
                       unsigned int unitSize);
 
+//! Adds bias to y of shape (*, channels, innerSize) along channels, and
+//! applies ReLU if relu is true in the same kernel
+__host__ void BiasActivation(float* y, const float* bias,
+                             unsigned int totalSize, unsigned int channels,
+                             unsigned int innerSize, bool relu);
+
+__host__ void AddReLU(float* y, const float* a, const float* b,
+                      unsigned int totalSize);
+
 //! Backward Kernels
 __host__ void ReLUBackward(float* dx, const float* dy, const float* x,
                            unsigned int totalSize);
@@ -8,6 +8,7 @@
 #define SAPPHIRE_COMPUTE_DENSE_CUDA_BASIC_CUH
 
 #include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+#include <Sapphire/compute/dense/StridedLayout.hpp>
 
 namespace Sapphire::Compute::Dense::Cuda
 {
@@ -34,6 +35,11 @@ __host__ void Scale(float* y, const float* x, const float scaleFactor,
 __host__ void Transpose(float* y, const float* x,
                         unsigned int inputNumRows, unsigned int inputNumCols,
                         unsigned int batchSize, bool broadcastInput);
+
+//! Copies each element of the layout shape from src to dst
+__host__ void StridedCopy(float* dst, const float* src,
+                          const StridedLayout& layout, unsigned int totalSize);
+
 //! out = pow(x, factor)
 __host__ void Pow(float* y, const float* x, const float factor,
                   unsigned int totalSize);
@@ -7,6 +7,7 @@
 #ifndef SAPPHIRE_COMPUTE_DENSE_CUDA_CUDNN_STRUCT_CUH
 #define SAPPHIRE_COMPUTE_DENSE_CUDA_CUDNN_STRUCT_CUH
 
+#include <cuda_runtime.h>
 #include <cudnn.h>
 #include <stdexcept>
 #include <string>
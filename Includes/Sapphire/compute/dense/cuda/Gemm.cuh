@@ -17,6 +17,14 @@ __host__ void Gemm(unsigned int totalSize,
                    unsigned int M, unsigned int N, unsigned int K,
                    int deviceId);
 
+//! Same as Gemm, but A or B may be given in transposed layout
+//! A is stored as (K x M) matrix if transposeA is true, and B is stored as
+//! (N x K) matrix if transposeB is true
+__host__ void GemmTransposed(unsigned int totalSize,
+                             float* out, const float* A, const float* B,
+                             unsigned int M, unsigned int N, unsigned int K,
+                             bool transposeA, bool transposeB, int deviceId);
+
 __host__ void GemmMatrixWiseBroadcast(float* out, const float* A,
                                       const float* B,
                                       unsigned int M, unsigned int N,
@@ -0,0 +1,53 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_CUDA_NORMALIZATION_CUH
+#define SAPPHIRE_COMPUTE_DENSE_CUDA_NORMALIZATION_CUH
+
+#include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+//! Normalizes x of shape (numUnits, channels, innerSize) with statistics of
+//! each channel and applies gamma and beta. Statistics are computed in a
+//! single pass with Welford's algorithm by one block per channel, which also
+//! updates running statistics with momentum
+__host__ void BatchNormForward(float* y, float* mean, float* invStd,
+                               float* runningMean, float* runningVar,
+                               const float* x, const float* gamma,
+                               const float* beta, unsigned int numUnits,
+                               unsigned int channels, unsigned int innerSize,
+                               float momentum, float epsilon);
+
+__host__ void BatchNormInference(float* y, const float* x,
+                                 const float* runningMean,
+                                 const float* runningVar, const float* gamma,
+                                 const float* beta, unsigned int numUnits,
+                                 unsigned int channels, unsigned int innerSize,
+                                 float epsilon);
+
+//! dx += gradient of BatchNormForward, dGamma and dBeta are overwritten
+__host__ void BatchNormBackward(float* dx, float* dGamma, float* dBeta,
+                                const float* dy, const float* x,
+                                const float* mean, const float* invStd,
+                                const float* gamma, unsigned int numUnits,
+                                unsigned int channels, unsigned int innerSize);
+
+//! Normalizes each row of x in (rows, rowSize) layout with one block per row
+__host__ void LayerNormForward(float* y, float* mean, float* invStd,
+                               const float* x, const float* gamma,
+                               const float* beta, unsigned int rows,
+                               unsigned int rowSize, float epsilon);
+
+//! dx += gradient of LayerNormForward, dGamma and dBeta are overwritten
+__host__ void LayerNormBackward(float* dx, float* dGamma, float* dBeta,
+                                const float* dy, const float* x,
+                                const float* mean, const float* invStd,
+                                const float* gamma, unsigned int rows,
+                                unsigned int rowSize);
+}
+
+#endif
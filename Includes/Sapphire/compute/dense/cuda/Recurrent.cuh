@@ -0,0 +1,40 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_CUDA_RECURRENT_CUH
+#define SAPPHIRE_COMPUTE_DENSE_CUDA_RECURRENT_CUH
+
+#include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+//! Applies every gate nonlinearity and the state update of a LSTM cell for
+//! one time step in a single kernel. See Dense::Naive::LstmCellForward
+__host__ void LstmCellForward(float* gates, float* cell, float* hidden,
+                              const float* cellPrev, unsigned int batchSize,
+                              unsigned int hiddenSize);
+
+__host__ void LstmCellBackward(float* dGates, float* dCell,
+                               const float* dHidden, const float* dHiddenNext,
+                               const float* gates, const float* cell,
+                               const float* cellPrev, unsigned int batchSize,
+                               unsigned int hiddenSize);
+
+//! Applies every gate nonlinearity and the state update of a GRU cell for
+//! one time step in a single kernel. See Dense::Naive::GruCellForward
+__host__ void GruCellForward(float* gates, float* hidden,
+                             const float* inputProj, const float* hiddenProj,
+                             const float* hiddenBias, const float* hiddenPrev,
+                             unsigned int batchSize, unsigned int hiddenSize);
+
+__host__ void GruCellBackward(float* dInputProj, float* dHiddenProj,
+                              float* dHiddenPrev, const float* dHidden,
+                              const float* dHiddenNext, const float* gates,
+                              const float* hiddenPrev, unsigned int batchSize,
+                              unsigned int hiddenSize);
+}
+
+#endif
@@ -19,6 +19,17 @@ __global__ void LeakyReLUKernel(float* y, const float* x,
                                 float a, unsigned int totalSize);
 
 __global__ void ReLUKernel(float* y, const float* x, unsigned int totalSize);
+
+//! Adds bias along channels of y in (*, channels, innerSize) layout, starting
+//! from element offset of y
+__global__ void BiasActivationKernel(float* y, const float* bias,
+                                     unsigned int offset,
+                                     unsigned int launchSize,
+                                     unsigned int channels,
+                                     unsigned int innerSize, bool relu);
+
+__global__ void AddReLUKernel(float* y, const float* a, const float* b,
+                              unsigned int totalSize);
 }
 
 #endif
\ No newline at end of file
@@ -7,6 +7,7 @@
 #ifndef SAPPHIRE_COMPUTE_DENSE_BASIC_KERNEL_CUH
 #define SAPPHIRE_COMPUTE_DENSE_BASIC_KERNEL_CUH
 #include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+#include <Sapphire/compute/dense/StridedLayout.hpp>
 
 namespace Sapphire::Compute::Dense::Cuda
 {
@@ -32,6 +33,10 @@ __global__ void TransposeKernel(float* y, const float* x,
                                 unsigned int inputNumRows,
                                 unsigned int inputNumCols, bool broadcastInput);
 
+__global__ void StridedCopyKernel(float* dst, const float* src,
+                                  StridedLayout layout,
+                                  unsigned int totalSize);
+
 __global__ void ScaleKernel(float* y, const float* x,
                             const float scaleFactor, unsigned int totalSize);
 
@@ -0,0 +1,83 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_CUDA_NORMALIZATION_KERNEL_CUH
+#define SAPPHIRE_COMPUTE_DENSE_CUDA_NORMALIZATION_KERNEL_CUH
+
+#include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+//! Number of threads of kernels that reduce a channel or a row in a block
+//! Must be a power of two
+constexpr unsigned int NormalizationBlockDim = 256;
+
+//! Launched with a block of NormalizationBlockDim threads per channel
+__global__ void BatchNormStatisticsKernel(float* mean, float* invStd,
+                                          float* runningMean,
+                                          float* runningVar, const float* x,
+                                          unsigned int numUnits,
+                                          unsigned int channels,
+                                          unsigned int innerSize,
+                                          float momentum, float epsilon);
+
+//! Normalizes y in (*, channels, innerSize) layout starting from element
+//! offset of it
+__global__ void BatchNormNormalizeKernel(float* y, const float* x,
+                                         const float* mean,
+                                         const float* invStd,
+                                         const float* gamma, const float* beta,
+                                         unsigned int offset,
+                                         unsigned int launchSize,
+                                         unsigned int channels,
+                                         unsigned int innerSize);
+
+__global__ void BatchNormInferenceKernel(float* y, const float* x,
+                                         const float* runningMean,
+                                         const float* runningVar,
+                                         const float* gamma, const float* beta,
+                                         float epsilon, unsigned int offset,
+                                         unsigned int launchSize,
+                                         unsigned int channels,
+                                         unsigned int innerSize);
+
+//! Launched with a block of NormalizationBlockDim threads per channel
+__global__ void BatchNormBackwardReduceKernel(float* dGamma, float* dBeta,
+                                              const float* dy, const float* x,
+                                              const float* mean,
+                                              const float* invStd,
+                                              unsigned int numUnits,
+                                              unsigned int channels,
+                                              unsigned int innerSize);
+
+__global__ void BatchNormBackwardKernel(float* dx, const float* dy,
+                                        const float* x, const float* mean,
+                                        const float* invStd,
+                                        const float* gamma,
+                                        const float* dGamma,
+                                        const float* dBeta, float count,
+                                        unsigned int offset,
+                                        unsigned int launchSize,
+                                        unsigned int channels,
+                                        unsigned int innerSize);
+
+//! Launched with a block of NormalizationBlockDim threads per row
+__global__ void LayerNormForwardKernel(float* y, float* mean, float* invStd,
+                                       const float* x, const float* gamma,
+                                       const float* beta, unsigned int rowSize,
+                                       float epsilon);
+
+//! Launched with a block of NormalizationBlockDim threads per row
+//! Gradients of gamma and beta are accumulated atomically over rows
+__global__ void LayerNormBackwardKernel(float* dx, float* dGamma,
+                                        float* dBeta, const float* dy,
+                                        const float* x, const float* mean,
+                                        const float* invStd,
+                                        const float* gamma,
+                                        unsigned int rowSize);
+}
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_CUDA_RECURRENT_KERNEL_CUH
+#define SAPPHIRE_COMPUTE_DENSE_CUDA_RECURRENT_KERNEL_CUH
+
+#include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+//! Each thread updates one element of the (batchSize, hiddenSize) state
+//! starting from element offset of it
+__global__ void LstmCellForwardKernel(float* gates, float* cell,
+                                      float* hidden, const float* cellPrev,
+                                      unsigned int offset,
+                                      unsigned int launchSize,
+                                      unsigned int hiddenSize);
+
+__global__ void LstmCellBackwardKernel(float* dGates, float* dCell,
+                                       const float* dHidden,
+                                       const float* dHiddenNext,
+                                       const float* gates, const float* cell,
+                                       const float* cellPrev,
+                                       unsigned int offset,
+                                       unsigned int launchSize,
+                                       unsigned int hiddenSize);
+
+__global__ void GruCellForwardKernel(float* gates, float* hidden,
+                                     const float* inputProj,
+                                     const float* hiddenProj,
+                                     const float* hiddenBias,
+                                     const float* hiddenPrev,
+                                     unsigned int offset,
+                                     unsigned int launchSize,
+                                     unsigned int hiddenSize);
+
+__global__ void GruCellBackwardKernel(float* dInputProj, float* dHiddenProj,
+                                      float* dHiddenPrev,
+                                      const float* dHidden,
+                                      const float* dHiddenNext,
+                                      const float* gates,
+                                      const float* hiddenPrev,
+                                      unsigned int offset,
+                                      unsigned int launchSize,
+                                      unsigned int hiddenSize);
+}
+
+#endif
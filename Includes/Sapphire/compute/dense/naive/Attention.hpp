@@ -0,0 +1,45 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_ATTENTION_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_ATTENTION_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Number of query rows processed together, which share every key and value
+//! tile loaded to cache
+constexpr unsigned int AttentionBlockRows = 32;
+//! Number of keys and values in a tile
+constexpr unsigned int AttentionBlockCols = 64;
+
+//! softmax(query * key^T * scale) * value for each of numMatrices matrices
+//! query : (queryLength, depth), key : (keyLength, depth)
+//! value : (keyLength, valueDepth), y : (queryLength, valueDepth)
+//! Scores are computed tile by tile with online softmax, which rescales the
+//! partial output whenever the maximum score of the row grows, so the
+//! (queryLength, keyLength) score matrix is never stored
+//! logSumExp : (queryLength) receives log of the softmax denominator of each
+//! row, which is given to AttentionBackward
+//! If causal, query i attends to keys up to i + keyLength - queryLength
+void AttentionForward(float* y, float* logSumExp, const float* query,
+                      const float* key, const float* value,
+                      unsigned int numMatrices, unsigned int queryLength,
+                      unsigned int keyLength, unsigned int depth,
+                      unsigned int valueDepth, float scale, bool causal);
+
+//! dQuery, dKey and dValue += gradients of AttentionForward
+//! Probabilities are recomputed from logSumExp one tile of keys at a time,
+//! so memory besides the gradients is a single value per query row
+void AttentionBackward(float* dQuery, float* dKey, float* dValue,
+                       const float* dy, const float* query, const float* key,
+                       const float* value, const float* y,
+                       const float* logSumExp, unsigned int numMatrices,
+                       unsigned int queryLength, unsigned int keyLength,
+                       unsigned int depth, unsigned int valueDepth,
+                       float scale, bool causal);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
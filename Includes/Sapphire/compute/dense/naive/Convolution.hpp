@@ -18,6 +18,12 @@ void Im2Col(TensorData& inputMatrix, const TensorData& filter,
             int rowPadding, int colPadding, int dilationRow, int dilationCol,
             float pad = 0.0f);
 
+//! Same as Im2Col, but only shape of the filter is given
+void Im2Col(TensorData& inputMatrix, const Shape& filterShape,
+            const TensorData& input, int strideRow, int strideCol,
+            int rowPadding, int colPadding, int dilationRow, int dilationCol,
+            float pad = 0.0f);
+
 void Col2Im(TensorData& input, const TensorData& inputMatrix,
             const TensorData& filter, int strideCol, int strideRow,
             int rowPadding, int colPadding, int dilationRow, int dilationCol);
@@ -26,6 +32,15 @@ void Conv2D(TensorData& y, const TensorData& x, const TensorData& filter,
             int strideRow, int strideCol, int rowPadding, int colPadding,
             int dilationRow, int dilationCol, CudaDevice device);
 
+//! y = relu(conv(x, filter) + bias), or the convolution alone if relu is false
+//! Units of the batch are lowered and multiplied one at a time, and bias and
+//! activation are applied to the output of each unit right after its gemm
+//! bias holds a value for each output channel, or is nullptr for no bias
+void Conv2DActivation(TensorData& y, const TensorData& x,
+                      const TensorData& filter, const float* bias, bool relu,
+                      int strideRow, int strideCol, int rowPadding,
+                      int colPadding, int dilationRow, int dilationCol);
+
 void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
                     const TensorData& x, const TensorData& filter,
                     int strideRow,
@@ -7,6 +7,8 @@
 #ifndef Sapphire_NAIVEBASIC_HPP
 #define Sapphire_NAIVEBASIC_HPP
 
+#include <Sapphire/compute/dense/StridedLayout.hpp>
+
 namespace Sapphire::Compute::Dense::Naive
 {
 void Add(unsigned int totalSize, float* output, const float* inputA,
@@ -29,6 +31,11 @@ void Transpose(float* output, const float* input, unsigned int inputRows,
                unsigned int batchSize,
                bool broadcast);
 
+//! Copies each element of the layout shape from src to dst
+//! \param totalSize : number of elements in the layout shape
+void StridedCopy(float* dst, const float* src, const StridedLayout& layout,
+                 unsigned int totalSize);
+
 void Pow(float* output, const float* input, float exponent,
          unsigned int totalSize);
 
@@ -56,6 +63,15 @@ void ReLUBackward(float* dx, const float* dy, const float* x,
 void LeakyReLU(float* output, const float* input, float a,
                unsigned int totalSize);
 
+//! Adds bias to y of shape (numUnits, channels, innerSize) along channels,
+//! and applies ReLU if relu is true in the same pass
+void BiasActivation(float* y, const float* bias, unsigned int numUnits,
+                    unsigned int channels, unsigned int innerSize, bool relu);
+
+//! output = ReLU(inputA + inputB)
+void AddReLU(float* output, const float* inputA, const float* inputB,
+             unsigned int totalSize);
+
 void LeakyReLUBackward(float* output, const float* input, float a,
                        unsigned int totalSize);
 
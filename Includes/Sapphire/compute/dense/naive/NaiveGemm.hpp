@@ -12,6 +12,13 @@ namespace Sapphire::Compute::Dense::Naive
 void Gemm(unsigned int totalSize, float* out, const float* A, const float* B,
           unsigned int M, unsigned int N,
           unsigned int K);
+
+//! Same as Gemm, but A or B may be given in transposed layout
+//! A is stored as (K x M) matrix if transposeA is true, and B is stored as
+//! (N x K) matrix if transposeB is true
+void GemmTransposed(unsigned int totalSize, float* out, const float* A,
+                    const float* B, unsigned int M, unsigned int N,
+                    unsigned int K, bool transposeA, bool transposeB);
 } // namespace Sapphire::Compute::Naive::Dense
 
 #endif
@@ -0,0 +1,87 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_NORMALIZATION_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_NORMALIZATION_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Running mean and sum of squared deviations from the mean, updated with
+//! Welford's algorithm. States of disjoint sets of elements are combined
+//! with Merge, so statistics are computed in a single pass without
+//! cancellation of sum of squares
+struct WelfordState
+{
+    float Mean = 0.0f;
+    float M2 = 0.0f;
+    float Count = 0.0f;
+
+    void Add(float value)
+    {
+        Count += 1.0f;
+        const float delta = value - Mean;
+        Mean += delta / Count;
+        M2 += delta * (value - Mean);
+    }
+
+    void Merge(const WelfordState& other)
+    {
+        const float count = Count + other.Count;
+        if (count == 0.0f)
+            return;
+        const float delta = other.Mean - Mean;
+        Mean += delta * other.Count / count;
+        M2 += other.M2 + delta * delta * Count * other.Count / count;
+        Count = count;
+    }
+
+    //! Biased variance used for normalization
+    [[nodiscard]] float Variance() const
+    {
+        return Count > 0.0f ? M2 / Count : 0.0f;
+    }
+};
+
+//! Normalizes x of shape (numUnits, channels, innerSize) with statistics of
+//! each channel, and applies gamma and beta of the channel in the same pass
+//! Each channel is normalized right after its statistics are computed,
+//! while it is still in cache
+//! mean and invStd receive statistics of each channel for back propagation,
+//! and variance receives the biased variance
+void BatchNormForward(float* y, float* mean, float* invStd, float* variance,
+                      const float* x, const float* gamma, const float* beta,
+                      unsigned int numUnits, unsigned int channels,
+                      unsigned int innerSize, float epsilon);
+
+//! y = gamma * (x - runningMean) / sqrt(runningVar + epsilon) + beta for
+//! each channel of x in (numUnits, channels, innerSize) layout
+void BatchNormInference(float* y, const float* x, const float* runningMean,
+                        const float* runningVar, const float* gamma,
+                        const float* beta, unsigned int numUnits,
+                        unsigned int channels, unsigned int innerSize,
+                        float epsilon);
+
+//! dx += gradient of BatchNormForward, dGamma and dBeta are overwritten
+//! x is normalized again with mean and invStd instead of keeping it
+void BatchNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* mean, const float* invStd,
+                       const float* gamma, unsigned int numUnits,
+                       unsigned int channels, unsigned int innerSize);
+
+//! Normalizes each row of x in (rows, rowSize) layout, and applies gamma and
+//! beta of each element of the row in the same pass
+void LayerNormForward(float* y, float* mean, float* invStd, const float* x,
+                      const float* gamma, const float* beta, unsigned int rows,
+                      unsigned int rowSize, float epsilon);
+
+//! dx += gradient of LayerNormForward, dGamma and dBeta are overwritten
+void LayerNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* mean, const float* invStd,
+                       const float* gamma, unsigned int rows,
+                       unsigned int rowSize);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
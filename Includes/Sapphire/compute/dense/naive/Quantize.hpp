@@ -0,0 +1,61 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_QUANTIZE_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_QUANTIZE_HPP
+
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <cstdint>
+
+//! Host kernels of int8 inference
+//! Activations are quantized to unsigned 8 bit values with zero point, and
+//! weights are quantized to signed 8 bit values symmetrically per output
+//! channel. Matrices are given with strides in number of elements, so
+//! transposed data can be read without copying
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Largest quantized activation. Activations use 7 bits so that vpmaddubsw
+//! on AVX2 cannot saturate
+constexpr int Int8ActivationMax = 127;
+//! Largest magnitude of quantized weight
+constexpr int Int8WeightMax = 127;
+
+//! Number of rows of A and B after padding K to multiple of Int8PackDepth
+unsigned int Int8PaddedDepth(unsigned int K);
+
+//! Number of channels after padding N to multiple of Int8PackWidth
+unsigned int Int8PaddedWidth(unsigned int N);
+
+//! Quantizes (rows x cols) matrix into rows of paddedCols elements
+//! out = clamp(round(in / scale) + zeroPoint, 0, Int8ActivationMax)
+//! Padded elements are set to zero
+//! \param rowStride, colStride : strides of input in number of elements
+void QuantizeActivation(std::uint8_t* out, const float* in, unsigned int rows,
+                        unsigned int cols, unsigned int paddedCols,
+                        unsigned int rowStride, unsigned int colStride,
+                        float scale, int zeroPoint);
+
+//! Quantizes (K x N) weight whose columns are output channels, and packs it
+//! in the layout of GemmInt8
+//! \param packed : Int8PaddedDepth(K) * Int8PaddedWidth(N) elements
+//! \param scales : N elements. Receives scale of each channel
+//! \param columnSums : N elements. Receives sum of quantized weights of each
+//! channel, which is used to remove zero point of activations
+//! \param rowStride, colStride : strides of weight in number of elements
+void PackInt8Weight(std::int8_t* packed, float* scales,
+                    std::int32_t* columnSums, const float* weight,
+                    unsigned int K, unsigned int N, unsigned int rowStride,
+                    unsigned int colStride);
+
+//! out[M x N] = epilogue(A[M x K] * B)
+//! Same as SimdKernels::GemmInt8. Dispatched to the kernel of current simd
+//! level, or computed in scalar if there is none
+void GemmInt8(float* out, const std::uint8_t* A, const std::int8_t* B,
+              unsigned int M, unsigned int N, unsigned int K,
+              const Int8Epilogue& epilogue);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
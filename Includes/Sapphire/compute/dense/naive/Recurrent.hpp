@@ -0,0 +1,58 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_RECURRENT_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_RECURRENT_HPP
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Applies every gate nonlinearity and the state update of a LSTM cell for
+//! one time step in a single pass
+//! gates : (batchSize, 4 * hiddenSize) pre-activations of input, forget,
+//! cell and output gates, replaced by their activations
+//! cell, hidden : (batchSize, hiddenSize) receive new states
+//! cellPrev may be nullptr for zero initial state
+void LstmCellForward(float* gates, float* cell, float* hidden,
+                     const float* cellPrev, unsigned int batchSize,
+                     unsigned int hiddenSize);
+
+//! Computes gradients of gate pre-activations of a time step from the saved
+//! gate activations and cell states
+//! dHidden is gradient of the output, and dHiddenNext is gradient from the
+//! next time step, which may be nullptr
+//! dCell holds gradient of the cell state from the next time step, and
+//! receives gradient of cellPrev
+void LstmCellBackward(float* dGates, float* dCell, const float* dHidden,
+                      const float* dHiddenNext, const float* gates,
+                      const float* cell, const float* cellPrev,
+                      unsigned int batchSize, unsigned int hiddenSize);
+
+//! Applies every gate nonlinearity and the state update of a GRU cell for
+//! one time step in a single pass
+//! inputProj : (batchSize, 3 * hiddenSize) projection of the input with its
+//! bias, in order of reset, update and new gates
+//! hiddenProj : (batchSize, 3 * hiddenSize) projection of hiddenPrev without
+//! bias, hiddenBias is added to it
+//! gates : (batchSize, 4 * hiddenSize) receives reset, update and new gates,
+//! and the new gate projection of hiddenPrev for back propagation
+//! hiddenProj and hiddenPrev may be nullptr for zero initial state
+void GruCellForward(float* gates, float* hidden, const float* inputProj,
+                    const float* hiddenProj, const float* hiddenBias,
+                    const float* hiddenPrev, unsigned int batchSize,
+                    unsigned int hiddenSize);
+
+//! Computes gradients of the input and hidden projections of a time step
+//! dInputProj, dHiddenProj : (batchSize, 3 * hiddenSize)
+//! dHiddenPrev receives gradient of hiddenPrev through the update gate, and
+//! may be the same array as dHiddenNext, which may be nullptr
+void GruCellBackward(float* dInputProj, float* dHiddenProj,
+                     float* dHiddenPrev, const float* dHidden,
+                     const float* dHiddenNext, const float* gates,
+                     const float* hiddenPrev, unsigned int batchSize,
+                     unsigned int hiddenSize);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
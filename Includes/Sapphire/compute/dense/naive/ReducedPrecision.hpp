@@ -0,0 +1,49 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_NAIVE_REDUCED_PRECISION_HPP
+#define SAPPHIRE_COMPUTE_DENSE_NAIVE_REDUCED_PRECISION_HPP
+
+#include <Sapphire/util/DataType.hpp>
+#include <cstdint>
+#include <functional>
+
+//! Host kernels on data stored in Float16 or BFloat16
+//! Untyped pointers point to float if the type is Float32, and to
+//! std::uint16_t otherwise. Computation is always done in Float32
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Converts totalSize elements from inputType to outputType
+//! Data of the same type is copied as it is
+void Convert(void* output, DataType outputType, const void* input,
+             DataType inputType, unsigned int totalSize);
+
+//! Same as GemmTransposed with A in row major order, but B is stored in
+//! Float16 or BFloat16 given by typeB
+//! B is converted while it is loaded, and products are accumulated in Float32
+void GemmReduced(unsigned int totalSize, float* out, const float* A,
+                 const std::uint16_t* B, unsigned int M, unsigned int N,
+                 unsigned int K, bool transposeB, DataType typeB);
+
+using UnaryKernel =
+    std::function<void(float* output, const float* input, unsigned int size)>;
+using BinaryKernel = std::function<void(
+    float* output, const float* inputA, const float* inputB,
+    unsigned int size)>;
+
+//! Invokes Float32 kernel on operands of the same size stored in any type
+//! Operands are converted in blocks small enough to stay in L1 cache, so
+//! reduced data is read and written once without expanding all of it
+void Elementwise(void* output, DataType outputType, const void* input,
+                 DataType inputType, unsigned int totalSize,
+                 const UnaryKernel& kernel);
+
+void Elementwise(void* output, DataType outputType, const void* inputA,
+                 DataType typeA, const void* inputB, DataType typeB,
+                 unsigned int totalSize, const BinaryKernel& kernel);
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
@@ -0,0 +1,174 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_DENSE_SIMD_KERNELS_HPP
+#define SAPPHIRE_COMPUTE_DENSE_SIMD_KERNELS_HPP
+
+//! Host kernels compiled for each instruction set
+//! Each variant lives in its own translation unit built with the flags of its
+//! instruction set only, so the rest of the library runs on any x86 cpu.
+//! Variants are selected at runtime with GetSimdKernels()
+//! Elementwise kernels take inputs of the same size without broadcasting
+//! 16 bit data is given as raw bits of Float16 or BFloat16
+
+#include <cstdint>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+//! Weights of GemmInt8 are packed as [K / Int8PackDepth][paddedN][Int8PackDepth]
+//! where paddedN is N rounded up to multiple of Int8PackWidth, so that each
+//! load reads Int8PackDepth consecutive weights of adjacent output channels
+constexpr unsigned int Int8PackWidth = 16;
+constexpr unsigned int Int8PackDepth = 4;
+
+//! Applied to int32 accumulators of GemmInt8 before they are stored
+//! out = Scale * (accumulator + Offset) + Bias, followed by ReLU if ReLU is
+//! true. Arrays hold one element per output channel and are padded to paddedN
+struct Int8Epilogue
+{
+    const float* Scale;
+    const std::int32_t* Offset;
+    const float* Bias;
+    bool ReLU;
+};
+
+struct SimdKernels
+{
+    //! Same as Naive::Gemm
+    void (*Gemm)(unsigned int totalSize, float* out, const float* A,
+                 const float* B, unsigned int M, unsigned int N,
+                 unsigned int K);
+    void (*Add)(float* output, const float* inputA, const float* inputB,
+                unsigned int totalSize);
+    void (*Sub)(float* output, const float* inputA, const float* inputB,
+                unsigned int totalSize);
+    void (*Dot)(float* output, const float* inputA, const float* inputB,
+                unsigned int totalSize);
+    void (*Scale)(float* output, const float* input, float scaleFactor,
+                  unsigned int totalSize);
+    void (*ReLU)(float* output, const float* input, unsigned int totalSize);
+
+    //! Same as Gemm, but B is stored in Float16 or BFloat16
+    //! Elements of B are converted in registers and accumulated in Float32
+    void (*GemmHalf)(unsigned int totalSize, float* out, const float* A,
+                     const std::uint16_t* B, unsigned int M, unsigned int N,
+                     unsigned int K);
+    void (*GemmBFloat16)(unsigned int totalSize, float* out, const float* A,
+                         const std::uint16_t* B, unsigned int M,
+                         unsigned int N, unsigned int K);
+
+    //! Conversions round to nearest even as Util::FloatToHalf and
+    //! Util::FloatToBFloat16
+    void (*FloatToHalf)(std::uint16_t* output, const float* input,
+                        unsigned int totalSize);
+    void (*HalfToFloat)(float* output, const std::uint16_t* input,
+                        unsigned int totalSize);
+    void (*FloatToBFloat16)(std::uint16_t* output, const float* input,
+                            unsigned int totalSize);
+    void (*BFloat16ToFloat)(float* output, const std::uint16_t* input,
+                            unsigned int totalSize);
+
+    //! out[M x N] = epilogue(A[M x K] * B[K x N])
+    //! A holds activations in [0, 127], so that sums of two products of
+    //! vpmaddubsw never saturate. B holds packed weights in [-127, 127]
+    //! K must be multiple of Int8PackDepth
+    //! May be nullptr if no kernel of this level is compiled
+    void (*GemmInt8)(float* out, const std::uint8_t* A, const std::int8_t* B,
+                     unsigned int M, unsigned int N, unsigned int K,
+                     const Int8Epilogue& epilogue);
+};
+
+//! Returns kernels of the level given by Util::GetSimdLevel()
+//! Returns nullptr if scalar kernels should be used
+const SimdKernels* GetSimdKernels();
+
+#ifdef WITH_AVX2
+namespace Avx2
+{
+void Gemm(unsigned int totalSize, float* out, const float* A, const float* B,
+          unsigned int M, unsigned int N, unsigned int K);
+void Add(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize);
+void Sub(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize);
+void Dot(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize);
+void Scale(float* output, const float* input, float scaleFactor,
+           unsigned int totalSize);
+void ReLU(float* output, const float* input, unsigned int totalSize);
+void GemmHalf(unsigned int totalSize, float* out, const float* A,
+              const std::uint16_t* B, unsigned int M, unsigned int N,
+              unsigned int K);
+void GemmBFloat16(unsigned int totalSize, float* out, const float* A,
+                  const std::uint16_t* B, unsigned int M, unsigned int N,
+                  unsigned int K);
+void FloatToHalf(std::uint16_t* output, const float* input,
+                 unsigned int totalSize);
+void HalfToFloat(float* output, const std::uint16_t* input,
+                 unsigned int totalSize);
+void FloatToBFloat16(std::uint16_t* output, const float* input,
+                     unsigned int totalSize);
+void BFloat16ToFloat(float* output, const std::uint16_t* input,
+                     unsigned int totalSize);
+void GemmInt8(float* out, const std::uint8_t* A, const std::int8_t* B,
+              unsigned int M, unsigned int N, unsigned int K,
+              const Int8Epilogue& epilogue);
+} // namespace Avx2
+#endif
+
+#ifdef WITH_AVX512
+namespace Avx512
+{
+void Gemm(unsigned int totalSize, float* out, const float* A, const float* B,
+          unsigned int M, unsigned int N, unsigned int K);
+void Add(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize);
+void Sub(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize);
+void Dot(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize);
+void Scale(float* output, const float* input, float scaleFactor,
+           unsigned int totalSize);
+void ReLU(float* output, const float* input, unsigned int totalSize);
+void GemmHalf(unsigned int totalSize, float* out, const float* A,
+              const std::uint16_t* B, unsigned int M, unsigned int N,
+              unsigned int K);
+void GemmBFloat16(unsigned int totalSize, float* out, const float* A,
+                  const std::uint16_t* B, unsigned int M, unsigned int N,
+                  unsigned int K);
+void FloatToHalf(std::uint16_t* output, const float* input,
+                 unsigned int totalSize);
+void HalfToFloat(float* output, const std::uint16_t* input,
+                 unsigned int totalSize);
+void FloatToBFloat16(std::uint16_t* output, const float* input,
+                     unsigned int totalSize);
+void BFloat16ToFloat(float* output, const std::uint16_t* input,
+                     unsigned int totalSize);
+} // namespace Avx512
+#endif
+
+#ifdef WITH_AVX512BF16
+//! Only used by Avx512 kernels if cpu supports AVX512-BF16
+namespace Avx512Bf16
+{
+void FloatToBFloat16(std::uint16_t* output, const float* input,
+                     unsigned int totalSize);
+} // namespace Avx512Bf16
+#endif
+
+#ifdef WITH_AVX512VNNI
+//! Used by Avx512 kernels if cpu supports AVX512-VNNI. Avx512 kernels use
+//! GemmInt8 of Avx2 otherwise
+namespace Avx512Vnni
+{
+void GemmInt8(float* out, const std::uint8_t* A, const std::int8_t* B,
+              unsigned int M, unsigned int N, unsigned int K,
+              const Int8Epilogue& epilogue);
+} // namespace Avx512Vnni
+#endif
+} // namespace Sapphire::Compute::Dense::Naive
+
+#endif
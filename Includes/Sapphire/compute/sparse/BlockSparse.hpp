@@ -0,0 +1,82 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_SPARSE_BLOCK_SPARSE_HPP
+#define SAPPHIRE_COMPUTE_SPARSE_BLOCK_SPARSE_HPP
+
+#include <Sapphire/compute/sparse/SparseMatrix.hpp>
+
+namespace Sapphire::Compute
+{
+//! Deep allocates block sparse matrix array on host
+//! \param blockSparseArray : ptr to allocate block sparse matrix array
+//! \param m : number of rows (must be multiple of blockRows)
+//! \param n : number of columns (must be multiple of blockCols)
+//! \param blockRows : number of rows in each block
+//! \param blockCols : number of columns in each block
+//! \param nnzb : array of number of non-zero blocks for each matrix
+//! \param numMatrices : number of matrices
+void DeepAllocateBlockSparseHost(BlockSparseMatrix** blockSparseArray,
+                                 uint32_t m, uint32_t n, uint32_t blockRows,
+                                 uint32_t blockCols, const uint32_t nnzb[],
+                                 uint32_t numMatrices);
+
+//! Frees block sparse matrix array on the host
+//! \param blockSparseArray : ptr to the block sparse matrix array to free
+//! \param numMatrices : number of matrices
+void DeepFreeBlockSparseHost(BlockSparseMatrix* blockSparseArray,
+                             uint32_t numMatrices);
+
+//! Creates and allocates new block sparse matrix using dense matrix
+//! Every block containing at least one non-zero element is stored
+//! \param dst : ptr to allocate block sparse matrix array
+//! \param src : dense matrix array to convert from
+//! \param paddedN : row stride of the dense matrix
+void CreateBlockSparseMatrixWithDenseMatrix(BlockSparseMatrix** dst,
+                                            const float* src, uint32_t m,
+                                            uint32_t n, uint32_t paddedN,
+                                            uint32_t blockRows,
+                                            uint32_t blockCols,
+                                            uint32_t numMatrices);
+
+//! Creates and allocates new block sparse matrix using CSR sparse matrix
+//! Every block containing at least one stored element of src is stored
+//! \param dst : ptr to allocate block sparse matrix array
+//! \param src : CSR sparse matrix array on the host to convert from
+void CreateBlockSparseMatrixWithSparseMatrix(BlockSparseMatrix** dst,
+                                             const SparseMatrix* src,
+                                             uint32_t blockRows,
+                                             uint32_t blockCols,
+                                             uint32_t numMatrices);
+
+//! Converts existing block sparse matrix to dense matrix
+//! Dense matrix should be pre-allocated
+void ConvertBlockSparseMatrixToDenseMatrix(float* dst,
+                                           const BlockSparseMatrix* src,
+                                           uint32_t paddedN,
+                                           uint32_t numMatrices);
+
+//! Prunes dense matrix by block magnitude and creates block sparse matrix
+//! Blocks with the smallest L1 norm are removed until the ratio of removed
+//! blocks reaches given sparsity
+//! \param dst : ptr to allocate single block sparse matrix
+//! \param src : dense matrix to prune
+//! \param sparsity : ratio of blocks to remove. Must be in range [0, 1)
+void PruneDenseMatrixToBlockSparse(BlockSparseMatrix** dst, const float* src,
+                                   uint32_t m, uint32_t n, uint32_t paddedN,
+                                   uint32_t blockRows, uint32_t blockCols,
+                                   float sparsity);
+
+//! Re-reads values of the stored blocks from the dense matrix, and zeros out
+//! every element of the dense matrix outside of the stored blocks
+//! Keeps dense and block sparse representation of the pruned matrix in sync
+//! \param dst : block sparse matrix with fixed block layout
+//! \param src : dense matrix with same shape as dst
+void SyncBlockSparseMatrix(BlockSparseMatrix* dst, float* src,
+                           uint32_t paddedN);
+} // namespace Sapphire::Compute
+
+#endif
@@ -48,4 +48,22 @@ struct ALIGN(16) LoadDistMatrix
     //! Padding bits to ensure this struct to be 48 bytes
     uint32_t Padding[3];
 };
+
+//! Block compressed sparse row (BSR) matrix
+//! Non-zero blocks of size (BlockRows x BlockCols) are stored contiguously in
+//! row-major order. ROW holds (M / BlockRows + 1) offsets into COL, and COL
+//! holds block column index of each non-zero block
+struct ALIGN(16) BlockSparseMatrix
+{
+    float* V;
+    uint32_t* COL;
+    uint32_t* ROW;
+    uint32_t NNZB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t BlockRows;
+    //! BlockRows and BlockCols fill up the padding so that this struct is
+    //! 48 bytes
+    uint32_t BlockCols;
+};
 #endif  // Sapphire_SPARSEMATRIX_HPP
\ No newline at end of file
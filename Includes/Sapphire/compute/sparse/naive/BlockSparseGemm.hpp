@@ -0,0 +1,25 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_COMPUTE_SPARSE_NAIVE_BLOCK_SPARSE_GEMM_HPP
+#define SAPPHIRE_COMPUTE_SPARSE_NAIVE_BLOCK_SPARSE_GEMM_HPP
+
+#include <Sapphire/compute/sparse/SparseMatrix.hpp>
+
+namespace Sapphire::Compute::Sparse::Naive
+{
+//! Performs out = a * b + out where a is dense (M x K) and b is block sparse
+//! (K x N)
+//! Each non-zero block of b is multiplied with a tile of rows of a using dense
+//! micro-kernel specialized for the block size
+//! \param out : dense output matrix (M x N) with row stride N
+//! \param a : dense input matrix (M x K) with row stride K
+//! \param b : block sparse matrix (K x N)
+void Gemm(float* out, const float* a, const BlockSparseMatrix* b,
+          unsigned int M);
+} // namespace Sapphire::Compute::Sparse::Naive
+
+#endif
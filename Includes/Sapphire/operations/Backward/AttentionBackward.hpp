@@ -0,0 +1,38 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_BACKPROP_ATTENTION_BACKWARD_HPP
+#define SAPPHIRE_BACKPROP_ATTENTION_BACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+
+namespace Sapphire::BackProp
+{
+//! Back propagates fused scaled dot product attention
+//! Log sum exp of each query row saved by forward propagation is released
+//! after back propagation
+class AttentionBackProp : public BackPropWrapper
+{
+public:
+    AttentionBackProp(std::string name, TensorUtil::TensorData dQuery,
+                      TensorUtil::TensorData dKey,
+                      TensorUtil::TensorData dValue,
+                      TensorUtil::TensorData dy,
+                      TensorUtil::TensorData query,
+                      TensorUtil::TensorData key,
+                      TensorUtil::TensorData value, TensorUtil::TensorData y,
+                      TensorUtil::TensorData logSumExp, float scale,
+                      bool causal);
+
+private:
+    void m_runBackProp() override;
+
+    float m_scale;
+    bool m_causal;
+};
+} // namespace Sapphire::BackProp
+
+#endif
@@ -8,6 +8,7 @@
 #define SAPPHIRE_BACKPROP_WRAPPER_HPP
 
 #include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/util/Profiler.hpp>
 #include <algorithm>
 #include <functional>
 
@@ -80,10 +81,10 @@ public:
     BackPropWrapper& operator=(BackPropWrapper&& backPropWrapper) noexcept
     = delete;
 
-    [[nodiscard]] std::vector<int>
+    [[nodiscard]] std::vector<std::int64_t>
     GetGradientOutputDescriptorKeys() const
     {
-        std::vector<int> tensorKeys(m_dxVector.size());
+        std::vector<std::int64_t> tensorKeys(m_dxVector.size());
 
         for (std::size_t i = 0; i < m_dxVector.size(); ++i)
             tensorKeys[i] = m_dxVector[i].GetDescriptorKey();
@@ -97,6 +98,8 @@ public:
     {
         if (m_isReady(location))
         {
+            SAPPHIRE_PROFILE_UNIT(m_name);
+            SAPPHIRE_PROFILE_OP("BackProp", 0);
             m_runBackProp();
             return true;
         }
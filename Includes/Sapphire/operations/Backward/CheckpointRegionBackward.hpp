@@ -0,0 +1,33 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_BACKPROP_CHECKPOINT_REGION_BACKWARD_HPP
+#define SAPPHIRE_BACKPROP_CHECKPOINT_REGION_BACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+#include <Sapphire/operations/Forward/CheckpointRegion.hpp>
+
+namespace Sapphire::BackProp
+{
+//! Computes the region again from its saved input, and back propagates dy
+//! through the recomputed units. Weights of the units are updated by their
+//! own wrappers during the recomputation, while the model is marked as
+//! recomputing so units do not update their state a second time
+class CheckpointRegionBackward : public BackPropWrapper
+{
+public:
+    CheckpointRegionBackward(std::string name, TensorUtil::TensorData dx,
+                             TensorUtil::TensorData dy,
+                             TensorUtil::TensorData x,
+                             NN::CheckpointRegion::RegionFunction region);
+
+private:
+    void m_runBackProp() override;
+
+    NN::CheckpointRegion::RegionFunction m_region;
+};
+} // namespace Sapphire::BackProp
+#endif
@@ -7,6 +7,7 @@
 #ifndef SAPPHIRE_BACKPROP_CONV2DBACKWARD_HPP
 #define SAPPHIRE_BACKPROP_CONV2DBACKWARD_HPP
 
+#include <Sapphire/compute/FusedOps.hpp>
 #include <Sapphire/operations/Backward/BackPropWrapper.hpp>
 
 namespace Sapphire::BackProp
@@ -20,12 +21,16 @@ public:
                    TensorData filter, TensorData bias,
                    TensorData x,
                    std::pair<int, int> stride, std::pair<int, int> dilation,
-                   std::pair<int, int> padding);
+                   std::pair<int, int> padding,
+                   Compute::Activation activation = Compute::Activation::None,
+                   TensorData y = {});
 
     Conv2DBackProp(std::string name, TensorData dx, TensorData dy,
                    TensorData filter, TensorData x,
                    std::pair<int, int> stride, std::pair<int, int> dilation,
-                   std::pair<int, int> padding);
+                   std::pair<int, int> padding,
+                   Compute::Activation activation = Compute::Activation::None,
+                   TensorData y = {});
 
     Conv2DBackProp(const Conv2DBackProp& conv2DBackProp) = default;
     Conv2DBackProp(Conv2DBackProp&& conv2DBackProp) noexcept = default;
@@ -41,6 +46,8 @@ private:
     std::pair<int, int> m_stride, m_dilation, m_padding;
     unsigned int m_batchSize;
     bool m_hasBias;
+    //! Activation fused to the output. Its output y is kept in constants
+    Compute::Activation m_activation;
 };
 }
 
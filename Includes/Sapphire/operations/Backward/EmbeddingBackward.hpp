@@ -0,0 +1,31 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_BACKPROP_EMBEDDING_BACKWARD_HPP
+#define SAPPHIRE_BACKPROP_EMBEDDING_BACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+
+namespace Sapphire::BackProp
+{
+//! Indices are not differentiable, so this wrapper has no dx
+//! Weight is updated with row sparse gradient containing only looked up rows
+class EmbeddingBackProp : public BackPropWrapper
+{
+public:
+    EmbeddingBackProp(std::string name, TensorUtil::TensorData dy,
+                      TensorUtil::TensorData weight,
+                      TensorUtil::TensorData indices, int bagSize, bool mean);
+
+private:
+    void m_runBackProp() override;
+
+    int m_bagSize;
+    bool m_mean;
+};
+} // namespace Sapphire::BackProp
+
+#endif
@@ -8,6 +8,7 @@
 #define SAPPHIRE_BACKPROP_LINEARBACKWARD_HPP
 
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
 #include <Sapphire/operations/Backward/BackPropWrapper.hpp>
 
 namespace Sapphire::BackProp
@@ -17,6 +18,7 @@ constexpr static int dyIdx = 0;
 constexpr static int weightIdx = 0;
 constexpr static int biasIdx = 1;
 constexpr static int xIdx = 0;
+constexpr static int yIdx = 1;
 
 class LinearBackProp : public BackPropWrapper
 {
@@ -25,18 +27,26 @@ public:
                             TensorUtil::TensorData dy,
                             TensorUtil::TensorData weight,
                             TensorUtil::TensorData bias,
-                            TensorUtil::TensorData x, int batchSize);
+                            TensorUtil::TensorData x, int batchSize,
+                            Compute::Activation activation =
+                                Compute::Activation::None,
+                            TensorUtil::TensorData y = {});
 
 private:
     void m_runBackProp() override;
 
-    void m_backProp(TensorUtil::TensorData& weight);
+    void m_backProp(TensorUtil::TensorData& weight,
+                    const TensorUtil::TensorData& dy);
 
-    void m_updateWeight(TensorUtil::TensorData& weight) const;
+    void m_updateWeight(TensorUtil::TensorData& weight,
+                        const TensorUtil::TensorData& dy) const;
 
-    void m_updateBias(TensorUtil::TensorData& bias) const;
+    void m_updateBias(TensorUtil::TensorData& bias,
+                      const TensorUtil::TensorData& dy) const;
 
     int m_batchSize;
+    //! Activation fused to the output. Its output y is kept in constants
+    Compute::Activation m_activation;
 };
 } // namespace Sapphire::BackProp
 
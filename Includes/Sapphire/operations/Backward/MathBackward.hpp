@@ -36,6 +36,19 @@ private:
     void m_runBackProp() override;
 };
 
+//! Back propagates through ReLU(a + b) using its output y
+class AddReLUBackProp : public BackPropWrapper
+{
+public:
+    explicit AddReLUBackProp(std::string name, TensorUtil::TensorData da,
+                             TensorUtil::TensorData db,
+                             TensorUtil::TensorData dy,
+                             TensorUtil::TensorData y);
+
+private:
+    void m_runBackProp() override;
+};
+
 class SubBackProp : public BackPropWrapper
 {
 public:
@@ -0,0 +1,60 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_BACKPROP_NORMALIZATION_BACKWARD_HPP
+#define SAPPHIRE_BACKPROP_NORMALIZATION_BACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+
+namespace Sapphire::BackProp
+{
+using namespace TensorUtil;
+
+//! Back propagates BatchNorm2D in training
+//! Statistics of the batch saved by forward propagation are released after
+//! back propagation
+class BatchNorm2DBackProp : public BackPropWrapper
+{
+public:
+    BatchNorm2DBackProp(std::string name, TensorData dx, TensorData dy,
+                        TensorData gamma, TensorData beta, TensorData x,
+                        TensorData savedMean, TensorData savedInvStd);
+
+    BatchNorm2DBackProp(const BatchNorm2DBackProp& backProp) = default;
+    BatchNorm2DBackProp(BatchNorm2DBackProp&& backProp) noexcept = default;
+    BatchNorm2DBackProp& operator=(const BatchNorm2DBackProp& backProp) =
+    delete;
+    BatchNorm2DBackProp& operator=(BatchNorm2DBackProp&& backProp) noexcept =
+    delete;
+
+    ~BatchNorm2DBackProp() override = default;
+
+private:
+    void m_runBackProp() override;
+};
+
+//! Back propagates LayerNorm
+class LayerNormBackProp : public BackPropWrapper
+{
+public:
+    LayerNormBackProp(std::string name, TensorData dx, TensorData dy,
+                      TensorData gamma, TensorData beta, TensorData x,
+                      TensorData savedMean, TensorData savedInvStd);
+
+    LayerNormBackProp(const LayerNormBackProp& backProp) = default;
+    LayerNormBackProp(LayerNormBackProp&& backProp) noexcept = default;
+    LayerNormBackProp& operator=(const LayerNormBackProp& backProp) = delete;
+    LayerNormBackProp& operator=(LayerNormBackProp&& backProp) noexcept =
+    delete;
+
+    ~LayerNormBackProp() override = default;
+
+private:
+    void m_runBackProp() override;
+};
+} // namespace Sapphire::BackProp
+
+#endif
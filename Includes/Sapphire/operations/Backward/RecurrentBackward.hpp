@@ -0,0 +1,61 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_BACKPROP_RECURRENT_BACKWARD_HPP
+#define SAPPHIRE_BACKPROP_RECURRENT_BACKWARD_HPP
+
+#include <Sapphire/operations/Backward/BackPropWrapper.hpp>
+
+namespace Sapphire::BackProp
+{
+using namespace TensorUtil;
+
+//! Back propagates LSTM through time
+//! Gate activations and cell states saved by forward propagation are
+//! released after back propagation
+class LstmBackProp : public BackPropWrapper
+{
+public:
+    LstmBackProp(std::string name, TensorData dx, TensorData dy,
+                 TensorData weightIh, TensorData weightHh, TensorData bias,
+                 TensorData x, TensorData y, TensorData gates,
+                 TensorData cells);
+
+    LstmBackProp(const LstmBackProp& backProp) = default;
+    LstmBackProp(LstmBackProp&& backProp) noexcept = default;
+    LstmBackProp& operator=(const LstmBackProp& backProp) = delete;
+    LstmBackProp& operator=(LstmBackProp&& backProp) noexcept = delete;
+
+    ~LstmBackProp() override = default;
+
+private:
+    void m_runBackProp() override;
+};
+
+//! Back propagates GRU through time
+//! Gate activations saved by forward propagation are released after back
+//! propagation
+class GruBackProp : public BackPropWrapper
+{
+public:
+    GruBackProp(std::string name, TensorData dx, TensorData dy,
+                TensorData weightIh, TensorData weightHh, TensorData biasIh,
+                TensorData biasHh, TensorData x, TensorData y,
+                TensorData gates);
+
+    GruBackProp(const GruBackProp& backProp) = default;
+    GruBackProp(GruBackProp&& backProp) noexcept = default;
+    GruBackProp& operator=(const GruBackProp& backProp) = delete;
+    GruBackProp& operator=(GruBackProp&& backProp) noexcept = delete;
+
+    ~GruBackProp() override = default;
+
+private:
+    void m_runBackProp() override;
+};
+} // namespace Sapphire::BackProp
+
+#endif
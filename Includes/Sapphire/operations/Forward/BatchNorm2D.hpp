@@ -0,0 +1,95 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_BATCH_NORM_2D_HPP
+#define SAPPHIRE_NN_BATCH_NORM_2D_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::NN
+{
+//! Normalizes each channel of (N, C, H, W) input, and applies trainable
+//! scale (gamma) and shift (beta) of the channel
+//! Running mean and variance are kept in preserved buffers, which are saved
+//! in checkpoints with gamma and beta
+class BatchNorm2D : public Unit
+{
+public:
+    //! \param momentum : weight of statistics of each batch in running
+    //! statistics
+    //! \param epsilon : added to variance to avoid division by zero
+    BatchNorm2D(int channels, float momentum = 0.1f, float epsilon = 1e-5f);
+    BatchNorm2D(std::string name, int channels, float momentum = 0.1f,
+                float epsilon = 1e-5f);
+
+    ~BatchNorm2D() override = default;
+
+    BatchNorm2D(const BatchNorm2D& batchNorm) = default;
+    BatchNorm2D(BatchNorm2D&& batchNorm) noexcept = default;
+    BatchNorm2D& operator=(const BatchNorm2D& batchNorm) = default;
+    BatchNorm2D& operator=(BatchNorm2D&& batchNorm) noexcept = default;
+
+    //! In training, x is normalized with statistics of the batch and running
+    //! statistics are updated. Otherwise x is normalized with running
+    //! statistics, and back propagation is not recorded
+    //! Returns x itself after the unit is folded into the preceding Conv2D
+    Tensor operator()(Tensor& x);
+
+    [[nodiscard]] Tensor GetGamma() const;
+    [[nodiscard]] Tensor GetBeta() const;
+    [[nodiscard]] Tensor GetRunningMean() const;
+    [[nodiscard]] Tensor GetRunningVar() const;
+
+    void SetTraining(bool training)
+    {
+        m_training = training;
+    }
+
+    [[nodiscard]] bool IsTraining() const
+    {
+        return m_training;
+    }
+
+    //! Returns (scale, shift) of each channel, so that normalization with
+    //! running statistics computes x * scale + shift
+    [[nodiscard]] std::pair<std::vector<float>, std::vector<float>>
+    GetScaleAndShift() const;
+
+    //! Marks that scale and shift are applied by the preceding unit
+    //! Use Conv2D::FoldBatchNorm, which calls this
+    void MarkFolded()
+    {
+        m_folded = true;
+    }
+
+    [[nodiscard]] bool IsFolded() const
+    {
+        return m_folded;
+    }
+
+    [[nodiscard]] int GetChannels() const
+    {
+        return m_channels;
+    }
+
+private:
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    static std::atomic<int> m_unitIdCount;
+    int m_channels;
+    float m_momentum;
+    float m_epsilon;
+    bool m_training = true;
+    bool m_folded = false;
+};
+} // namespace Sapphire::NN
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_CHECKPOINT_REGION_HPP
+#define SAPPHIRE_NN_CHECKPOINT_REGION_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <atomic>
+#include <functional>
+
+namespace Sapphire::NN
+{
+//! Runs a sequence of units as a checkpoint region (gradient checkpointing)
+//! Only the input of the region is kept during forward propagation, and
+//! tensors computed inside the region are released as soon as the output is
+//! computed. The region is computed again during back propagation to
+//! propagate the gradient through it, so activation memory of N units split
+//! into sqrt(N) regions becomes O(sqrt(N)) at the cost of one more forward
+//! propagation
+//! The region must be deterministic, and must not contain another region
+class CheckpointRegion : public Unit
+{
+public:
+    using RegionFunction = std::function<Tensor(const Tensor&)>;
+
+    explicit CheckpointRegion(RegionFunction region);
+    CheckpointRegion(std::string name, RegionFunction region);
+
+    ~CheckpointRegion() override = default;
+
+    CheckpointRegion(const CheckpointRegion& region) = default;
+    CheckpointRegion(CheckpointRegion&& region) noexcept = default;
+    CheckpointRegion& operator=(const CheckpointRegion& region) = default;
+    CheckpointRegion& operator=(CheckpointRegion&& region) noexcept = default;
+
+    Tensor operator()(const Tensor& x);
+
+private:
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    static std::atomic<int> m_unitIdCount;
+    RegionFunction m_region;
+};
+} // namespace Sapphire::NN
+
+#endif
@@ -7,12 +7,18 @@
 #ifndef SAPPHIRE_NN_CONV2D_HPP
 #define SAPPHIRE_NN_CONV2D_HPP
 
+#include <Sapphire/compute/FusedOps.hpp>
+#include <Sapphire/compute/QuantizeOps.hpp>
 #include <Sapphire/operations/Unit.hpp>
 #include <Sapphire/tensor/Tensor.hpp>
+#include <atomic>
+#include <memory>
 #include <utility>
 
 namespace Sapphire::NN
 {
+class BatchNorm2D;
+
 class Conv2D : public Unit
 {
 public:
@@ -41,22 +47,65 @@ public:
     [[nodiscard]] Tensor GetFilter() const;
     [[nodiscard]] Tensor GetBias() const;
 
+    //! Starts recording range of inputs given to forward propagation on the
+    //! host. Run forward propagation with sample batches before Quantize()
+    void Calibrate();
+
+    //! Quantizes the filter to int8 per output channel, and inputs with the
+    //! range recorded since Calibrate()
+    //! Forward propagation on the host computes in int8 afterwards, so this is
+    //! meant for inference
+    void Quantize();
+
+    [[nodiscard]] bool IsQuantized() const
+    {
+        return m_int8Filter != nullptr;
+    }
+
+    //! Applies activation to the output in the same pass as the bias, and
+    //! back propagates through both in a single wrapper
+    //! conv2D(x) after FuseActivation(Activation::ReLU) computes the same as
+    //! F::ReLU(conv2D(x)) without the intermediate tensor
+    void FuseActivation(Compute::Activation activation)
+    {
+        m_activation = activation;
+    }
+
+    [[nodiscard]] Compute::Activation GetActivation() const
+    {
+        return m_activation;
+    }
+
+    //! Folds scale and shift of batchNorm with its running statistics into
+    //! the filter and bias, so conv2D(x) computes batchNorm(conv2D(x)) of
+    //! inference without a separate pass over the output. batchNorm returns
+    //! its input afterwards. Bias is created if this unit does not use it
+    //! Meant for exporting a trained model for inference
+    void FoldBatchNorm(BatchNorm2D& batchNorm);
+
 private:
-    [[nodiscard]] int m_registerOutputTensor(
+    //! Returns true if forward propagation with given filter runs in int8
+    [[nodiscard]] bool m_useInt8(const Tensor& filter, ComputeMode mode) const;
+
+    [[nodiscard]] std::int64_t m_registerOutputTensor(
         const TensorUtil::TensorDescriptor& xDesc) const;
 
     void m_checkArguments(
         std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
 
-    static int m_unitIdCount;
+    static std::atomic<int> m_unitIdCount;
     const int m_yChannels = -1;
     const int m_xChannels = -1;
-    const bool m_useBias = false;
+    bool m_useBias = false;
     const bool m_isSparse = false;
     const std::pair<int, int> m_filterSize, m_stride, m_padSize, m_dilation;
     std::pair<int, int> m_inputSize;
     int m_yRows = -1;
     int m_yCols = -1;
+    std::shared_ptr<Compute::RangeObserver> m_inputObserver = nullptr;
+    std::shared_ptr<Compute::Int8Weight> m_int8Filter = nullptr;
+    Compute::QuantizationParams m_inputParams;
+    Compute::Activation m_activation = Compute::Activation::None;
 };
 }; // namespace Sapphire::NN
 
@@ -0,0 +1,64 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_EMBEDDING_HPP
+#define SAPPHIRE_NN_EMBEDDING_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <atomic>
+
+namespace Sapphire::NN
+{
+//! Pooling applied over the last dimension of the indices
+enum class EmbeddingBag
+{
+    None,
+    Sum,
+    Mean,
+};
+
+//! Looks up rows of (numEmbeddings x embeddingDim) table (Host only)
+//! Indices are given as tensor with float values
+//! With EmbeddingBag::None, output shape is indices shape with embeddingDim
+//! appended. With Sum or Mean, the last dimension of the indices is pooled and
+//! replaced by embeddingDim
+//! Back propagation updates only the rows that were looked up
+class Embedding : public Unit
+{
+public:
+    Embedding(int numEmbeddings, int embeddingDim,
+              EmbeddingBag bag = EmbeddingBag::None);
+    Embedding(std::string name, int numEmbeddings, int embeddingDim,
+              EmbeddingBag bag = EmbeddingBag::None);
+
+    ~Embedding() override = default;
+
+    Embedding(const Embedding& embedding) = default;
+    Embedding(Embedding&& embedding) noexcept = default;
+    Embedding& operator=(const Embedding& embedding) = default;
+    Embedding& operator=(Embedding&& embedding) noexcept = default;
+
+    Tensor operator()(Tensor& indices);
+    Tensor operator()(Tensor& indices, Tensor weight);
+
+    [[nodiscard]] Tensor GetWeight() const;
+
+private:
+    [[nodiscard]] std::int64_t m_registerOutputTensor(
+        const TensorUtil::TensorDescriptor& indicesDesc) const;
+
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    static std::atomic<int> m_unitIdCount;
+    int m_numEmbeddings;
+    int m_embeddingDim;
+    EmbeddingBag m_bag;
+};
+} // namespace Sapphire::NN
+
+#endif
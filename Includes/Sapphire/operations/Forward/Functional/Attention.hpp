@@ -0,0 +1,27 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_FUNCTIONAL_ATTENTION_HPP
+#define SAPPHIRE_FUNCTIONAL_ATTENTION_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+
+namespace Sapphire::F
+{
+//! softmax(query * key^T / sqrt(depth)) * value computed in a single fused
+//! pass over tiles of keys, without the (queryLength, keyLength) score
+//! matrix or intermediate tensors of F::MatMul and F::SoftMax
+//! query : (*, queryLength, depth), key : (*, keyLength, depth)
+//! value : (*, keyLength, valueDepth). Returns (*, queryLength, valueDepth)
+//! Heads are given as leading dimensions. Only available in host mode
+//! \param causal : If true, query i attends to keys up to
+//! i + keyLength - queryLength
+[[maybe_unused]]
+Tensor ScaledDotProductAttention(const Tensor& query, const Tensor& key,
+                                 const Tensor& value, bool causal = false);
+}
+
+#endif
@@ -17,6 +17,12 @@ Tensor MatMul(const Tensor& inputA, const Tensor& inputB);
 [[maybe_unused]]
 Tensor Add(const Tensor& inputA, const Tensor& inputB);
 
+//! ReLU(inputA + inputB) computed in a single pass, as the residual
+//! connection of ResNet blocks. Same as F::ReLU(F::Add(inputA, inputB))
+//! without the intermediate tensor
+[[maybe_unused]]
+Tensor AddReLU(const Tensor& inputA, const Tensor& inputB);
+
 [[maybe_unused]]
 Tensor Sub(const Tensor& inputA, const Tensor& inputB);
 
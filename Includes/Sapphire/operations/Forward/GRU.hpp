@@ -0,0 +1,54 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_GRU_HPP
+#define SAPPHIRE_NN_GRU_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <atomic>
+
+namespace Sapphire::NN
+{
+//! Single layer GRU over a sequence with zero initial state
+//! Weights of reset, update and new gates are concatenated, so each time step
+//! computes every gate with a single gemm and a single fused kernel.
+//! See Compute::GruForward
+class GRU : public Unit
+{
+public:
+    GRU(int inputSize, int hiddenSize);
+    GRU(std::string name, int inputSize, int hiddenSize);
+
+    ~GRU() override = default;
+
+    GRU(const GRU& gru) = default;
+    GRU(GRU&& gru) noexcept = default;
+    GRU& operator=(const GRU& gru) = default;
+    GRU& operator=(GRU&& gru) noexcept = default;
+
+    //! x : (T, N, inputSize)
+    //! Returns hidden states of every time step in (T, N, hiddenSize)
+    Tensor operator()(Tensor& x);
+
+    //! (inputSize, 3 * hiddenSize)
+    [[nodiscard]] Tensor GetWeightIh() const;
+    //! (hiddenSize, 3 * hiddenSize)
+    [[nodiscard]] Tensor GetWeightHh() const;
+    [[nodiscard]] Tensor GetBiasIh() const;
+    [[nodiscard]] Tensor GetBiasHh() const;
+
+private:
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    static std::atomic<int> m_unitIdCount;
+    int m_inputSize;
+    int m_hiddenSize;
+};
+} // namespace Sapphire::NN
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_LSTM_HPP
+#define SAPPHIRE_NN_LSTM_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <atomic>
+
+namespace Sapphire::NN
+{
+//! Single layer LSTM over a sequence with zero initial state
+//! Weights of input, forget, cell and output gates are concatenated, so each
+//! time step computes every gate with a single gemm and a single fused
+//! kernel. See Compute::LstmForward
+class LSTM : public Unit
+{
+public:
+    LSTM(int inputSize, int hiddenSize);
+    LSTM(std::string name, int inputSize, int hiddenSize);
+
+    ~LSTM() override = default;
+
+    LSTM(const LSTM& lstm) = default;
+    LSTM(LSTM&& lstm) noexcept = default;
+    LSTM& operator=(const LSTM& lstm) = default;
+    LSTM& operator=(LSTM&& lstm) noexcept = default;
+
+    //! x : (T, N, inputSize)
+    //! Returns hidden states of every time step in (T, N, hiddenSize)
+    Tensor operator()(Tensor& x);
+
+    //! (inputSize, 4 * hiddenSize)
+    [[nodiscard]] Tensor GetWeightIh() const;
+    //! (hiddenSize, 4 * hiddenSize)
+    [[nodiscard]] Tensor GetWeightHh() const;
+    [[nodiscard]] Tensor GetBias() const;
+
+private:
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    static std::atomic<int> m_unitIdCount;
+    int m_inputSize;
+    int m_hiddenSize;
+};
+} // namespace Sapphire::NN
+
+#endif
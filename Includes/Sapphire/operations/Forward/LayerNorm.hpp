@@ -0,0 +1,52 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_NN_LAYER_NORM_HPP
+#define SAPPHIRE_NN_LAYER_NORM_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <atomic>
+
+namespace Sapphire::NN
+{
+//! Normalizes each sample over its last dimensions of normalizedShape, and
+//! applies trainable scale (gamma) and shift (beta) of each element
+//! Statistics are computed for each sample, so the unit behaves the same in
+//! training and inference
+class LayerNorm : public Unit
+{
+public:
+    //! \param normalizedShape : shape of the last dimensions of the input
+    //! \param epsilon : added to variance to avoid division by zero
+    explicit LayerNorm(Shape normalizedShape, float epsilon = 1e-5f);
+    LayerNorm(std::string name, Shape normalizedShape,
+              float epsilon = 1e-5f);
+
+    ~LayerNorm() override = default;
+
+    LayerNorm(const LayerNorm& layerNorm) = default;
+    LayerNorm(LayerNorm&& layerNorm) noexcept = default;
+    LayerNorm& operator=(const LayerNorm& layerNorm) = default;
+    LayerNorm& operator=(LayerNorm&& layerNorm) noexcept = default;
+
+    //! x : (*, normalizedShape)
+    Tensor operator()(Tensor& x);
+
+    [[nodiscard]] Tensor GetGamma() const;
+    [[nodiscard]] Tensor GetBeta() const;
+
+private:
+    void m_checkArguments(
+        std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
+
+    static std::atomic<int> m_unitIdCount;
+    Shape m_normalizedShape;
+    float m_epsilon;
+};
+} // namespace Sapphire::NN
+
+#endif
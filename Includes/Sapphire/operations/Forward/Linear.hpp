@@ -11,6 +11,12 @@
 #include <Sapphire/operations/optimizers/Optimizer.hpp>
 #include <Sapphire/operations/Unit.hpp>
 #include <Sapphire/operations/Initializers/Initialize.hpp>
+#include <Sapphire/compute/sparse/SparseMatrix.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
+#include <Sapphire/compute/QuantizeOps.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
 namespace Sapphire::NN
 {
@@ -35,6 +41,53 @@ public:
     [[nodiscard]] Tensor GetWeight() const;
     [[nodiscard]] Tensor GetBias() const;
 
+    //! Prunes the weight by block magnitude
+    //! Blocks with the smallest L1 norm are set to zero, and remaining blocks
+    //! are kept in block sparse format. Forward propagation uses block sparse
+    //! kernels afterwards, and is only available on the host
+    //! Blocks are synced with the dense weight whenever it has been written
+    //! by optimizers, LoadData or checkpoints, and pruned blocks of the dense
+    //! weight are set back to zero
+    //! \param sparsity : ratio of blocks to remove. Must be in range [0, 1)
+    //! \param blockSize : (rows, cols) of each block. Weight shape
+    //! (inputFeatureSize, outputFeatureSize) must be divisible by it
+    void Prune(float sparsity, std::pair<int, int> blockSize);
+
+    [[nodiscard]] bool IsPruned() const
+    {
+        return m_sparseWeight != nullptr;
+    }
+
+    //! Starts recording range of inputs given to forward propagation on the
+    //! host. Run forward propagation with sample batches before Quantize()
+    void Calibrate();
+
+    //! Quantizes the weight to int8 per output channel, and inputs with the
+    //! range recorded since Calibrate()
+    //! Forward propagation on the host computes in int8 afterwards. The
+    //! quantized weight is not updated by optimizers, so this is meant for
+    //! inference
+    void Quantize();
+
+    [[nodiscard]] bool IsQuantized() const
+    {
+        return m_int8Weight != nullptr;
+    }
+
+    //! Applies activation to the output in the same pass as the bias, and
+    //! back propagates through both in a single wrapper
+    //! linear(x) after FuseActivation(Activation::ReLU) computes the same as
+    //! F::ReLU(linear(x)) without the intermediate tensor
+    void FuseActivation(Compute::Activation activation)
+    {
+        m_activation = activation;
+    }
+
+    [[nodiscard]] Compute::Activation GetActivation() const
+    {
+        return m_activation;
+    }
+
 protected:
     void m_addTensorData(std::string name, TensorUtil::TensorData tensorData)
     {
@@ -56,17 +109,24 @@ protected:
     std::unordered_map<std::string, TensorUtil::TensorData> m_tensorDataMap;
 
 private:
-    [[nodiscard]] int m_registerOutputTensor(
+    [[nodiscard]] std::int64_t m_registerOutputTensor(
         const TensorUtil::TensorDescriptor& xDesc) const;
 
     void m_checkArguments(
         std::vector<TensorUtil::TensorDescriptor*> arguments) const override;
 
-    static int m_unitIdCount;
+    static std::atomic<int> m_unitIdCount;
     int m_inputs;
     int m_outputs;
     CudaDevice m_device;
     bool m_isSparse;
+    std::shared_ptr<BlockSparseMatrix> m_sparseWeight = nullptr;
+    //! Version of the dense weight that m_sparseWeight was synced with
+    std::uint64_t m_sparseWeightVersion = 0;
+    std::shared_ptr<Compute::RangeObserver> m_inputObserver = nullptr;
+    std::shared_ptr<Compute::Int8Weight> m_int8Weight = nullptr;
+    Compute::QuantizationParams m_inputParams;
+    Compute::Activation m_activation = Compute::Activation::None;
 };
 } // namespace Sapphire::NN
 
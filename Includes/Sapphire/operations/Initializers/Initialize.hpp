@@ -135,12 +135,52 @@ private:
     int m_fanIn;
 };
 
+//! Initialize skips the initializers on this thread while this scope is alive
+//! Tensors created in the scope keep zeros until they are filled, which
+//! avoids initializing weights that are loaded or mapped by
+//! Util::LoadCheckpoint and Util::MapCheckpoint afterwards
+class SkipInitializationScope
+{
+public:
+    SkipInitializationScope()
+        : m_previous(m_skip())
+    {
+        m_skip() = true;
+    }
+
+    ~SkipInitializationScope()
+    {
+        m_skip() = m_previous;
+    }
+
+    SkipInitializationScope(const SkipInitializationScope& scope) = delete;
+    SkipInitializationScope& operator=(const SkipInitializationScope& scope) =
+    delete;
+
+    [[nodiscard]] static bool IsActive()
+    {
+        return m_skip();
+    }
+
+private:
+    static bool& m_skip()
+    {
+        thread_local bool skip = false;
+        return skip;
+    }
+
+    bool m_previous;
+};
+
 inline void Initialize(Tensor& tensor, std::unique_ptr<Initializer> initializer)
 {
+    if (SkipInitializationScope::IsActive())
+        return;
     auto& desc = ModelManager::CurModel().GetDescriptor(
         tensor.TensorDescriptorKey());
     auto forwardData = desc.GetForwardData();
     initializer->operator()(forwardData);
+    desc.MarkForwardDataWritten();
 }
 
 inline void InitializeGradient(Tensor& tensor,
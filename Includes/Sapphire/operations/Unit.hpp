@@ -30,12 +30,41 @@ public:
     Unit& operator=(const Unit& unit) = default;
     Unit& operator=(Unit&& unit) noexcept = default;
 
+    [[nodiscard]] const std::string& GetName() const
+    {
+        return m_name;
+    }
+
+    //! Returns trainable tensors of the unit by their names
+    [[nodiscard]] const std::unordered_map<std::string, Tensor>&
+    GetTrainableTensors() const
+    {
+        return m_trainableTensorMap;
+    }
+
+    //! Returns tensors kept by the unit that are not trained, such as running
+    //! statistics of normalization
+    //! Buffers are preserved, and saved in checkpoints with trainable tensors
+    [[nodiscard]] const std::unordered_map<std::string, Tensor>&
+    GetBufferTensors() const
+    {
+        return m_bufferTensorMap;
+    }
+
+    //! Stores trainable tensors of the unit in given type
+    //! Buffers are kept in Float32. See Tensor::ConvertTo
+    void SetWeightDataType(DataType dataType) const
+    {
+        for (const auto& [name, tensor] : m_trainableTensorMap)
+            tensor.ConvertTo(dataType);
+    }
 
 protected:
     virtual void m_checkArguments(
         std::vector<TensorUtil::TensorDescriptor*> arguments) const = 0;
     std::string m_name;
     std::unordered_map<std::string, Tensor> m_trainableTensorMap;
+    std::unordered_map<std::string, Tensor> m_bufferTensorMap;
 };
 
 //! UnitDataWrapper
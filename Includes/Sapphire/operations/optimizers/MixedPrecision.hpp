@@ -0,0 +1,63 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_OPTIMIZER_MIXED_PRECISION_HPP
+#define SAPPHIRE_OPTIMIZER_MIXED_PRECISION_HPP
+
+#include <Sapphire/operations/optimizers/Optimizer.hpp>
+
+namespace Sapphire::Optimizer
+{
+//! Keeps Float32 master copies of weights stored in Float16 or BFloat16
+//! Given optimizer updates the master copy, and the weight is rounded from it
+//! after each update. Updates smaller than precision of the weight would be
+//! lost if they were applied to the weight directly, but they accumulate in
+//! the master copy
+//! Float32 weights are given to the optimizer as they are
+//! Master copies are not saved in checkpoints. They are created again from
+//! the weights on the first update after loading
+class MixedPrecision final : public Optimizer
+{
+public:
+    //! \param optimizer : optimizer that updates Float32 weights. It must
+    //! outlive this object
+    explicit MixedPrecision(Optimizer* optimizer);
+
+    MixedPrecision(const MixedPrecision& mixedPrecision) = default;
+    MixedPrecision(MixedPrecision&& mixedPrecision) noexcept = default;
+    ~MixedPrecision() override = default;
+    MixedPrecision& operator=(const MixedPrecision& mixedPrecision) = default;
+    MixedPrecision& operator=(MixedPrecision&& mixedPrecision) noexcept =
+    default;
+
+    void operator()(TensorData& z, const TensorData& dz,
+                    std::string name) override;
+
+    void operator()(TensorData& z, const RowSparseData& dz,
+                    std::string name) override;
+
+    [[nodiscard]] std::unordered_map<std::string, std::vector<float>>
+    GetState() const override;
+
+    void SetState(const std::string& name, const float* data,
+                  std::size_t size) override;
+
+    //! Returns master copy of given weight
+    //! Throws std::invalid_argument if weight has not been updated yet
+    [[nodiscard]] const TensorData& GetMasterWeight(const TensorData& z) const;
+
+private:
+    //! Returns master copy of z, creating it on the first update
+    TensorData& m_masterWeight(const TensorData& z);
+
+    Optimizer* m_optimizer;
+    //! Master copies keyed by host data of the weights, since weights of a
+    //! unit are updated under the same name
+    std::unordered_map<const void*, TensorData> m_masterWeights;
+};
+} // namespace Sapphire::Optimizer
+
+#endif
@@ -8,6 +8,11 @@
 #define SAPPHIRE_OPTIMIZER_OPTIMIZER_HPP
 
 #include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/tensor/RowSparseData.hpp>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace Sapphire::Optimizer
 {
@@ -29,6 +34,38 @@ public:
             "Optimizer::Optimizer::operator() - Default operator should not be "
             "called");
     }
+
+    //! Updates only the rows of z that are stored in dz
+    //! Default implementation expands dz to dense gradient and invokes dense
+    //! update. Optimizers should override this to avoid dense update
+    virtual void operator()(TensorData& z, const RowSparseData& dz,
+                            std::string name)
+    {
+        TensorData dense(z.GetShape(), z.GetType(), z.GetCudaDevice());
+        std::vector<float> denseData(z.GetShape().Size(), 0.0f);
+        for (std::size_t i = 0; i < dz.NumRows(); ++i)
+            std::copy(dz.Rows.begin() + i * dz.Cols,
+                      dz.Rows.begin() + (i + 1) * dz.Cols,
+                      denseData.begin() + dz.Indices[i] * dz.Cols);
+        dense.SetMode(z.Mode());
+        dense.SetData(denseData);
+        this->operator()(z, dense, std::move(name));
+    }
+
+    //! Returns state of the optimizer that is saved in checkpoints
+    //! (e.g. hyper parameters, step counters and moment buffers by name)
+    [[nodiscard]] virtual std::unordered_map<std::string, std::vector<float>>
+    GetState() const
+    {
+        return {};
+    }
+
+    //! Restores state saved by GetState
+    //! States unknown to the optimizer are ignored
+    virtual void SetState(const std::string& name, const float* data,
+                          std::size_t size)
+    {
+    }
 };
 }
 
@@ -25,6 +25,15 @@ public:
 
     void operator()(TensorData& z, const TensorData& dz, [[maybe_unused]] std::string name) override;
 
+    void operator()(TensorData& z, const RowSparseData& dz,
+                    [[maybe_unused]] std::string name) override;
+
+    [[nodiscard]] std::unordered_map<std::string, std::vector<float>>
+    GetState() const override;
+
+    void SetState(const std::string& name, const float* data,
+                  std::size_t size) override;
+
 private:
     float m_learningRate;
 };
@@ -0,0 +1,31 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TENSOR_ROW_SPARSE_DATA_HPP
+#define SAPPHIRE_TENSOR_ROW_SPARSE_DATA_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace Sapphire::TensorUtil
+{
+//! Row sparse representation of (M x Cols) matrix on the host
+//! Only rows listed in Indices are stored. Rows holds values of stored rows
+//! contiguously in the same order as Indices. Indices are sorted and unique
+struct RowSparseData
+{
+    std::vector<std::uint32_t> Indices;
+    std::vector<float> Rows;
+    int Cols = 0;
+
+    [[nodiscard]] std::size_t NumRows() const
+    {
+        return Indices.size();
+    }
+};
+} // namespace Sapphire::TensorUtil
+
+#endif
@@ -8,6 +8,8 @@
 
 #include <Sapphire/util/Shape.hpp>
 #include <Sapphire/util/CudaDevice.hpp>
+#include <Sapphire/util/DataType.hpp>
+#include <cstdint>
 #include <memory>
 
 namespace Sapphire
@@ -27,7 +29,7 @@ public:
     Tensor(const Shape& shape, const CudaDevice& device, Type type,
            bool preserve = false);
 
-    Tensor(int descKey);
+    Tensor(std::int64_t descKey);
     ~Tensor() = default;
 
     Tensor(const Tensor& tensor) = default;
@@ -38,9 +40,9 @@ public:
 
     [[nodiscard]] Shape GetShape() const;
     [[nodiscard]] CudaDevice GetDevice() const;
-    [[nodiscard]] int TensorDescriptorKey() const;
+    [[nodiscard]] std::int64_t TensorDescriptorKey() const;
 
-    void SetDescriptorKey(int key)
+    void SetDescriptorKey(std::int64_t key)
     {
         m_tensorDescKey = key;
     }
@@ -51,6 +53,14 @@ public:
     void LoadData(const std::vector<float>& data) const;
     void LoadGradient(const std::vector<float>& data) const;
 
+    [[nodiscard]] DataType GetDataType() const;
+
+    //! Stores forward data of the tensor in given type
+    //! Gradients stay in Float32. Reduced precision weights should be
+    //! trained with Optimizer::MixedPrecision
+    //! Only available in host mode
+    void ConvertTo(DataType dataType) const;
+
     void SetDevice(CudaDevice device) const;
     void ToCuda() const;
     void ToHost() const;
@@ -62,7 +72,7 @@ public:
     void Flatten() const;
 
 private:
-    int m_tensorDescKey = -1;
+    std::int64_t m_tensorDescKey = -1;
 };
 
 
@@ -7,14 +7,29 @@
 #ifndef SAPPHIRE_TENSORUTIL_TENSOR_DATA_HPP
 #define SAPPHIRE_TENSORUTIL_TENSOR_DATA_HPP
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <Sapphire/compute/sparse/SparseMatrix.hpp>
+#include <Sapphire/util/DataType.hpp>
 #include <Sapphire/util/Shape.hpp>
 #include <Sapphire/util/CudaDevice.hpp>
 
+namespace Sapphire::Util
+{
+class MappedFile;
+}
+
 namespace Sapphire::TensorUtil
 {
+//! TensorData refers to the data through shape, strides and offset
+//! Views created with TransposeView, NarrowView, ExpandView, SqueezeView and
+//! UnSqueezeView share the allocation with the tensorData they were created
+//! from in O(1). Kernels that require contiguous data receive a contiguous
+//! copy of the view only if the view is not contiguous
+//! Elements are stored in Float32 unless other DataType is given. Float16 and
+//! BFloat16 data is available on host only, and kernels that cannot read it
+//! receive Float32 copy of it
 class TensorData
 {
 public:
@@ -23,14 +38,18 @@ public:
     TensorData(Shape shape, Type type,
                bool preserve = false);
 
-    TensorData(Shape shape, Type type, int parentDescKey,
+    TensorData(Shape shape, Type type, std::int64_t parentDescKey,
+               bool preserve = false);
+
+    //! TensorData is defined in Host only Mode storing elements in dataType
+    TensorData(Shape shape, Type type, DataType dataType,
                bool preserve = false);
     //! TensorData is configured in both Host and Cuda Mode
     TensorData(Shape shape, Type type, CudaDevice device,
                bool preserve = false);
 
     TensorData(Shape shape, Type type, CudaDevice device,
-               int parentDescKey, bool preserve = false);
+               std::int64_t parentDescKey, bool preserve = false);
 
     //! Shallow copies the internal data
     TensorData(const TensorData& tensorData) = default;
@@ -53,6 +72,39 @@ public:
     //! \param data : vector that contains data to load
     void SetData(std::vector<float> data);
 
+    //! Backs host data with a region of the mapped file instead of pool memory
+    //! Pages are read from the file on first access and shared through the
+    //! page cache with every other process mapping the same file. The mapping
+    //! must be copy-on-write, so writes to the data stay private
+    //! The region holds the data in the data type of this tensorData
+    //! If tensorData is in cuda mode, mapped data is copied to the device
+    //! Host memory held before stays in its ResourceManager pool until the
+    //! pool is cleared, so shallow copies made before mapping stay valid and
+    //! keep referring to it
+    //! \param mappedFile : mapped file holding the data. It is kept alive as
+    //! long as this tensorData or its shallow copies use it
+    //! \param byteOffset : offset of the data in the file
+    void MapHostData(std::shared_ptr<Util::MappedFile> mappedFile,
+                     std::size_t byteOffset);
+
+    //! Returns true if host data is backed by mapped file
+    [[nodiscard]] bool IsMapped() const
+    {
+        return m_mappedFile != nullptr;
+    }
+
+    //! Returns true if data is kept in preserved memory pool
+    [[nodiscard]] bool IsPreserved() const
+    {
+        return m_preserve;
+    }
+
+    //! Returns memory of this tensorData to the free pool of ResourceManager
+    //! before Clean() is called. Shallow copies and views of this tensorData
+    //! must not be used afterwards
+    //! Preserved data and data backed by mapped file are kept
+    void ReleaseMemory();
+
     //! Sets cuda device of the tensorData
     //! If TensorData was configured in host mode, tensorData will be able to use
     //! cuda mode after this function is called.
@@ -68,10 +120,78 @@ public:
     [[nodiscard]] CudaDevice GetCudaDevice() const;
 
     //! Changes shape of the tensorData
+    //! Throws if tensorData is not contiguous
     //! \param shape : shape to change
     void Reshape(const Shape& shape);
 
-    [[nodiscard]] int GetDescriptorKey() const
+    //! Returns view with last two dimensions swapped
+    //! One dimensional data is treated as (1 x N) matrix
+    [[nodiscard]] TensorData TransposeView() const;
+
+    //! Returns view of range [start, start + length) of given dimension
+    //! \param dim : index of the dimension, outermost first. Negative index
+    //! counts from the last dimension
+    [[nodiscard]] TensorData NarrowView(int dim, int start, int length) const;
+
+    //! Returns view expanded to given dimension as Shape::Expand
+    [[nodiscard]] TensorData ExpandView(int dim) const;
+
+    //! Returns view with given dimension removed if it has size 1
+    //! \param dim : index of the dimension, outermost first. Negative index
+    //! counts from the last dimension
+    [[nodiscard]] TensorData SqueezeView(int dim) const;
+
+    //! Returns view with all dimensions of size 1 removed
+    [[nodiscard]] TensorData SqueezeView() const;
+
+    //! Returns view with dimension of size 1 inserted at given index
+    //! \param dim : index of the new dimension, outermost first. Negative
+    //! index counts from the end
+    [[nodiscard]] TensorData UnSqueezeView(int dim) const;
+
+    //! Returns this tensorData if it is contiguous, or contiguous copy of it
+    //! in the same mode otherwise
+    [[nodiscard]] TensorData Contiguous() const;
+
+    //! Returns true if elements are placed in row major order without gaps
+    [[nodiscard]] bool IsContiguous() const;
+
+    //! Returns this tensorData if it is contiguous and stored in Float32, or
+    //! contiguous Float32 copy of it otherwise
+    [[nodiscard]] TensorData ContiguousFloat() const;
+
+    //! Returns true if data is contiguous and stored in Float32
+    [[nodiscard]] bool IsContiguousFloat() const;
+
+    //! Returns contiguous copy of the data stored in given type
+    //! Conversion to Float16 and BFloat16 rounds to nearest even
+    //! Only available in host mode
+    //! \param preserve : keeps the copy in preserved memory pool as weights
+    [[nodiscard]] TensorData ConvertTo(DataType dataType,
+                                       bool preserve = false) const;
+
+    [[nodiscard]] DataType GetDataType() const
+    {
+        return m_dataType;
+    }
+
+    //! Returns true if data is contiguous after swapping last two dimensions
+    //! This is the layout of TransposeView of contiguous data
+    [[nodiscard]] bool IsTransposed() const;
+
+    //! Strides of each dimension in number of elements
+    [[nodiscard]] const std::vector<int>& GetStrides() const
+    {
+        return m_strides;
+    }
+
+    //! Offset of the first element from the start of the allocation
+    [[nodiscard]] std::size_t GetOffset() const
+    {
+        return m_offset;
+    }
+
+    [[nodiscard]] std::int64_t GetDescriptorKey() const
     {
         return m_parentDescKey;
     }
@@ -157,28 +277,59 @@ public:
     //! operation units
 
     //! Deep copies tensor data from src to dst
+    //! src may be a view with any layout, while dst must be contiguous
+    //! Data is converted on host if data types of src and dst are different
     static void DeepCopy(TensorData& dst, const TensorData& src);
 
 
     //!Getters for raw pointers
+    //! Pointers refer to the first element of the view. Elements are laid
+    //! out contiguously only if IsContiguous() is true
     [[nodiscard]] const float* HostRawPtr() const
     {
-        return m_denseHost;
+        return m_denseHost ? m_denseHost + m_offset : nullptr;
     }
 
     [[nodiscard]] const float* CudaRawPtr() const
     {
-        return m_denseCuda;
+        return m_denseCuda ? m_denseCuda + m_offset : nullptr;
     }
 
     [[nodiscard]] float* HostMutableRawPtr() const
     {
-        return m_denseHost;
+        return m_denseHost ? m_denseHost + m_offset : nullptr;
     }
 
     [[nodiscard]] float* CudaMutableRawPtr() const
     {
-        return m_denseCuda;
+        return m_denseCuda ? m_denseCuda + m_offset : nullptr;
+    }
+
+    //! Getters for host data stored in Float16 or BFloat16
+    [[nodiscard]] const std::uint16_t* HostReducedRawPtr() const
+    {
+        return m_reducedHost ? m_reducedHost + m_offset : nullptr;
+    }
+
+    [[nodiscard]] std::uint16_t* HostReducedMutableRawPtr() const
+    {
+        return m_reducedHost ? m_reducedHost + m_offset : nullptr;
+    }
+
+    //! Host data in its storage type
+    //! Points to float if data type is Float32, or std::uint16_t otherwise
+    [[nodiscard]] const void* HostRawData() const
+    {
+        if (m_dataType == DataType::Float32)
+            return HostRawPtr();
+        return HostReducedRawPtr();
+    }
+
+    [[nodiscard]] void* HostMutableRawData() const
+    {
+        if (m_dataType == DataType::Float32)
+            return HostMutableRawPtr();
+        return HostReducedMutableRawPtr();
     }
 
 
@@ -200,16 +351,33 @@ private:
     //! Allocates data on the GPU with given batchSize
     void m_allocateCuda();
 
+    //! Sets strides of row major contiguous layout of current shape
+    void m_setContiguousStrides();
+
+    //! Returns view with same allocation as this tensorData
+    [[nodiscard]] TensorData m_createView(Shape shape,
+                                          std::vector<int> strides,
+                                          std::size_t offset) const;
+
     Shape m_shape;
+    std::vector<int> m_strides;
+    //! Offset of the view in number of elements
+    std::size_t m_offset = 0;
+    //! Number of elements in the allocation shared between views
+    std::size_t m_storageSize = 0;
     float* m_denseHost = nullptr;
     float* m_denseCuda = nullptr;
-    int m_parentDescKey = -1;
+    //! Host data of Float16 and BFloat16 tensorData
+    std::uint16_t* m_reducedHost = nullptr;
+    DataType m_dataType = DataType::Float32;
+    std::int64_t m_parentDescKey = -1;
 
     Type m_type = Type::Dense;
     ComputeMode m_mode = ComputeMode::Host;
 
     CudaDevice m_device;
     bool m_preserve;
+    std::shared_ptr<Util::MappedFile> m_mappedFile;
 };
 } // namespace Sapphire::TensorUtil
 
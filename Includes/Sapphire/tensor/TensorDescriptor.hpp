@@ -10,6 +10,8 @@
 #include <Sapphire/operations/Backward/BackPropWrapper.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <mutex>
 
@@ -24,11 +26,11 @@ class TensorDescriptor
 public:
     TensorDescriptor() = default;
 
-    TensorDescriptor(const Shape& shape, Type type, int key,
+    TensorDescriptor(const Shape& shape, Type type, std::int64_t key,
                      bool preserve = false);
 
     TensorDescriptor(const Shape& shape, Type type, const CudaDevice& device,
-                     int key, bool preserve = false);
+                     std::int64_t key, bool preserve = false);
 
     ~TensorDescriptor() = default;
 
@@ -53,6 +55,31 @@ public:
 
     void Reshape(Shape shape);
 
+    //! Backs forward data with region of the mapped file
+    //! See TensorData::MapHostData
+    void MapForwardData(std::shared_ptr<Util::MappedFile> mappedFile,
+                        std::size_t byteOffset);
+
+    //! Replaces forward data with its copy stored in given type
+    //! Data held before stays in its pool until the pool is cleared, as in
+    //! TensorData::MapHostData. Backward data stays in Float32
+    //! Only available in host mode
+    void ConvertForwardData(DataType dataType);
+
+    //! Increases version of the forward data
+    //! Called when forward data is written by loading data, mapping files,
+    //! initializers or optimizers. Units keeping their own copies of the
+    //! data compare versions to find out that the copies are stale
+    void MarkForwardDataWritten()
+    {
+        m_forwardDataVersion.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t GetForwardDataVersion() const
+    {
+        return m_forwardDataVersion.load(std::memory_order_relaxed);
+    }
+
     //! Moves internal TensorData to cuda
     void ToCuda();
 
@@ -68,22 +95,26 @@ public:
     //! Initializes backward data to zero
     void InitGradient();
 
+    //! Returns memory of forward and backward data to the free pool
+    //! See TensorData::ReleaseMemory
+    void ReleaseMemory();
+
     //! Add unit m_key if unit was used as output or flow-through type
     //! \param backPropWrapperKey : backPropWrapper for starting back propagation on this tensor
     //! \param location : Forward output of this tensorDescriptor is preserved
     //! if true
     void AppendOutputHistory(
-        int backPropWrapperKey, int location);
+        std::int64_t backPropWrapperKey, int location);
 
     //! Add unit key if unit was used as operand only
     //! \param tensorDescKey : m_key of the tensor that this tensor should receive
     //! gradient from
-    void AppendOperandHistory(int tensorDescKey);
+    void AppendOperandHistory(std::int64_t tensorDescKey);
 
     //! Removes the gradient input key
     //! The last history must not be output
     //! \param tensorDescKey : key of the operand target tensor to remove
-    void RemoveOperand(int tensorDescKey);
+    void RemoveOperand(std::int64_t tensorDescKey);
 
     //! Removes last history from the history list if it is operand history and history list is not empty
     void PopIfOperandHistory();
@@ -102,7 +133,7 @@ public:
     //! \return : true if ready false otherwise
     [[nodiscard]] bool IsBackPropReady() const;
 
-    std::pair<int, int>
+    std::pair<std::int64_t, int>
     GetBackPropWrapperKeyFromLastHistory()
     {
         const auto& history = m_history.back();
@@ -114,7 +145,7 @@ public:
         return !m_history.empty();
     }
 
-    [[nodiscard]] int GetKey() const
+    [[nodiscard]] std::int64_t GetKey() const
     {
         return m_key;
     }
@@ -132,7 +163,7 @@ private:
     {
         //! This constructor creates output history, where tensor was newly created
         //! This kind of history will invoke backPropWrapper
-        explicit History(int backPropWrapperKey,
+        explicit History(std::int64_t backPropWrapperKey,
                          int location)
             : IsOutput(true),
               Location(location),
@@ -176,12 +207,12 @@ private:
         History& operator=(const History& history) = delete;
 
         //! Add tensor descriptor key to receive the gradient input
-        void AddOperand(int tensorDescKey)
+        void AddOperand(std::int64_t tensorDescKey)
         {
             GradientInputTensorKeyList.emplace_back(tensorDescKey);
         }
 
-        void RemoveOperand(int tensorDescKey)
+        void RemoveOperand(std::int64_t tensorDescKey)
         {
             const auto it = std::find(
                 GradientInputTensorKeyList.begin(),
@@ -199,13 +230,14 @@ private:
         //! Location specifies which index that tensor was created
         int Location = 0;
 
-        int BackPropWrapperKey;
+        std::int64_t BackPropWrapperKey;
         //! List of the units that was as operand
-        std::list<int> GradientInputTensorKeyList;
+        std::list<std::int64_t> GradientInputTensorKeyList;
     };
 
     //! m_key to identify tensor data
-    int m_key = -1;
+    std::int64_t m_key = -1;
+    std::atomic<std::uint64_t> m_forwardDataVersion = 0;
     unsigned int m_batchSize = 0;
     bool m_trainable = true;
 
@@ -0,0 +1,163 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_CHECKPOINT_HPP
+#define SAPPHIRE_UTIL_CHECKPOINT_HPP
+
+#include <Sapphire/operations/Unit.hpp>
+#include <Sapphire/operations/optimizers/Optimizer.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/tensor/TensorDescriptor.hpp>
+#include <Sapphire/util/MappedFile.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Util
+{
+//! Checkpoint file layout
+//! [CheckpointHeader][index][payloads]
+//! Index holds one entry for each tensor, and each payload starts at
+//! CheckpointAlignment byte aligned offset so that it can be used directly
+//! from the mapped file
+constexpr std::size_t CheckpointAlignment = 64;
+
+enum class CheckpointDataType : std::uint32_t
+{
+    Float32 = 0,
+    Float16 = 1,
+    BFloat16 = 2,
+};
+
+struct CheckpointHeader
+{
+    char Magic[8];
+    std::uint32_t Version;
+    std::uint32_t NumEntries;
+    std::uint64_t IndexOffset;
+    std::uint64_t IndexSize;
+    std::uint64_t PayloadOffset;
+    std::uint64_t FileSize;
+    std::uint8_t Reserved[16];
+};
+
+static_assert(sizeof(CheckpointHeader) == 64,
+              "CheckpointHeader must be 64 bytes");
+
+struct CheckpointEntry
+{
+    std::string Name;
+    Shape TensorShape;
+    CheckpointDataType DataType = CheckpointDataType::Float32;
+    //! Offset of the payload from the beginning of the file
+    std::uint64_t Offset = 0;
+    std::uint64_t ByteSize = 0;
+};
+
+//! Collects tensors and writes them to a checkpoint file
+//! Payloads are streamed through a buffered file stream in the order they
+//! were added, without gathering them in memory
+class CheckpointWriter
+{
+public:
+    //! Adds tensor data to write
+    //! Data is written in its own data type. Views are written in row major
+    //! order of the view
+    //! Data is read when Write() is called, so it should not be modified
+    //! before that
+    void Add(std::string name, TensorUtil::TensorData tensorData);
+
+    //! Adds owned data to write
+    void Add(std::string name, Shape shape, std::vector<float> data);
+
+    //! Writes the checkpoint to temporary file, and renames it to filePath
+    //! when it is complete
+    void Write(const std::filesystem::path& filePath) const;
+
+private:
+    struct Pending
+    {
+        std::string Name;
+        Shape TensorShape;
+        TensorUtil::TensorData TensorData;
+        DataType StoredType = DataType::Float32;
+        std::vector<float> Data;
+        bool Owned = false;
+    };
+
+    std::vector<Pending> m_pending;
+};
+
+//! Opens checkpoint file with copy-on-write memory mapping
+//! Payloads are only paged in when they are loaded or accessed
+class CheckpointReader
+{
+public:
+    explicit CheckpointReader(const std::filesystem::path& filePath);
+
+    [[nodiscard]] const std::vector<CheckpointEntry>& Entries() const
+    {
+        return m_entries;
+    }
+
+    [[nodiscard]] bool Contains(const std::string& name) const;
+
+    [[nodiscard]] const CheckpointEntry& GetEntry(
+        const std::string& name) const;
+
+    //! Returns pointer to the payload inside the mapped file
+    //! Throws std::invalid_argument if the payload is not stored in Float32
+    [[nodiscard]] const float* Data(const std::string& name) const;
+
+    //! Copies the payload straight into the host buffer of tensorData, or to
+    //! the device buffer if tensorData is in Cuda mode
+    //! Payloads stored in other data type than tensorData are converted
+    //! Shape of the tensorData must match the stored shape
+    void Load(const std::string& name, TensorUtil::TensorData& tensorData) const;
+
+    //! Backs forward data of the descriptor with the payload in the mapped
+    //! file instead of copying it. The mapping stays alive while any tensor
+    //! uses it, even after this reader is destroyed
+    //! Shape and data type of the descriptor must match the stored ones
+    void Map(const std::string& name,
+             TensorUtil::TensorDescriptor& descriptor) const;
+
+private:
+    std::filesystem::path m_filePath;
+    std::shared_ptr<MappedFile> m_file;
+    std::vector<CheckpointEntry> m_entries;
+    std::unordered_map<std::string, std::size_t> m_entryMap;
+};
+
+//! Saves trainable tensors and buffers of the units, and state of the
+//! optimizer. Tensors are named "<unit name>/<tensor name>", and optimizer
+//! states are named "Optimizer/<state name>"
+void SaveCheckpoint(const std::filesystem::path& filePath,
+                    const std::vector<const Unit*>& units,
+                    const Optimizer::Optimizer* optimizer = nullptr);
+
+//! Loads trainable tensors and buffers of the units, and state of the
+//! optimizer saved by SaveCheckpoint. Units must have been created in the
+//! same order as the saved model so that their names match
+void LoadCheckpoint(const std::filesystem::path& filePath,
+                    const std::vector<Unit*>& units,
+                    Optimizer::Optimizer* optimizer = nullptr);
+
+//! Backs trainable tensors and buffers of the units with payloads of the
+//! mapped checkpoint instead of loading them
+//! Weights are paged in on first access, and processes mapping the same
+//! checkpoint share single physical copy of the weights until they are
+//! written. Suited for inference where weights are never updated
+//! Host memory the tensors held before stays in its pool until the pool is
+//! cleared. Units can be created in Initialize::SkipInitializationScope to
+//! avoid initializing weights that are replaced by the mapping
+void MapCheckpoint(const std::filesystem::path& filePath,
+                   const std::vector<Unit*>& units);
+} // namespace Sapphire::Util
+
+#endif
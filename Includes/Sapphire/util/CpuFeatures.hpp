@@ -0,0 +1,74 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_CPU_FEATURES_HPP
+#define SAPPHIRE_UTIL_CPU_FEATURES_HPP
+
+#include <string>
+
+namespace Sapphire::Util
+{
+//! Instruction set used by host kernels
+//! Levels are ordered so that each level includes the ones below it
+enum class SimdLevel
+{
+    Scalar = 0,
+    //! AVX2 with FMA and F16C
+    Avx2 = 1,
+    //! AVX-512 foundation
+    Avx512 = 2,
+};
+
+//! Features of the host cpu queried with CPUID
+struct CpuFeatures
+{
+    bool Avx = false;
+    bool Avx2 = false;
+    bool Fma = false;
+    bool Avx512F = false;
+    //! Conversions between half precision and single precision
+    bool F16c = false;
+    //! AVX-512 conversions between bfloat16 and single precision
+    bool Avx512Bf16 = false;
+    //! AVX-512 dot products of bytes accumulated in int32
+    bool Avx512Vnni = false;
+    //! OS saves YMM registers on context switch
+    bool OsYmm = false;
+    //! OS saves ZMM and opmask registers on context switch
+    bool OsZmm = false;
+
+    //! Detects features of the host cpu. Detection is done once and cached
+    static const CpuFeatures& Host();
+
+    //! Highest level supported by both the cpu and the OS
+    [[nodiscard]] SimdLevel SupportedLevel() const;
+};
+
+//! Highest level whose kernels are compiled into this binary
+SimdLevel CompiledSimdLevel();
+
+//! Level host kernels are dispatched to
+//! Resolved once on the first call as the highest level supported by the cpu
+//! and compiled into this binary. Environment variable SAPPHIRE_SIMD_LEVEL
+//! ("scalar", "avx2" or "avx512") lowers it for testing. Requests above the
+//! available level are clamped with a warning
+SimdLevel GetSimdLevel();
+
+//! Overrides the dispatched level
+//! Throws std::invalid_argument if level is not available on this machine
+void SetSimdLevel(SimdLevel level);
+
+//! Returns true if kernels of the level can run on this machine
+bool IsSimdLevelAvailable(SimdLevel level);
+
+std::string SimdLevelToString(SimdLevel level);
+
+//! Parses "scalar", "avx2" or "avx512" (case insensitive)
+//! Throws std::invalid_argument on unknown names
+SimdLevel SimdLevelFromString(const std::string& name);
+} // namespace Sapphire::Util
+
+#endif
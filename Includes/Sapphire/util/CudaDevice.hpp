@@ -7,7 +7,6 @@
 #ifndef Sapphire_DEVICE_HPP
 #define Sapphire_DEVICE_HPP
 
-#include <cuda_runtime.h>
 #include <stdexcept>
 #include <string>
 
@@ -50,12 +49,8 @@ public:
         return m_cudaCapability;
     }
 
-    static int GetAvailableCudaDeviceCount()
-    {
-        int count;
-        cudaGetDeviceCount(&count);
-        return count;
-    }
+    //! Always returns 0 if Sapphire was built without cuda
+    static int GetAvailableCudaDeviceCount();
 
 private:
     int m_id = -1;
@@ -8,10 +8,14 @@
 #define SAPPHIRE_UTIL_BINARY_LOADER_HPP
 
 #include <Sapphire/util/DataLoader/DataLoader.hpp>
+#include <Sapphire/util/MappedFile.hpp>
+#include <Sapphire/compute/cudaUtil/Memory.hpp>
 #include <Sapphire/tensor/Tensor.hpp>
-#include <random>
-#include <fstream>
+#include <Sapphire/Model.hpp>
+#include <algorithm>
+#include <cstring>
 #include <functional>
+#include <type_traits>
 
 namespace Sapphire::Util
 {
@@ -26,43 +30,189 @@ std::vector<T> GetDataVector(char* data, std::size_t fileByteSize)
     return dataVector;
 }
 
+//! Converts src to float and normalizes in single pass
+//! dst[i] = float(src[i]) * scale + shift
+template <typename T>
+void ConvertAndNormalize(float* dst, const T* src, std::size_t size,
+                         float scale, float shift)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (scale == 1.0f && shift == 0.0f)
+        {
+            std::memcpy(dst, src, size * sizeof(float));
+            return;
+        }
+    }
+
+    for (std::size_t i = 0; i < size; ++i)
+        dst[i] = static_cast<float>(src[i]) * scale + shift;
+}
+
+//! Loads fixed size records from binary file
+//! The file is memory mapped, so only the pages of the accessed records are
+//! kept resident. All offsets and sizes are given in number of elements of T
 template <typename T>
 class BinaryLoader : public DataLoader<T>
 {
 public:
+    //! \param startOffset : offset of the first record
+    //! \param totalSize : number of elements in the region holding the
+    //! records. Records outside of this region cannot be accessed
+    //! \param batchSize : default batch size
+    //! \param batchStride : distance between start of two adjacent records
     BinaryLoader(std::filesystem::path filePath, std::size_t startOffset,
-                 std::size_t totalByteSize,
+                 std::size_t totalSize,
                  std::size_t batchSize,
                  std::size_t batchStride)
         : DataLoader<T>(std::move(filePath)),
           m_batchSize(batchSize),
-          m_totalByteSize(totalByteSize),
+          m_totalSize(totalSize),
           m_startOffset(startOffset),
           m_batchStride(batchStride),
-          m_gen(m_rd()),
-          m_dist(0, m_batchSize - 1)
+          m_file(DataLoader<T>::m_filePath)
+    {
+        m_fileSize = m_file.Size() / sizeof(T);
+        if (m_startOffset > m_fileSize)
+            throw std::invalid_argument(
+                "BinaryLoader - Start offset exceeds file size (" +
+                DataLoader<T>::m_filePath.string() + ")");
+        //! Records are usually accessed in shuffled order
+        m_file.Advise(MappedFile::AccessPattern::Random);
+    }
+
+    virtual ~BinaryLoader()
+    {
+        if (m_stagingBuffer != nullptr)
+            Compute::Cuda::CudaFreeHost(m_stagingBuffer);
+    }
+
+    BinaryLoader(const BinaryLoader& binaryLoader) = delete;
+    BinaryLoader& operator=(const BinaryLoader& binaryLoader) = delete;
 
+    //! Returns typed pointer to the first record in the mapped file
+    [[nodiscard]] const T* Data() const
     {
-        std::ifstream is(DataLoader<T>::m_filePath, std::ifstream::binary);
-        if (is)
+        return reinterpret_cast<const T*>(m_file.Data()) + m_startOffset;
+    }
+
+    //! Returns number of elements from the first record to the end of region
+    [[nodiscard]] std::size_t Size() const
+    {
+        return std::min(m_totalSize, m_fileSize - m_startOffset);
+    }
+
+    //! Number of records available
+    [[nodiscard]] std::size_t NumRecords() const
+    {
+        return m_batchStride == 0 ? 0 : Size() / m_batchStride;
+    }
+
+    //! Default batch size given at construction
+    [[nodiscard]] std::size_t BatchSize() const
+    {
+        return m_batchSize;
+    }
+
+    //! Copies elements [firstIdx, lastIdx] of each record in batchIndices to
+    //! dst contiguously
+    void Gather(T* dst, const std::vector<std::size_t>& batchIndices,
+                std::size_t firstIdx, std::size_t lastIdx) const
+    {
+        const auto inputSizePerBatch = lastIdx - firstIdx + 1;
+        for (std::size_t batchIdx = 0; batchIdx < batchIndices.size();
+             ++batchIdx)
+            std::memcpy(dst + batchIdx * inputSizePerBatch,
+                        m_recordPtr(batchIndices[batchIdx], firstIdx,
+                                    lastIdx),
+                        inputSizePerBatch * sizeof(T));
+    }
+
+    //! Gathers records and converts them to normalized float in single pass
+    //! dst = float(record) * scale + shift
+    void GatherNormalized(float* dst,
+                          const std::vector<std::size_t>& batchIndices,
+                          std::size_t firstIdx, std::size_t lastIdx,
+                          float scale, float shift) const
+    {
+        const auto inputSizePerBatch = lastIdx - firstIdx + 1;
+        for (std::size_t batchIdx = 0; batchIdx < batchIndices.size();
+             ++batchIdx)
+            ConvertAndNormalize(dst + batchIdx * inputSizePerBatch,
+                                m_recordPtr(batchIndices[batchIdx], firstIdx,
+                                            lastIdx),
+                                inputSizePerBatch, scale, shift);
+    }
+
+    //! Gathers records of the batch at given step of the sampler
+    //! \return : number of records in the batch
+    std::size_t GatherBatch(T* dst, std::size_t step, std::size_t firstIdx,
+                            std::size_t lastIdx) const
+    {
+        std::vector<std::size_t> batchIndices;
+        DataLoader<T>::GetSampler().Step(step, batchIndices);
+        Gather(dst, batchIndices, firstIdx, lastIdx);
+        return batchIndices.size();
+    }
+
+    //! Gathers and normalizes records of the batch at given step of the
+    //! sampler
+    //! \return : number of records in the batch
+    std::size_t GatherNormalizedBatch(float* dst, std::size_t step,
+                                      std::size_t firstIdx,
+                                      std::size_t lastIdx, float scale,
+                                      float shift) const
+    {
+        std::vector<std::size_t> batchIndices;
+        DataLoader<T>::GetSampler().Step(step, batchIndices);
+        GatherNormalized(dst, batchIndices, firstIdx, lastIdx, scale, shift);
+        return batchIndices.size();
+    }
+
+    //! Loads records directly to the memory of the tensor without
+    //! intermediate buffers. On Cuda, records are staged in page-locked
+    //! host buffer before they are copied to the device
+    //! Tensor size must be equal to (batchIndices.size() * record size)
+    void LoadData(const Tensor& tensor,
+                  const std::vector<std::size_t>& batchIndices,
+                  std::size_t firstIdx, std::size_t lastIdx,
+                  float scale = 1.0f, float shift = 0.0f)
+    {
+        const auto size = batchIndices.size() * (lastIdx - firstIdx + 1);
+        if (static_cast<std::size_t>(tensor.Size()) != size)
+            throw std::invalid_argument(
+                "BinaryLoader::LoadData - Tensor size (" +
+                std::to_string(tensor.Size()) +
+                ") does not match size of the batch (" + std::to_string(size) +
+                ")");
+
+        auto tensorData = ModelManager::CurModel()
+                          .GetDescriptor(tensor.TensorDescriptorKey())
+                          .GetForwardData();
+
+        if (tensorData.Mode() == ComputeMode::Host)
         {
-            is.seekg(0, is.end);
-            std::size_t size = is.tellg();
-            is.seekg(0, is.beg);
-            auto* buffer = static_cast<char*>(malloc(size));
-            is.read(buffer, size);
-            is.close();
-
-            auto vector = GetDataVector<T>(buffer, size);
-            m_fileData = std::move(vector);
-            free(buffer);
+            GatherNormalized(tensorData.HostMutableRawPtr(), batchIndices,
+                             firstIdx, lastIdx, scale, shift);
+            return;
         }
-        else
-            throw std::runtime_error("BinaryLoader - Could not open file (" +
-                                     filePath.string() + ")");
+
+        GatherNormalized(m_getStagingBuffer(size), batchIndices, firstIdx,
+                         lastIdx, scale, shift);
+        Compute::Cuda::CopyHostToDevice(
+            tensorData.CudaMutableRawPtr(), m_stagingBuffer,
+            static_cast<unsigned int>(size * sizeof(float)));
     }
 
-    virtual ~BinaryLoader() = default;
+    //! Loads records of the batch at given step of the sampler
+    void LoadBatch(const Tensor& tensor, std::size_t step,
+                   std::size_t firstIdx, std::size_t lastIdx,
+                   float scale = 1.0f, float shift = 0.0f)
+    {
+        std::vector<std::size_t> batchIndices;
+        DataLoader<T>::GetSampler().Step(step, batchIndices);
+        LoadData(tensor, batchIndices, firstIdx, lastIdx, scale, shift);
+    }
 
     void LoadData(const Tensor& tensor, std::vector<std::size_t> batchIndices,
                   std::size_t firstIdx, std::size_t lastIdx,
@@ -72,28 +222,51 @@ public:
         const auto batchSize = batchIndices.size();
 
         std::vector<T> data(batchSize * inputSizePerBatch);
+        Gather(data.data(), batchIndices, firstIdx, lastIdx);
+        tensor.LoadData(preprocess(std::move(data)));
+    }
+
+    //! Releases resident pages of the mapped file
+    //! Useful after a full pass over the dataset
+    void ReleaseResidentPages() const
+    {
+        m_file.Release(0, m_file.Size());
+    }
 
-        for (std::size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+private:
+    const T* m_recordPtr(std::size_t recordIdx, std::size_t firstIdx,
+                         std::size_t lastIdx) const
+    {
+        const auto recordOffset = recordIdx * m_batchStride;
+        if (firstIdx > lastIdx || recordOffset + lastIdx >= Size())
+            throw std::out_of_range(
+                "BinaryLoader - Record (" + std::to_string(recordIdx) +
+                ") with range [" + std::to_string(firstIdx) + ", " +
+                std::to_string(lastIdx) + "] exceeds the file");
+        return Data() + recordOffset + firstIdx;
+    }
+
+    float* m_getStagingBuffer(std::size_t size)
+    {
+        if (size > m_stagingBufferSize)
         {
-            for (std::size_t i = 0; i < inputSizePerBatch; ++i)
-            {
-                const auto fileIdx =
-                    m_startOffset + batchIndices.at(batchIdx) * m_batchStride +
-                    firstIdx + i;
-                data.at(batchIdx * inputSizePerBatch + i) = m_fileData.at(
-                    fileIdx);
-            }
+            if (m_stagingBuffer != nullptr)
+                Compute::Cuda::CudaFreeHost(m_stagingBuffer);
+            m_stagingBuffer = nullptr;
+            Compute::Cuda::CudaMallocHost(
+                reinterpret_cast<void**>(&m_stagingBuffer),
+                size * sizeof(float));
+            m_stagingBufferSize = size;
         }
-        tensor.LoadData(preprocess(data));
+        return m_stagingBuffer;
     }
 
-private:
-    std::size_t m_batchSize, m_totalByteSize;
+    std::size_t m_batchSize, m_totalSize;
     std::size_t m_startOffset, m_batchStride;
-    std::random_device m_rd;
-    std::mt19937 m_gen;
-    std::uniform_int_distribution<int> m_dist;
-    std::vector<T> m_fileData;
+    MappedFile m_file;
+    std::size_t m_fileSize = 0;
+    float* m_stagingBuffer = nullptr;
+    std::size_t m_stagingBufferSize = 0;
 };
 }
 
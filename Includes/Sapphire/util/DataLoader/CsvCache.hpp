@@ -0,0 +1,158 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_CSV_CACHE_HPP
+#define SAPPHIRE_UTIL_CSV_CACHE_HPP
+
+#include <Sapphire/util/DataLoader/BinaryLoader.hpp>
+#include <Sapphire/util/DataLoader/CsvLoader.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace Sapphire::Util
+{
+//! Header of the binary cache of parsed csv file
+//! Parsed elements are stored right after the header as (NumRows x NumCols)
+//! row-major array of the element type, so the cache can be opened directly
+//! by BinaryLoader
+struct CsvCacheHeader
+{
+    char Magic[8];
+    std::uint32_t Version;
+    std::uint32_t ElementSize;
+    //! 0 : unsigned integer, 1 : signed integer, 2 : floating point
+    std::uint32_t ElementType;
+    std::uint32_t Reserved0;
+    std::uint64_t NumRows;
+    std::uint64_t NumCols;
+    //! Size of the source csv file. Used to detect stale caches
+    std::uint64_t SourceSize;
+    std::uint8_t Reserved[16];
+};
+
+static_assert(sizeof(CsvCacheHeader) == 64,
+              "CsvCacheHeader must be 64 bytes");
+
+constexpr char CsvCacheMagic[8] = "SPHRCSV";
+constexpr std::uint32_t CsvCacheVersion = 1;
+
+template <typename T>
+constexpr std::uint32_t CsvCacheElementType()
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return 2;
+    else if constexpr (std::is_signed_v<T>)
+        return 1;
+    else
+        return 0;
+}
+
+//! Writes parsed elements of the loader to binary cache file
+//! The cache is written to temporary file first, and renamed when it is
+//! complete so that interrupted conversions never leave a valid-looking cache
+template <typename T>
+void WriteCsvCache(const CsvLoader<T>& csvLoader,
+                   const std::filesystem::path& csvPath,
+                   const std::filesystem::path& cachePath)
+{
+    static_assert(sizeof(CsvCacheHeader) % sizeof(T) == 0,
+                  "Element size must divide the header size");
+
+    CsvCacheHeader header{};
+    std::memcpy(header.Magic, CsvCacheMagic, sizeof(header.Magic));
+    header.Version = CsvCacheVersion;
+    header.ElementSize = sizeof(T);
+    header.ElementType = CsvCacheElementType<T>();
+    header.NumRows = csvLoader.GetLineSize();
+    header.NumCols = csvLoader.GetColumnSize();
+    header.SourceSize = std::filesystem::file_size(csvPath);
+
+    auto tempPath = cachePath;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            throw std::runtime_error("WriteCsvCache - Could not open file (" +
+                                     tempPath.string() + ")");
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(csvLoader.Data().data()),
+                   static_cast<std::streamsize>(csvLoader.Data().size() *
+                                                sizeof(T)));
+        if (!file.good())
+            throw std::runtime_error(
+                "WriteCsvCache - Failed to write file (" + tempPath.string() +
+                ")");
+    }
+    std::filesystem::rename(tempPath, cachePath);
+}
+
+//! Reads header of the cache file
+//! \return : header if the cache exists and matches the element type
+template <typename T>
+std::optional<CsvCacheHeader> ReadCsvCacheHeader(
+    const std::filesystem::path& cachePath)
+{
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file.is_open())
+        return std::nullopt;
+
+    CsvCacheHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good() ||
+        std::memcmp(header.Magic, CsvCacheMagic, sizeof(header.Magic)) != 0 ||
+        header.Version != CsvCacheVersion || header.ElementSize != sizeof(T) ||
+        header.ElementType != CsvCacheElementType<T>())
+        return std::nullopt;
+
+    const auto expectedSize =
+        sizeof(header) + header.NumRows * header.NumCols * sizeof(T);
+    if (std::filesystem::file_size(cachePath) != expectedSize)
+        return std::nullopt;
+    return header;
+}
+
+//! Opens binary cache of the csv file with BinaryLoader
+//! If the cache does not exist or is older than the csv file, the csv file is
+//! parsed and the cache is (re)written. Later runs map the cache directly
+//! without parsing. Each line of the csv file becomes one record
+//! \param csvPath : csv file to load. Cache is used as is if this does not
+//! exist
+//! \param cachePath : path of the binary cache
+//! \param batchSize : default batch size of the loader
+//! \param numThreads : number of threads used for parsing
+template <typename T>
+std::unique_ptr<BinaryLoader<T>> OpenCsvCache(
+    const std::filesystem::path& csvPath,
+    const std::filesystem::path& cachePath, std::size_t batchSize,
+    unsigned int numThreads = 0)
+{
+    auto header = ReadCsvCacheHeader<T>(cachePath);
+    if (std::filesystem::exists(csvPath) &&
+        (!header ||
+         header->SourceSize != std::filesystem::file_size(csvPath) ||
+         std::filesystem::last_write_time(cachePath) <
+         std::filesystem::last_write_time(csvPath)))
+    {
+        const CsvLoader<T> csvLoader(csvPath, numThreads);
+        WriteCsvCache(csvLoader, csvPath, cachePath);
+        header = ReadCsvCacheHeader<T>(cachePath);
+    }
+
+    if (!header)
+        throw std::runtime_error("OpenCsvCache - Could not open cache (" +
+                                 cachePath.string() + ")");
+
+    return std::make_unique<BinaryLoader<T>>(
+        cachePath, sizeof(CsvCacheHeader) / sizeof(T),
+        header->NumRows * header->NumCols, batchSize, header->NumCols);
+}
+} // namespace Sapphire::Util
+
+#endif
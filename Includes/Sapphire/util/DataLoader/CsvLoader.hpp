@@ -8,15 +8,19 @@
 #define SAPPHIRE_UTIL_CSV_LOADER_HPP
 
 #include <Sapphire/util/DataLoader/DataLoader.hpp>
+#include <Sapphire/util/MappedFile.hpp>
 #include <Sapphire/tensor/Tensor.hpp>
+#include <algorithm>
+#include <future>
 #include <iterator>
+#include <thread>
 #include <vector>
 #include <deque>
 #include <string>
-#include <random>
 #include <charconv>
 #include <fstream>
 #include <functional>
+#include <utility>
 
 namespace Sapphire::Util
 {
@@ -79,49 +83,139 @@ private:
     std::istream& stream;
 };
 
+//! Splits the range into at most numChunks chunks. Every chunk except the
+//! last one ends right after a newline, so lines are never split
+//! \return : offsets of the chunk boundaries including 0 and size
+std::vector<std::size_t> SplitCsvChunks(const char* data, std::size_t size,
+                                        std::size_t numChunks);
+
+//! Calls func(lineBegin, lineEnd) for every non-empty line in [begin, end)
+//! Line endings ('\n' or "\r\n") are not included in the line
+template <typename Func>
+void ForEachCsvLine(const char* begin, const char* end, Func func)
+{
+    while (begin < end)
+    {
+        const auto* lineEnd = std::find(begin, end, '\n');
+        const auto* next = lineEnd == end ? end : lineEnd + 1;
+        if (lineEnd != begin && *(lineEnd - 1) == '\r')
+            --lineEnd;
+        if (lineEnd != begin)
+            func(begin, lineEnd);
+        begin = next;
+    }
+}
+
+//! Returns [lineBegin, lineEnd) of the first non-empty line in [begin, end),
+//! or (end, end) if every line is empty. Scanning stops at the first line
+//! terminator after it
+inline std::pair<const char*, const char*> FirstCsvLine(const char* begin,
+                                                        const char* end)
+{
+    while (begin < end)
+    {
+        const auto* lineEnd = std::find(begin, end, '\n');
+        const auto* next = lineEnd == end ? end : lineEnd + 1;
+        if (lineEnd != begin && *(lineEnd - 1) == '\r')
+            --lineEnd;
+        if (lineEnd != begin)
+            return { begin, lineEnd };
+        begin = next;
+    }
+    return { end, end };
+}
+
+//! Loads whole csv file into single typed buffer of (lines x columns)
+//! The file is memory mapped and split into chunks on line boundaries, which
+//! are parsed concurrently straight into the buffer. Fields that are not
+//! numbers (e.g. header line) are loaded as zero
+//! Empty lines are skipped, and every other line must have same number of
+//! fields as the first line
 template <typename T>
 class CsvLoader : public DataLoader<T>
 {
 public:
-    CsvLoader(std::filesystem::path filePath)
-        : DataLoader<T>(std::move(filePath)),
-          m_gen(m_rd())
+    //! \param numThreads : number of threads used for parsing. 0 selects
+    //! number of hardware threads
+    CsvLoader(std::filesystem::path filePath, unsigned int numThreads = 0)
+        : DataLoader<T>(std::move(filePath))
     {
-        std::ifstream file;
-        file.open(DataLoader<T>::m_filePath);
-        if (file.is_open())
-        {
-            for (auto& row : CSVRange(file))
-            {
-                m_csvRows.emplace_back(row);
-            }
-            file.close();
-        }
-        else
-            throw std::runtime_error("CsvLoader - Could not open file (" +
-                                     filePath.string() + ")");
+        const MappedFile file(DataLoader<T>::m_filePath);
+        file.Advise(MappedFile::AccessPattern::Sequential);
+        const auto* data = file.Data();
+        const auto* end = data + file.Size();
+
+        const auto [firstLine, firstLineEnd] = FirstCsvLine(data, end);
+        if (firstLine == end)
+            return;
+        m_numColumns = std::count(firstLine, firstLineEnd, ',') + 1;
+
+        if (numThreads == 0)
+            numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const auto boundaries =
+            SplitCsvChunks(data, file.Size(), numThreads);
+        const auto numChunks = boundaries.size() - 1;
+
+        //! First pass counts lines of each chunk so that every chunk knows
+        //! where to write in the buffer
+        std::vector<std::size_t> lineOffsets(numChunks + 1, 0);
+        m_forEachChunk(numChunks, [&](std::size_t chunkIdx) {
+            std::size_t numLines = 0;
+            ForEachCsvLine(data + boundaries[chunkIdx],
+                           data + boundaries[chunkIdx + 1],
+                           [&numLines](const char*, const char*) {
+                               ++numLines;
+                           });
+            lineOffsets[chunkIdx + 1] = numLines;
+        });
+        for (std::size_t chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+            lineOffsets[chunkIdx + 1] += lineOffsets[chunkIdx];
+
+        m_numLines = lineOffsets.back();
+        m_data.resize(m_numLines * m_numColumns);
+
+        m_forEachChunk(numChunks, [&](std::size_t chunkIdx) {
+            auto lineIdx = lineOffsets[chunkIdx];
+            ForEachCsvLine(data + boundaries[chunkIdx],
+                           data + boundaries[chunkIdx + 1],
+                           [this, &lineIdx](const char* begin,
+                                            const char* lineEnd) {
+                               m_parseLine(m_data.data() +
+                                           lineIdx * m_numColumns,
+                                           begin, lineEnd, lineIdx);
+                               ++lineIdx;
+                           });
+        });
+    }
+
+    //! Returns parsed elements of given line
+    [[nodiscard]] const T* Row(std::size_t lineIdx) const
+    {
+        if (lineIdx >= m_numLines)
+            throw std::out_of_range(
+                "CsvLoader::Row - line index (" + std::to_string(lineIdx) +
+                ") exceeds number of rows in the file (" +
+                std::to_string(m_numLines) + ")");
+        return m_data.data() + lineIdx * m_numColumns;
+    }
+
+    //! Returns buffer of every parsed element in row-major order
+    [[nodiscard]] const std::vector<T>& Data() const
+    {
+        return m_data;
     }
 
     void LoadData(const Tensor& tensor, std::size_t lineIdx,
                   std::size_t firstElemIdx, std::size_t lastElemIdx)
     {
-        if (lineIdx >= m_csvRows.size())
+        if (lineIdx >= m_numLines)
             throw std::invalid_argument(
                 "CsvLoader::LoadData - line index (" + std::to_string(lineIdx) +
                 ") exceeds number of rows in the file (" +
-                std::to_string(m_csvRows.size()) + ")");
-        const auto csvRow = m_csvRows.at(lineIdx);
-        const auto size = tensor.Size();
-        std::vector<float> data(size);
-        for (std::size_t i = 0; i <= lastElemIdx - firstElemIdx; ++i)
-        {
-            T value = static_cast<T>(0.0f);
-            const auto elemIdx = i + firstElemIdx;
-            std::string_view str = csvRow[elemIdx];
-            std::from_chars(str.data(), str.data() + str.size(),
-                            value);
-            data[i] = static_cast<float>(value);
-        }
+                std::to_string(m_numLines) + ")");
+        std::vector<float> data(tensor.Size());
+        GatherNormalized(data.data(), { lineIdx }, firstElemIdx, lastElemIdx,
+                         1.0f, 0.0f);
         tensor.LoadData(data);
     }
 
@@ -132,32 +226,138 @@ public:
         const auto inputSizePerBatch = lastIdx - firstIdx + 1;
         const auto batchSize = lineIndices.size();
         std::vector<T> data(batchSize * inputSizePerBatch);
+        Gather(data.data(), lineIndices, firstIdx, lastIdx);
+        tensor.LoadData(preprocess(std::move(data)));
+    }
 
-        for (std::size_t batchIdx = 0;
-             batchIdx < lineIndices.size(); ++batchIdx)
+    //! Copies elements [firstIdx, lastIdx] of each line in lineIndices to dst
+    //! This does not modify the loader, so it can be called concurrently
+    void Gather(T* dst, const std::vector<std::size_t>& lineIndices,
+                std::size_t firstIdx, std::size_t lastIdx) const
+    {
+        const auto inputSizePerBatch = lastIdx - firstIdx + 1;
+        for (std::size_t batchIdx = 0; batchIdx < lineIndices.size();
+             ++batchIdx)
         {
-            const auto csvRow = m_csvRows.at(lineIndices.at(batchIdx));
+            const auto* src = m_rangePtr(lineIndices[batchIdx], firstIdx,
+                                         lastIdx);
+            std::copy(src, src + inputSizePerBatch,
+                      dst + batchIdx * inputSizePerBatch);
+        }
+    }
+
+    //! Converts and normalizes elements in single pass
+    //! dst = float(element) * scale + shift
+    void GatherNormalized(float* dst,
+                          const std::vector<std::size_t>& lineIndices,
+                          std::size_t firstIdx, std::size_t lastIdx,
+                          float scale, float shift) const
+    {
+        const auto inputSizePerBatch = lastIdx - firstIdx + 1;
+        for (std::size_t batchIdx = 0; batchIdx < lineIndices.size();
+             ++batchIdx)
+        {
+            const auto* src = m_rangePtr(lineIndices[batchIdx], firstIdx,
+                                         lastIdx);
             for (std::size_t i = 0; i < inputSizePerBatch; ++i)
-            {
-                T value = static_cast<T>(0.0f);
-                const auto elemIdx = i + firstIdx;
-                std::string_view str = csvRow[elemIdx];
-                std::from_chars(str.data(), str.data() + str.size(), value);
-                data[batchIdx * inputSizePerBatch + i] = value;
-            }
+                dst[batchIdx * inputSizePerBatch + i] =
+                    static_cast<float>(src[i]) * scale + shift;
         }
-        tensor.LoadData(preprocess(data));
+    }
+
+    //! Gathers elements of the lines in the batch at given step of the
+    //! sampler
+    //! \return : number of lines in the batch
+    std::size_t GatherBatch(T* dst, std::size_t step, std::size_t firstIdx,
+                            std::size_t lastIdx) const
+    {
+        std::vector<std::size_t> lineIndices;
+        DataLoader<T>::GetSampler().Step(step, lineIndices);
+        Gather(dst, lineIndices, firstIdx, lastIdx);
+        return lineIndices.size();
+    }
+
+    //! Gathers and normalizes elements of the lines in the batch at given step
+    //! of the sampler
+    //! \return : number of lines in the batch
+    std::size_t GatherNormalizedBatch(float* dst, std::size_t step,
+                                      std::size_t firstIdx,
+                                      std::size_t lastIdx, float scale,
+                                      float shift) const
+    {
+        std::vector<std::size_t> lineIndices;
+        DataLoader<T>::GetSampler().Step(step, lineIndices);
+        GatherNormalized(dst, lineIndices, firstIdx, lastIdx, scale, shift);
+        return lineIndices.size();
     }
 
     [[nodiscard]] std::size_t GetLineSize() const
     {
-        return m_csvRows.size();
+        return m_numLines;
+    }
+
+    [[nodiscard]] std::size_t GetColumnSize() const
+    {
+        return m_numColumns;
     }
 
 private:
-    std::random_device m_rd;
-    std::mt19937 m_gen;
-    std::deque<CSVRow> m_csvRows;
+    //! Runs func(chunkIdx) for every chunk on its own thread
+    //! Rethrows the first exception thrown by func
+    template <typename Func>
+    static void m_forEachChunk(std::size_t numChunks, Func func)
+    {
+        std::vector<std::future<void>> futures;
+        futures.reserve(numChunks);
+        for (std::size_t chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+            futures.emplace_back(
+                std::async(std::launch::async, func, chunkIdx));
+        for (auto& future : futures)
+            future.get();
+    }
+
+    void m_parseLine(T* dst, const char* begin, const char* end,
+                     std::size_t lineIdx) const
+    {
+        std::size_t column = 0;
+        while (true)
+        {
+            const auto* fieldEnd = std::find(begin, end, ',');
+            if (column < m_numColumns)
+            {
+                T value = static_cast<T>(0);
+                std::from_chars(begin, fieldEnd, value);
+                dst[column] = value;
+            }
+            ++column;
+            if (fieldEnd == end)
+                break;
+            begin = fieldEnd + 1;
+        }
+
+        if (column != m_numColumns)
+            throw std::runtime_error(
+                "CsvLoader - Line (" + std::to_string(lineIdx) + ") has " +
+                std::to_string(column) + " fields, but expected " +
+                std::to_string(m_numColumns) + " (" +
+                DataLoader<T>::m_filePath.string() + ")");
+    }
+
+    const T* m_rangePtr(std::size_t lineIdx, std::size_t firstIdx,
+                        std::size_t lastIdx) const
+    {
+        if (lineIdx >= m_numLines || firstIdx > lastIdx ||
+            lastIdx >= m_numColumns)
+            throw std::out_of_range(
+                "CsvLoader - Line (" + std::to_string(lineIdx) +
+                ") with range [" + std::to_string(firstIdx) + ", " +
+                std::to_string(lastIdx) + "] exceeds the file");
+        return m_data.data() + lineIdx * m_numColumns + firstIdx;
+    }
+
+    std::size_t m_numLines = 0;
+    std::size_t m_numColumns = 0;
+    std::vector<T> m_data;
 };
 }
 
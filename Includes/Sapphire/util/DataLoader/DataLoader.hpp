@@ -7,7 +7,10 @@
 #ifndef SAPPHIRE_UTIL_DATA_LOADER_HPP
 #define SAPPHIRE_UTIL_DATA_LOADER_HPP
 
+#include <Sapphire/util/DataLoader/Sampler.hpp>
 #include <filesystem>
+#include <memory>
+#include <stdexcept>
 
 namespace Sapphire::Util
 {
@@ -20,8 +23,24 @@ public:
     {
     }
 
+    //! Sets sampler that decides records of each batch
+    //! Loaders gather batches by step index using this sampler
+    void SetSampler(std::shared_ptr<Sampler> sampler)
+    {
+        m_sampler = std::move(sampler);
+    }
+
+    [[nodiscard]] const Sampler& GetSampler() const
+    {
+        if (!m_sampler)
+            throw std::runtime_error(
+                "DataLoader::GetSampler - Sampler has not been set");
+        return *m_sampler;
+    }
+
 protected:
     std::filesystem::path m_filePath;
+    std::shared_ptr<Sampler> m_sampler;
 };
 }
 
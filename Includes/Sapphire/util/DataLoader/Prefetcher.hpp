@@ -0,0 +1,123 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_PREFETCHER_HPP
+#define SAPPHIRE_UTIL_PREFETCHER_HPP
+
+#include <Sapphire/tensor/Tensor.hpp>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Util
+{
+//! Loads batches on background worker threads while the training thread
+//! computes on the current batch
+//! Prefetcher owns (prefetchDepth) sets of preserved input tensors. Each set
+//! is filled by workers, handed to the training thread by Next(), and reused
+//! when Next() is called again. Depth of 2 gives double buffering, and depth of
+//! 3 gives triple buffering
+//! Batches are always returned in order of their index regardless of which
+//! worker has filled them
+//! Batches of Cuda tensors are filled in page-locked staging buffers, and
+//! uploaded to the device by the worker that filled them
+class Prefetcher
+{
+public:
+    //! Fills host buffers of the batch with given index
+    //! buffers[i] points to (shapes[i].Size()) floats for i-th input tensor
+    //! This is called concurrently from worker threads, so it must not access
+    //! Model, Tensor or anything that is not thread safe
+    using FillFunction =
+    std::function<void(std::size_t batchIdx,
+                       const std::vector<float*>& buffers)>;
+
+    //! Creates input tensors on the current model
+    //! \param shapes : shapes of input tensors of a batch
+    //! \param device : device of the input tensors
+    //! \param mode : compute mode of the input tensors
+    //! \param numBatches : total number of batches to load
+    //! \param fill : function that loads a batch
+    //! \param numWorkers : number of worker threads
+    //! \param prefetchDepth : number of batches that can be in flight
+    Prefetcher(std::vector<Shape> shapes, const CudaDevice& device,
+               ComputeMode mode, std::size_t numBatches, FillFunction fill,
+               int numWorkers = 1, int prefetchDepth = 2);
+    ~Prefetcher();
+
+    Prefetcher(const Prefetcher& prefetcher) = delete;
+    Prefetcher(Prefetcher&& prefetcher) noexcept = delete;
+    Prefetcher& operator=(const Prefetcher& prefetcher) = delete;
+    Prefetcher& operator=(Prefetcher&& prefetcher) noexcept = delete;
+
+    //! Starts worker threads
+    void Start();
+
+    //! Stops and joins worker threads. Batches that were not consumed are
+    //! discarded
+    void Stop();
+
+    //! Returns input tensors of the next batch. Waits if it is not ready yet
+    //! Tensors returned by the previous call are recycled for loading, so they
+    //! should not be used after this call
+    //! Rethrows exception thrown by the fill function
+    //! \return : input tensors in same order as shapes. Empty if every batch
+    //! has been consumed
+    std::vector<Tensor> Next();
+
+    [[nodiscard]] std::size_t NumBatches() const
+    {
+        return m_numBatches;
+    }
+
+private:
+    struct Slot
+    {
+        std::vector<Tensor> Tensors;
+        std::vector<TensorUtil::TensorData> TensorData;
+        //! Page-locked host buffers for Cuda tensors. Host tensors are filled
+        //! directly
+        std::vector<float*> Staging;
+        std::vector<float*> Buffers;
+    };
+
+    void m_workerLoop();
+
+    //! Copies staging buffers of the slot to its Cuda tensors
+    void m_upload(Slot& slot) const;
+
+    std::vector<Shape> m_shapes;
+    CudaDevice m_device;
+    ComputeMode m_mode;
+    std::size_t m_numBatches;
+    FillFunction m_fill;
+    int m_numWorkers;
+
+    std::vector<Slot> m_slots;
+    std::deque<std::size_t> m_freeSlots;
+    //! Maps batch index to the slot holding the loaded batch
+    std::unordered_map<std::size_t, std::size_t> m_readySlots;
+    std::optional<std::size_t> m_currentSlot;
+    std::size_t m_nextBatchIdx = 0;
+    std::size_t m_consumeBatchIdx = 0;
+
+    std::mutex m_mtx;
+    std::condition_variable m_freeCond;
+    std::condition_variable m_readyCond;
+    std::vector<std::thread> m_workers;
+    bool m_stop = false;
+    std::exception_ptr m_error = nullptr;
+    std::size_t m_errorBatchIdx = 0;
+};
+} // namespace Sapphire::Util
+
+#endif
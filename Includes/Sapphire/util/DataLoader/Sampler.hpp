@@ -0,0 +1,111 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_SAMPLER_HPP
+#define SAPPHIRE_UTIL_SAMPLER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::Util
+{
+enum class SampleMode
+{
+    //! Records are visited in file order
+    Sequential,
+    //! Every epoch is a random permutation of the records
+    Shuffle,
+    //! Records are grouped into blocks of adjacent records. Order of the
+    //! blocks and order of records inside each block are shuffled, so each
+    //! batch touches only a few regions of the file
+    BlockShuffle,
+    //! Every epoch is a permutation where each class is spread evenly, so
+    //! every batch contains classes in proportion to the dataset
+    Stratified,
+};
+
+//! Decides which records are loaded in each batch
+//! Each epoch visits every record exactly once. Order of an epoch depends only
+//! on the seed and the epoch index, so runs with same seed are reproducible
+//! regardless of how many threads request batches
+//! Batch queries are thread safe, so the sampler can be shared with the
+//! worker threads of Prefetcher
+class Sampler
+{
+public:
+    //! \param numRecords : number of records to sample from
+    //! \param batchSize : number of records in each batch
+    //! \param mode : sampling mode
+    //! \param seed : seed of the permutations
+    //! \param firstRecord : index of the first record. Records in range
+    //! [firstRecord, firstRecord + numRecords) are sampled
+    Sampler(std::size_t numRecords, std::size_t batchSize, SampleMode mode,
+            std::uint64_t seed, std::size_t firstRecord = 0);
+
+    Sampler(const Sampler& sampler) = delete;
+    Sampler& operator=(const Sampler& sampler) = delete;
+
+    //! Sets number of adjacent records in each block for BlockShuffle
+    void SetBlockSize(std::size_t blockSize);
+
+    //! Sets class of each record for Stratified sampling
+    //! labels[i] is the class of record (firstRecord + i)
+    void SetLabels(std::vector<std::uint32_t> labels);
+
+    //! If true, the last batch of the epoch is dropped if it is not full
+    //! Otherwise, it holds the remaining records
+    void SetDropLast(bool dropLast);
+
+    //! Number of batches in each epoch
+    [[nodiscard]] std::size_t NumBatches() const;
+
+    [[nodiscard]] std::size_t BatchSize() const
+    {
+        return m_batchSize;
+    }
+
+    //! Writes record indices of the batch in given epoch to dst
+    void Batch(std::size_t epoch, std::size_t batchIdx,
+               std::vector<std::size_t>& dst) const;
+
+    //! Writes record indices of the batch at given step to dst
+    //! Steps count batches over consecutive epochs, so step
+    //! (epoch * NumBatches() + batchIdx) is equal to Batch(epoch, batchIdx)
+    void Step(std::size_t step, std::vector<std::size_t>& dst) const;
+
+    //! Returns every record index of the epoch in visiting order
+    [[nodiscard]] std::vector<std::size_t> EpochOrder(std::size_t epoch) const;
+
+private:
+    //! Returns order of the epoch from the cache. Generates it if needed
+    //! Must be called while holding m_mtx
+    const std::vector<std::size_t>& m_getOrder(std::size_t epoch) const;
+
+    void m_generateOrder(std::size_t epoch,
+                         std::vector<std::size_t>& order) const;
+
+    std::size_t m_numRecords;
+    std::size_t m_batchSize;
+    SampleMode m_mode;
+    std::uint64_t m_seed;
+    std::size_t m_firstRecord;
+    std::size_t m_blockSize = 256;
+    bool m_dropLast = false;
+    std::vector<std::uint32_t> m_labels;
+
+    //! Orders of the most recently used epochs
+    //! Two epochs are kept since prefetching workers may be loading the next
+    //! epoch while the current one is being consumed
+    mutable std::deque<std::pair<std::size_t, std::vector<std::size_t>>>
+    m_orderCache;
+    mutable std::mutex m_mtx;
+};
+} // namespace Sapphire::Util
+
+#endif
@@ -0,0 +1,45 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_DATA_TYPE_HPP
+#define SAPPHIRE_UTIL_DATA_TYPE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Sapphire
+{
+//! Type of the elements stored in tensorData
+//! Float16 and BFloat16 are storage types. Kernels load them and compute in
+//! Float32, so they halve the memory traffic at the cost of precision
+enum class DataType
+{
+    Float32,
+    //! IEEE 754 half precision
+    Float16,
+    //! Upper 16 bits of Float32 with 8 bit exponent and 7 bit mantissa
+    BFloat16,
+};
+
+//! Size of one element in bytes
+std::size_t DataTypeSize(DataType dataType);
+
+std::string DataTypeToString(DataType dataType);
+} // namespace Sapphire
+
+namespace Sapphire::Util
+{
+//! Scalar conversions between Float32 and 16 bit types
+//! Conversions to 16 bit types round to nearest even. Values out of range of
+//! Float16 become infinity and NaN stays NaN
+std::uint16_t FloatToHalf(float value);
+float HalfToFloat(std::uint16_t value);
+std::uint16_t FloatToBFloat16(float value);
+float BFloat16ToFloat(std::uint16_t value);
+} // namespace Sapphire::Util
+
+#endif
@@ -28,6 +28,7 @@ struct DeviceIdTidHash
     }
 };
 
+#ifdef WITH_CUDA
 struct ConvMetaDataHash
 {
     std::size_t operator()(const Compute::Dense::Cuda::ConvConfig& key) const
@@ -53,6 +54,7 @@ struct PoolMetaDataHash
                                 key.ColumnPadding);
     }
 };
+#endif
 }
 
 #endif
@@ -0,0 +1,98 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_MAPPED_FILE_HPP
+#define SAPPHIRE_UTIL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+
+namespace Sapphire::Util
+{
+//! Read-only memory mapping of a file
+//! Pages are loaded lazily by the OS when they are accessed, and can be
+//! dropped again under memory pressure since they are backed by the file.
+//! Therefore, resident memory does not grow with the file size
+class MappedFile
+{
+public:
+    enum class AccessPattern
+    {
+        Normal,
+        Sequential,
+        Random,
+    };
+
+    enum class MapMode
+    {
+        //! Mapped pages cannot be written
+        ReadOnly,
+        //! Mapped pages can be written, but written pages become private
+        //! copies of this process and are never written back to the file.
+        //! Pages that are not written stay shared through the page cache
+        CopyOnWrite,
+    };
+
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& filePath,
+                        MapMode mode = MapMode::ReadOnly);
+    ~MappedFile();
+
+    MappedFile(const MappedFile& mappedFile) = delete;
+    MappedFile(MappedFile&& mappedFile) noexcept;
+    MappedFile& operator=(const MappedFile& mappedFile) = delete;
+    MappedFile& operator=(MappedFile&& mappedFile) noexcept;
+
+    [[nodiscard]] const char* Data() const
+    {
+        return m_data;
+    }
+
+    //! Returns writable pointer to the mapped data
+    //! Only available on CopyOnWrite mapping
+    [[nodiscard]] char* MutableData() const;
+
+    [[nodiscard]] MapMode Mode() const
+    {
+        return m_mode;
+    }
+
+    [[nodiscard]] std::size_t Size() const
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] bool IsOpen() const
+    {
+        return m_isOpen;
+    }
+
+    //! Hints the expected access pattern of the given range to the OS
+    //! \param length : length of the range in bytes. 0 selects until the end
+    void Advise(AccessPattern pattern, std::size_t offset = 0,
+                std::size_t length = 0) const;
+
+    //! Tells the OS that the given range will not be accessed soon, so its
+    //! resident pages can be released. Range is reloaded from the file if it
+    //! is accessed again. Pages written on CopyOnWrite mapping lose their
+    //! modifications
+    void Release(std::size_t offset, std::size_t length) const;
+
+private:
+    void m_close();
+
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_isOpen = false;
+    MapMode m_mode = MapMode::ReadOnly;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+};
+} // namespace Sapphire::Util
+
+#endif
@@ -0,0 +1,153 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_PROFILER_HPP
+#define SAPPHIRE_UTIL_PROFILER_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Util
+{
+//! Single timed operation
+struct ProfileEvent
+{
+    std::string Name;
+    std::string Unit;
+    std::string Shapes;
+    ComputeMode Mode = ComputeMode::Host;
+    //! Time since the first event of the process in nanoseconds
+    std::int64_t StartNs = 0;
+    std::int64_t DurationNs = 0;
+    double Flops = 0.0;
+    double Bytes = 0.0;
+    std::uint32_t ThreadId = 0;
+};
+
+//! Collects timing of compute ops and back propagation
+//! Profiling is compiled in only if WITH_PROFILER is defined, and records
+//! events only while it is enabled. While disabled, each instrumented op only
+//! pays for single relaxed atomic load
+class Profiler
+{
+public:
+    //! Starts recording events
+    //! \param synchronizeCuda : if true, device is synchronized before and
+    //! after each cuda op so that the time covers kernel execution instead of
+    //! kernel launch only
+    static void Enable(bool synchronizeCuda = false);
+
+    //! Stops recording events. Recorded events are kept
+    static void Disable();
+
+    [[nodiscard]] static bool IsEnabled()
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static bool SynchronizeCuda()
+    {
+        return m_synchronizeCuda.load(std::memory_order_relaxed);
+    }
+
+    //! Removes every recorded event
+    static void Clear();
+
+    static void Record(ProfileEvent event);
+
+    //! Returns copy of every recorded event sorted by start time
+    [[nodiscard]] static std::vector<ProfileEvent> Events();
+
+    //! Writes recorded events in Chrome trace event format
+    //! The file can be opened with chrome://tracing or Perfetto
+    static void ExportChromeTrace(const std::filesystem::path& filePath);
+
+    //! Returns table of events aggregated by name and device, sorted by total
+    //! time
+    [[nodiscard]] static std::string Summary();
+
+    //! Returns current time since the first call in nanoseconds
+    [[nodiscard]] static std::int64_t Now();
+
+private:
+    static std::atomic<bool> m_enabled;
+    static std::atomic<bool> m_synchronizeCuda;
+};
+
+//! Sets unit name of every event recorded on this thread while it is alive
+//! unitName is referenced, so it must outlive the scope
+class ProfileUnitScope
+{
+public:
+    explicit ProfileUnitScope(const std::string& unitName);
+    ~ProfileUnitScope();
+
+    ProfileUnitScope(const ProfileUnitScope& scope) = delete;
+    ProfileUnitScope& operator=(const ProfileUnitScope& scope) = delete;
+
+    //! Returns unit name of the innermost scope on this thread
+    [[nodiscard]] static const std::string& Current();
+
+private:
+    const std::string* m_previous = nullptr;
+    bool m_active = false;
+};
+
+//! Times single op from Begin() until destruction
+//! Does nothing unless Begin() is called, so the cost of building the event
+//! is only paid while profiler is enabled
+class ProfileScope
+{
+public:
+    ProfileScope() = default;
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope& scope) = delete;
+    ProfileScope& operator=(const ProfileScope& scope) = delete;
+
+    //! Starts timing the op
+    //! \param name : name of the op
+    //! \param flops : number of floating point operations of the op
+    //! \param tensors : tensors accessed by the op. Their shapes are recorded,
+    //! and their sizes are counted as bytes moved. First tensor decides the
+    //! device
+    void Begin(const char* name, double flops,
+               std::initializer_list<const TensorUtil::TensorData*> tensors);
+
+private:
+    ProfileEvent m_event;
+    bool m_active = false;
+};
+} // namespace Sapphire::Util
+
+#define SAPPHIRE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SAPPHIRE_PROFILE_CONCAT(a, b) SAPPHIRE_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef WITH_PROFILER
+//! Times the enclosing scope as op with given name
+//! flops is only evaluated while the profiler is enabled
+#define SAPPHIRE_PROFILE_OP(name, flops, ...)                                 \
+    ::Sapphire::Util::ProfileScope SAPPHIRE_PROFILE_CONCAT(                   \
+        sapphireProfileScope, __LINE__);                                      \
+    if (::Sapphire::Util::Profiler::IsEnabled())                              \
+    SAPPHIRE_PROFILE_CONCAT(sapphireProfileScope, __LINE__)                   \
+        .Begin(name, static_cast<double>(flops), { __VA_ARGS__ })
+
+//! Records events in the enclosing scope under given unit name
+#define SAPPHIRE_PROFILE_UNIT(unitName)                                       \
+    const ::Sapphire::Util::ProfileUnitScope SAPPHIRE_PROFILE_CONCAT(         \
+        sapphireProfileUnit, __LINE__)(unitName)
+#else
+#define SAPPHIRE_PROFILE_OP(name, flops, ...) static_cast<void>(0)
+#define SAPPHIRE_PROFILE_UNIT(unitName) static_cast<void>(0)
+#endif
+
+#endif
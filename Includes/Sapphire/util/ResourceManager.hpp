@@ -7,11 +7,15 @@
 #ifndef SAPPHIRE_UTIL_MEMORYMANAGER_HPP
 #define SAPPHIRE_UTIL_MEMORYMANAGER_HPP
 
+#ifdef WITH_CUDA
 #include <Sapphire/compute/dense/cuda/CudnnStruct.cuh>
 #include <Sapphire/compute/dense/cuda/Convolution.cuh>
 #include <Sapphire/compute/dense/cuda/Pool.cuh>
 #include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+#endif
 #include <Sapphire/util/HashFunctions.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <thread>
 #include <unordered_map>
@@ -39,6 +43,9 @@ struct MemoryChunk
     int RefCount;
 };
 
+//! Pools are shared by every thread and guarded by a mutex
+//! Clean() and Clear functions release memory of every thread, so they must
+//! not be called while other threads are computing
 class ResourceManager
 {
 public:
@@ -62,6 +69,14 @@ public:
 
     static void MoveToVolatileCuda(void* ptr);
 
+    //! Returns volatile memory to the free pool without waiting for Clean(),
+    //! so following allocations can reuse it
+    //! Pointers that are not in the volatile pool are ignored
+    static void FreeVolatileHost(void* ptr);
+
+    static void FreeVolatileCuda(void* ptr);
+
+#ifdef WITH_CUDA
     static Compute::Dense::Cuda::CudnnConv2DMetaData* GetCudnnConvMetaData(
         Compute::Dense::Cuda::ConvConfig convConfig);
 
@@ -78,6 +93,7 @@ public:
     static void AddCudnnConv2DMetaData(
         Compute::Dense::Cuda::ConvConfig convConfig, Ts ... args)
     {
+        std::lock_guard lock(m_mutex);
         auto* metaData = new Compute::Dense::Cuda::CudnnConv2DMetaData();
         Compute::Dense::Cuda::CreateCudnnConv2DMetaData(metaData, args...);
         m_cudnnConv2DMetaDataPool[convConfig] = metaData;
@@ -87,6 +103,7 @@ public:
     static void AddCudnnPool2DMetaData(
         Compute::Dense::Cuda::PoolConfig poolConfig, Ts ... args)
     {
+        std::lock_guard lock(m_mutex);
         auto* metaData = new Compute::Dense::Cuda::CudnnPool2DMetaData();
         Compute::Dense::Cuda::CreateCudnnPool2DMetaData(metaData, args...);
         m_cudnnPool2DMetaDataPool[poolConfig] = metaData;
@@ -103,6 +120,7 @@ public:
     static void ClearCublasHandlePool();
 
     static void ClearCudnnHandlePool();
+#endif
 
     static void Clean();
 
@@ -114,6 +132,7 @@ public:
 
     static void ClearAll();
 
+#ifdef WITH_CUDA
     static bool HasConvConfig(Compute::Dense::Cuda::ConvConfig convConfig);
 
     static bool HasPoolConfig(Compute::Dense::Cuda::PoolConfig poolConfig);
@@ -121,8 +140,45 @@ public:
     static bool HasCublasHandle(int deviceId, std::thread::id tid);
 
     static bool HasCudnnHandle(int deviceId, std::thread::id tid);
+#endif
+
+    //! Returns bytes currently allocated from the system on host, including
+    //! memory kept in the free pool
+    static std::size_t GetAllocatedByteSizeHost()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_hostAllocatedByteSize;
+    }
+
+    //! Returns bytes currently allocated from the system on cuda, including
+    //! memory kept in the free pool
+    static std::size_t GetAllocatedByteSizeCuda()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_cudaAllocatedByteSize;
+    }
+
+    //! Returns the largest allocated byte size on host since the last reset
+    static std::size_t GetPeakByteSizeHost()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_hostPeakByteSize;
+    }
+
+    //! Returns the largest allocated byte size on cuda since the last reset
+    static std::size_t GetPeakByteSizeCuda()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_cudaPeakByteSize;
+    }
+
+    //! Resets peak byte sizes to currently allocated byte sizes
+    static void ResetPeakByteSize();
 
 private:
+    static void m_addAllocatedHost(std::size_t byteSize);
+    static void m_addAllocatedCuda(std::size_t byteSize);
+
     //! Memory resources
 
     static std::unordered_map<std::intptr_t, MemoryChunk>
@@ -136,6 +192,7 @@ private:
     static std::unordered_map<std::intptr_t, MemoryChunk>
     m_cudaPreservedPool;
 
+#ifdef WITH_CUDA
     static std::unordered_map<Compute::Dense::Cuda::ConvConfig,
                               Compute::Dense::Cuda::CudnnConv2DMetaData*,
                               ConvMetaDataHash>
@@ -155,8 +212,15 @@ private:
     static std::unordered_map<std::pair<int, std::thread::id>, cudnnHandle_t*,
                               DeviceIdTidHash>
     m_cudnnHandlePool;
+#endif
 
+    static std::mutex m_mutex;
     static unsigned int m_allocationUnitByteSize;
+
+    static std::size_t m_hostAllocatedByteSize;
+    static std::size_t m_cudaAllocatedByteSize;
+    static std::size_t m_hostPeakByteSize;
+    static std::size_t m_cudaPeakByteSize;
 };
 } // namespace Sapphire::Util
 
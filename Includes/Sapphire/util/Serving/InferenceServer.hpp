@@ -0,0 +1,155 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_INFERENCE_SERVER_HPP
+#define SAPPHIRE_UTIL_INFERENCE_SERVER_HPP
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/tensor/Tensor.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sapphire::Util
+{
+//! Statistics of requests completed by InferenceServer
+//! Latencies are measured from submission to completion of each request
+//! over the most recent requests, in milliseconds
+struct InferenceStats
+{
+    std::size_t NumRequests = 0;
+    std::size_t NumFailed = 0;
+    std::size_t NumBatches = 0;
+    double MeanBatchSize = 0.0;
+    //! Completed requests per second since the server started or the
+    //! statistics were reset
+    double Throughput = 0.0;
+    double LatencyP50 = 0.0;
+    double LatencyP95 = 0.0;
+    double LatencyP99 = 0.0;
+};
+
+//! Coalesces single sample requests into batches and runs them on a pool of
+//! model sessions
+//! Each session owns its own model, and is driven by its own worker thread.
+//! A worker takes requests from the queue when (maxBatchSize) requests are
+//! waiting, or when the oldest waiting request has waited for (maxLatency).
+//! Forward propagation runs without recording history, and every tensor
+//! created by it is released after results are scattered back to the callers
+class InferenceServer
+{
+public:
+    //! Runs forward propagation of a session
+    //! Given input has shape of (batchSize, sampleShape...), and returned
+    //! tensor must have (batchSize) rows of equal size
+    using ForwardFunction = std::function<Tensor(Tensor& x)>;
+
+    //! Creates units of a session and returns its forward function
+    //! This is called once for each session while its model is the current
+    //! model, so units created by it belong to the session
+    using SessionFactory = std::function<ForwardFunction()>;
+
+    //! Creates sessions on the calling thread
+    //! \param sampleShape : shape of a single sample without batch dimension
+    //! \param device : device of the input tensors
+    //! \param mode : compute mode of the input tensors
+    //! \param factory : function that creates each session
+    //! \param maxBatchSize : maximum number of requests in a batch
+    //! \param maxLatency : maximum time a request waits for its batch to fill
+    //! \param numSessions : number of sessions and worker threads
+    InferenceServer(Shape sampleShape, const CudaDevice& device,
+                    ComputeMode mode, const SessionFactory& factory,
+                    std::size_t maxBatchSize,
+                    std::chrono::microseconds maxLatency,
+                    int numSessions = 1);
+    ~InferenceServer();
+
+    InferenceServer(const InferenceServer& server) = delete;
+    InferenceServer(InferenceServer&& server) noexcept = delete;
+    InferenceServer& operator=(const InferenceServer& server) = delete;
+    InferenceServer& operator=(InferenceServer&& server) noexcept = delete;
+
+    //! Starts worker threads and resets the statistics
+    void Start();
+
+    //! Stops and joins worker threads after every submitted request has been
+    //! completed
+    void Stop();
+
+    //! Queues a single sample
+    //! Throws if the server is not running or the sample size does not match
+    //! \param sample : (sampleShape.Size()) floats of the sample
+    //! \return : future of the output row of the sample. It rethrows the
+    //! exception thrown by forward propagation of its batch
+    std::future<std::vector<float>> Submit(std::vector<float> sample);
+
+    [[nodiscard]] InferenceStats GetStats() const;
+
+    void ResetStats();
+
+    [[nodiscard]] std::size_t SampleSize() const
+    {
+        return static_cast<std::size_t>(m_sampleShape.Size());
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request
+    {
+        std::vector<float> Sample;
+        std::promise<std::vector<float>> Result;
+        Clock::time_point Arrival;
+    };
+
+    struct Session
+    {
+        std::unique_ptr<Model> SessionModel;
+        ForwardFunction Forward;
+    };
+
+    void m_workerLoop(std::size_t sessionIdx);
+
+    void m_runBatch(Session& session, std::vector<Request>& batch);
+
+    void m_recordBatch(const std::vector<Request>& batch, bool failed);
+
+    //! Number of latencies kept for percentiles
+    static constexpr std::size_t LatencyWindow = 4096;
+
+    Shape m_sampleShape;
+    CudaDevice m_device;
+    ComputeMode m_mode;
+    std::size_t m_maxBatchSize;
+    std::chrono::microseconds m_maxLatency;
+    std::vector<Session> m_sessions;
+
+    std::deque<Request> m_queue;
+    std::mutex m_mtx;
+    std::condition_variable m_requestCond;
+    std::vector<std::thread> m_workers;
+    bool m_running = false;
+    bool m_stop = false;
+
+    mutable std::mutex m_statsMtx;
+    Clock::time_point m_statsBegin;
+    std::size_t m_numRequests = 0;
+    std::size_t m_numFailed = 0;
+    std::size_t m_numBatches = 0;
+    //! Ring buffer of recent latencies in milliseconds
+    std::vector<double> m_latencies;
+    std::size_t m_latencyIdx = 0;
+};
+} // namespace Sapphire::Util
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_UNIX_SOCKET_SERVER_HPP
+#define SAPPHIRE_UTIL_UNIX_SOCKET_SERVER_HPP
+
+#include <Sapphire/util/Serving/InferenceServer.hpp>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//! Requests and responses on the socket are framed as below, in native byte
+//! order
+//! request : (uint32 count) (count floats of the sample)
+//! response : (uint32 status) (uint32 count) (payload)
+//! Payload is (count) floats of the output if status is 0, and (count) bytes
+//! of the error message otherwise
+//! Each connection sends one request at a time, and requests of different
+//! connections are batched together by the InferenceServer
+namespace Sapphire::Util
+{
+//! Accepts requests on a local Unix domain socket and forwards them to an
+//! InferenceServer
+//! Each connection is served by its own thread. Threads of closed
+//! connections are joined when the next connection is accepted
+//! Not supported on Windows
+class UnixSocketServer
+{
+public:
+    //! \param server : server that runs the requests. Must outlive this
+    //! \param socketPath : path of the socket file. Existing socket is
+    //! replaced, while other kinds of files are never removed
+    UnixSocketServer(InferenceServer& server, std::string socketPath);
+    ~UnixSocketServer();
+
+    UnixSocketServer(const UnixSocketServer& server) = delete;
+    UnixSocketServer(UnixSocketServer&& server) noexcept = delete;
+    UnixSocketServer& operator=(const UnixSocketServer& server) = delete;
+    UnixSocketServer& operator=(UnixSocketServer&& server) noexcept = delete;
+
+    //! Binds the socket and starts accepting connections
+    void Start();
+
+    //! Closes the socket and every connection, and removes the socket file
+    void Stop();
+
+    [[nodiscard]] const std::string& SocketPath() const
+    {
+        return m_socketPath;
+    }
+
+private:
+    void m_acceptLoop();
+
+    void m_serveConnection(int connectionFd);
+
+    //! Joins threads of closed connections. m_mtx must be held
+    void m_reapConnections();
+
+    InferenceServer& m_server;
+    std::string m_socketPath;
+    int m_listenFd = -1;
+    std::atomic<bool> m_stop = false;
+    std::thread m_acceptThread;
+
+    std::mutex m_mtx;
+    std::vector<int> m_connectionFds;
+    std::vector<std::thread> m_connectionThreads;
+    //! Threads that have finished serving their connection
+    std::vector<std::thread::id> m_finishedThreads;
+};
+
+//! Blocking client of UnixSocketServer
+class UnixSocketClient
+{
+public:
+    //! Connects to the server listening on socketPath
+    explicit UnixSocketClient(const std::string& socketPath);
+    ~UnixSocketClient();
+
+    UnixSocketClient(const UnixSocketClient& client) = delete;
+    UnixSocketClient(UnixSocketClient&& client) noexcept = delete;
+    UnixSocketClient& operator=(const UnixSocketClient& client) = delete;
+    UnixSocketClient& operator=(UnixSocketClient&& client) noexcept = delete;
+
+    //! Sends a sample and waits for its output
+    //! Throws std::runtime_error with the message of the server if the
+    //! request has failed
+    std::vector<float> Infer(const std::vector<float>& sample);
+
+private:
+    int m_fd = -1;
+};
+} // namespace Sapphire::Util
+
+#endif
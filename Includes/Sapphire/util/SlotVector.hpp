@@ -0,0 +1,193 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_UTIL_SLOT_VECTOR_HPP
+#define SAPPHIRE_UTIL_SLOT_VECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::Util
+{
+//! Vector of slots addressed by 64 bit integer keys
+//! Key holds index of the slot in lower IndexBits, and generation of the slot
+//! in upper GenerationBits. Erased slots are reused from the free list with
+//! increased generation, so lookup is a single index without hashing and keys
+//! of erased values are always detected as invalid
+//! Slot whose generation reached MaxGeneration is retired instead of being
+//! reused, so no key is ever given twice. Free slots are reused in the order
+//! they were erased, and only after MinFreeSlots of them are accumulated.
+//! Generation of a slot advances at most once every MinFreeSlots insertions,
+//! so slots are retired after (MinFreeSlots << GenerationBits) insertions
+//! Slots are allocated in pages, so references to values stay valid until
+//! they are erased, as references to elements of unordered_map
+//! \tparam GenerationBitCount : number of generation bits. Smaller values are
+//! only useful for testing retirement of slots
+template <typename T, int GenerationBitCount = 63 - 22>
+class SlotVector
+{
+public:
+    using Key = std::int64_t;
+    static constexpr int IndexBits = 22;
+    static constexpr int MaxSize = 1 << IndexBits;
+    static constexpr int GenerationBits = GenerationBitCount;
+    static constexpr std::uint64_t MaxGeneration =
+        (std::uint64_t{ 1 } << GenerationBits) - 1;
+    static constexpr std::size_t MinFreeSlots = 1 << 10;
+    static constexpr int PageBits = 8;
+    static constexpr int PageSize = 1 << PageBits;
+
+    //! Returns key that will be assigned to the next inserted value
+    [[nodiscard]] Key NextKey() const
+    {
+        if (m_reusesFreeSlot())
+        {
+            const auto index = m_freeList.front();
+            return m_makeKey(index, m_slot(index).Generation);
+        }
+        if (m_numSlots == MaxSize)
+            throw std::length_error("SlotVector::NextKey - Out of slots");
+        return m_makeKey(m_numSlots, 0);
+    }
+
+    //! Inserts value and returns its key, which equals NextKey()
+    Key Insert(T value)
+    {
+        const auto key = NextKey();
+        if (m_reusesFreeSlot())
+            m_freeList.pop_front();
+        else
+        {
+            if (m_numSlots % PageSize == 0)
+                m_pages.emplace_back(std::make_unique<Slot[]>(PageSize));
+            ++m_numSlots;
+        }
+        m_slot(static_cast<int>(key & (MaxSize - 1)))
+            .Value.emplace(std::move(value));
+        ++m_size;
+        return key;
+    }
+
+    [[nodiscard]] bool Contains(Key key) const
+    {
+        const auto index = static_cast<int>(key & (MaxSize - 1));
+        if (key < 0 || index >= m_numSlots)
+            return false;
+        const auto& slot = m_slot(index);
+        return slot.Value.has_value() &&
+               m_makeKey(index, slot.Generation) == key;
+    }
+
+    //! Throws std::out_of_range if key is invalid
+    [[nodiscard]] T& At(Key key)
+    {
+        if (!Contains(key))
+            throw std::out_of_range("SlotVector::At - Invalid key");
+        return *m_slot(static_cast<int>(key & (MaxSize - 1))).Value;
+    }
+
+    [[nodiscard]] const T& At(Key key) const
+    {
+        if (!Contains(key))
+            throw std::out_of_range("SlotVector::At - Invalid key");
+        return *m_slot(static_cast<int>(key & (MaxSize - 1))).Value;
+    }
+
+    //! Erases value of the key if it exists
+    void Erase(Key key)
+    {
+        if (Contains(key))
+            m_erase(static_cast<int>(key & (MaxSize - 1)));
+    }
+
+    //! Erases every value that satisfies pred(value)
+    template <typename Pred>
+    void EraseIf(Pred pred)
+    {
+        for (int index = 0; index < m_numSlots; ++index)
+            if (auto& slot = m_slot(index);
+                slot.Value.has_value() && pred(*slot.Value))
+                m_erase(index);
+    }
+
+    //! Erases every value
+    void Clear()
+    {
+        EraseIf([](const T&) { return true; });
+    }
+
+    //! Calls func(key, value) for every value in order of slots
+    template <typename Func>
+    void ForEach(Func func)
+    {
+        for (int index = 0; index < m_numSlots; ++index)
+            if (auto& slot = m_slot(index); slot.Value.has_value())
+                func(m_makeKey(index, slot.Generation), *slot.Value);
+    }
+
+    [[nodiscard]] std::size_t Size() const
+    {
+        return m_size;
+    }
+
+private:
+    struct Slot
+    {
+        std::optional<T> Value;
+        std::uint64_t Generation = 0;
+    };
+
+    [[nodiscard]] Slot& m_slot(int index)
+    {
+        return m_pages[index >> PageBits][index & (PageSize - 1)];
+    }
+
+    [[nodiscard]] const Slot& m_slot(int index) const
+    {
+        return m_pages[index >> PageBits][index & (PageSize - 1)];
+    }
+
+    //! New slots are taken until enough free slots are accumulated, or no
+    //! more slots can be made
+    [[nodiscard]] bool m_reusesFreeSlot() const
+    {
+        return !m_freeList.empty() &&
+               (m_freeList.size() >= MinFreeSlots || m_numSlots == MaxSize);
+    }
+
+    static Key m_makeKey(int index, std::uint64_t generation)
+    {
+        return static_cast<Key>(generation << IndexBits) | index;
+    }
+
+    void m_erase(int index)
+    {
+        auto& slot = m_slot(index);
+        slot.Value.reset();
+        --m_size;
+        if (slot.Generation == MaxGeneration)
+            return;
+        ++slot.Generation;
+        m_freeList.emplace_back(index);
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> m_pages;
+    int m_numSlots = 0;
+    std::deque<int> m_freeList;
+    std::size_t m_size = 0;
+
+    static_assert(IndexBits + GenerationBits <= 63,
+                  "SlotVector - Key must fit in 63 bits");
+};
+} // namespace Sapphire::Util
+
+#endif
@@ -74,7 +74,7 @@ inline int GetMatchingDim(std::vector<Shape> shapes)
 }
 
 template <std::size_t I = 0, typename... Tp>
-void AddOutputHistory(int backPropWrapperKey,
+void AddOutputHistory(std::int64_t backPropWrapperKey,
                       std::tuple<Tp...> t)
 {
     if constexpr (I < sizeof...(Tp))
@@ -105,11 +105,21 @@ void AddOperandHistory(
 //! \param wrapper : SharedPtr to the backPropWrapper for this unit
 //! \param inputs : Tuple of pointers of TensorUtil::TensorDescriptor* of inputs
 //! \param outputs : Tuple of pointers of TensorUtil::TensorDescriptor* of outputs
+//! Inside checkpoint region, history is not saved and the wrapper is deleted
 template <std::size_t inputIdx = 0, typename... InputTs, typename... OutputTs>
 void SaveHistory(BackProp::BackPropWrapper* wrapper,
                  std::tuple<InputTs...> inputs,
                  std::tuple<OutputTs...> outputs)
 {
+    if constexpr (inputIdx == 0)
+    {
+        if (!ModelManager::CurModel().IsRecordingHistory())
+        {
+            delete wrapper;
+            return;
+        }
+    }
+
     if constexpr (inputIdx == sizeof...(InputTs))
     {
         const auto backPropWrapperKey = ModelManager::CurModel().
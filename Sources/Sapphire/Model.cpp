@@ -6,9 +6,16 @@
 
 #include <Sapphire/Model.hpp>
 #include <Sapphire/compute/Initialize.hpp>
+#include <algorithm>
+#include <stdexcept>
 
 namespace Sapphire
 {
+namespace
+{
+thread_local Model* CurrentModel = nullptr;
+}
+
 Model::Model(std::string name)
     : m_name(std::move(name)),
       m_optimizer(nullptr)
@@ -24,63 +31,38 @@ Model::Model(std::string name, Optimizer::Optimizer* optimizer)
 
 Model::~Model()
 {
-    m_tensorDescriptorPool.TensorDescMap.clear();
-    m_preservedDescriptorPool.TensorDescMap.clear();
+    m_descriptorPool.Clear();
 }
 
-int Model::RegisterTensorDescriptor(const Shape& shape, Type type,
+std::int64_t Model::RegisterTensorDescriptor(const Shape& shape, Type type,
                                     bool preserve)
 {
-    const int tensorDescKey = m_tensorDescriptorPool.Counter++;
-
-    if (preserve)
-    {
-        TensorUtil::TensorDescriptor tensorDesc(shape, type, tensorDescKey,
-                                                preserve);
-        m_preservedDescriptorPool.TensorDescMap[tensorDescKey] =
-            std::move(tensorDesc);
-        return tensorDescKey;
-    }
-
+    const auto tensorDescKey = m_descriptorPool.NextKey();
     TensorUtil::TensorDescriptor tensorDesc(shape, type, tensorDescKey,
                                             preserve);
-    m_tensorDescriptorPool.TensorDescMap[tensorDescKey] = std::move(tensorDesc);
-
-    return tensorDescKey;
+    if (m_inCheckpointRegion)
+        m_checkpointRegionKeys.emplace_back(tensorDescKey);
+    return m_descriptorPool.Insert({ std::move(tensorDesc), preserve });
 }
 
-int Model::RegisterTensorDescriptor(const Shape& shape, Type type,
+std::int64_t Model::RegisterTensorDescriptor(const Shape& shape, Type type,
                                     const CudaDevice& device, bool preserve)
 {
-    const int tensorDescKey = m_tensorDescriptorPool.Counter++;
-
-    if (preserve)
-    {
-        TensorUtil::TensorDescriptor tensorDesc(shape, type, device,
-                                                tensorDescKey, preserve);
-        m_preservedDescriptorPool.TensorDescMap[tensorDescKey] =
-            std::move(tensorDesc);
-        return tensorDescKey;
-    }
-
+    const auto tensorDescKey = m_descriptorPool.NextKey();
     TensorUtil::TensorDescriptor tensorDesc(shape, type, device,
                                             tensorDescKey, preserve);
-    m_tensorDescriptorPool.TensorDescMap[tensorDescKey] =
-        std::move(tensorDesc);
-
-    return tensorDescKey;
+    if (m_inCheckpointRegion)
+        m_checkpointRegionKeys.emplace_back(tensorDescKey);
+    return m_descriptorPool.Insert({ std::move(tensorDesc), preserve });
 }
 
-int Model::RegisterBackPropWrapper(BackProp::BackPropWrapper* backPropWrapper)
+std::int64_t Model::RegisterBackPropWrapper(
+    BackProp::BackPropWrapper* backPropWrapper)
 {
-    const auto key = static_cast<int>(m_backPropWrapperPool.size());
-    m_backPropWrapperPool[key] =
-        backPropWrapper;
-    return key;
+    return m_backPropWrapperPool.Insert(backPropWrapper);
 }
 
-
-void Model::m_autoGrad(int tensorKey)
+void Model::m_autoGrad(std::int64_t tensorKey)
 {
     if (auto& descriptor = GetDescriptor(tensorKey);
         descriptor.IsBackPropReady())
@@ -93,46 +75,98 @@ void Model::m_autoGrad(int tensorKey)
 
         const auto& [backPropWrapperKey, location] =
             descriptor.GetBackPropWrapperKeyFromLastHistory();
+        auto* backPropWrapper = m_backPropWrapperPool.At(backPropWrapperKey);
         const auto outputGradientKeyVector =
-            m_backPropWrapperPool[backPropWrapperKey]->
-            GetGradientOutputDescriptorKeys();
+            backPropWrapper->GetGradientOutputDescriptorKeys();
 
         auto data = descriptor.GetBackwardData();
 
         //! Checks if wrapper is ready to backprop. If it does, performs backprop
         //! Update the operands if successes
-        const bool invoked = m_backPropWrapperPool[backPropWrapperKey]->
-            InvokeBackPropIfReady(location);
+        const bool invoked = backPropWrapper->InvokeBackPropIfReady(location);
 
         descriptor.PopOutputHistory(); //! Pop output history
 
+        //! Gradient of the descriptor has been propagated if it has no
+        //! history left and the wrapper is invoked
+        const bool consumed = m_releaseOnBackProp && !descriptor.HasHistory();
         if (invoked)
         {
-            delete m_backPropWrapperPool[backPropWrapperKey];
-            m_backPropWrapperPool.erase(backPropWrapperKey);
+            delete backPropWrapper;
+            m_backPropWrapperPool.Erase(backPropWrapperKey);
             for (auto& descKey : outputGradientKeyVector)
                 GetDescriptor(descKey).RemoveOperand(tensorKey);
 
+            if (consumed)
+                m_releaseDescriptor(tensorKey);
+            if (const auto itr = m_pendingRelease.find(backPropWrapperKey);
+                itr != m_pendingRelease.end())
+            {
+                for (const auto descKey : itr->second)
+                    m_releaseDescriptor(descKey);
+                m_pendingRelease.erase(itr);
+            }
+
             for (auto& tensorData : outputGradientKeyVector)
                 m_autoGrad(tensorData);
         }
+        else if (consumed)
+            m_pendingRelease[backPropWrapperKey].emplace_back(tensorKey);
     }
 }
 
-void Model::m_removeDescriptor(int descKey)
+void Model::m_removeDescriptor(std::int64_t descKey)
+{
+    m_descriptorPool.Erase(descKey);
+}
+
+void Model::m_releaseDescriptor(std::int64_t descKey)
+{
+    auto& entry = m_descriptorPool.At(descKey);
+    if (entry.Preserved)
+        return;
+    entry.Descriptor.ReleaseMemory();
+    m_removeDescriptor(descKey);
+}
+
+void Model::BeginCheckpointRegion()
+{
+    if (m_inCheckpointRegion)
+        throw std::runtime_error(
+            "Model::BeginCheckpointRegion - Checkpoint regions cannot be "
+            "nested");
+    m_inCheckpointRegion = true;
+    m_checkpointRegionKeys.clear();
+}
+
+void Model::EndCheckpointRegion(std::int64_t outputKey)
+{
+    if (!m_inCheckpointRegion)
+        throw std::runtime_error(
+            "Model::EndCheckpointRegion - Checkpoint region has not begun");
+    m_inCheckpointRegion = false;
+    for (const auto descKey : m_checkpointRegionKeys)
+        if (descKey != outputKey && m_descriptorPool.Contains(descKey))
+            m_releaseDescriptor(descKey);
+    m_checkpointRegionKeys.clear();
+}
+
+bool Model::IsInCheckpointRegion(std::int64_t descKey) const
 {
-    if (m_tensorDescriptorPool.TensorDescMap.find(descKey) !=
-        m_tensorDescriptorPool.TensorDescMap.end())
-        m_tensorDescriptorPool.TensorDescMap.erase(descKey);
-    m_preservedDescriptorPool.TensorDescMap.erase(descKey);
+    return m_inCheckpointRegion &&
+           std::find(m_checkpointRegionKeys.begin(),
+                     m_checkpointRegionKeys.end(),
+                     descKey) != m_checkpointRegionKeys.end();
 }
 
-TensorUtil::TensorDescriptor& Model::GetDescriptor(int descKey)
+void Model::ReleaseTensor(const Tensor& tensor)
 {
-    if (m_tensorDescriptorPool.TensorDescMap.find(descKey) !=
-        m_tensorDescriptorPool.TensorDescMap.end())
-        return m_tensorDescriptorPool.TensorDescMap.at(descKey);
-    return m_preservedDescriptorPool.TensorDescMap.at(descKey);
+    m_releaseDescriptor(tensor.TensorDescriptorKey());
+}
+
+TensorUtil::TensorDescriptor& Model::GetDescriptor(std::int64_t descKey)
+{
+    return m_descriptorPool.At(descKey).Descriptor;
 }
 
 void Model::BackProp(Tensor tensor)
@@ -145,45 +179,90 @@ void Model::BackProp(Tensor tensor)
 
 void Model::Clear()
 {
-    for (const auto& [_, desc] : m_preservedDescriptorPool.TensorDescMap)
-    {
-        auto tensorData = desc.GetBackwardData();
-        Compute::Initialize::Zeros(tensorData);
-    }
-    m_tensorDescriptorPool.TensorDescMap.clear();
+    m_descriptorPool.ForEach([](std::int64_t, DescriptorEntry& entry) {
+        if (entry.Preserved)
+        {
+            auto tensorData = entry.Descriptor.GetBackwardData();
+            Compute::Initialize::Zeros(tensorData);
+        }
+    });
+    m_descriptorPool.EraseIf(
+        [](const DescriptorEntry& entry) { return !entry.Preserved; });
+    m_pendingRelease.clear();
+    m_inCheckpointRegion = false;
+    m_recomputing = false;
+    m_checkpointRegionKeys.clear();
 }
 
 void Model::InitGradient()
 {
-    for (auto& [id, tensorDesc] : m_tensorDescriptorPool.TensorDescMap)
-        tensorDesc.InitGradient();
+    m_descriptorPool.ForEach([](std::int64_t, DescriptorEntry& entry) {
+        if (!entry.Preserved)
+            entry.Descriptor.InitGradient();
+    });
 }
 
 Model& ModelManager::GetModel(const std::string& modelName)
 {
+    std::lock_guard lock(m_mutex);
     return m_modelMap.at(modelName);
 }
 
 Model& ModelManager::CurModel()
 {
-    return m_modelMap.at(m_currentModel);
+    if (CurrentModel == nullptr)
+        throw std::runtime_error(
+            "ModelManager::CurModel - Current model has not been set on this "
+            "thread");
+    return *CurrentModel;
+}
+
+bool ModelManager::HasCurModel()
+{
+    return CurrentModel != nullptr;
 }
 
 void ModelManager::SetCurrentModel(const std::string& modelName)
 {
-    if (m_modelMap.find(modelName) == m_modelMap.end())
+    std::lock_guard lock(m_mutex);
+    const auto itr = m_modelMap.find(modelName);
+    if (itr == m_modelMap.end())
         throw std::invalid_argument(
             "ModelManager::SetCurrentModel - Given model name is not "
             "registered");
-    m_currentModel = modelName;
+    //! References to elements of unordered_map stay valid on rehashing
+    CurrentModel = &itr->second;
+}
+
+void ModelManager::SetCurrentModel(Model& model)
+{
+    CurrentModel = &model;
 }
 
-void ModelManager::AddModel(const std::string& modelName)
+Model& ModelManager::AddModel(const std::string& modelName)
 {
-    m_modelMap.emplace(modelName, Model(modelName));
+    std::lock_guard lock(m_mutex);
+    return m_modelMap.emplace(modelName, Model(modelName)).first->second;
 }
 
-std::string ModelManager::m_currentModel;
+std::mutex ModelManager::m_mutex;
 
 std::unordered_map<std::string, Model> ModelManager::m_modelMap;
+
+ModelScope::ModelScope(Model& model)
+    : m_previous(CurrentModel)
+{
+    ModelManager::SetCurrentModel(model);
+}
+
+ModelScope::ModelScope(const std::string& modelName)
+    : m_previous(CurrentModel)
+{
+    ModelManager::SetCurrentModel(modelName);
+}
+
+ModelScope::~ModelScope()
+{
+    CurrentModel = m_previous;
+}
 } // namespace Sapphire
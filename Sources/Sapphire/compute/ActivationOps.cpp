@@ -5,19 +5,37 @@
 // property of any third parties.
 
 #include <Sapphire/compute/ActivationOps.hpp>
-#include <Sapphire/compute/dense/cuda/Activation.cuh>
+#include <Sapphire/compute/OutputCheck.hpp>
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/ReducedPrecision.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Activation.cuh>
 #include <Sapphire/compute/dense/cuda/Basic.cuh>
+#endif
 
 namespace Sapphire::Compute
 {
 void SoftMax(TensorData& y, const TensorData& x)
 {
+    CheckOutput("SoftMax", y);
+    if (!x.IsContiguousFloat())
+    {
+        SoftMax(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("SoftMax", 3.0 * y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto unitSize = y.GetShape().At(-1);
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::SoftMax(y.CudaMutableRawPtr(), x.CudaRawPtr(),
@@ -25,6 +43,7 @@ void SoftMax(TensorData& y, const TensorData& x)
                              unitSize);
     }
     else
+#endif
     {
         Dense::Naive::SoftMax(y.HostMutableRawPtr(), x.HostRawPtr(),
                               totalSize, unitSize);
@@ -33,16 +52,26 @@ void SoftMax(TensorData& y, const TensorData& x)
 
 void LeakyReLU(TensorData& y, const TensorData& x, float a)
 {
+    CheckOutput("LeakyReLU", y);
+    if (!x.IsContiguousFloat())
+    {
+        LeakyReLU(y, x.ContiguousFloat(), a);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("LeakyReLU", y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::LeakyReLU(y.CudaMutableRawPtr(), x.CudaRawPtr(), a,
                                totalSize);
     }
     else
+#endif
     {
         Dense::Naive::LeakyReLU(y.HostMutableRawPtr(), x.HostRawPtr(), a,
                                 totalSize);
@@ -51,15 +80,35 @@ void LeakyReLU(TensorData& y, const TensorData& x, float a)
 
 void ReLU(TensorData& y, const TensorData& x)
 {
+    CheckOutput("ReLU", y, true);
+    if ((y.GetDataType() != DataType::Float32 ||
+         x.GetDataType() != DataType::Float32) && x.IsContiguous())
+    {
+        SAPPHIRE_PROFILE_OP("ReLU", y.Size(), &y, &x);
+        Dense::Naive::Elementwise(y.HostMutableRawData(), y.GetDataType(),
+                                  x.HostRawData(), x.GetDataType(), y.Size(),
+                                  Dense::Naive::ReLU);
+        return;
+    }
+
+    if (!x.IsContiguousFloat())
+    {
+        ReLU(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ReLU", y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::ReLU(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::ReLU(y.HostMutableRawPtr(), x.HostRawPtr(),
                            totalSize);
@@ -68,16 +117,26 @@ void ReLU(TensorData& y, const TensorData& x)
 
 void ReLUBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("ReLUBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        ReLUBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ReLUBackward", dx.Size(), &dx, &dy, &x);
     assert(dx.Mode() == dy.Mode() && dx.Mode() == x.Mode());
     const auto device = dx.GetCudaDevice();
     const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::ReLUBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                   x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::ReLUBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
                                    x.HostRawPtr(), totalSize);
@@ -87,17 +146,27 @@ void ReLUBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 void LeakyReLUBackward(TensorData& dx, const TensorData& dy,
                        const TensorData& x, float a)
 {
+    CheckOutput("LeakyReLUBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        LeakyReLUBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat(), a);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("LeakyReLUBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::LeakyReLUBackward(dx.CudaMutableRawPtr(),
                                        dy.CudaRawPtr(),
                                        x.CudaRawPtr(),
                                        a, totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::LeakyReLUBackward - Host not implemented");
@@ -106,17 +175,28 @@ void LeakyReLUBackward(TensorData& dx, const TensorData& dy,
 
 void SoftMaxBackward(TensorData& dx, const TensorData& dy, const TensorData& y)
 {
+    CheckOutput("SoftMaxBackward", dx);
+    if (!dy.IsContiguousFloat() || !y.IsContiguousFloat())
+    {
+        SoftMaxBackward(dx, dy.ContiguousFloat(), y.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("SoftMaxBackward", 2.0 * dx.Size() * dx.Cols(),
+                        &dx, &dy, &y);
     assert(dx.Mode() == dy.Mode() && dx.Mode() == y.Mode());
     const auto device = dx.GetCudaDevice();
     const auto totalSize = dx.Size();
     const auto unitSize = dx.GetShape().At(-1);
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::SoftmaxBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                      y.CudaRawPtr(), totalSize, unitSize);
     }
     else
+#endif
     {
         Dense::Naive::SoftMaxBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
                                       y.HostRawPtr(), totalSize, unitSize);
@@ -0,0 +1,130 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/AttentionOps.hpp>
+#include <Sapphire/compute/OutputCheck.hpp>
+#include <Sapphire/compute/dense/naive/Attention.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Compute
+{
+namespace
+{
+//! (numMatrices, length, depth) layout of query, key and value
+struct AttentionLayout
+{
+    unsigned int NumMatrices;
+    unsigned int QueryLength;
+    unsigned int KeyLength;
+    unsigned int Depth;
+    unsigned int ValueDepth;
+};
+
+AttentionLayout GetLayout(const std::string& name, const TensorData& query,
+                          const TensorData& key, const TensorData& value)
+{
+    if (query.Mode() != ComputeMode::Host || key.Mode() != ComputeMode::Host ||
+        value.Mode() != ComputeMode::Host)
+        throw std::invalid_argument("Compute::" + name +
+                                    " - Only available in host mode");
+
+    const auto qShape = query.GetShape();
+    const auto kShape = key.GetShape();
+    const auto vShape = value.GetShape();
+    if (qShape.Dim() < 2 || kShape.Dim() != qShape.Dim() ||
+        vShape.Dim() != qShape.Dim())
+        throw std::invalid_argument(
+            "Compute::" + name +
+            " - Query, key and value must have the same dimension of at "
+            "least 2");
+
+    for (int axis = 0; axis < qShape.Dim() - 2; ++axis)
+        if (kShape.At(axis) != qShape.At(axis) ||
+            vShape.At(axis) != qShape.At(axis))
+            throw std::invalid_argument(
+                "Compute::" + name +
+                " - Leading dimensions of query, key and value mismatch");
+
+    if (kShape.Cols() != qShape.Cols() || vShape.Rows() != kShape.Rows())
+        throw std::invalid_argument("Compute::" + name + " - Shape mismatch");
+
+    return { static_cast<unsigned int>(query.GetNumUnits(2)),
+             static_cast<unsigned int>(qShape.Rows()),
+             static_cast<unsigned int>(kShape.Rows()),
+             static_cast<unsigned int>(qShape.Cols()),
+             static_cast<unsigned int>(vShape.Cols()) };
+}
+
+void CheckSize(const std::string& name, const TensorData& data,
+               unsigned int size)
+{
+    if (data.Size() != static_cast<int>(size))
+        throw std::invalid_argument("Compute::" + name + " - Size mismatch");
+}
+} // namespace
+
+void AttentionForward(TensorData& y, TensorData& logSumExp,
+                      const TensorData& query, const TensorData& key,
+                      const TensorData& value, float scale, bool causal)
+{
+    const auto [numMatrices, queryLength, keyLength, depth, valueDepth] =
+        GetLayout("AttentionForward", query, key, value);
+    CheckOutputs("AttentionForward", ComputeMode::Host,
+                 { &y, &logSumExp });
+    CheckSize("AttentionForward", y, numMatrices * queryLength * valueDepth);
+    CheckSize("AttentionForward", logSumExp, numMatrices * queryLength);
+
+    const auto queryData = query.ContiguousFloat();
+    const auto keyData = key.ContiguousFloat();
+    const auto valueData = value.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("AttentionForward",
+                        2.0 * numMatrices * queryLength * keyLength *
+                        (depth + valueDepth), &y, &query, &key, &value);
+
+    Dense::Naive::AttentionForward(
+        y.HostMutableRawPtr(), logSumExp.HostMutableRawPtr(),
+        queryData.HostRawPtr(), keyData.HostRawPtr(), valueData.HostRawPtr(),
+        numMatrices, queryLength, keyLength, depth, valueDepth, scale,
+        causal);
+}
+
+void AttentionBackward(TensorData& dQuery, TensorData& dKey,
+                       TensorData& dValue, const TensorData& dy,
+                       const TensorData& query, const TensorData& key,
+                       const TensorData& value, const TensorData& y,
+                       const TensorData& logSumExp, float scale, bool causal)
+{
+    const auto [numMatrices, queryLength, keyLength, depth, valueDepth] =
+        GetLayout("AttentionBackward", query, key, value);
+    CheckOutputs("AttentionBackward", ComputeMode::Host,
+                 { &dQuery, &dKey, &dValue });
+    CheckSize("AttentionBackward", dQuery, query.Size());
+    CheckSize("AttentionBackward", dKey, key.Size());
+    CheckSize("AttentionBackward", dValue, value.Size());
+    CheckSize("AttentionBackward", dy, y.Size());
+    CheckSize("AttentionBackward", y, numMatrices * queryLength * valueDepth);
+    CheckSize("AttentionBackward", logSumExp, numMatrices * queryLength);
+
+    const auto dyData = dy.ContiguousFloat();
+    const auto queryData = query.ContiguousFloat();
+    const auto keyData = key.ContiguousFloat();
+    const auto valueData = value.ContiguousFloat();
+    const auto yData = y.ContiguousFloat();
+    const auto logSumExpData = logSumExp.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("AttentionBackward",
+                        4.0 * numMatrices * queryLength * keyLength *
+                        (depth + valueDepth), &dQuery, &dy, &query);
+
+    Dense::Naive::AttentionBackward(
+        dQuery.HostMutableRawPtr(), dKey.HostMutableRawPtr(),
+        dValue.HostMutableRawPtr(), dyData.HostRawPtr(),
+        queryData.HostRawPtr(), keyData.HostRawPtr(), valueData.HostRawPtr(),
+        yData.HostRawPtr(), logSumExpData.HostRawPtr(), numMatrices,
+        queryLength, keyLength, depth, valueDepth, scale, causal);
+}
+} // namespace Sapphire::Compute
@@ -6,20 +6,97 @@
 
 #include <Sapphire/compute/Broadcast.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
-#include <Sapphire/compute/dense/cuda/Basic.cuh>
-#include <Sapphire/compute/dense/cuda/Gemm.cuh>
+#include <Sapphire/compute/OutputCheck.hpp>
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
 #include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
-#include <Sapphire/compute/dense/cuda/BasicBackward.cuh>
+#include <Sapphire/compute/dense/naive/ReducedPrecision.hpp>
+#include <Sapphire/compute/sparse/naive/BlockSparseGemm.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
+#include <Sapphire/util/Profiler.hpp>
 #include <algorithm>
 #include <cassert>
+#include <stdexcept>
+#include <string>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Basic.cuh>
+#include <Sapphire/compute/dense/cuda/Gemm.cuh>
+#include <Sapphire/compute/dense/cuda/BasicBackward.cuh>
+#endif
 
 
 namespace Sapphire::Compute
 {
+namespace
+{
+//! Returns true if any of the operands is stored in Float16 or BFloat16
+bool HasReducedOperand(std::initializer_list<const TensorData*> operands)
+{
+    return std::any_of(operands.begin(), operands.end(),
+                       [](const TensorData* operand) {
+                           return operand->GetDataType() != DataType::Float32;
+                       });
+}
+
+//! Returns true if reduced precision operands can be given to
+//! Dense::Naive::Elementwise without broadcasting or copying them
+bool IsElementwise(const TensorData& y, const TensorData& a,
+                   const TensorData& b)
+{
+    return a.IsContiguous() && b.IsContiguous() && a.Size() == y.Size() &&
+           b.Size() == y.Size();
+}
+
+void ReducedElementwise(TensorData& y, const TensorData& a,
+                        const TensorData& b,
+                        const Dense::Naive::BinaryKernel& kernel)
+{
+    Dense::Naive::Elementwise(y.HostMutableRawData(), y.GetDataType(),
+                              a.HostRawData(), a.GetDataType(),
+                              b.HostRawData(), b.GetDataType(), y.Size(),
+                              kernel);
+}
+
+//! Computes output stored in reduced precision through Float32 copy of it
+template <typename Func>
+void ComputeInFloat(TensorData& y, Func func)
+{
+    auto buffer = y.ConvertTo(DataType::Float32);
+    func(buffer);
+    TensorData::DeepCopy(y, buffer);
+}
+} // namespace
+
 void Add(TensorData& y, const TensorData& a, const TensorData& b)
 {
+    CheckOutput("Add", y, true);
+    if (HasReducedOperand({ &y, &a, &b }))
+    {
+        if (IsElementwise(y, a, b))
+        {
+            SAPPHIRE_PROFILE_OP("Add", y.Size(), &y, &a, &b);
+            ReducedElementwise(y, a, b,
+                               [](float* out, const float* inputA,
+                                  const float* inputB, unsigned int size) {
+                                   Dense::Naive::Add(size, out, inputA, inputB,
+                                                    size, false, false);
+                               });
+            return;
+        }
+        if (y.GetDataType() != DataType::Float32)
+        {
+            ComputeInFloat(y, [&](TensorData& buffer) { Add(buffer, a, b); });
+            return;
+        }
+    }
+
+    if (!a.IsContiguousFloat() || !b.IsContiguousFloat())
+    {
+        Add(y, a.ContiguousFloat(), b.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Add", y.Size(), &y, &a, &b);
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
 
@@ -43,6 +120,7 @@ void Add(TensorData& y, const TensorData& a, const TensorData& b)
     const int minRequiredDim =
         Util::GetMatchingDim({ shapeOut, shapeA, shapeB });
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
@@ -51,9 +129,9 @@ void Add(TensorData& y, const TensorData& a, const TensorData& b)
                              minRequiredDim, Dense::Cuda::Add, 0, false, false);
     }
     else
+#endif
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
+        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
                              y.HostMutableRawPtr(),
                              a.HostRawPtr(), b.HostRawPtr(), 0, minRequiredDim,
                              Dense::Naive::Add, 0, false, false);
@@ -62,6 +140,34 @@ void Add(TensorData& y, const TensorData& a, const TensorData& b)
 
 void Sub(TensorData& y, const TensorData& a, const TensorData& b)
 {
+    CheckOutput("Sub", y, true);
+    if (HasReducedOperand({ &y, &a, &b }))
+    {
+        if (IsElementwise(y, a, b))
+        {
+            SAPPHIRE_PROFILE_OP("Sub", y.Size(), &y, &a, &b);
+            ReducedElementwise(y, a, b,
+                               [](float* out, const float* inputA,
+                                  const float* inputB, unsigned int size) {
+                                   Dense::Naive::Sub(size, out, inputA, inputB,
+                                                    size, false, false);
+                               });
+            return;
+        }
+        if (y.GetDataType() != DataType::Float32)
+        {
+            ComputeInFloat(y, [&](TensorData& buffer) { Sub(buffer, a, b); });
+            return;
+        }
+    }
+
+    if (!a.IsContiguousFloat() || !b.IsContiguousFloat())
+    {
+        Sub(y, a.ContiguousFloat(), b.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Sub", y.Size(), &y, &a, &b);
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
 
@@ -85,6 +191,7 @@ void Sub(TensorData& y, const TensorData& a, const TensorData& b)
     const int minRequiredDim = Util::GetMatchingDim(
         { shapeOut, shapeA, shapeB });
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
@@ -94,9 +201,9 @@ void Sub(TensorData& y, const TensorData& a, const TensorData& b)
                              false);
     }
     else
+#endif
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
+        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
                              y.HostMutableRawPtr(),
                              a.HostRawPtr(), b.HostRawPtr(), 0, minRequiredDim,
                              Dense::Naive::Sub, 0, false, false);
@@ -105,6 +212,34 @@ void Sub(TensorData& y, const TensorData& a, const TensorData& b)
 
 void Dot(TensorData& y, const TensorData& a, const TensorData& b)
 {
+    CheckOutput("Dot", y, true);
+    if (HasReducedOperand({ &y, &a, &b }))
+    {
+        if (IsElementwise(y, a, b))
+        {
+            SAPPHIRE_PROFILE_OP("Dot", y.Size(), &y, &a, &b);
+            ReducedElementwise(y, a, b,
+                               [](float* out, const float* inputA,
+                                  const float* inputB, unsigned int size) {
+                                   Dense::Naive::Dot(size, out, inputA, inputB,
+                                                    size, false, false);
+                               });
+            return;
+        }
+        if (y.GetDataType() != DataType::Float32)
+        {
+            ComputeInFloat(y, [&](TensorData& buffer) { Dot(buffer, a, b); });
+            return;
+        }
+    }
+
+    if (!a.IsContiguousFloat() || !b.IsContiguousFloat())
+    {
+        Dot(y, a.ContiguousFloat(), b.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Dot", y.Size(), &y, &a, &b);
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
 
@@ -125,6 +260,7 @@ void Dot(TensorData& y, const TensorData& a, const TensorData& b)
     const auto sizeA = shapeA.Size();
     const auto sizeB = shapeB.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
@@ -133,9 +269,9 @@ void Dot(TensorData& y, const TensorData& a, const TensorData& b)
                              false);
     }
     else
+#endif
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
+        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
                              y.HostMutableRawPtr(),
                              a.HostRawPtr(), b.HostRawPtr(), 0, 0,
                              Dense::Naive::Dot, 0, false, false);
@@ -145,6 +281,15 @@ void Dot(TensorData& y, const TensorData& a, const TensorData& b)
 void DotBackward(TensorData& da, TensorData& db, const TensorData& dy,
                  const TensorData& a, const TensorData& b)
 {
+    CheckOutput("DotBackward", da);
+    CheckOutput("DotBackward", db);
+    if (!dy.IsContiguousFloat() || !a.IsContiguousFloat() || !b.IsContiguousFloat())
+    {
+        DotBackward(da, db, dy.ContiguousFloat(), a.ContiguousFloat(), b.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("DotBackward", 2.0 * dy.Size(), &da, &db, &dy, &a, &b);
     assert(dy.GetCudaDevice() == da.GetCudaDevice());
     assert(dy.GetCudaDevice() == db.GetCudaDevice());
     assert(dy.GetCudaDevice() == a.GetCudaDevice());
@@ -163,18 +308,19 @@ void DotBackward(TensorData& da, TensorData& db, const TensorData& dy,
     shapeA.Expand(maxDim);
     shapeB.Expand(maxDim);
 
-    const auto sizeOut = shapeOut.Size();
-    const auto sizeA = shapeA.Size();
-    const auto sizeB = shapeB.Size();
-
+#ifdef WITH_CUDA
     if (dy.Mode() == ComputeMode::Cuda)
     {
+        const auto sizeOut = shapeOut.Size();
+        const auto sizeA = shapeA.Size();
+        const auto sizeB = shapeB.Size();
         BroadcastBackwardWith2Inputs(
             shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB, dy.CudaRawPtr(),
             da.CudaMutableRawPtr(), db.CudaMutableRawPtr(), a.CudaRawPtr(),
             b.CudaRawPtr(), 0, 0, Dense::Cuda::DotBackward, 0, false, false);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::DotBackward - Host not implemented");
     }
@@ -182,6 +328,33 @@ void DotBackward(TensorData& da, TensorData& db, const TensorData& dy,
 
 void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
 {
+    CheckOutput("Gemm", y, true);
+    //! Only b is read in reduced precision by the kernels
+    if (y.GetDataType() != DataType::Float32)
+    {
+        ComputeInFloat(y, [&](TensorData& buffer) { Gemm(buffer, a, b); });
+        return;
+    }
+    if (a.GetDataType() != DataType::Float32 ||
+        (b.GetDataType() != DataType::Float32 && !a.IsContiguous()))
+    {
+        Gemm(y, a.ContiguousFloat(), b);
+        return;
+    }
+
+    //! Transposed views are given to the kernels without copying them
+    if (!a.IsContiguous() && !a.IsTransposed())
+    {
+        Gemm(y, a.ContiguousFloat(), b);
+        return;
+    }
+    if (!b.IsContiguous() && !b.IsTransposed())
+    {
+        Gemm(y, a, b.Contiguous());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Gemm", 2.0 * y.Size() * a.Cols(), &y, &a, &b);
     assert(y.Mode() == a.Mode());
     assert(y.Mode() == b.Mode());
 
@@ -198,10 +371,14 @@ void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
     const auto M = shapeOut.Rows();
     const auto N = shapeOut.Cols();
     const auto K = shapeA.Cols();
+    const bool transposeA = !a.IsContiguous();
+    const bool transposeB = !b.IsContiguous();
 
+#ifdef WITH_CUDA
     //! Faster broadcast multiply for Cuda if all tensor dimensions are fixed to
     //! 2
-    if (y.GetShape().Dim() == 2 && a.GetShape().Dim() == 2 &&
+    if (!transposeA && !transposeB &&
+        y.GetShape().Dim() == 2 && a.GetShape().Dim() == 2 &&
         b.GetShape().Dim() == 2 && y.
         GetNumUnits(2) > 1)
     {
@@ -216,6 +393,7 @@ void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
             return;
         }
     }
+#endif
 
     const auto maxDim = std::max({ y.GetShape().Dim(), a.GetShape().Dim(),
                                    b.GetShape().Dim() });
@@ -229,45 +407,120 @@ void Gemm(TensorData& y, const TensorData& a, const TensorData& b)
     const auto sizeA = shapeA.Size();
     const auto sizeB = shapeB.Size();
 
+    if (b.GetDataType() != DataType::Float32)
+    {
+        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
+                             y.HostMutableRawPtr(), a.HostRawPtr(),
+                             b.HostReducedRawPtr(), 0, 2,
+                             Dense::Naive::GemmReduced, M, N, K, transposeB,
+                             b.GetDataType());
+        return;
+    }
+
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA,
                              sizeB, y.CudaMutableRawPtr(),
                              a.CudaRawPtr(),
-                             b.CudaRawPtr(), 0, 2, Dense::Cuda::Gemm, M, N, K,
+                             b.CudaRawPtr(), 0, 2, Dense::Cuda::GemmTransposed,
+                             M, N, K, transposeA, transposeB,
                              y.GetCudaDevice().GetID());
     }
     else
+#endif
     {
-        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, shapeOut.Size(),
-                             shapeA.Size(), shapeB.Size(),
+        BroadcastWith2Inputs(shapeOut, shapeA, shapeB, sizeOut, sizeA, sizeB,
                              y.HostMutableRawPtr(), a.HostRawPtr(),
-                             b.HostRawPtr(), 0, 2, Dense::Naive::Gemm, M,
-                             N, K);
+                             b.HostRawPtr(), 0, 2, Dense::Naive::GemmTransposed,
+                             M, N, K, transposeA, transposeB);
     }
 }
 
+void Gemm(TensorData& y, const TensorData& a, const BlockSparseMatrix& b)
+{
+    CheckOutput("Gemm", y);
+    if (!a.IsContiguousFloat())
+    {
+        Gemm(y, a.ContiguousFloat(), b);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("GemmBlockSparse",
+                        2.0 * a.Size() / a.Cols() * b.NNZB * b.BlockRows *
+                          b.BlockCols,
+                        &y, &a);
+    assert(y.Mode() == a.Mode());
+
+    if (y.Mode() == ComputeMode::Cuda)
+        throw std::runtime_error(
+            "Compute::Gemm - Block sparse Gemm is not implemented on Cuda");
+
+    const auto K = static_cast<unsigned int>(a.Cols());
+    const auto N = static_cast<unsigned int>(y.Cols());
+    if (K != b.M || N != b.N)
+        throw std::invalid_argument(
+            "Compute::Gemm - Shape mismatch between dense and block sparse "
+            "matrix");
+
+    const auto M = static_cast<unsigned int>(y.GetShape().Size() / N);
+    if (a.GetShape().Size() / K != M)
+        throw std::invalid_argument(
+            "Compute::Gemm - Number of rows of a and y does not match");
+
+    Sparse::Naive::Gemm(y.HostMutableRawPtr(), a.HostRawPtr(), &b, M);
+}
+
 void Scale(TensorData& y, const TensorData& x, const float factor)
 {
+    CheckOutput("Scale", y, true);
+    if (HasReducedOperand({ &y, &x }) && x.IsContiguous())
+    {
+        SAPPHIRE_PROFILE_OP("Scale", y.Size(), &y, &x);
+        Dense::Naive::Elementwise(
+            y.HostMutableRawData(), y.GetDataType(), x.HostRawData(),
+            x.GetDataType(), y.Size(),
+            [factor](float* out, const float* input, unsigned int size) {
+                Dense::Naive::Scale(out, input, factor, size);
+            });
+        return;
+    }
+
+    if (!x.IsContiguousFloat())
+    {
+        Scale(y, x.ContiguousFloat(), factor);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Scale", y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.GetShape().Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Scale(y.CudaMutableRawPtr(), x.CudaRawPtr(), factor,
                            totalSize);
     }
     else
+#endif
     {
-        auto shapeY = y.GetShape();
         Dense::Naive::Scale(y.HostMutableRawPtr(), x.HostRawPtr(), factor,
-                            shapeY.Size());
+                            totalSize);
     }
 }
 
 void Transpose(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Transpose", y);
+    if (!x.IsContiguousFloat())
+    {
+        Transpose(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Transpose", 0, &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto inputM = x.Rows();
@@ -275,6 +528,7 @@ void Transpose(TensorData& y, const TensorData& x)
     const auto broadcast = x.GetNumUnits(2) == 1;
     const auto chunkSize = y.GetShape().Size() / (inputM * inputN);
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Transpose(y.CudaMutableRawPtr(), x.CudaRawPtr(),
@@ -282,6 +536,7 @@ void Transpose(TensorData& y, const TensorData& x)
                                chunkSize, broadcast);
     }
     else
+#endif
     {
         Dense::Naive::Transpose(y.HostMutableRawPtr(), x.HostRawPtr(),
                                 inputM, inputN,
@@ -292,16 +547,26 @@ void Transpose(TensorData& y, const TensorData& x)
 //! Performs y = x^factor for each element
 void Pow(TensorData& y, const TensorData& x, const float factor)
 {
+    CheckOutput("Pow", y);
+    if (!x.IsContiguousFloat())
+    {
+        Pow(y, x.ContiguousFloat(), factor);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Pow", y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.GetShape().Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Pow(y.CudaMutableRawPtr(), x.CudaRawPtr(), factor,
                          totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Pow(y.HostMutableRawPtr(), x.HostRawPtr(), factor,
                           totalSize);
@@ -310,15 +575,25 @@ void Pow(TensorData& y, const TensorData& x, const float factor)
 
 void log(TensorData& y, const TensorData& x)
 {
+    CheckOutput("log", y);
+    if (!x.IsContiguousFloat())
+    {
+        log(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("log", y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.GetShape().Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::log(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::log(y.HostMutableRawPtr(), x.HostRawPtr(),
                           totalSize);
@@ -327,16 +602,26 @@ void log(TensorData& y, const TensorData& x)
 
 void log10(TensorData& y, const TensorData& x)
 {
+    CheckOutput("log10", y);
+    if (!x.IsContiguousFloat())
+    {
+        log10(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("log10", y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.GetShape().Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::log10(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                            totalSize);
     }
     else
+#endif
     {
         Dense::Naive::log10(y.HostMutableRawPtr(), x.HostRawPtr(),
                             totalSize);
@@ -345,16 +630,26 @@ void log10(TensorData& y, const TensorData& x)
 
 void Inverse(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Inverse", y);
+    if (!x.IsContiguousFloat())
+    {
+        Inverse(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Inverse", y.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.GetShape().Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Inverse(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                              totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Inverse(y.HostMutableRawPtr(), x.HostRawPtr(),
                               totalSize);
@@ -363,6 +658,14 @@ void Inverse(TensorData& y, const TensorData& x)
 
 void Mean(TensorData& y, const TensorData& x, int dim)
 {
+    CheckOutput("Mean", y);
+    if (!x.IsContiguousFloat())
+    {
+        Mean(y, x.ContiguousFloat(), dim);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Mean", x.Size(), &y, &x);
     assert(y.Mode() == x.Mode());
     assert(y.GetShape().At(dim) == 1);
 
@@ -376,12 +679,14 @@ void Mean(TensorData& y, const TensorData& x, int dim)
     const auto unitSize = x.GetShape().At(dim);
     const auto ySize = y.GetShape().Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Mean(y.CudaMutableRawPtr(), x.CudaRawPtr(), ySize,
                           unitSize, stride);
     }
     else
+#endif
     {
         Dense::Naive::Mean(y.HostMutableRawPtr(), x.HostRawPtr(), ySize
                            , unitSize, stride);
@@ -392,6 +697,14 @@ void Mean(TensorData& y, const TensorData& x, int dim)
 void MeanBackward(TensorData& dx, const TensorData& dy,
                   int dim)
 {
+    CheckOutput("MeanBackward", dx);
+    if (!dy.IsContiguousFloat())
+    {
+        MeanBackward(dx, dy.ContiguousFloat(), dim);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("MeanBackward", dx.Size(), &dx, &dy);
     assert(dy.Mode() == dx.Mode());
     assert(dx.GetShape().Dim() == dy.GetShape().Dim());
 
@@ -405,12 +718,14 @@ void MeanBackward(TensorData& dx, const TensorData& dy,
         stride *= yShape.At(i);
     }
 
+#ifdef WITH_CUDA
     if (dy.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::MeanBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                   yShape.Size(), xShape.At(dim), stride);
     }
     else
+#endif
     {
         Dense::Naive::MeanBackward(dx.HostMutableRawPtr(), dy.HostRawPtr(),
                                    yShape.Size(), xShape.At(dim), stride);
@@ -5,10 +5,15 @@
 // property of any third parties.
 
 #include <Sapphire/compute/ConvolutionOps.hpp>
-#include <Sapphire/compute/dense/cuda/Pool.cuh>
 #include <Sapphire/compute/dense/naive/Pool.hpp>
-#include <Sapphire/compute/dense/cuda/Convolution.cuh>
 #include <Sapphire/compute/dense/naive/Convolution.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <cassert>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Pool.cuh>
+#include <Sapphire/compute/dense/cuda/Convolution.cuh>
+#endif
 
 
 namespace Sapphire::Compute
@@ -17,9 +22,22 @@ void Conv2DForward(TensorData& y, const TensorData& x, const TensorData& filter,
                    int strideRow, int strideCol, int dilationRow,
                    int dilationCol, int rowPadding, int columnPadding)
 {
+    if (!x.IsContiguousFloat() || !filter.IsContiguousFloat())
+    {
+        Conv2DForward(y, x.ContiguousFloat(), filter.ContiguousFloat(), strideRow,
+                      strideCol, dilationRow, dilationCol, rowPadding,
+                      columnPadding);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Conv2DForward",
+                        2.0 * y.Size() *
+                          (filter.Size() / filter.GetShape().At(0)),
+                        &y, &x, &filter);
     assert(y.Mode() == x.Mode() && y.Mode() == filter.Mode());
 
     const auto device = y.GetCudaDevice();
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         const Dense::Cuda::Shape4D filterShape = {
@@ -43,6 +61,7 @@ void Conv2DForward(TensorData& y, const TensorData& x, const TensorData& filter,
             rowPadding, columnPadding, device.GetID());
     }
     else
+#endif
     {
         Dense::Naive::Conv2D(y, x, filter, strideRow, strideCol, rowPadding,
                              columnPadding, dilationRow, dilationCol, device);
@@ -53,9 +72,20 @@ void MaxPool2DForward(TensorData& y, const TensorData& x, int windowRows,
                       int windowCols, int strideRow, int strideCol,
                       int rowPadding, int colPadding)
 {
+    if (!x.IsContiguousFloat())
+    {
+        MaxPool2DForward(y, x.ContiguousFloat(), windowRows, windowCols, strideRow,
+                         strideCol, rowPadding, colPadding);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("MaxPool2DForward",
+                        static_cast<double>(y.Size()) * windowRows * windowCols,
+                        &y, &x);
     assert(y.Mode() == x.Mode());
 
     const auto device = y.GetCudaDevice();
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         const Dense::Cuda::Shape4D xShape = {
@@ -71,6 +101,7 @@ void MaxPool2DForward(TensorData& y, const TensorData& x, int windowRows,
             Dense::Cuda::PoolingMode::Max, CUDNN_PROPAGATE_NAN, device.GetID());
     }
     else
+#endif
     {
         Dense::Naive::MaxPool2D(y, x, std::make_pair(windowRows, windowCols),
                                 std::make_pair(strideRow, strideCol),
@@ -83,8 +114,19 @@ void AvgPool2DForward(TensorData& y, const TensorData& x, int windowRows,
                       int windowCols, int strideRow, int strideCol,
                       int rowPadding, int colPadding)
 {
+    if (!x.IsContiguousFloat())
+    {
+        AvgPool2DForward(y, x.ContiguousFloat(), windowRows, windowCols, strideRow,
+                         strideCol, rowPadding, colPadding);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("AvgPool2DForward",
+                        static_cast<double>(y.Size()) * windowRows * windowCols,
+                        &y, &x);
     assert(y.Mode() == x.Mode());
     const auto device = y.GetCudaDevice();
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         const Dense::Cuda::Shape4D xShape = {
@@ -100,6 +142,7 @@ void AvgPool2DForward(TensorData& y, const TensorData& x, int windowRows,
             Dense::Cuda::PoolingMode::Avg, CUDNN_PROPAGATE_NAN, device.GetID());
     }
     else
+#endif
     {
         throw std::invalid_argument(
             "Compute::Conv2DForward - Host mode Not implemented");
@@ -111,9 +154,22 @@ void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
                     int strideRow, int strideCol, int rowPadding,
                     int colPadding, int dilationRow, int dilationCol)
 {
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat() || !filter.IsContiguousFloat())
+    {
+        Conv2DBackward(dx, dFilter, dy.ContiguousFloat(), x.ContiguousFloat(),
+                       filter.ContiguousFloat(), strideRow, strideCol, rowPadding,
+                       colPadding, dilationRow, dilationCol);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Conv2DBackward",
+                        4.0 * dy.Size() *
+                          (filter.Size() / filter.GetShape().At(0)),
+                        &dx, &dFilter, &dy, &x, &filter);
     assert(dy.Mode() == dx.Mode() && dy.Mode() == dFilter.Mode());
     assert(dy.Mode() == x.Mode() && dy.Mode() == filter.Mode());
     const auto device = dx.GetCudaDevice();
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
         const Dense::Cuda::Shape4D filterShape = {
@@ -138,6 +194,7 @@ void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
             device.GetID());
     }
     else
+#endif
     {
         Dense::Naive::Conv2DBackward(dx, dFilter, dy, x, filter, strideRow,
                                      strideCol, rowPadding, colPadding,
@@ -151,10 +208,23 @@ void MaxPool2DBackward(TensorData& dx, const TensorData& dy,
                        int strideRow, int strideCol, int rowPadding,
                        int colPadding)
 {
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat() || !y.IsContiguousFloat())
+    {
+        MaxPool2DBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat(), y.ContiguousFloat(),
+                          windowRows, windowCols, strideRow, strideCol,
+                          rowPadding, colPadding);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("MaxPool2DBackward",
+                        static_cast<double>(dy.Size()) * windowRows *
+                          windowCols,
+                        &dx, &dy, &x, &y);
     assert(dx.Mode() == dy.Mode() && dx.Mode() == x.Mode() &&
         dx.Mode() == y.Mode());
 
     const auto device = dx.GetCudaDevice();
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
         const Dense::Cuda::Shape4D xShape = {
@@ -171,6 +241,7 @@ void MaxPool2DBackward(TensorData& dx, const TensorData& dy,
             colPadding, Dense::Cuda::PoolingMode::Max, device.GetID());
     }
     else
+#endif
     {
         Dense::Naive::MaxPool2DBackward(
             dx, x, dy, std::make_pair(windowRows, windowCols),
@@ -187,11 +258,24 @@ void AvgPool2DBackward(TensorData& dx, const TensorData& dy,
                        int strideRow, int strideCol, int rowPadding,
                        int colPadding)
 {
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat() || !y.IsContiguousFloat())
+    {
+        AvgPool2DBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat(), y.ContiguousFloat(),
+                          windowRows, windowCols, strideRow, strideCol,
+                          rowPadding, colPadding);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("AvgPool2DBackward",
+                        static_cast<double>(dy.Size()) * windowRows *
+                          windowCols,
+                        &dx, &dy, &x, &y);
     assert(
         dx.Mode() == dy.Mode() && dx.Mode() == x.Mode() && dx.Mode() == y.Mode(
         ));
 
     const auto device = dx.GetCudaDevice();
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
         const Dense::Cuda::Shape4D xShape = {
@@ -208,6 +292,7 @@ void AvgPool2DBackward(TensorData& dx, const TensorData& dy,
             colPadding, Dense::Cuda::PoolingMode::Avg, device.GetID());
     }
     else
+#endif
     {
         throw std::invalid_argument(
             "Compute::MaxPool2DBackward - Host mode Not implemented");
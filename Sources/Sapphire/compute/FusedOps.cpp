@@ -0,0 +1,241 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/ActivationOps.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/ConvolutionOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/dense/naive/Convolution.hpp>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Activation.cuh>
+#endif
+
+namespace Sapphire::Compute
+{
+namespace
+{
+//! Rows of the output computed at once by LinearActivation on host
+constexpr std::size_t LinearBlockByteSize = 1 << 16;
+
+//! Returns (channels, innerSize) of y where bias is added
+std::pair<int, int> GetBiasLayout(const TensorData& y, const TensorData& bias)
+{
+    const auto yShape = y.GetShape();
+    const auto biasShape = bias.GetShape();
+    if (biasShape.Dim() > yShape.Dim())
+        throw std::invalid_argument(
+            "Compute::BiasActivation - Bias has more dimensions than y");
+
+    int channels = 1, innerSize = 1;
+    bool foundAxis = false;
+    for (int axis = -1; axis >= -biasShape.Dim(); --axis)
+    {
+        if (biasShape.At(biasShape.Dim() + axis) == 1)
+        {
+            if (!foundAxis)
+                innerSize *= yShape.At(yShape.Dim() + axis);
+            continue;
+        }
+        if (foundAxis ||
+            biasShape.At(biasShape.Dim() + axis) !=
+            yShape.At(yShape.Dim() + axis))
+            throw std::invalid_argument(
+                "Compute::BiasActivation - Bias must be broadcastable to y "
+                "along one axis");
+        channels = biasShape.At(biasShape.Dim() + axis);
+        foundAxis = true;
+    }
+    if (!foundAxis)
+        innerSize = 1;
+    return { channels, innerSize };
+}
+
+//! Conv2DActivation on host, with bias given as nullptr if there is none
+//! Returns false without computing anything if the operands are not in the
+//! layout the fused kernel expects
+bool FusedConv2D(TensorData& y, const TensorData& x, const TensorData& filter,
+                 const TensorData* bias, Activation activation, int strideRow,
+                 int strideCol, int dilationRow, int dilationCol,
+                 int rowPadding, int colPadding)
+{
+    const auto yShape = y.GetShape();
+    if (y.Mode() != ComputeMode::Host || !y.IsContiguousFloat() ||
+        (bias && (!bias->IsContiguousFloat() ||
+                  bias->Size() != yShape.At(yShape.Dim() - 3))))
+        return false;
+    if (!x.IsContiguousFloat() || !filter.IsContiguousFloat())
+        return FusedConv2D(y, x.ContiguousFloat(), filter.ContiguousFloat(),
+                           bias, activation, strideRow, strideCol,
+                           dilationRow, dilationCol, rowPadding, colPadding);
+
+    SAPPHIRE_PROFILE_OP("Conv2DActivation",
+                        2.0 * y.Size() *
+                        (filter.Size() / filter.GetShape().At(0)),
+                        &y, &x, &filter);
+    Dense::Naive::Conv2DActivation(
+        y, x, filter, bias ? bias->HostRawPtr() : nullptr,
+        activation == Activation::ReLU, strideRow, strideCol, rowPadding,
+        colPadding, dilationRow, dilationCol);
+    return true;
+}
+} // namespace
+
+void BiasActivation(TensorData& y, const TensorData& bias,
+                    Activation activation)
+{
+    if (!y.IsContiguousFloat() || !bias.IsContiguousFloat())
+    {
+        Add(y, y, bias);
+        if (activation == Activation::ReLU)
+            ReLU(y, y);
+        return;
+    }
+
+    const auto [channels, innerSize] = GetBiasLayout(y, bias);
+    const auto totalSize = static_cast<unsigned int>(y.Size());
+    const bool relu = activation == Activation::ReLU;
+    SAPPHIRE_PROFILE_OP("BiasActivation", y.Size(), &y, &bias);
+
+#ifdef WITH_CUDA
+    if (y.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::BiasActivation(y.CudaMutableRawPtr(), bias.CudaRawPtr(),
+                                    totalSize, channels, innerSize, relu);
+        return;
+    }
+#endif
+    Dense::Naive::BiasActivation(y.HostMutableRawPtr(), bias.HostRawPtr(),
+                                 totalSize / (channels * innerSize), channels,
+                                 innerSize, relu);
+}
+
+void LinearActivation(TensorData& y, const TensorData& x,
+                      const TensorData& weight, const TensorData& bias,
+                      Activation activation)
+{
+    const auto K = weight.GetShape().Rows();
+    const auto N = weight.GetShape().Cols();
+    const bool fusable = y.Mode() == ComputeMode::Host &&
+                         y.IsContiguousFloat() && x.IsContiguousFloat() &&
+                         weight.IsContiguousFloat() &&
+                         bias.IsContiguousFloat() &&
+                         weight.GetShape().Size() == K * N &&
+                         x.Cols() == K && y.Cols() == N &&
+                         bias.Size() == N && x.Size() / K == y.Size() / N;
+    if (!fusable)
+    {
+        Initialize::Zeros(y);
+        Gemm(y, x, weight);
+        BiasActivation(y, bias, activation);
+        return;
+    }
+
+    const auto M = static_cast<std::size_t>(y.Size() / N);
+    SAPPHIRE_PROFILE_OP("LinearActivation", 2.0 * M * N * K, &y, &x, &weight);
+
+    const auto blockRows = std::max<std::size_t>(
+        1, LinearBlockByteSize / (sizeof(float) * N));
+    float* yPtr = y.HostMutableRawPtr();
+    const float* xPtr = x.HostRawPtr();
+    const float* biasPtr = bias.HostRawPtr();
+    const bool relu = activation == Activation::ReLU;
+
+    for (std::size_t rowIdx = 0; rowIdx < M; rowIdx += blockRows)
+    {
+        const auto rows = std::min(blockRows, M - rowIdx);
+        float* out = yPtr + rowIdx * N;
+        std::fill(out, out + rows * N, 0.0f);
+        Dense::Naive::Gemm(static_cast<unsigned int>(rows * N), out,
+                           xPtr + rowIdx * K, weight.HostRawPtr(),
+                           static_cast<unsigned int>(rows),
+                           static_cast<unsigned int>(N),
+                           static_cast<unsigned int>(K));
+        Dense::Naive::BiasActivation(out, biasPtr,
+                                     static_cast<unsigned int>(rows),
+                                     static_cast<unsigned int>(N), 1, relu);
+    }
+}
+
+void Conv2DActivation(TensorData& y, const TensorData& x,
+                      const TensorData& filter, const TensorData& bias,
+                      Activation activation, int strideRow, int strideCol,
+                      int dilationRow, int dilationCol, int rowPadding,
+                      int colPadding)
+{
+    if (FusedConv2D(y, x, filter, &bias, activation, strideRow, strideCol,
+                    dilationRow, dilationCol, rowPadding, colPadding))
+        return;
+
+    Initialize::Zeros(y);
+    Conv2DForward(y, x, filter, strideRow, strideCol, dilationRow,
+                  dilationCol, rowPadding, colPadding);
+    BiasActivation(y, bias, activation);
+}
+
+void Conv2DActivation(TensorData& y, const TensorData& x,
+                      const TensorData& filter, Activation activation,
+                      int strideRow, int strideCol, int dilationRow,
+                      int dilationCol, int rowPadding, int colPadding)
+{
+    if (FusedConv2D(y, x, filter, nullptr, activation, strideRow, strideCol,
+                    dilationRow, dilationCol, rowPadding, colPadding))
+        return;
+
+    Initialize::Zeros(y);
+    Conv2DForward(y, x, filter, strideRow, strideCol, dilationRow,
+                  dilationCol, rowPadding, colPadding);
+    if (activation == Activation::ReLU)
+        ReLU(y, y);
+}
+
+void AddActivation(TensorData& y, const TensorData& a, const TensorData& b,
+                   Activation activation)
+{
+    if (activation == Activation::None)
+    {
+        Add(y, a, b);
+        return;
+    }
+
+    if (!y.IsContiguousFloat() || !a.IsContiguousFloat() ||
+        !b.IsContiguousFloat() || a.Size() != y.Size() ||
+        b.Size() != y.Size())
+    {
+        Add(y, a, b);
+        ReLU(y, y);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("AddActivation", y.Size(), &y, &a, &b);
+    const auto totalSize = static_cast<unsigned int>(y.Size());
+#ifdef WITH_CUDA
+    if (y.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::AddReLU(y.CudaMutableRawPtr(), a.CudaRawPtr(),
+                             b.CudaRawPtr(), totalSize);
+        return;
+    }
+#endif
+    Dense::Naive::AddReLU(y.HostMutableRawPtr(), a.HostRawPtr(),
+                          b.HostRawPtr(), totalSize);
+}
+
+void ActivationBackward(TensorData& dx, const TensorData& dy,
+                        const TensorData& y, Activation activation)
+{
+    if (activation == Activation::ReLU)
+        ReLUBackward(dx, dy, y);
+    else
+        Add(dx, dx, dy);
+}
+} // namespace Sapphire::Compute
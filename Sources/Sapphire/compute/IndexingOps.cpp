@@ -5,6 +5,12 @@
 // property of any third parties.
 
 #include <Sapphire/compute/IndexingOps.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace Sapphire::Compute
 {
@@ -16,4 +22,121 @@ void Flatten(TensorData& tensorData)
     const Shape newShape({ 1, shape.Size() });
     tensorData.Reshape(newShape);
 }
+
+namespace
+{
+std::uint32_t ToRowIndex(float index, int numRows)
+{
+    const auto rowIdx = static_cast<long>(index);
+    if (rowIdx < 0 || rowIdx >= numRows ||
+        static_cast<float>(rowIdx) != index)
+        throw std::out_of_range(
+            "Compute::Embedding - Invalid index (" + std::to_string(index) +
+            ") for table with " + std::to_string(numRows) + " rows");
+    return static_cast<std::uint32_t>(rowIdx);
+}
+} // namespace
+
+void EmbeddingForward(TensorData& y, const TensorData& weight,
+                      const TensorData& indices, int bagSize, bool mean)
+{
+    if (!weight.IsContiguousFloat() || !indices.IsContiguousFloat())
+    {
+        EmbeddingForward(y, weight.ContiguousFloat(), indices.ContiguousFloat(), bagSize,
+                         mean);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("EmbeddingForward", mean ? y.Size() * bagSize : 0,
+                        &y, &indices);
+    if (y.Mode() == ComputeMode::Cuda || weight.Mode() == ComputeMode::Cuda ||
+        indices.Mode() == ComputeMode::Cuda)
+        throw std::runtime_error(
+            "Compute::EmbeddingForward - Cuda not implemented");
+
+    const auto numRows = weight.GetShape().Rows();
+    const auto dim = static_cast<std::size_t>(weight.GetShape().Cols());
+    const auto numIndices = indices.GetShape().Size();
+    const auto numBags = numIndices / bagSize;
+    if (numIndices % bagSize != 0 ||
+        static_cast<std::size_t>(y.GetShape().Size()) != numBags * dim)
+        throw std::invalid_argument(
+            "Compute::EmbeddingForward - Shape mismatch");
+
+    const float* indexPtr = indices.HostRawPtr();
+    const float* weightPtr = weight.HostRawPtr();
+    float* yPtr = y.HostMutableRawPtr();
+    const float scale = mean ? 1.0f / static_cast<float>(bagSize) : 1.0f;
+
+    for (int bagIdx = 0; bagIdx < numBags; ++bagIdx)
+    {
+        float* yRow = yPtr + bagIdx * dim;
+        const auto firstRowIdx = ToRowIndex(indexPtr[bagIdx * bagSize],
+                                            numRows);
+        std::memcpy(yRow, weightPtr + firstRowIdx * dim, dim * sizeof(float));
+
+        for (int i = 1; i < bagSize; ++i)
+        {
+            const float* weightRow =
+                weightPtr + ToRowIndex(indexPtr[bagIdx * bagSize + i],
+                                       numRows) * dim;
+            for (std::size_t col = 0; col < dim; ++col)
+                yRow[col] += weightRow[col];
+        }
+
+        if (mean && bagSize > 1)
+            for (std::size_t col = 0; col < dim; ++col)
+                yRow[col] *= scale;
+    }
+}
+
+void EmbeddingBackward(RowSparseData& dWeight, const TensorData& dy,
+                       const TensorData& indices, int bagSize, bool mean)
+{
+    if (!dy.IsContiguousFloat() || !indices.IsContiguousFloat())
+    {
+        EmbeddingBackward(dWeight, dy.ContiguousFloat(), indices.ContiguousFloat(),
+                          bagSize, mean);
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("EmbeddingBackward", dy.Size() * bagSize,
+                        &dy, &indices);
+    if (dy.Mode() == ComputeMode::Cuda || indices.Mode() == ComputeMode::Cuda)
+        throw std::runtime_error(
+            "Compute::EmbeddingBackward - Cuda not implemented");
+
+    const auto numIndices = indices.GetShape().Size();
+    const auto dim = static_cast<std::size_t>(dy.GetShape().Cols());
+    const float* indexPtr = indices.HostRawPtr();
+    const float* dyPtr = dy.HostRawPtr();
+    const float scale = mean ? 1.0f / static_cast<float>(bagSize) : 1.0f;
+
+    //! Sort (row index, position) pairs so gradients for the same row are
+    //! accumulated together, and stored rows are ordered by row index
+    std::vector<std::pair<std::uint32_t, int>> order(numIndices);
+    for (int i = 0; i < numIndices; ++i)
+        order[i] = { static_cast<std::uint32_t>(indexPtr[i]), i };
+    std::sort(order.begin(), order.end());
+
+    dWeight.Cols = static_cast<int>(dim);
+    dWeight.Indices.clear();
+    dWeight.Rows.clear();
+    dWeight.Indices.reserve(numIndices);
+    dWeight.Rows.reserve(numIndices * dim);
+
+    for (const auto& [rowIdx, position] : order)
+    {
+        if (dWeight.Indices.empty() || dWeight.Indices.back() != rowIdx)
+        {
+            dWeight.Indices.emplace_back(rowIdx);
+            dWeight.Rows.resize(dWeight.Rows.size() + dim, 0.0f);
+        }
+
+        float* gradRow = dWeight.Rows.data() + dWeight.Rows.size() - dim;
+        const float* dyRow = dyPtr + (position / bagSize) * dim;
+        for (std::size_t col = 0; col < dim; ++col)
+            gradRow[col] += dyRow[col] * scale;
+    }
 }
+} // namespace Sapphire::Compute
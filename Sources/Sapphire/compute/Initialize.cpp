@@ -5,16 +5,22 @@
 // property of any third parties.
 
 #include <Sapphire/compute/Initialize.hpp>
-#include <Sapphire/compute/dense/cuda/Initialize.cuh>
 #include <Sapphire/compute/dense/naive/NaiveInitialize.hpp>
+#include <Sapphire/util/Profiler.hpp>
 #include <chrono>
 #include <cmath>
 
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Initialize.cuh>
+#endif
+
 namespace Sapphire::Compute::Initialize
 {
 void Normal(TensorUtil::TensorData& data, float mean, float sd)
 {
+    SAPPHIRE_PROFILE_OP("Normal", 0, &data);
     const auto device = data.GetCudaDevice();
+#ifdef WITH_CUDA
     if (data.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Normal(data.CudaMutableRawPtr(), mean, sd,
@@ -22,6 +28,7 @@ void Normal(TensorUtil::TensorData& data, float mean, float sd)
                             static_cast<int>(std::clock()));
     }
     else
+#endif
     {
         Dense::Naive::Normal(data.HostMutableRawPtr(), mean, sd,
                              data.GetShape());
@@ -30,6 +37,8 @@ void Normal(TensorUtil::TensorData& data, float mean, float sd)
 
 void Uniform(TensorUtil::TensorData& data, float min, float max)
 {
+    SAPPHIRE_PROFILE_OP("Uniform", 0, &data);
+#ifdef WITH_CUDA
     if (const auto device = data.GetCudaDevice();
         data.Mode() == ComputeMode::Cuda)
     {
@@ -38,6 +47,7 @@ void Uniform(TensorUtil::TensorData& data, float min, float max)
                              static_cast<int>(std::clock()));
     }
     else
+#endif
     {
         Dense::Naive::Uniform(data.HostMutableRawPtr(), min, max,
                               data.GetShape());
@@ -46,13 +56,16 @@ void Uniform(TensorUtil::TensorData& data, float min, float max)
 
 void Ones(TensorUtil::TensorData& data)
 {
+    SAPPHIRE_PROFILE_OP("Ones", 0, &data);
     const auto device = data.GetCudaDevice();
+#ifdef WITH_CUDA
     if (data.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Scalar(data.CudaMutableRawPtr(), 1.0f,
                             data.DenseTotalLengthCuda);
     }
     else
+#endif
     {
         Dense::Naive::Scalar(data.HostMutableRawPtr(), 1.0f, data.GetShape());
     }
@@ -60,13 +73,16 @@ void Ones(TensorUtil::TensorData& data)
 
 void Zeros(TensorUtil::TensorData& data)
 {
+    SAPPHIRE_PROFILE_OP("Zeros", 0, &data);
     const auto device = data.GetCudaDevice();
+#ifdef WITH_CUDA
     if (data.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Scalar(data.CudaMutableRawPtr(), 0.0f,
                             data.DenseTotalLengthCuda);
     }
     else
+#endif
     {
         Dense::Naive::Scalar(data.HostMutableRawPtr(), 0.0f, data.GetShape());
     }
@@ -74,13 +90,16 @@ void Zeros(TensorUtil::TensorData& data)
 
 void Scalar(TensorUtil::TensorData& data, float value)
 {
+    SAPPHIRE_PROFILE_OP("Scalar", 0, &data);
     const auto device = data.GetCudaDevice();
+#ifdef WITH_CUDA
     if (data.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Scalar(data.CudaMutableRawPtr(), value,
                             data.DenseTotalLengthCuda);
     }
     else
+#endif
     {
         Dense::Naive::Scalar(data.HostMutableRawPtr(), value, data.GetShape());
     }
@@ -88,7 +107,9 @@ void Scalar(TensorUtil::TensorData& data, float value)
 
 void HeNormal(TensorUtil::TensorData& data, int fanIn)
 {
+    SAPPHIRE_PROFILE_OP("HeNormal", 0, &data);
     const auto device = data.GetCudaDevice();
+#ifdef WITH_CUDA
     if (data.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Normal(
@@ -97,6 +118,7 @@ void HeNormal(TensorUtil::TensorData& data, int fanIn)
             data.DenseTotalLengthCuda, static_cast<int>(std::clock()));
     }
     else
+#endif
     {
         Dense::Naive::Normal(data.HostMutableRawPtr(), 0.0,
                              2.0f / std::sqrt(static_cast<float>(fanIn)),
@@ -106,7 +128,9 @@ void HeNormal(TensorUtil::TensorData& data, int fanIn)
 
 void Xavier(TensorUtil::TensorData& data, int fanIn, int fanOut)
 {
+    SAPPHIRE_PROFILE_OP("Xavier", 0, &data);
     const auto device = data.GetCudaDevice();
+#ifdef WITH_CUDA
     if (data.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Normal(
@@ -115,6 +139,7 @@ void Xavier(TensorUtil::TensorData& data, int fanIn, int fanOut)
             data.DenseTotalLengthCuda, static_cast<int>(std::clock()));
     }
     else
+#endif
     {
         Dense::Naive::Normal(data.HostMutableRawPtr(), 0.0,
                              1.0f / std::sqrt(
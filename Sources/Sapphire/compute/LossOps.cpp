@@ -7,7 +7,12 @@
 #include <Sapphire/compute/LossOps.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
 #include <Sapphire/compute/dense/naive/NaiveCrossEntropy.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <cassert>
+
+#ifdef WITH_CUDA
 #include <Sapphire/compute/dense/cuda/CrossEntropy.cuh>
+#endif
 
 namespace Sapphire::Compute
 {
@@ -17,17 +22,26 @@ constexpr int dxIdx = 0;
 void CrossEntropy(TensorUtil::TensorData& y, const TensorUtil::TensorData& x,
                   const TensorUtil::TensorData& label)
 {
+    if (!x.IsContiguousFloat() || !label.IsContiguousFloat())
+    {
+        CrossEntropy(y, x.ContiguousFloat(), label.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("CrossEntropy", 2.0 * x.Size(), &y, &x, &label);
     assert(y.Mode() == x.Mode());
 
     const auto batchSize = x.GetNumUnits(1);
     const auto unitSize = x.GetUnitSize(1);
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::CrossEntropy(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                                   label.CudaRawPtr(), batchSize, unitSize);
     }
     else
+#endif
     {
         Dense::Naive::CrossEntropy(y.HostMutableRawPtr(), x.HostRawPtr(),
                                    label.HostRawPtr(), batchSize, unitSize);
@@ -38,11 +52,19 @@ void CrossEntropyBackward(TensorUtil::TensorData& dx,
                           const TensorUtil::TensorData& x,
                           const TensorUtil::TensorData& label)
 {
+    if (!x.IsContiguousFloat() || !label.IsContiguousFloat())
+    {
+        CrossEntropyBackward(dx, x.ContiguousFloat(), label.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("CrossEntropyBackward", x.Size(), &dx, &x, &label);
     assert(dx.Mode() == label.Mode());
 
     const auto batchSize = dx.GetNumUnits(1);
     const auto unitSize = dx.GetUnitSize(1);
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::CrossEntropyBackward(
@@ -51,6 +73,7 @@ void CrossEntropyBackward(TensorUtil::TensorData& dx,
             unitSize);
     }
     else
+#endif
     {
         Dense::Naive::CrossEntropyBackward(
             dx.HostMutableRawPtr(), x.HostRawPtr(), label.HostRawPtr(),
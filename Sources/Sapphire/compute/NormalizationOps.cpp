@@ -0,0 +1,272 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/NormalizationOps.hpp>
+#include <Sapphire/compute/OutputCheck.hpp>
+#include <Sapphire/compute/dense/naive/Normalization.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Normalization.cuh>
+#endif
+
+namespace Sapphire::Compute
+{
+namespace
+{
+//! (numUnits, channels, innerSize) layout of x in (N, C, *) shape
+struct ChannelLayout
+{
+    unsigned int NumUnits;
+    unsigned int Channels;
+    unsigned int InnerSize;
+};
+
+ChannelLayout GetChannelLayout(const std::string& name, const TensorData& x,
+                               const TensorData& gamma)
+{
+    const auto shape = x.GetShape();
+    const auto channels = gamma.Size();
+    if (shape.Dim() < 2 || shape.At(1) != channels)
+        throw std::invalid_argument(
+            "Compute::" + name +
+            " - x must have shape of (N, C, *) where C is size of gamma");
+    return { static_cast<unsigned int>(shape.At(0)),
+             static_cast<unsigned int>(channels),
+             static_cast<unsigned int>(shape.Size() /
+                                       (shape.At(0) * channels)) };
+}
+
+//! Returns number of rows of x normalized by layer normalization
+unsigned int GetRows(const std::string& name, const TensorData& x,
+                     const TensorData& gamma)
+{
+    const auto shape = x.GetShape();
+    int trailingSize = 1;
+    for (int axis = shape.Dim() - 1; axis >= 0 && trailingSize < gamma.Size();
+         --axis)
+        trailingSize *= shape.At(axis);
+    if (trailingSize != gamma.Size())
+        throw std::invalid_argument(
+            "Compute::" + name +
+            " - Last dimensions of x must match size of gamma");
+    return static_cast<unsigned int>(shape.Size() / gamma.Size());
+}
+
+void CheckSize(const std::string& name, const TensorData& data, int size)
+{
+    if (data.Size() != size)
+        throw std::invalid_argument("Compute::" + name + " - Size mismatch");
+}
+} // namespace
+
+void BatchNormForward(TensorData& y, TensorData& savedMean,
+                      TensorData& savedInvStd, TensorData& runningMean,
+                      TensorData& runningVar, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      float momentum, float epsilon)
+{
+    const auto [numUnits, channels, innerSize] =
+        GetChannelLayout("BatchNormForward", x, gamma);
+    CheckOutputs("BatchNormForward", x.Mode(),
+                 { &y, &savedMean, &savedInvStd, &runningMean, &runningVar });
+    for (const auto* data : std::initializer_list<const TensorData*>{
+             &savedMean, &savedInvStd, &runningMean, &runningVar, &beta })
+        CheckSize("BatchNormForward", *data, static_cast<int>(channels));
+    CheckSize("BatchNormForward", y, x.Size());
+
+    const auto xData = x.ContiguousFloat();
+    const auto gammaData = gamma.ContiguousFloat();
+    const auto betaData = beta.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("BatchNormForward", 2.0 * x.Size(), &y, &x);
+
+#ifdef WITH_CUDA
+    if (y.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::BatchNormForward(
+            y.CudaMutableRawPtr(), savedMean.CudaMutableRawPtr(),
+            savedInvStd.CudaMutableRawPtr(), runningMean.CudaMutableRawPtr(),
+            runningVar.CudaMutableRawPtr(), xData.CudaRawPtr(),
+            gammaData.CudaRawPtr(), betaData.CudaRawPtr(), numUnits,
+            channels, innerSize, momentum, epsilon);
+        return;
+    }
+#endif
+    std::vector<float> variance(channels);
+    Dense::Naive::BatchNormForward(
+        y.HostMutableRawPtr(), savedMean.HostMutableRawPtr(),
+        savedInvStd.HostMutableRawPtr(), variance.data(), xData.HostRawPtr(),
+        gammaData.HostRawPtr(), betaData.HostRawPtr(), numUnits, channels,
+        innerSize, epsilon);
+    if (momentum == 0.0f)
+        return;
+
+    const auto count = static_cast<float>(numUnits) *
+                       static_cast<float>(innerSize);
+    const float unbiasedFactor = count > 1.0f ? count / (count - 1.0f) : 1.0f;
+    float* meanPtr = runningMean.HostMutableRawPtr();
+    float* varPtr = runningVar.HostMutableRawPtr();
+    const float* batchMean = savedMean.HostRawPtr();
+    for (std::size_t channelIdx = 0; channelIdx < channels; ++channelIdx)
+    {
+        meanPtr[channelIdx] = (1.0f - momentum) * meanPtr[channelIdx] +
+                              momentum * batchMean[channelIdx];
+        varPtr[channelIdx] = (1.0f - momentum) * varPtr[channelIdx] +
+                             momentum * unbiasedFactor * variance[channelIdx];
+    }
+}
+
+void BatchNormInference(TensorData& y, const TensorData& x,
+                        const TensorData& gamma, const TensorData& beta,
+                        const TensorData& runningMean,
+                        const TensorData& runningVar, float epsilon)
+{
+    const auto [numUnits, channels, innerSize] =
+        GetChannelLayout("BatchNormInference", x, gamma);
+    CheckOutputs("BatchNormInference", x.Mode(), { &y });
+    for (const auto* data : { &runningMean, &runningVar, &beta })
+        CheckSize("BatchNormInference", *data, static_cast<int>(channels));
+    CheckSize("BatchNormInference", y, x.Size());
+
+    const auto xData = x.ContiguousFloat();
+    const auto gammaData = gamma.ContiguousFloat();
+    const auto betaData = beta.ContiguousFloat();
+    const auto meanData = runningMean.ContiguousFloat();
+    const auto varData = runningVar.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("BatchNormInference", 2.0 * x.Size(), &y, &x);
+
+#ifdef WITH_CUDA
+    if (y.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::BatchNormInference(
+            y.CudaMutableRawPtr(), xData.CudaRawPtr(), meanData.CudaRawPtr(),
+            varData.CudaRawPtr(), gammaData.CudaRawPtr(),
+            betaData.CudaRawPtr(), numUnits, channels, innerSize, epsilon);
+        return;
+    }
+#endif
+    Dense::Naive::BatchNormInference(
+        y.HostMutableRawPtr(), xData.HostRawPtr(), meanData.HostRawPtr(),
+        varData.HostRawPtr(), gammaData.HostRawPtr(), betaData.HostRawPtr(),
+        numUnits, channels, innerSize, epsilon);
+}
+
+void BatchNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const TensorData& savedMean,
+                       const TensorData& savedInvStd)
+{
+    const auto [numUnits, channels, innerSize] =
+        GetChannelLayout("BatchNormBackward", x, gamma);
+    CheckOutputs("BatchNormBackward", x.Mode(), { &dx, &dGamma, &dBeta });
+    for (const auto* data : std::initializer_list<const TensorData*>{
+             &dGamma, &dBeta, &savedMean, &savedInvStd })
+        CheckSize("BatchNormBackward", *data, static_cast<int>(channels));
+    CheckSize("BatchNormBackward", dx, x.Size());
+    CheckSize("BatchNormBackward", dy, x.Size());
+
+    const auto dyData = dy.ContiguousFloat();
+    const auto xData = x.ContiguousFloat();
+    const auto gammaData = gamma.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("BatchNormBackward", 4.0 * x.Size(), &dx, &dy, &x);
+
+#ifdef WITH_CUDA
+    if (dx.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::BatchNormBackward(
+            dx.CudaMutableRawPtr(), dGamma.CudaMutableRawPtr(),
+            dBeta.CudaMutableRawPtr(), dyData.CudaRawPtr(), xData.CudaRawPtr(),
+            savedMean.CudaRawPtr(), savedInvStd.CudaRawPtr(),
+            gammaData.CudaRawPtr(), numUnits, channels, innerSize);
+        return;
+    }
+#endif
+    Dense::Naive::BatchNormBackward(
+        dx.HostMutableRawPtr(), dGamma.HostMutableRawPtr(),
+        dBeta.HostMutableRawPtr(), dyData.HostRawPtr(), xData.HostRawPtr(),
+        savedMean.HostRawPtr(), savedInvStd.HostRawPtr(),
+        gammaData.HostRawPtr(), numUnits, channels, innerSize);
+}
+
+void LayerNormForward(TensorData& y, TensorData& savedMean,
+                      TensorData& savedInvStd, const TensorData& x,
+                      const TensorData& gamma, const TensorData& beta,
+                      float epsilon)
+{
+    const auto rows = GetRows("LayerNormForward", x, gamma);
+    const auto rowSize = static_cast<unsigned int>(gamma.Size());
+    CheckOutputs("LayerNormForward", x.Mode(),
+                 { &y, &savedMean, &savedInvStd });
+    CheckSize("LayerNormForward", savedMean, static_cast<int>(rows));
+    CheckSize("LayerNormForward", savedInvStd, static_cast<int>(rows));
+    CheckSize("LayerNormForward", beta, gamma.Size());
+    CheckSize("LayerNormForward", y, x.Size());
+
+    const auto xData = x.ContiguousFloat();
+    const auto gammaData = gamma.ContiguousFloat();
+    const auto betaData = beta.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("LayerNormForward", 2.0 * x.Size(), &y, &x);
+
+#ifdef WITH_CUDA
+    if (y.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::LayerNormForward(
+            y.CudaMutableRawPtr(), savedMean.CudaMutableRawPtr(),
+            savedInvStd.CudaMutableRawPtr(), xData.CudaRawPtr(),
+            gammaData.CudaRawPtr(), betaData.CudaRawPtr(), rows, rowSize,
+            epsilon);
+        return;
+    }
+#endif
+    Dense::Naive::LayerNormForward(
+        y.HostMutableRawPtr(), savedMean.HostMutableRawPtr(),
+        savedInvStd.HostMutableRawPtr(), xData.HostRawPtr(),
+        gammaData.HostRawPtr(), betaData.HostRawPtr(), rows, rowSize,
+        epsilon);
+}
+
+void LayerNormBackward(TensorData& dx, TensorData& dGamma, TensorData& dBeta,
+                       const TensorData& dy, const TensorData& x,
+                       const TensorData& gamma, const TensorData& savedMean,
+                       const TensorData& savedInvStd)
+{
+    const auto rows = GetRows("LayerNormBackward", x, gamma);
+    const auto rowSize = static_cast<unsigned int>(gamma.Size());
+    CheckOutputs("LayerNormBackward", x.Mode(), { &dx, &dGamma, &dBeta });
+    CheckSize("LayerNormBackward", savedMean, static_cast<int>(rows));
+    CheckSize("LayerNormBackward", savedInvStd, static_cast<int>(rows));
+    CheckSize("LayerNormBackward", dGamma, gamma.Size());
+    CheckSize("LayerNormBackward", dBeta, gamma.Size());
+    CheckSize("LayerNormBackward", dx, x.Size());
+    CheckSize("LayerNormBackward", dy, x.Size());
+
+    const auto dyData = dy.ContiguousFloat();
+    const auto xData = x.ContiguousFloat();
+    const auto gammaData = gamma.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("LayerNormBackward", 4.0 * x.Size(), &dx, &dy, &x);
+
+#ifdef WITH_CUDA
+    if (dx.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::LayerNormBackward(
+            dx.CudaMutableRawPtr(), dGamma.CudaMutableRawPtr(),
+            dBeta.CudaMutableRawPtr(), dyData.CudaRawPtr(), xData.CudaRawPtr(),
+            savedMean.CudaRawPtr(), savedInvStd.CudaRawPtr(),
+            gammaData.CudaRawPtr(), rows, rowSize);
+        return;
+    }
+#endif
+    Dense::Naive::LayerNormBackward(
+        dx.HostMutableRawPtr(), dGamma.HostMutableRawPtr(),
+        dBeta.HostMutableRawPtr(), dyData.HostRawPtr(), xData.HostRawPtr(),
+        savedMean.HostRawPtr(), savedInvStd.HostRawPtr(),
+        gammaData.HostRawPtr(), rows, rowSize);
+}
+} // namespace Sapphire::Compute
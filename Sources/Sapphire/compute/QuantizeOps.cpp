@@ -0,0 +1,256 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/QuantizeOps.hpp>
+#include <Sapphire/compute/dense/naive/Convolution.hpp>
+#include <Sapphire/compute/dense/naive/Quantize.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Compute
+{
+namespace
+{
+//! Arrays of Int8Epilogue padded to Int8PaddedWidth
+struct EpilogueData
+{
+    std::vector<float> Scale;
+    std::vector<std::int32_t> Offset;
+    std::vector<float> Bias;
+};
+
+//! Combines scales of activation and weight, and removes zero point of the
+//! activation using sum of the quantized weights of each channel
+EpilogueData MakeEpilogue(const Int8Weight& weight,
+                          QuantizationParams inputParams, const float* bias)
+{
+    const auto paddedN = Dense::Naive::Int8PaddedWidth(weight.Outputs());
+    EpilogueData data{ std::vector<float>(paddedN, 0.0f),
+                       std::vector<std::int32_t>(paddedN, 0),
+                       std::vector<float>(paddedN, 0.0f) };
+
+    const auto& scales = weight.GetScales();
+    const auto& columnSums = weight.GetColumnSums();
+    for (int nIdx = 0; nIdx < weight.Outputs(); ++nIdx)
+    {
+        data.Scale[nIdx] = inputParams.Scale * scales[nIdx];
+        data.Offset[nIdx] = -inputParams.ZeroPoint * columnSums[nIdx];
+        data.Bias[nIdx] = bias ? bias[nIdx] : 0.0f;
+    }
+    return data;
+}
+
+void CheckHost(const std::string& name, const TensorData& y,
+               const TensorData& x)
+{
+    if (y.Mode() != ComputeMode::Host || x.Mode() != ComputeMode::Host)
+        throw std::invalid_argument("Compute::" + name +
+                                    " - Only available in host mode");
+    if (!y.IsContiguousFloat())
+        throw std::invalid_argument("Compute::" + name +
+                                    " - y must be contiguous Float32 data");
+}
+
+void GemmInt8(TensorData& y, const TensorData& x, const Int8Weight& weight,
+              const float* bias, QuantizationParams inputParams, bool relu)
+{
+    if (!x.IsContiguousFloat())
+    {
+        GemmInt8(y, x.ContiguousFloat(), weight, bias, inputParams, relu);
+        return;
+    }
+
+    CheckHost("GemmInt8", y, x);
+    const auto K = static_cast<unsigned int>(weight.Inputs());
+    const auto N = static_cast<unsigned int>(weight.Outputs());
+    if (x.Cols() != weight.Inputs() || y.Cols() != weight.Outputs() ||
+        x.Size() / K != y.Size() / N)
+        throw std::invalid_argument("Compute::GemmInt8 - Shape mismatch");
+
+    const auto M = static_cast<unsigned int>(x.Size()) / K;
+    SAPPHIRE_PROFILE_OP("GemmInt8", 2.0 * M * N * K, &y, &x);
+
+    const auto paddedK = Dense::Naive::Int8PaddedDepth(K);
+    std::vector<std::uint8_t> quantized(static_cast<std::size_t>(M) *
+                                        paddedK);
+    Dense::Naive::QuantizeActivation(quantized.data(), x.HostRawPtr(), M, K,
+                                     paddedK, K, 1, inputParams.Scale,
+                                     inputParams.ZeroPoint);
+
+    const auto epilogue = MakeEpilogue(weight, inputParams, bias);
+    Dense::Naive::GemmInt8(
+        y.HostMutableRawPtr(), quantized.data(), weight.Data(), M, N, paddedK,
+        { epilogue.Scale.data(), epilogue.Offset.data(),
+          epilogue.Bias.data(), relu });
+}
+
+void Conv2DInt8(TensorData& y, const TensorData& x, const Int8Weight& filter,
+                const float* bias, QuantizationParams inputParams,
+                int strideRow, int strideCol, int dilationRow, int dilationCol,
+                int rowPadding, int columnPadding, bool relu)
+{
+    if (!x.IsContiguousFloat())
+    {
+        Conv2DInt8(y, x.ContiguousFloat(), filter, bias, inputParams,
+                   strideRow, strideCol, dilationRow, dilationCol, rowPadding,
+                   columnPadding, relu);
+        return;
+    }
+
+    CheckHost("Conv2DInt8", y, x);
+    const auto filterShape = filter.GetShape();
+    const auto xShape = x.GetShape();
+    const auto yShape = y.GetShape();
+    if (xShape.Dim() < 4 || yShape.Dim() < 4 ||
+        xShape.At(-3) != filterShape.At(1) ||
+        yShape.At(-3) != filter.Outputs() ||
+        x.GetNumUnits(3) != y.GetNumUnits(3))
+        throw std::invalid_argument("Compute::Conv2DInt8 - Shape mismatch");
+
+    const auto numUnits = static_cast<unsigned int>(y.GetNumUnits(3));
+    const auto K = static_cast<unsigned int>(filter.Inputs());
+    const auto N = static_cast<unsigned int>(filter.Outputs());
+    const auto P = static_cast<unsigned int>(yShape.Rows() * yShape.Cols());
+    SAPPHIRE_PROFILE_OP("Conv2DInt8", 2.0 * numUnits * P * N * K, &y, &x);
+
+    //! Each column of inputMatrix is a window of x, so the transpose of it is
+    //! multiplied with the filter
+    TensorData inputMatrix(Shape({ static_cast<int>(numUnits),
+                                   static_cast<int>(K), static_cast<int>(P) }),
+                           Type::Dense);
+    Dense::Naive::Im2Col(inputMatrix, filterShape, x, strideRow, strideCol,
+                         rowPadding, columnPadding, dilationRow, dilationCol,
+                         0);
+
+    const auto paddedK = Dense::Naive::Int8PaddedDepth(K);
+    std::vector<std::uint8_t> quantized(static_cast<std::size_t>(P) *
+                                        paddedK);
+    std::vector<float> transposed(static_cast<std::size_t>(P) * N);
+    const auto epilogue = MakeEpilogue(filter, inputParams, bias);
+
+    for (std::size_t unitIdx = 0; unitIdx < numUnits; ++unitIdx)
+    {
+        Dense::Naive::QuantizeActivation(
+            quantized.data(), inputMatrix.HostRawPtr() + unitIdx * K * P, P,
+            K, paddedK, 1, P, inputParams.Scale, inputParams.ZeroPoint);
+        Dense::Naive::GemmInt8(
+            transposed.data(), quantized.data(), filter.Data(), P, N, paddedK,
+            { epilogue.Scale.data(), epilogue.Offset.data(),
+              epilogue.Bias.data(), relu });
+
+        float* out = y.HostMutableRawPtr() + unitIdx * N * P;
+        for (std::size_t pIdx = 0; pIdx < P; ++pIdx)
+            for (std::size_t nIdx = 0; nIdx < N; ++nIdx)
+                out[nIdx * P + pIdx] = transposed[pIdx * N + nIdx];
+    }
+}
+
+//! Returns contiguous Float32 bias after checking its size
+TensorData GetBias(const std::string& name, const TensorData& bias,
+                   int outputs)
+{
+    if (bias.Mode() != ComputeMode::Host)
+        throw std::invalid_argument("Compute::" + name +
+                                    " - Only available in host mode");
+    if (bias.Size() != outputs)
+        throw std::invalid_argument("Compute::" + name +
+                                    " - Bias size mismatch");
+    return bias.ContiguousFloat();
+}
+} // namespace
+
+void RangeObserver::Observe(const TensorData& x)
+{
+    if (x.Mode() != ComputeMode::Host)
+        throw std::invalid_argument(
+            "Compute::RangeObserver::Observe - Only available in host mode");
+
+    const auto data = x.ContiguousFloat();
+    const float* begin = data.HostRawPtr();
+    const auto [minIt, maxIt] = std::minmax_element(begin,
+                                                    begin + data.Size());
+    if (minIt == begin + data.Size())
+        return;
+
+    m_min = m_empty ? *minIt : std::min(m_min, *minIt);
+    m_max = m_empty ? *maxIt : std::max(m_max, *maxIt);
+    m_empty = false;
+}
+
+QuantizationParams RangeObserver::GetParams() const
+{
+    const float minValue = std::min(m_min, 0.0f);
+    const float maxValue = std::max(m_max, 0.0f);
+
+    QuantizationParams params;
+    if (maxValue > minValue)
+        params.Scale = (maxValue - minValue) / Dense::Naive::Int8ActivationMax;
+    params.ZeroPoint = std::clamp(
+        static_cast<int>(std::nearbyint(-minValue / params.Scale)), 0,
+        Dense::Naive::Int8ActivationMax);
+    return params;
+}
+
+Int8Weight::Int8Weight(const TensorData& weight, bool outputChannelFirst)
+    : m_shape(weight.GetShape())
+{
+    if (weight.Mode() != ComputeMode::Host)
+        throw std::invalid_argument(
+            "Compute::Int8Weight::Int8Weight - Only available in host mode");
+
+    const auto data = weight.ContiguousFloat();
+    m_outputs = outputChannelFirst ? m_shape.At(0) : m_shape.Cols();
+    m_inputs = m_shape.Size() / m_outputs;
+
+    const auto K = static_cast<unsigned int>(m_inputs);
+    const auto N = static_cast<unsigned int>(m_outputs);
+    m_packed.resize(static_cast<std::size_t>(Dense::Naive::Int8PaddedDepth(K)) *
+                    Dense::Naive::Int8PaddedWidth(N));
+    m_scales.resize(N);
+    m_columnSums.resize(N);
+    Dense::Naive::PackInt8Weight(m_packed.data(), m_scales.data(),
+                                 m_columnSums.data(), data.HostRawPtr(), K, N,
+                                 outputChannelFirst ? 1 : N,
+                                 outputChannelFirst ? K : 1);
+}
+
+void GemmInt8(TensorData& y, const TensorData& x, const Int8Weight& weight,
+              QuantizationParams inputParams, bool relu)
+{
+    GemmInt8(y, x, weight, nullptr, inputParams, relu);
+}
+
+void GemmInt8(TensorData& y, const TensorData& x, const Int8Weight& weight,
+              const TensorData& bias, QuantizationParams inputParams,
+              bool relu)
+{
+    const auto biasData = GetBias("GemmInt8", bias, weight.Outputs());
+    GemmInt8(y, x, weight, biasData.HostRawPtr(), inputParams, relu);
+}
+
+void Conv2DInt8(TensorData& y, const TensorData& x, const Int8Weight& filter,
+                QuantizationParams inputParams, int strideRow, int strideCol,
+                int dilationRow, int dilationCol, int rowPadding,
+                int columnPadding, bool relu)
+{
+    Conv2DInt8(y, x, filter, nullptr, inputParams, strideRow, strideCol,
+               dilationRow, dilationCol, rowPadding, columnPadding, relu);
+}
+
+void Conv2DInt8(TensorData& y, const TensorData& x, const Int8Weight& filter,
+                const TensorData& bias, QuantizationParams inputParams,
+                int strideRow, int strideCol, int dilationRow, int dilationCol,
+                int rowPadding, int columnPadding, bool relu)
+{
+    const auto biasData = GetBias("Conv2DInt8", bias, filter.Outputs());
+    Conv2DInt8(y, x, filter, biasData.HostRawPtr(), inputParams, strideRow,
+               strideCol, dilationRow, dilationCol, rowPadding, columnPadding,
+               relu);
+}
+} // namespace Sapphire::Compute
@@ -0,0 +1,446 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/FusedOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/OutputCheck.hpp>
+#include <Sapphire/compute/RecurrentOps.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/compute/dense/naive/Recurrent.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <stdexcept>
+#include <string>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Gemm.cuh>
+#include <Sapphire/compute/dense/cuda/Recurrent.cuh>
+#endif
+
+namespace Sapphire::Compute
+{
+namespace
+{
+//! (steps, batchSize, inputSize) layout of the input and hidden size
+struct SequenceLayout
+{
+    unsigned int Steps;
+    unsigned int BatchSize;
+    unsigned int InputSize;
+    unsigned int HiddenSize;
+};
+
+SequenceLayout GetLayout(const std::string& name, const TensorData& x,
+                         const TensorData& weightIh,
+                         const TensorData& weightHh, int numGates)
+{
+    const auto xShape = x.GetShape();
+    const auto ihShape = weightIh.GetShape();
+    const auto hhShape = weightHh.GetShape();
+    if (xShape.Dim() != 3)
+        throw std::invalid_argument(
+            "Compute::" + name + " - x must have shape of (T, N, inputSize)");
+
+    const auto inputSize = xShape.At(2);
+    const auto hiddenSize = hhShape.Rows();
+    if (ihShape.Dim() != 2 || hhShape.Dim() != 2 ||
+        ihShape.Rows() != inputSize ||
+        ihShape.Cols() != numGates * hiddenSize ||
+        hhShape.Cols() != numGates * hiddenSize)
+        throw std::invalid_argument("Compute::" + name +
+                                    " - Weight shape mismatch");
+    return { static_cast<unsigned int>(xShape.At(0)),
+             static_cast<unsigned int>(xShape.At(1)),
+             static_cast<unsigned int>(inputSize),
+             static_cast<unsigned int>(hiddenSize) };
+}
+
+void CheckSize(const std::string& name, const TensorData& data,
+               unsigned int size)
+{
+    if (data.Size() != static_cast<int>(size))
+        throw std::invalid_argument("Compute::" + name + " - Size mismatch");
+}
+
+const float* RawPtr(const TensorData& data)
+{
+    return data.Mode() == ComputeMode::Cuda ? data.CudaRawPtr()
+                                            : data.HostRawPtr();
+}
+
+float* MutableRawPtr(const TensorData& data)
+{
+    return data.Mode() == ComputeMode::Cuda ? data.CudaMutableRawPtr()
+                                            : data.HostMutableRawPtr();
+}
+
+//! Allocates contiguous Float32 data in mode and device of reference
+TensorData CreateBuffer(unsigned int rows, unsigned int cols,
+                        const TensorData& reference)
+{
+    TensorData buffer(Shape({ static_cast<int>(rows),
+                              static_cast<int>(cols) }),
+                      Type::Dense, reference.GetCudaDevice());
+    buffer.SetMode(reference.Mode());
+    return buffer;
+}
+
+//! out += op(a) * op(b) where op(a) is (M, K) and op(b) is (K, N), on raw
+//! arrays in mode of reference, so slices of time steps are multiplied
+//! without copies
+void MatMul(const TensorData& reference, float* out, const float* a,
+            const float* b, unsigned int M, unsigned int N, unsigned int K,
+            bool transposeA, bool transposeB)
+{
+    if (M == 0 || N == 0 || K == 0)
+        return;
+#ifdef WITH_CUDA
+    if (reference.Mode() == ComputeMode::Cuda)
+    {
+        Dense::Cuda::GemmTransposed(M * N, out, a, b, M, N, K, transposeA,
+                                    transposeB,
+                                    reference.GetCudaDevice().GetID());
+        return;
+    }
+#endif
+    Dense::Naive::GemmTransposed(M * N, out, a, b, M, N, K, transposeA,
+                                 transposeB);
+}
+
+//! Overwrites out with sums of every row of (rows, cols) matrix
+void ColumnSums(TensorData& out, const float* matrix, unsigned int rows,
+                unsigned int cols)
+{
+    Initialize::Zeros(out);
+#ifdef WITH_CUDA
+    if (out.Mode() == ComputeMode::Cuda)
+    {
+        auto ones = CreateBuffer(1, rows, out);
+        Initialize::Ones(ones);
+        MatMul(out, out.CudaMutableRawPtr(), ones.CudaRawPtr(), matrix, 1,
+               cols, rows, false, false);
+        ones.ReleaseMemory();
+        return;
+    }
+#endif
+    float* sums = out.HostMutableRawPtr();
+    for (std::size_t rowIdx = 0; rowIdx < rows; ++rowIdx)
+    {
+        const float* row = matrix + rowIdx * cols;
+#pragma omp simd
+        for (std::size_t colIdx = 0; colIdx < cols; ++colIdx)
+            sums[colIdx] += row[colIdx];
+    }
+}
+
+//! Input projection x * weightIh + bias of every time step in a single gemm
+void ProjectInput(TensorData& projection, const TensorData& x,
+                  const TensorData& weightIh, const TensorData& bias,
+                  const SequenceLayout& layout)
+{
+    const auto rows = static_cast<int>(layout.Steps * layout.BatchSize);
+    auto x2D = x;
+    x2D.Reshape(Shape({ rows, static_cast<int>(layout.InputSize) }));
+    auto projection2D = projection;
+    projection2D.Reshape(Shape({ rows, weightIh.GetShape().Cols() }));
+    LinearActivation(projection2D, x2D, weightIh, bias, Activation::None);
+}
+
+//! Computes gradients of the weights and x from gradients of the input
+//! projection (dInputProj) and hidden projection (dHiddenProj) of every time
+//! step, each with a single gemm over the sequence
+void AccumulateWeightGradients(TensorData& dx, TensorData& dWeightIh,
+                               TensorData& dWeightHh, const TensorData& x,
+                               const TensorData& y,
+                               const TensorData& weightIh,
+                               const float* dInputProj,
+                               const float* dHiddenProj,
+                               const SequenceLayout& layout,
+                               unsigned int gateSize)
+{
+    const auto [steps, batchSize, inputSize, hiddenSize] = layout;
+    const auto rows = steps * batchSize;
+
+    Initialize::Zeros(dWeightIh);
+    MatMul(dWeightIh, MutableRawPtr(dWeightIh), RawPtr(x), dInputProj,
+           inputSize, gateSize, rows, true, false);
+
+    //! Hidden projection of step t multiplies the hidden state of step t - 1,
+    //! and the zero initial state has no gradient
+    Initialize::Zeros(dWeightHh);
+    MatMul(dWeightHh, MutableRawPtr(dWeightHh), RawPtr(y),
+           dHiddenProj + batchSize * gateSize, hiddenSize, gateSize,
+           rows - batchSize, true, false);
+
+    MatMul(dx, MutableRawPtr(dx), dInputProj, RawPtr(weightIh), rows,
+           inputSize, gateSize, false, true);
+}
+} // namespace
+
+void LstmForward(TensorData& y, TensorData& gates, TensorData& cells,
+                 const TensorData& x, const TensorData& weightIh,
+                 const TensorData& weightHh, const TensorData& bias)
+{
+    const auto layout = GetLayout("LstmForward", x, weightIh, weightHh, 4);
+    const auto [steps, batchSize, inputSize, hiddenSize] = layout;
+    const auto stateSize = batchSize * hiddenSize;
+    CheckOutputs("LstmForward", x.Mode(), { &y, &gates, &cells });
+    CheckSize("LstmForward", y, steps * stateSize);
+    CheckSize("LstmForward", cells, steps * stateSize);
+    CheckSize("LstmForward", gates, 4 * steps * stateSize);
+    CheckSize("LstmForward", bias, 4 * hiddenSize);
+
+    const auto xData = x.ContiguousFloat();
+    const auto weightHhData = weightHh.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("LstmForward",
+                        8.0 * steps * stateSize * (inputSize + hiddenSize),
+                        &y, &x);
+
+    ProjectInput(gates, xData, weightIh, bias, layout);
+
+    float* gatePtr = MutableRawPtr(gates);
+    float* cellPtr = MutableRawPtr(cells);
+    float* hiddenPtr = MutableRawPtr(y);
+    const float* weightHhPtr = RawPtr(weightHhData);
+    for (unsigned int step = 0; step < steps; ++step)
+    {
+        float* gate = gatePtr + 4 * step * stateSize;
+        const float* hiddenPrev =
+            step > 0 ? hiddenPtr + (step - 1) * stateSize : nullptr;
+        const float* cellPrev =
+            step > 0 ? cellPtr + (step - 1) * stateSize : nullptr;
+
+        //! Every gate of the step in a single gemm
+        if (hiddenPrev)
+            MatMul(y, gate, hiddenPrev, weightHhPtr, batchSize,
+                   4 * hiddenSize, hiddenSize, false, false);
+
+#ifdef WITH_CUDA
+        if (y.Mode() == ComputeMode::Cuda)
+            Dense::Cuda::LstmCellForward(gate, cellPtr + step * stateSize,
+                                         hiddenPtr + step * stateSize,
+                                         cellPrev, batchSize, hiddenSize);
+        else
+#endif
+            Dense::Naive::LstmCellForward(gate, cellPtr + step * stateSize,
+                                          hiddenPtr + step * stateSize,
+                                          cellPrev, batchSize, hiddenSize);
+    }
+}
+
+void LstmBackward(TensorData& dx, TensorData& dWeightIh,
+                  TensorData& dWeightHh, TensorData& dBias,
+                  const TensorData& dy, const TensorData& x,
+                  const TensorData& y, const TensorData& weightIh,
+                  const TensorData& weightHh, const TensorData& gates,
+                  const TensorData& cells)
+{
+    const auto layout = GetLayout("LstmBackward", x, weightIh, weightHh, 4);
+    const auto [steps, batchSize, inputSize, hiddenSize] = layout;
+    const auto stateSize = batchSize * hiddenSize;
+    CheckOutputs("LstmBackward", x.Mode(),
+                 { &dx, &dWeightIh, &dWeightHh, &dBias, &y, &gates, &cells });
+    CheckSize("LstmBackward", dx, x.Size());
+    CheckSize("LstmBackward", dy, steps * stateSize);
+    CheckSize("LstmBackward", dWeightIh, weightIh.Size());
+    CheckSize("LstmBackward", dWeightHh, weightHh.Size());
+    CheckSize("LstmBackward", dBias, 4 * hiddenSize);
+
+    const auto dyData = dy.ContiguousFloat();
+    const auto xData = x.ContiguousFloat();
+    const auto weightIhData = weightIh.ContiguousFloat();
+    const auto weightHhData = weightHh.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("LstmBackward",
+                        16.0 * steps * stateSize * (inputSize + hiddenSize),
+                        &dx, &dy, &x);
+
+    auto dGates = CreateBuffer(steps * batchSize, 4 * hiddenSize, x);
+    auto dCell = CreateBuffer(batchSize, hiddenSize, x);
+    auto dHiddenNext = CreateBuffer(batchSize, hiddenSize, x);
+    Initialize::Zeros(dCell);
+
+    float* dGatePtr = MutableRawPtr(dGates);
+    const float* gatePtr = RawPtr(gates);
+    const float* cellPtr = RawPtr(cells);
+    const float* dyPtr = RawPtr(dyData);
+    for (unsigned int step = steps; step-- > 0;)
+    {
+        float* dGate = dGatePtr + 4 * step * stateSize;
+        const float* cellPrev =
+            step > 0 ? cellPtr + (step - 1) * stateSize : nullptr;
+        const float* dHidden =
+            step + 1 < steps ? RawPtr(dHiddenNext) : nullptr;
+
+#ifdef WITH_CUDA
+        if (x.Mode() == ComputeMode::Cuda)
+            Dense::Cuda::LstmCellBackward(
+                dGate, dCell.CudaMutableRawPtr(), dyPtr + step * stateSize,
+                dHidden, gatePtr + 4 * step * stateSize,
+                cellPtr + step * stateSize, cellPrev, batchSize, hiddenSize);
+        else
+#endif
+            Dense::Naive::LstmCellBackward(
+                dGate, dCell.HostMutableRawPtr(), dyPtr + step * stateSize,
+                dHidden, gatePtr + 4 * step * stateSize,
+                cellPtr + step * stateSize, cellPrev, batchSize, hiddenSize);
+
+        if (step > 0)
+        {
+            Initialize::Zeros(dHiddenNext);
+            MatMul(x, MutableRawPtr(dHiddenNext), dGate,
+                   RawPtr(weightHhData), batchSize, hiddenSize,
+                   4 * hiddenSize, false, true);
+        }
+    }
+
+    AccumulateWeightGradients(dx, dWeightIh, dWeightHh, xData, y,
+                              weightIhData, dGatePtr, dGatePtr, layout,
+                              4 * hiddenSize);
+    ColumnSums(dBias, dGatePtr, steps * batchSize, 4 * hiddenSize);
+
+    dGates.ReleaseMemory();
+    dCell.ReleaseMemory();
+    dHiddenNext.ReleaseMemory();
+}
+
+void GruForward(TensorData& y, TensorData& gates, const TensorData& x,
+                const TensorData& weightIh, const TensorData& weightHh,
+                const TensorData& biasIh, const TensorData& biasHh)
+{
+    const auto layout = GetLayout("GruForward", x, weightIh, weightHh, 3);
+    const auto [steps, batchSize, inputSize, hiddenSize] = layout;
+    const auto stateSize = batchSize * hiddenSize;
+    CheckOutputs("GruForward", x.Mode(), { &y, &gates });
+    CheckSize("GruForward", y, steps * stateSize);
+    CheckSize("GruForward", gates, 4 * steps * stateSize);
+    CheckSize("GruForward", biasIh, 3 * hiddenSize);
+    CheckSize("GruForward", biasHh, 3 * hiddenSize);
+
+    const auto xData = x.ContiguousFloat();
+    const auto weightHhData = weightHh.ContiguousFloat();
+    const auto biasHhData = biasHh.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("GruForward",
+                        6.0 * steps * stateSize * (inputSize + hiddenSize),
+                        &y, &x);
+
+    auto inputProj = CreateBuffer(steps * batchSize, 3 * hiddenSize, x);
+    auto hiddenProj = CreateBuffer(batchSize, 3 * hiddenSize, x);
+    ProjectInput(inputProj, xData, weightIh, biasIh, layout);
+
+    float* gatePtr = MutableRawPtr(gates);
+    float* hiddenPtr = MutableRawPtr(y);
+    const float* inputProjPtr = RawPtr(inputProj);
+    for (unsigned int step = 0; step < steps; ++step)
+    {
+        const float* hiddenPrev =
+            step > 0 ? hiddenPtr + (step - 1) * stateSize : nullptr;
+
+        //! Every gate of the step in a single gemm. Bias of the hidden
+        //! projection is added by the cell kernel
+        if (hiddenPrev)
+        {
+            Initialize::Zeros(hiddenProj);
+            MatMul(y, MutableRawPtr(hiddenProj), hiddenPrev,
+                   RawPtr(weightHhData), batchSize, 3 * hiddenSize,
+                   hiddenSize, false, false);
+        }
+        const float* hiddenProjPtr = hiddenPrev ? RawPtr(hiddenProj)
+                                                : nullptr;
+
+#ifdef WITH_CUDA
+        if (y.Mode() == ComputeMode::Cuda)
+            Dense::Cuda::GruCellForward(
+                gatePtr + 4 * step * stateSize, hiddenPtr + step * stateSize,
+                inputProjPtr + 3 * step * stateSize, hiddenProjPtr,
+                biasHhData.CudaRawPtr(), hiddenPrev, batchSize, hiddenSize);
+        else
+#endif
+            Dense::Naive::GruCellForward(
+                gatePtr + 4 * step * stateSize, hiddenPtr + step * stateSize,
+                inputProjPtr + 3 * step * stateSize, hiddenProjPtr,
+                biasHhData.HostRawPtr(), hiddenPrev, batchSize, hiddenSize);
+    }
+
+    inputProj.ReleaseMemory();
+    hiddenProj.ReleaseMemory();
+}
+
+void GruBackward(TensorData& dx, TensorData& dWeightIh, TensorData& dWeightHh,
+                 TensorData& dBiasIh, TensorData& dBiasHh,
+                 const TensorData& dy, const TensorData& x,
+                 const TensorData& y, const TensorData& weightIh,
+                 const TensorData& weightHh, const TensorData& gates)
+{
+    const auto layout = GetLayout("GruBackward", x, weightIh, weightHh, 3);
+    const auto [steps, batchSize, inputSize, hiddenSize] = layout;
+    const auto stateSize = batchSize * hiddenSize;
+    CheckOutputs("GruBackward", x.Mode(),
+                 { &dx, &dWeightIh, &dWeightHh, &dBiasIh, &dBiasHh, &y,
+                   &gates });
+    CheckSize("GruBackward", dx, x.Size());
+    CheckSize("GruBackward", dy, steps * stateSize);
+    CheckSize("GruBackward", dWeightIh, weightIh.Size());
+    CheckSize("GruBackward", dWeightHh, weightHh.Size());
+    CheckSize("GruBackward", dBiasIh, 3 * hiddenSize);
+    CheckSize("GruBackward", dBiasHh, 3 * hiddenSize);
+
+    const auto dyData = dy.ContiguousFloat();
+    const auto xData = x.ContiguousFloat();
+    const auto weightIhData = weightIh.ContiguousFloat();
+    const auto weightHhData = weightHh.ContiguousFloat();
+    SAPPHIRE_PROFILE_OP("GruBackward",
+                        12.0 * steps * stateSize * (inputSize + hiddenSize),
+                        &dx, &dy, &x);
+
+    auto dInputProj = CreateBuffer(steps * batchSize, 3 * hiddenSize, x);
+    auto dHiddenProj = CreateBuffer(steps * batchSize, 3 * hiddenSize, x);
+    auto dHiddenNext = CreateBuffer(batchSize, hiddenSize, x);
+
+    float* dInputProjPtr = MutableRawPtr(dInputProj);
+    float* dHiddenProjPtr = MutableRawPtr(dHiddenProj);
+    float* dHiddenNextPtr = MutableRawPtr(dHiddenNext);
+    const float* gatePtr = RawPtr(gates);
+    const float* hiddenPtr = RawPtr(y);
+    const float* dyPtr = RawPtr(dyData);
+    for (unsigned int step = steps; step-- > 0;)
+    {
+        float* dHiddenProjStep = dHiddenProjPtr + 3 * step * stateSize;
+        const float* hiddenPrev =
+            step > 0 ? hiddenPtr + (step - 1) * stateSize : nullptr;
+        const float* dHidden = step + 1 < steps ? dHiddenNextPtr : nullptr;
+
+        //! Gradient of the previous hidden state through the update gate
+        //! replaces dHiddenNext in place
+#ifdef WITH_CUDA
+        if (x.Mode() == ComputeMode::Cuda)
+            Dense::Cuda::GruCellBackward(
+                dInputProjPtr + 3 * step * stateSize, dHiddenProjStep,
+                dHiddenNextPtr, dyPtr + step * stateSize, dHidden,
+                gatePtr + 4 * step * stateSize, hiddenPrev, batchSize,
+                hiddenSize);
+        else
+#endif
+            Dense::Naive::GruCellBackward(
+                dInputProjPtr + 3 * step * stateSize, dHiddenProjStep,
+                dHiddenNextPtr, dyPtr + step * stateSize, dHidden,
+                gatePtr + 4 * step * stateSize, hiddenPrev, batchSize,
+                hiddenSize);
+
+        if (step > 0)
+            MatMul(x, dHiddenNextPtr, dHiddenProjStep, RawPtr(weightHhData),
+                   batchSize, hiddenSize, 3 * hiddenSize, false, true);
+    }
+
+    AccumulateWeightGradients(dx, dWeightIh, dWeightHh, xData, y,
+                              weightIhData, dInputProjPtr, dHiddenProjPtr,
+                              layout, 3 * hiddenSize);
+    ColumnSums(dBiasIh, dInputProjPtr, steps * batchSize, 3 * hiddenSize);
+    ColumnSums(dBiasHh, dHiddenProjPtr, steps * batchSize, 3 * hiddenSize);
+
+    dInputProj.ReleaseMemory();
+    dHiddenProj.ReleaseMemory();
+    dHiddenNext.ReleaseMemory();
+}
+} // namespace Sapphire::Compute
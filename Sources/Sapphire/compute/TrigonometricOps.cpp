@@ -5,21 +5,36 @@
 // property of any third parties.
 
 #include <Sapphire/compute/TrigonometricOps.hpp>
-#include <Sapphire/compute/dense/cuda/Trigonometric.cuh>
+#include <Sapphire/compute/OutputCheck.hpp>
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/util/Profiler.hpp>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Trigonometric.cuh>
+#endif
 
 namespace Sapphire::Compute
 {
 void Cos(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Cos", y);
+    if (!x.IsContiguousFloat())
+    {
+        Cos(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Cos", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Cos(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Cos(y.HostMutableRawPtr(), x.HostRawPtr(),
                           totalSize);
@@ -28,14 +43,24 @@ void Cos(TensorData& y, const TensorData& x)
 
 void Sin(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Sin", y);
+    if (!x.IsContiguousFloat())
+    {
+        Sin(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Sin", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Sin(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Sin(y.HostMutableRawPtr(), x.HostRawPtr(),
                           totalSize);
@@ -44,14 +69,24 @@ void Sin(TensorData& y, const TensorData& x)
 
 void Tan(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Tan", y);
+    if (!x.IsContiguousFloat())
+    {
+        Tan(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Tan", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Tan(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Tan(y.HostMutableRawPtr(), x.HostRawPtr(),
                           totalSize);
@@ -60,14 +95,24 @@ void Tan(TensorData& y, const TensorData& x)
 
 void Cosh(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Cosh", y);
+    if (!x.IsContiguousFloat())
+    {
+        Cosh(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Cosh", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Cosh(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Cosh(y.HostMutableRawPtr(), x.HostRawPtr(),
                            totalSize);
@@ -76,14 +121,24 @@ void Cosh(TensorData& y, const TensorData& x)
 
 void Sinh(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Sinh", y);
+    if (!x.IsContiguousFloat())
+    {
+        Sinh(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Sinh", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Sinh(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Sinh(y.HostMutableRawPtr(), x.HostRawPtr(),
                            totalSize);
@@ -92,14 +147,24 @@ void Sinh(TensorData& y, const TensorData& x)
 
 void Tanh(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Tanh", y);
+    if (!x.IsContiguousFloat())
+    {
+        Tanh(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Tanh", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
     const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
         Dense::Cuda::Tanh(y.CudaMutableRawPtr(), x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         Dense::Naive::Tanh(y.HostMutableRawPtr(), x.HostRawPtr(),
                            totalSize);
@@ -108,15 +173,25 @@ void Tanh(TensorData& y, const TensorData& x)
 
 void ArcCos(TensorData& y, const TensorData& x)
 {
+    CheckOutput("ArcCos", y);
+    if (!x.IsContiguousFloat())
+    {
+        ArcCos(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcCos", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
-    const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = y.Size();
         Dense::Cuda::ArcCos(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                             totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::ArcCos - Host not implemented");
     }
@@ -124,15 +199,25 @@ void ArcCos(TensorData& y, const TensorData& x)
 
 void Arcsin(TensorData& y, const TensorData& x)
 {
+    CheckOutput("Arcsin", y);
+    if (!x.IsContiguousFloat())
+    {
+        Arcsin(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("Arcsin", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
-    const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = y.Size();
         Dense::Cuda::ArcSin(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                             totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::ArcSin - Host not implemented");
     }
@@ -141,15 +226,25 @@ void Arcsin(TensorData& y, const TensorData& x)
 
 void ArcTan(TensorData& y, const TensorData& x)
 {
+    CheckOutput("ArcTan", y);
+    if (!x.IsContiguousFloat())
+    {
+        ArcTan(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcTan", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
-    const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = y.Size();
         Dense::Cuda::ArcTan(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                             totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::ArcTan - Host not implemented");
     }
@@ -157,14 +252,24 @@ void ArcTan(TensorData& y, const TensorData& x)
 
 void ArcCosh(TensorData& y, const TensorData& x)
 {
+    CheckOutput("ArcCosh", y);
+    if (!x.IsContiguousFloat())
+    {
+        ArcCosh(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcCosh", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
-    const auto totalSize = y.Size();
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = y.Size();
         Dense::Cuda::ArcCosh(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                              totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::ArcCosh - Host not implemented");
     }
@@ -172,15 +277,25 @@ void ArcCosh(TensorData& y, const TensorData& x)
 
 void ArcSinh(TensorData& y, const TensorData& x)
 {
+    CheckOutput("ArcSinh", y);
+    if (!x.IsContiguousFloat())
+    {
+        ArcSinh(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcSinh", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
-    const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = y.Size();
         Dense::Cuda::ArcSinh(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                              totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::ArcSinh - Host not implemented");
     }
@@ -188,15 +303,25 @@ void ArcSinh(TensorData& y, const TensorData& x)
 
 void ArcTanh(TensorData& y, const TensorData& x)
 {
+    CheckOutput("ArcTanh", y);
+    if (!x.IsContiguousFloat())
+    {
+        ArcTanh(y, x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcTanh", y.Size(), &y, &x);
     const auto device = y.GetCudaDevice();
-    const auto totalSize = y.Size();
 
+#ifdef WITH_CUDA
     if (y.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = y.Size();
         Dense::Cuda::ArcTanh(y.CudaMutableRawPtr(), x.CudaRawPtr(),
                              totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::ArcTanh - Host not implemented");
     }
@@ -204,15 +329,25 @@ void ArcTanh(TensorData& y, const TensorData& x)
 
 void CosBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("CosBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        CosBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("CosBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::CosBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                  x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::CosBackward - Host not implemented");
     }
@@ -220,15 +355,25 @@ void CosBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void SinBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("SinBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        SinBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("SinBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::SinBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                  x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::SinBackward - Host not implemented");
     }
@@ -236,15 +381,25 @@ void SinBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void TanBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("TanBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        TanBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("TanBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::TanBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                  x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error("Compute::TanBackward - Host not implemented");
     }
@@ -252,15 +407,25 @@ void TanBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void CoshBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("CoshBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        CoshBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("CoshBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::CoshBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                   x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::CoshBackward - Host not implemented");
@@ -269,15 +434,25 @@ void CoshBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void SinhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("SinhBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        SinhBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("SinhBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::SinhBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                   x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::SinhBackward - Host not implemented");
@@ -286,15 +461,25 @@ void SinhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void TanhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("TanhBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        TanhBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("TanhBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::TanhBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                   x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::TanhBackward - Host not implemented");
@@ -303,15 +488,25 @@ void TanhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void ArcCosBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("ArcCosBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        ArcCosBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcCosBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::ArcCosBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                     x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::ArcCosBackward - Host not implemented");
@@ -320,15 +515,25 @@ void ArcCosBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void ArcSinBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("ArcSinBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        ArcSinBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcSinBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::ArcSinBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                     x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::ArcSinBackward - Host not implemented");
@@ -337,15 +542,25 @@ void ArcSinBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void ArcTanBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("ArcTanBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        ArcTanBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcTanBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::ArcTanBackward(dx.CudaMutableRawPtr(), dy.CudaRawPtr(),
                                     x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::ArcTanBackward- Host not implemented");
@@ -354,16 +569,26 @@ void ArcTanBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void ArcCoshBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("ArcCoshBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        ArcCoshBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcCoshBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::ArcCoshBackward(dx.CudaMutableRawPtr(),
                                      dy.CudaRawPtr(),
                                      x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::ArcCoshBackward - Host not implemented");
@@ -372,16 +597,26 @@ void ArcCoshBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void ArcSinhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("ArcSinhBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        ArcSinhBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcSinhBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::ArcSinhBackward(dx.CudaMutableRawPtr(),
                                      dy.CudaRawPtr(),
                                      x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::ArcSinhBackward - Host not implemented");
@@ -390,16 +625,26 @@ void ArcSinhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 
 void ArcTanhBackward(TensorData& dx, const TensorData& dy, const TensorData& x)
 {
+    CheckOutput("ArcTanhBackward", dx);
+    if (!dy.IsContiguousFloat() || !x.IsContiguousFloat())
+    {
+        ArcTanhBackward(dx, dy.ContiguousFloat(), x.ContiguousFloat());
+        return;
+    }
+
+    SAPPHIRE_PROFILE_OP("ArcTanhBackward", dx.Size(), &dx, &dy, &x);
     const auto device = dx.GetCudaDevice();
-    const auto totalSize = dx.Size();
 
+#ifdef WITH_CUDA
     if (dx.Mode() == ComputeMode::Cuda)
     {
+        const auto totalSize = dx.Size();
         Dense::Cuda::ArcTanhBackward(dx.CudaMutableRawPtr(),
                                      dy.CudaRawPtr(),
                                      x.CudaRawPtr(), totalSize);
     }
     else
+#endif
     {
         throw std::runtime_error(
             "Compute::ArcTanhBackward - Host not implemented");
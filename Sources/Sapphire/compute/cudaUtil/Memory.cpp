@@ -6,11 +6,13 @@
 
 #include <Sapphire/compute/cudaUtil/Memory.hpp>
 #include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+#include <cstdlib>
 #include <stdexcept>
 #include <string>
 
 namespace Sapphire::Compute::Cuda
 {
+#ifdef WITH_CUDA
 void CudaSetDevice(int deviceId)
 {
     int deviceCount;
@@ -43,6 +45,30 @@ void CudaFree(void* ptr)
                                  std::string(cudaGetErrorString(error)));
 }
 
+void CudaMallocHost(void** ptr, std::size_t byteSize)
+{
+    const cudaError_t error = cudaMallocHost(ptr, byteSize);
+    if (error != cudaSuccess)
+        throw std::runtime_error("CudaMallocHost failed with " +
+                                 std::string(cudaGetErrorString(error)));
+}
+
+void CudaFreeHost(void* ptr)
+{
+    const cudaError_t error = cudaFreeHost(ptr);
+    if (error != cudaSuccess)
+        throw std::runtime_error("CudaFreeHost failed with " +
+                                 std::string(cudaGetErrorString(error)));
+}
+
+void CudaDeviceSynchronize()
+{
+    const cudaError_t error = cudaDeviceSynchronize();
+    if (error != cudaSuccess)
+        throw std::runtime_error("CudaDeviceSynchronize failed with " +
+                                 std::string(cudaGetErrorString(error)));
+}
+
 void CopyHostToDevice(void* devicePtr, void* hostPtr, unsigned int byteSize)
 {
     const cudaError_t error = cudaMemcpy((void*)(devicePtr), (void*)(hostPtr),
@@ -97,5 +123,66 @@ void CopyDeviceToDeviceBroadcast(void* dst, const void* src,
                 std::string(cudaGetErrorString(error)));
     }
 }
+#else
+namespace
+{
+[[noreturn]] void ThrowNoCuda(const std::string& functionName)
+{
+    throw std::runtime_error(functionName +
+                             " - Sapphire was built without cuda");
+}
+} // namespace
+
+void CudaSetDevice(int)
+{
+    ThrowNoCuda("CudaSetDevice");
+}
+
+void CudaMalloc(void**, unsigned int)
+{
+    ThrowNoCuda("CudaMalloc");
+}
 
+void CudaFree(void*)
+{
+    ThrowNoCuda("CudaFree");
+}
+
+void CudaMallocHost(void** ptr, std::size_t byteSize)
+{
+    *ptr = std::malloc(byteSize);
+    if (*ptr == nullptr && byteSize > 0)
+        throw std::runtime_error("CudaMallocHost - Allocation failed");
+}
+
+void CudaFreeHost(void* ptr)
+{
+    std::free(ptr);
+}
+
+void CudaDeviceSynchronize()
+{
+}
+
+void CopyHostToDevice(void*, void*, unsigned int)
+{
+    ThrowNoCuda("CopyHostToDevice");
+}
+
+void CopyDeviceToHost(void*, void*, unsigned int)
+{
+    ThrowNoCuda("CopyDeviceToHost");
+}
+
+void CopyDeviceToDevice(void*, const void*, unsigned int)
+{
+    ThrowNoCuda("CopyDeviceToDevice");
+}
+
+void CopyDeviceToDeviceBroadcast(void*, const void*, unsigned int,
+                                 unsigned int)
+{
+    ThrowNoCuda("CopyDeviceToDeviceBroadcast");
+}
+#endif
 }  // namespace Sapphire::Compute::Cuda
@@ -49,6 +49,44 @@ __host__ void LeakyReLU(float* y, const float* x, const float a,
 }
 
 
+__host__ void BiasActivation(float* y, const float* bias,
+                             unsigned int totalSize, unsigned int channels,
+                             unsigned int innerSize, bool relu)
+{
+    const auto threadDim = MAX_THREAD_DIM_X / NUM_LOOPS;
+
+    const auto blockDim = totalSize / (threadDim * NUM_LOOPS);
+    const auto firstLaunchSize = blockDim * threadDim * NUM_LOOPS;
+
+    if (firstLaunchSize > 0)
+        BiasActivationKernel<<<blockDim, threadDim>>>(
+            y, bias, 0, firstLaunchSize, channels, innerSize, relu);
+    if (totalSize > firstLaunchSize)
+    {
+        BiasActivationKernel<<<1, totalSize - firstLaunchSize>>>(
+            y, bias, firstLaunchSize, totalSize - firstLaunchSize, channels,
+            innerSize, relu);
+    }
+}
+
+__host__ void AddReLU(float* y, const float* a, const float* b,
+                      unsigned int totalSize)
+{
+    const auto threadDim = MAX_THREAD_DIM_X / NUM_LOOPS;
+
+    const auto blockDim = totalSize / (threadDim * NUM_LOOPS);
+    const auto firstLaunchSize = blockDim * threadDim * NUM_LOOPS;
+
+    if (firstLaunchSize > 0)
+        AddReLUKernel<<<blockDim, threadDim>>>(y, a, b, firstLaunchSize);
+    if (totalSize > firstLaunchSize)
+    {
+        AddReLUKernel<<<1, totalSize - firstLaunchSize>>>(
+            y + firstLaunchSize, a + firstLaunchSize, b + firstLaunchSize,
+            totalSize - firstLaunchSize);
+    }
+}
+
 __host__ void ReLUBackward(float* dx, const float* dy, const float* x,
                            unsigned int totalSize)
 {
@@ -101,6 +101,17 @@ __host__ void Transpose(float* y, const float* x,
                                              inputNumCols, broadcastInput);
 }
 
+__host__ void StridedCopy(float* dst, const float* src,
+                          const StridedLayout& layout, unsigned int totalSize)
+{
+    if (totalSize == 0)
+        return;
+
+    const auto threadDim = MAX_THREAD_DIM_X;
+    const auto blockDim = (totalSize + threadDim - 1) / threadDim;
+    StridedCopyKernel<<<blockDim, threadDim>>>(dst, src, layout, totalSize);
+}
+
 __host__ void Dot(unsigned int totalSize, float* y, const float* a,
                   const float* b, unsigned int inputStride,
                   bool broadcastInputA, bool broadcastInputB)
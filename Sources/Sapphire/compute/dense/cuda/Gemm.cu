@@ -20,6 +20,17 @@ __host__ void Gemm(unsigned int totalSize, float* out, const float* A,
                    const float* B, unsigned int M, unsigned int N,
                    unsigned int K,
                    int deviceId)
+{
+    GemmTransposed(totalSize, out, A, B, M, N, K, false, false, deviceId);
+}
+
+//! cublas assumes column major matrices, so row major (M x N) output is
+//! computed as (N x M) column major matrix out^T = B^T * A^T
+//! Transposed inputs are handled by operation of cublas without copying them
+__host__ void GemmTransposed(unsigned int totalSize, float* out,
+                             const float* A, const float* B, unsigned int M,
+                             unsigned int N, unsigned int K, bool transposeA,
+                             bool transposeB, int deviceId)
 {
     const auto tid = std::this_thread::get_id();
     if (!Util::ResourceManager::HasCublasHandle(deviceId, tid))
@@ -37,15 +48,16 @@ __host__ void Gemm(unsigned int totalSize, float* out, const float* A,
     const auto strideB = K * N;
     const auto strideOut = M * N;
 
-    const float* ptrA = A;
-    const float* ptrB = B;
-    float* ptrOut = out;
+    const auto opA = transposeA ? CUBLAS_OP_T : CUBLAS_OP_N;
+    const auto opB = transposeB ? CUBLAS_OP_T : CUBLAS_OP_N;
+    const auto leadingDimA = static_cast<int>(transposeA ? M : K);
+    const auto leadingDimB = static_cast<int>(transposeB ? K : N);
 
     CHECK_CUBLAS(cublasGemmStridedBatchedEx(
-        *handle, CUBLAS_OP_N, CUBLAS_OP_N, static_cast<int>(N),
-        static_cast<int>(M), static_cast<int>(K), &alpha, ptrB, CUDA_R_32F,
-        static_cast<int>(N), strideB, ptrA, CUDA_R_32F, static_cast<int>(K),
-        strideA, &beta, ptrOut, CUDA_R_32F, static_cast<int>(N), strideOut,
+        *handle, opB, opA, static_cast<int>(N),
+        static_cast<int>(M), static_cast<int>(K), &alpha, B, CUDA_R_32F,
+        leadingDimB, strideB, A, CUDA_R_32F, leadingDimA,
+        strideA, &beta, out, CUDA_R_32F, static_cast<int>(N), strideOut,
         static_cast<int>(totalSize / strideOut), CUBLAS_COMPUTE_32F_FAST_TF32,
         CUBLAS_GEMM_DEFAULT_TENSOR_OP))
 }
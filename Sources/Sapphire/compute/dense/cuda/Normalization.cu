@@ -0,0 +1,116 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/cuda/Normalization.cuh>
+#include <Sapphire/compute/dense/cuda/kernels/NormalizationKernel.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+__host__ void BatchNormForward(float* y, float* mean, float* invStd,
+                               float* runningMean, float* runningVar,
+                               const float* x, const float* gamma,
+                               const float* beta, unsigned int numUnits,
+                               unsigned int channels, unsigned int innerSize,
+                               float momentum, float epsilon)
+{
+    BatchNormStatisticsKernel<<<channels, NormalizationBlockDim>>>(
+        mean, invStd, runningMean, runningVar, x, numUnits, channels,
+        innerSize, momentum, epsilon);
+
+    const auto totalSize = numUnits * channels * innerSize;
+    const auto threadDim = MAX_THREAD_DIM_X / NUM_LOOPS;
+
+    const auto blockDim = totalSize / (threadDim * NUM_LOOPS);
+    const auto firstLaunchSize = blockDim * threadDim * NUM_LOOPS;
+
+    if (firstLaunchSize > 0)
+        BatchNormNormalizeKernel<<<blockDim, threadDim>>>(
+            y, x, mean, invStd, gamma, beta, 0, firstLaunchSize, channels,
+            innerSize);
+    if (totalSize > firstLaunchSize)
+    {
+        BatchNormNormalizeKernel<<<1, totalSize - firstLaunchSize>>>(
+            y, x, mean, invStd, gamma, beta, firstLaunchSize,
+            totalSize - firstLaunchSize, channels, innerSize);
+    }
+}
+
+__host__ void BatchNormInference(float* y, const float* x,
+                                 const float* runningMean,
+                                 const float* runningVar, const float* gamma,
+                                 const float* beta, unsigned int numUnits,
+                                 unsigned int channels, unsigned int innerSize,
+                                 float epsilon)
+{
+    const auto totalSize = numUnits * channels * innerSize;
+    const auto threadDim = MAX_THREAD_DIM_X / NUM_LOOPS;
+
+    const auto blockDim = totalSize / (threadDim * NUM_LOOPS);
+    const auto firstLaunchSize = blockDim * threadDim * NUM_LOOPS;
+
+    if (firstLaunchSize > 0)
+        BatchNormInferenceKernel<<<blockDim, threadDim>>>(
+            y, x, runningMean, runningVar, gamma, beta, epsilon, 0,
+            firstLaunchSize, channels, innerSize);
+    if (totalSize > firstLaunchSize)
+    {
+        BatchNormInferenceKernel<<<1, totalSize - firstLaunchSize>>>(
+            y, x, runningMean, runningVar, gamma, beta, epsilon,
+            firstLaunchSize, totalSize - firstLaunchSize, channels,
+            innerSize);
+    }
+}
+
+__host__ void BatchNormBackward(float* dx, float* dGamma, float* dBeta,
+                                const float* dy, const float* x,
+                                const float* mean, const float* invStd,
+                                const float* gamma, unsigned int numUnits,
+                                unsigned int channels, unsigned int innerSize)
+{
+    BatchNormBackwardReduceKernel<<<channels, NormalizationBlockDim>>>(
+        dGamma, dBeta, dy, x, mean, invStd, numUnits, channels, innerSize);
+
+    const auto totalSize = numUnits * channels * innerSize;
+    const auto count = static_cast<float>(numUnits * innerSize);
+    const auto threadDim = MAX_THREAD_DIM_X / NUM_LOOPS;
+
+    const auto blockDim = totalSize / (threadDim * NUM_LOOPS);
+    const auto firstLaunchSize = blockDim * threadDim * NUM_LOOPS;
+
+    if (firstLaunchSize > 0)
+        BatchNormBackwardKernel<<<blockDim, threadDim>>>(
+            dx, dy, x, mean, invStd, gamma, dGamma, dBeta, count, 0,
+            firstLaunchSize, channels, innerSize);
+    if (totalSize > firstLaunchSize)
+    {
+        BatchNormBackwardKernel<<<1, totalSize - firstLaunchSize>>>(
+            dx, dy, x, mean, invStd, gamma, dGamma, dBeta, count,
+            firstLaunchSize, totalSize - firstLaunchSize, channels,
+            innerSize);
+    }
+}
+
+__host__ void LayerNormForward(float* y, float* mean, float* invStd,
+                               const float* x, const float* gamma,
+                               const float* beta, unsigned int rows,
+                               unsigned int rowSize, float epsilon)
+{
+    LayerNormForwardKernel<<<rows, NormalizationBlockDim>>>(
+        y, mean, invStd, x, gamma, beta, rowSize, epsilon);
+}
+
+__host__ void LayerNormBackward(float* dx, float* dGamma, float* dBeta,
+                                const float* dy, const float* x,
+                                const float* mean, const float* invStd,
+                                const float* gamma, unsigned int rows,
+                                unsigned int rowSize)
+{
+    CHECK_CUDA(cudaMemset(dGamma, 0, rowSize * sizeof(float)));
+    CHECK_CUDA(cudaMemset(dBeta, 0, rowSize * sizeof(float)));
+    LayerNormBackwardKernel<<<rows, NormalizationBlockDim>>>(
+        dx, dGamma, dBeta, dy, x, mean, invStd, gamma, rowSize);
+}
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/cuda/Recurrent.cuh>
+#include <Sapphire/compute/dense/cuda/kernels/RecurrentKernel.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+namespace
+{
+//! Calls launch(blocks, threads, offset, launchSize) to cover totalSize
+//! elements, with the remainder in a single block
+template <typename Launch>
+__host__ void LaunchElementWise(unsigned int totalSize, Launch launch)
+{
+    const auto threadDim = MAX_THREAD_DIM_X / NUM_LOOPS;
+
+    const auto blockDim = totalSize / (threadDim * NUM_LOOPS);
+    const auto firstLaunchSize = blockDim * threadDim * NUM_LOOPS;
+
+    if (firstLaunchSize > 0)
+        launch(blockDim, threadDim, 0, firstLaunchSize);
+    if (totalSize > firstLaunchSize)
+        launch(1, totalSize - firstLaunchSize, firstLaunchSize,
+               totalSize - firstLaunchSize);
+}
+} // namespace
+
+__host__ void LstmCellForward(float* gates, float* cell, float* hidden,
+                              const float* cellPrev, unsigned int batchSize,
+                              unsigned int hiddenSize)
+{
+    LaunchElementWise(
+        batchSize * hiddenSize,
+        [=](unsigned int blocks, unsigned int threads, unsigned int offset,
+            unsigned int launchSize)
+        {
+            LstmCellForwardKernel<<<blocks, threads>>>(
+                gates, cell, hidden, cellPrev, offset, launchSize,
+                hiddenSize);
+        });
+}
+
+__host__ void LstmCellBackward(float* dGates, float* dCell,
+                               const float* dHidden, const float* dHiddenNext,
+                               const float* gates, const float* cell,
+                               const float* cellPrev, unsigned int batchSize,
+                               unsigned int hiddenSize)
+{
+    LaunchElementWise(
+        batchSize * hiddenSize,
+        [=](unsigned int blocks, unsigned int threads, unsigned int offset,
+            unsigned int launchSize)
+        {
+            LstmCellBackwardKernel<<<blocks, threads>>>(
+                dGates, dCell, dHidden, dHiddenNext, gates, cell, cellPrev,
+                offset, launchSize, hiddenSize);
+        });
+}
+
+__host__ void GruCellForward(float* gates, float* hidden,
+                             const float* inputProj, const float* hiddenProj,
+                             const float* hiddenBias, const float* hiddenPrev,
+                             unsigned int batchSize, unsigned int hiddenSize)
+{
+    LaunchElementWise(
+        batchSize * hiddenSize,
+        [=](unsigned int blocks, unsigned int threads, unsigned int offset,
+            unsigned int launchSize)
+        {
+            GruCellForwardKernel<<<blocks, threads>>>(
+                gates, hidden, inputProj, hiddenProj, hiddenBias, hiddenPrev,
+                offset, launchSize, hiddenSize);
+        });
+}
+
+__host__ void GruCellBackward(float* dInputProj, float* dHiddenProj,
+                              float* dHiddenPrev, const float* dHidden,
+                              const float* dHiddenNext, const float* gates,
+                              const float* hiddenPrev, unsigned int batchSize,
+                              unsigned int hiddenSize)
+{
+    LaunchElementWise(
+        batchSize * hiddenSize,
+        [=](unsigned int blocks, unsigned int threads, unsigned int offset,
+            unsigned int launchSize)
+        {
+            GruCellBackwardKernel<<<blocks, threads>>>(
+                dInputProj, dHiddenProj, dHiddenPrev, dHidden, dHiddenNext,
+                gates, hiddenPrev, offset, launchSize, hiddenSize);
+        });
+}
+} // namespace Sapphire::Compute::Dense::Cuda
@@ -35,6 +35,39 @@ __global__ void LeakyReLUKernel(float* y, const float* x,
     }
 }
 
+__global__ void BiasActivationKernel(float* y, const float* bias,
+                                     unsigned int offset,
+                                     unsigned int launchSize,
+                                     unsigned int channels,
+                                     unsigned int innerSize, bool relu)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+
+    for (unsigned int i = 0; i < numLoops; i++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * i + threadIdx.x;
+        const auto value = y[idx] + bias[(idx / innerSize) % channels];
+        y[idx] = relu && value < 0.0f ? 0.0f : value;
+    }
+}
+
+__global__ void AddReLUKernel(float* y, const float* a, const float* b,
+                              unsigned int totalSize)
+{
+    const auto sizePerBlock = totalSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+
+    for (unsigned int i = 0; i < numLoops; i++)
+    {
+        const auto idx = blockOffset + blockDim.x * i + threadIdx.x;
+        const auto value = a[idx] + b[idx];
+        y[idx] = value > 0.0f ? value : 0.0f;
+    }
+}
+
 __global__ void SoftMaxKernel(float* y, const float* x, unsigned int totalSize,
                               unsigned int unitSize)
 {
@@ -112,6 +112,29 @@ __global__ void TransposeKernel(float* y, const float* x,
     }
 }
 
+//! Each thread copies elements at (blockIdx.x * blockDim.x + threadIdx.x)
+//! with stride of total number of threads
+__global__ void StridedCopyKernel(float* dst, const float* src,
+                                  StridedLayout layout,
+                                  unsigned int totalSize)
+{
+    for (unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+         idx < totalSize; idx += gridDim.x * blockDim.x)
+    {
+        long dstOffset = 0;
+        long srcOffset = 0;
+        unsigned int leftOver = idx;
+        for (int dim = layout.Dim - 1; dim >= 0; --dim)
+        {
+            const auto dimIdx = static_cast<long>(leftOver % layout.Shape[dim]);
+            leftOver /= layout.Shape[dim];
+            dstOffset += dimIdx * layout.DstStrides[dim];
+            srcOffset += dimIdx * layout.SrcStrides[dim];
+        }
+        dst[dstOffset] = src[srcOffset];
+    }
+}
+
 __global__ void ScaleKernel(float* y, const float* x,
                             const float scaleFactor, unsigned int totalSize)
 {
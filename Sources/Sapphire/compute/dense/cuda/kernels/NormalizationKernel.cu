@@ -0,0 +1,286 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/cuda/kernels/NormalizationKernel.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+namespace
+{
+//! Merges Welford states of threads in the block. Merged state is left in
+//! index 0 of the shared arrays
+__device__ void BlockMergeWelford(float* sharedMean, float* sharedM2,
+                                  float* sharedCount, float mean, float m2,
+                                  float count)
+{
+    const auto tid = threadIdx.x;
+    sharedMean[tid] = mean;
+    sharedM2[tid] = m2;
+    sharedCount[tid] = count;
+    __syncthreads();
+
+    for (unsigned int stride = blockDim.x / 2; stride > 0; stride /= 2)
+    {
+        if (tid < stride)
+        {
+            const float countA = sharedCount[tid];
+            const float countB = sharedCount[tid + stride];
+            const float total = countA + countB;
+            if (total > 0.0f)
+            {
+                const float delta = sharedMean[tid + stride] - sharedMean[tid];
+                sharedMean[tid] += delta * countB / total;
+                sharedM2[tid] += sharedM2[tid + stride] +
+                    delta * delta * countA * countB / total;
+                sharedCount[tid] = total;
+            }
+        }
+        __syncthreads();
+    }
+}
+
+//! Sums values of threads in the block into index 0 of the shared arrays
+__device__ void BlockSum2(float* sharedA, float* sharedB, float a, float b)
+{
+    const auto tid = threadIdx.x;
+    sharedA[tid] = a;
+    sharedB[tid] = b;
+    __syncthreads();
+
+    for (unsigned int stride = blockDim.x / 2; stride > 0; stride /= 2)
+    {
+        if (tid < stride)
+        {
+            sharedA[tid] += sharedA[tid + stride];
+            sharedB[tid] += sharedB[tid + stride];
+        }
+        __syncthreads();
+    }
+}
+
+__device__ void WelfordAdd(float& mean, float& m2, float& count, float value)
+{
+    count += 1.0f;
+    const float delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+}
+} // namespace
+
+__global__ void BatchNormStatisticsKernel(float* mean, float* invStd,
+                                          float* runningMean,
+                                          float* runningVar, const float* x,
+                                          unsigned int numUnits,
+                                          unsigned int channels,
+                                          unsigned int innerSize,
+                                          float momentum, float epsilon)
+{
+    __shared__ float sharedMean[NormalizationBlockDim];
+    __shared__ float sharedM2[NormalizationBlockDim];
+    __shared__ float sharedCount[NormalizationBlockDim];
+
+    const auto channelIdx = blockIdx.x;
+    const auto channelSize = numUnits * innerSize;
+    float threadMean = 0.0f, threadM2 = 0.0f, threadCount = 0.0f;
+    for (unsigned int i = threadIdx.x; i < channelSize; i += blockDim.x)
+    {
+        const auto idx =
+            (i / innerSize * channels + channelIdx) * innerSize +
+            i % innerSize;
+        WelfordAdd(threadMean, threadM2, threadCount, x[idx]);
+    }
+    BlockMergeWelford(sharedMean, sharedM2, sharedCount, threadMean, threadM2,
+                      threadCount);
+
+    if (threadIdx.x == 0)
+    {
+        const float count = sharedCount[0];
+        const float variance = sharedM2[0] / count;
+        const float unbiasedVariance =
+            count > 1.0f ? sharedM2[0] / (count - 1.0f) : variance;
+        mean[channelIdx] = sharedMean[0];
+        invStd[channelIdx] = rsqrtf(variance + epsilon);
+        if (momentum == 0.0f)
+            return;
+        runningMean[channelIdx] = (1.0f - momentum) * runningMean[channelIdx] +
+                                  momentum * sharedMean[0];
+        runningVar[channelIdx] = (1.0f - momentum) * runningVar[channelIdx] +
+                                 momentum * unbiasedVariance;
+    }
+}
+
+__global__ void BatchNormNormalizeKernel(float* y, const float* x,
+                                         const float* mean,
+                                         const float* invStd,
+                                         const float* gamma, const float* beta,
+                                         unsigned int offset,
+                                         unsigned int launchSize,
+                                         unsigned int channels,
+                                         unsigned int innerSize)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+
+    for (unsigned int i = 0; i < numLoops; i++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * i + threadIdx.x;
+        const auto channelIdx = (idx / innerSize) % channels;
+        const float scale = gamma[channelIdx] * invStd[channelIdx];
+        y[idx] = (x[idx] - mean[channelIdx]) * scale + beta[channelIdx];
+    }
+}
+
+__global__ void BatchNormInferenceKernel(float* y, const float* x,
+                                         const float* runningMean,
+                                         const float* runningVar,
+                                         const float* gamma, const float* beta,
+                                         float epsilon, unsigned int offset,
+                                         unsigned int launchSize,
+                                         unsigned int channels,
+                                         unsigned int innerSize)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+
+    for (unsigned int i = 0; i < numLoops; i++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * i + threadIdx.x;
+        const auto channelIdx = (idx / innerSize) % channels;
+        const float scale =
+            gamma[channelIdx] * rsqrtf(runningVar[channelIdx] + epsilon);
+        y[idx] = (x[idx] - runningMean[channelIdx]) * scale +
+                 beta[channelIdx];
+    }
+}
+
+__global__ void BatchNormBackwardReduceKernel(float* dGamma, float* dBeta,
+                                              const float* dy, const float* x,
+                                              const float* mean,
+                                              const float* invStd,
+                                              unsigned int numUnits,
+                                              unsigned int channels,
+                                              unsigned int innerSize)
+{
+    __shared__ float sharedDy[NormalizationBlockDim];
+    __shared__ float sharedDyXHat[NormalizationBlockDim];
+
+    const auto channelIdx = blockIdx.x;
+    const auto channelSize = numUnits * innerSize;
+    const float channelMean = mean[channelIdx];
+    const float channelInvStd = invStd[channelIdx];
+    float sumDy = 0.0f, sumDyXHat = 0.0f;
+    for (unsigned int i = threadIdx.x; i < channelSize; i += blockDim.x)
+    {
+        const auto idx =
+            (i / innerSize * channels + channelIdx) * innerSize +
+            i % innerSize;
+        sumDy += dy[idx];
+        sumDyXHat += dy[idx] * (x[idx] - channelMean) * channelInvStd;
+    }
+    BlockSum2(sharedDy, sharedDyXHat, sumDy, sumDyXHat);
+
+    if (threadIdx.x == 0)
+    {
+        dGamma[channelIdx] = sharedDyXHat[0];
+        dBeta[channelIdx] = sharedDy[0];
+    }
+}
+
+__global__ void BatchNormBackwardKernel(float* dx, const float* dy,
+                                        const float* x, const float* mean,
+                                        const float* invStd,
+                                        const float* gamma,
+                                        const float* dGamma,
+                                        const float* dBeta, float count,
+                                        unsigned int offset,
+                                        unsigned int launchSize,
+                                        unsigned int channels,
+                                        unsigned int innerSize)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+
+    for (unsigned int i = 0; i < numLoops; i++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * i + threadIdx.x;
+        const auto channelIdx = (idx / innerSize) % channels;
+        const float xHat = (x[idx] - mean[channelIdx]) * invStd[channelIdx];
+        dx[idx] += gamma[channelIdx] * invStd[channelIdx] / count *
+            (count * dy[idx] - dBeta[channelIdx] - xHat * dGamma[channelIdx]);
+    }
+}
+
+__global__ void LayerNormForwardKernel(float* y, float* mean, float* invStd,
+                                       const float* x, const float* gamma,
+                                       const float* beta, unsigned int rowSize,
+                                       float epsilon)
+{
+    __shared__ float sharedMean[NormalizationBlockDim];
+    __shared__ float sharedM2[NormalizationBlockDim];
+    __shared__ float sharedCount[NormalizationBlockDim];
+
+    const auto rowIdx = blockIdx.x;
+    const float* in = x + rowIdx * rowSize;
+    float* out = y + rowIdx * rowSize;
+
+    float threadMean = 0.0f, threadM2 = 0.0f, threadCount = 0.0f;
+    for (unsigned int i = threadIdx.x; i < rowSize; i += blockDim.x)
+        WelfordAdd(threadMean, threadM2, threadCount, in[i]);
+    BlockMergeWelford(sharedMean, sharedM2, sharedCount, threadMean, threadM2,
+                      threadCount);
+
+    const float rowMean = sharedMean[0];
+    const float rowInvStd = rsqrtf(sharedM2[0] / sharedCount[0] + epsilon);
+    if (threadIdx.x == 0)
+    {
+        mean[rowIdx] = rowMean;
+        invStd[rowIdx] = rowInvStd;
+    }
+
+    for (unsigned int i = threadIdx.x; i < rowSize; i += blockDim.x)
+        out[i] = (in[i] - rowMean) * rowInvStd * gamma[i] + beta[i];
+}
+
+__global__ void LayerNormBackwardKernel(float* dx, float* dGamma,
+                                        float* dBeta, const float* dy,
+                                        const float* x, const float* mean,
+                                        const float* invStd,
+                                        const float* gamma,
+                                        unsigned int rowSize)
+{
+    __shared__ float sharedDxHat[NormalizationBlockDim];
+    __shared__ float sharedDxHatXHat[NormalizationBlockDim];
+
+    const auto rowIdx = blockIdx.x;
+    const auto offset = rowIdx * rowSize;
+    const float rowMean = mean[rowIdx];
+    const float rowInvStd = invStd[rowIdx];
+
+    float sumDxHat = 0.0f, sumDxHatXHat = 0.0f;
+    for (unsigned int i = threadIdx.x; i < rowSize; i += blockDim.x)
+    {
+        const float xHat = (x[offset + i] - rowMean) * rowInvStd;
+        const float dxHat = dy[offset + i] * gamma[i];
+        sumDxHat += dxHat;
+        sumDxHatXHat += dxHat * xHat;
+        atomicAdd(dGamma + i, dy[offset + i] * xHat);
+        atomicAdd(dBeta + i, dy[offset + i]);
+    }
+    BlockSum2(sharedDxHat, sharedDxHatXHat, sumDxHat, sumDxHatXHat);
+
+    const auto size = static_cast<float>(rowSize);
+    for (unsigned int i = threadIdx.x; i < rowSize; i += blockDim.x)
+    {
+        const float xHat = (x[offset + i] - rowMean) * rowInvStd;
+        dx[offset + i] += rowInvStd / size *
+            (size * dy[offset + i] * gamma[i] - sharedDxHat[0] -
+             xHat * sharedDxHatXHat[0]);
+    }
+}
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/cuda/kernels/RecurrentKernel.cuh>
+
+namespace Sapphire::Compute::Dense::Cuda
+{
+namespace
+{
+__device__ float Sigmoid(float x)
+{
+    return 1.0f / (1.0f + expf(-x));
+}
+} // namespace
+
+__global__ void LstmCellForwardKernel(float* gates, float* cell,
+                                      float* hidden, const float* cellPrev,
+                                      unsigned int offset,
+                                      unsigned int launchSize,
+                                      unsigned int hiddenSize)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+    const auto H = hiddenSize;
+
+    for (unsigned int loop = 0; loop < numLoops; loop++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * loop +
+                         threadIdx.x;
+        const auto i = idx % H;
+        float* gate = gates + (idx / H) * 4 * H;
+
+        const float inputGate = Sigmoid(gate[i]);
+        const float forgetGate = Sigmoid(gate[H + i]);
+        const float cellGate = tanhf(gate[2 * H + i]);
+        const float outputGate = Sigmoid(gate[3 * H + i]);
+        const float prev = cellPrev ? cellPrev[idx] : 0.0f;
+        const float state = forgetGate * prev + inputGate * cellGate;
+
+        gate[i] = inputGate;
+        gate[H + i] = forgetGate;
+        gate[2 * H + i] = cellGate;
+        gate[3 * H + i] = outputGate;
+        cell[idx] = state;
+        hidden[idx] = outputGate * tanhf(state);
+    }
+}
+
+__global__ void LstmCellBackwardKernel(float* dGates, float* dCell,
+                                       const float* dHidden,
+                                       const float* dHiddenNext,
+                                       const float* gates, const float* cell,
+                                       const float* cellPrev,
+                                       unsigned int offset,
+                                       unsigned int launchSize,
+                                       unsigned int hiddenSize)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+    const auto H = hiddenSize;
+
+    for (unsigned int loop = 0; loop < numLoops; loop++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * loop +
+                         threadIdx.x;
+        const auto i = idx % H;
+        const float* gate = gates + (idx / H) * 4 * H;
+        float* dGate = dGates + (idx / H) * 4 * H;
+
+        const float inputGate = gate[i];
+        const float forgetGate = gate[H + i];
+        const float cellGate = gate[2 * H + i];
+        const float outputGate = gate[3 * H + i];
+        const float tanhCell = tanhf(cell[idx]);
+        const float prev = cellPrev ? cellPrev[idx] : 0.0f;
+
+        const float dh =
+            dHidden[idx] + (dHiddenNext ? dHiddenNext[idx] : 0.0f);
+        const float dc =
+            dCell[idx] + dh * outputGate * (1.0f - tanhCell * tanhCell);
+
+        dGate[i] = dc * cellGate * inputGate * (1.0f - inputGate);
+        dGate[H + i] = dc * prev * forgetGate * (1.0f - forgetGate);
+        dGate[2 * H + i] = dc * inputGate * (1.0f - cellGate * cellGate);
+        dGate[3 * H + i] = dh * tanhCell * outputGate * (1.0f - outputGate);
+        dCell[idx] = dc * forgetGate;
+    }
+}
+
+__global__ void GruCellForwardKernel(float* gates, float* hidden,
+                                     const float* inputProj,
+                                     const float* hiddenProj,
+                                     const float* hiddenBias,
+                                     const float* hiddenPrev,
+                                     unsigned int offset,
+                                     unsigned int launchSize,
+                                     unsigned int hiddenSize)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+    const auto H = hiddenSize;
+
+    for (unsigned int loop = 0; loop < numLoops; loop++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * loop +
+                         threadIdx.x;
+        const auto batchIdx = idx / H;
+        const auto i = idx % H;
+        const float* in = inputProj + batchIdx * 3 * H;
+        const float* proj = hiddenProj ? hiddenProj + batchIdx * 3 * H
+                                       : nullptr;
+        float* gate = gates + batchIdx * 4 * H;
+
+        const float hr = hiddenBias[i] + (proj ? proj[i] : 0.0f);
+        const float hz = hiddenBias[H + i] + (proj ? proj[H + i] : 0.0f);
+        const float hn =
+            hiddenBias[2 * H + i] + (proj ? proj[2 * H + i] : 0.0f);
+
+        const float resetGate = Sigmoid(in[i] + hr);
+        const float updateGate = Sigmoid(in[H + i] + hz);
+        const float newGate = tanhf(in[2 * H + i] + resetGate * hn);
+        const float prev = hiddenPrev ? hiddenPrev[idx] : 0.0f;
+
+        gate[i] = resetGate;
+        gate[H + i] = updateGate;
+        gate[2 * H + i] = newGate;
+        gate[3 * H + i] = hn;
+        hidden[idx] = (1.0f - updateGate) * newGate + updateGate * prev;
+    }
+}
+
+__global__ void GruCellBackwardKernel(float* dInputProj, float* dHiddenProj,
+                                      float* dHiddenPrev,
+                                      const float* dHidden,
+                                      const float* dHiddenNext,
+                                      const float* gates,
+                                      const float* hiddenPrev,
+                                      unsigned int offset,
+                                      unsigned int launchSize,
+                                      unsigned int hiddenSize)
+{
+    const auto sizePerBlock = launchSize / gridDim.x;
+    const auto numLoops = sizePerBlock / blockDim.x;
+    const auto blockOffset = sizePerBlock * blockIdx.x;
+    const auto H = hiddenSize;
+
+    for (unsigned int loop = 0; loop < numLoops; loop++)
+    {
+        const auto idx = offset + blockOffset + blockDim.x * loop +
+                         threadIdx.x;
+        const auto batchIdx = idx / H;
+        const auto i = idx % H;
+        const float* gate = gates + batchIdx * 4 * H;
+        float* dIn = dInputProj + batchIdx * 3 * H;
+        float* dProj = dHiddenProj + batchIdx * 3 * H;
+
+        const float resetGate = gate[i];
+        const float updateGate = gate[H + i];
+        const float newGate = gate[2 * H + i];
+        const float hn = gate[3 * H + i];
+        const float prev = hiddenPrev ? hiddenPrev[idx] : 0.0f;
+
+        const float dh =
+            dHidden[idx] + (dHiddenNext ? dHiddenNext[idx] : 0.0f);
+        const float dNewPre =
+            dh * (1.0f - updateGate) * (1.0f - newGate * newGate);
+        const float dResetPre = dNewPre * hn * resetGate * (1.0f - resetGate);
+        const float dUpdatePre =
+            dh * (prev - newGate) * updateGate * (1.0f - updateGate);
+
+        dIn[i] = dResetPre;
+        dIn[H + i] = dUpdatePre;
+        dIn[2 * H + i] = dNewPre;
+        dProj[i] = dResetPre;
+        dProj[H + i] = dUpdatePre;
+        dProj[2 * H + i] = dNewPre * resetGate;
+        dHiddenPrev[idx] = dh * updateGate;
+    }
+}
+} // namespace Sapphire::Compute::Dense::Cuda
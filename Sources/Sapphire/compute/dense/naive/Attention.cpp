@@ -0,0 +1,205 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/Attention.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+constexpr float NegativeInfinity = -std::numeric_limits<float>::infinity();
+
+float DotProduct(const float* a, const float* b, std::size_t size)
+{
+    float sum = 0.0f;
+#pragma omp simd reduction(+ : sum)
+    for (std::size_t i = 0; i < size; ++i)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+//! y += alpha * x
+void Axpy(float* y, const float* x, float alpha, std::size_t size)
+{
+#pragma omp simd
+    for (std::size_t i = 0; i < size; ++i)
+        y[i] += alpha * x[i];
+}
+
+//! Number of keys of the tile starting from colStart that query row attends
+std::size_t ValidKeys(std::size_t row, std::size_t colStart,
+                      std::size_t cols, std::size_t queryLength,
+                      std::size_t keyLength, bool causal)
+{
+    if (!causal)
+        return cols;
+    //! Last key attended by the row, aligned to the end of the keys
+    const auto end = row + 1 + keyLength;
+    if (end <= colStart + queryLength)
+        return 0;
+    return std::min(cols, end - queryLength - colStart);
+}
+} // namespace
+
+void AttentionForward(float* y, float* logSumExp, const float* query,
+                      const float* key, const float* value,
+                      unsigned int numMatrices, unsigned int queryLength,
+                      unsigned int keyLength, unsigned int depth,
+                      unsigned int valueDepth, float scale, bool causal)
+{
+    const std::size_t D = depth, Dv = valueDepth;
+    std::vector<float> scores(AttentionBlockCols);
+    std::vector<float> rowMax(AttentionBlockRows);
+    std::vector<float> rowSum(AttentionBlockRows);
+    std::vector<float> output(AttentionBlockRows * Dv);
+
+    for (std::size_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        const float* q = query + matrixIdx * queryLength * D;
+        const float* k = key + matrixIdx * keyLength * D;
+        const float* v = value + matrixIdx * keyLength * Dv;
+        float* out = y + matrixIdx * queryLength * Dv;
+        float* lse = logSumExp + matrixIdx * queryLength;
+
+        for (std::size_t rowStart = 0; rowStart < queryLength;
+             rowStart += AttentionBlockRows)
+        {
+            const auto rows = std::min<std::size_t>(AttentionBlockRows,
+                                                    queryLength - rowStart);
+            std::fill(rowMax.begin(), rowMax.end(), NegativeInfinity);
+            std::fill(rowSum.begin(), rowSum.end(), 0.0f);
+            std::fill(output.begin(), output.end(), 0.0f);
+
+            for (std::size_t colStart = 0; colStart < keyLength;
+                 colStart += AttentionBlockCols)
+            {
+                const auto cols = std::min<std::size_t>(
+                    AttentionBlockCols, keyLength - colStart);
+                for (std::size_t r = 0; r < rows; ++r)
+                {
+                    const auto validCols =
+                        ValidKeys(rowStart + r, colStart, cols, queryLength,
+                                  keyLength, causal);
+                    if (validCols == 0)
+                        continue;
+
+                    const float* qRow = q + (rowStart + r) * D;
+                    float tileMax = NegativeInfinity;
+                    for (std::size_t c = 0; c < validCols; ++c)
+                    {
+                        scores[c] = scale *
+                                    DotProduct(qRow, k + (colStart + c) * D,
+                                               D);
+                        tileMax = std::max(tileMax, scores[c]);
+                    }
+
+                    //! Rescales the partial output to the new maximum
+                    const float newMax = std::max(rowMax[r], tileMax);
+                    const float correction = std::exp(rowMax[r] - newMax);
+                    float* outRow = output.data() + r * Dv;
+                    rowSum[r] *= correction;
+#pragma omp simd
+                    for (std::size_t i = 0; i < Dv; ++i)
+                        outRow[i] *= correction;
+
+                    for (std::size_t c = 0; c < validCols; ++c)
+                    {
+                        const float probability =
+                            std::exp(scores[c] - newMax);
+                        rowSum[r] += probability;
+                        Axpy(outRow, v + (colStart + c) * Dv, probability,
+                             Dv);
+                    }
+                    rowMax[r] = newMax;
+                }
+            }
+
+            for (std::size_t r = 0; r < rows; ++r)
+            {
+                //! Rows without any key to attend produce zeros
+                const float inverse = rowSum[r] > 0.0f ? 1.0f / rowSum[r]
+                                                       : 0.0f;
+                float* outRow = out + (rowStart + r) * Dv;
+                const float* partial = output.data() + r * Dv;
+#pragma omp simd
+                for (std::size_t i = 0; i < Dv; ++i)
+                    outRow[i] = partial[i] * inverse;
+                lse[rowStart + r] = rowSum[r] > 0.0f
+                                        ? rowMax[r] + std::log(rowSum[r])
+                                        : NegativeInfinity;
+            }
+        }
+    }
+}
+
+void AttentionBackward(float* dQuery, float* dKey, float* dValue,
+                       const float* dy, const float* query, const float* key,
+                       const float* value, const float* y,
+                       const float* logSumExp, unsigned int numMatrices,
+                       unsigned int queryLength, unsigned int keyLength,
+                       unsigned int depth, unsigned int valueDepth,
+                       float scale, bool causal)
+{
+    const std::size_t D = depth, Dv = valueDepth;
+    std::vector<float> delta(queryLength);
+
+    for (std::size_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        const auto qOffset = matrixIdx * queryLength * D;
+        const auto kOffset = matrixIdx * keyLength * D;
+        const auto vOffset = matrixIdx * keyLength * Dv;
+        const auto yOffset = matrixIdx * queryLength * Dv;
+        const float* lse = logSumExp + matrixIdx * queryLength;
+
+        //! Gradient of the softmax needs sum(dy * y) of each row
+        for (std::size_t row = 0; row < queryLength; ++row)
+            delta[row] = DotProduct(dy + yOffset + row * Dv,
+                                    y + yOffset + row * Dv, Dv);
+
+        //! Gradients of a tile of keys and values are accumulated over every
+        //! query while the tile stays in cache
+        for (std::size_t colStart = 0; colStart < keyLength;
+             colStart += AttentionBlockCols)
+        {
+            const auto cols = std::min<std::size_t>(AttentionBlockCols,
+                                                    keyLength - colStart);
+            for (std::size_t row = 0; row < queryLength; ++row)
+            {
+                const auto validCols = ValidKeys(row, colStart, cols,
+                                                 queryLength, keyLength,
+                                                 causal);
+                if (validCols == 0 || lse[row] == NegativeInfinity)
+                    continue;
+
+                const float* qRow = query + qOffset + row * D;
+                const float* dyRow = dy + yOffset + row * Dv;
+                float* dqRow = dQuery + qOffset + row * D;
+                for (std::size_t c = 0; c < validCols; ++c)
+                {
+                    const auto col = colStart + c;
+                    const float* kRow = key + kOffset + col * D;
+                    const float probability = std::exp(
+                        scale * DotProduct(qRow, kRow, D) - lse[row]);
+                    Axpy(dValue + vOffset + col * Dv, dyRow, probability,
+                         Dv);
+
+                    const float dProbability =
+                        DotProduct(dyRow, value + vOffset + col * Dv, Dv);
+                    const float dScore =
+                        scale * probability * (dProbability - delta[row]);
+                    Axpy(dqRow, kRow, dScore, D);
+                    Axpy(dKey + kOffset + col * D, qRow, dScore, D);
+                }
+            }
+        }
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,435 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! This file is compiled with AVX2, FMA and F16C enabled
+//! Helpers are kept in anonymous namespace and no standard library headers
+//! with inline functions are included, so that no inline function compiled
+//! with AVX2 can be merged with the ones used by the rest of the library
+
+#ifdef WITH_AVX2
+
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx2
+{
+namespace
+{
+constexpr unsigned int Width = 8;
+
+//! Mask with lanes smaller than count set
+__m256i TailMask(unsigned int count)
+{
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)),
+                              lanes);
+}
+
+//! Copies count (< Width) 16 bit elements to zero padded buffer, so that full
+//! vector can be loaded without reading past the end of the data
+//! Masked loads of 16 bit elements are not available in AVX2
+__m128i LoadPartial16(const std::uint16_t* src, unsigned int count)
+{
+    alignas(16) std::uint16_t buffer[Width] = {};
+    for (unsigned int i = 0; i < count; ++i)
+        buffer[i] = src[i];
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(buffer));
+}
+
+__m256 BFloat16Bits(__m128i bits)
+{
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(bits),
+                                                 16));
+}
+
+//! Rounds to nearest even keeping NaN quiet as Util::FloatToBFloat16
+__m128i ToBFloat16Bits(__m256 value)
+{
+    const __m256i bits = _mm256_castps_si256(value);
+    const __m256i odd =
+        _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_srli_epi32(
+        _mm256_add_epi32(bits, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), odd)),
+        16);
+    const __m256i quietNaN = _mm256_srli_epi32(
+        _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000)), 16);
+    const __m256i isNaN =
+        _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+    const __m256i result = _mm256_blendv_epi8(rounded, quietNaN, isNaN);
+    //! Packing works on each 128 bit lane, so lanes are gathered afterwards
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(
+        _mm256_packus_epi32(result, result), 0x08));
+}
+
+//! Loaders of B for GemmRows
+struct LoadFloat
+{
+    using Element = float;
+
+    static __m256 Load(const float* src)
+    {
+        return _mm256_loadu_ps(src);
+    }
+
+    static __m256 LoadPartial(const float* src, unsigned int, __m256i mask)
+    {
+        return _mm256_maskload_ps(src, mask);
+    }
+};
+
+struct LoadHalf
+{
+    using Element = std::uint16_t;
+
+    static __m256 Load(const std::uint16_t* src)
+    {
+        return _mm256_cvtph_ps(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+
+    static __m256 LoadPartial(const std::uint16_t* src, unsigned int count,
+                              __m256i)
+    {
+        return _mm256_cvtph_ps(LoadPartial16(src, count));
+    }
+};
+
+struct LoadBFloat16
+{
+    using Element = std::uint16_t;
+
+    static __m256 Load(const std::uint16_t* src)
+    {
+        return BFloat16Bits(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+
+    static __m256 LoadPartial(const std::uint16_t* src, unsigned int count,
+                              __m256i)
+    {
+        return BFloat16Bits(LoadPartial16(src, count));
+    }
+};
+
+//! out[Rows x N] += A[Rows x K] * B[K x N]
+//! Each step accumulates (Rows x 2 * Width) block of out in registers
+//! Loader converts elements of B to float, so B can be stored in any type
+template <typename Loader, unsigned int Rows>
+void GemmRows(float* out, const float* A, const typename Loader::Element* B,
+              unsigned int N, unsigned int K)
+{
+    unsigned int nIdx = 0;
+    for (; nIdx + 2 * Width <= N; nIdx += 2 * Width)
+    {
+        __m256 acc[Rows][2];
+        for (unsigned int row = 0; row < Rows; ++row)
+            acc[row][0] = acc[row][1] = _mm256_setzero_ps();
+
+        for (unsigned int kIdx = 0; kIdx < K; ++kIdx)
+        {
+            const auto* rowB = B + static_cast<std::size_t>(kIdx) * N + nIdx;
+            const __m256 b0 = Loader::Load(rowB);
+            const __m256 b1 = Loader::Load(rowB + Width);
+            for (unsigned int row = 0; row < Rows; ++row)
+            {
+                const __m256 a = _mm256_broadcast_ss(A + row * K + kIdx);
+                acc[row][0] = _mm256_fmadd_ps(a, b0, acc[row][0]);
+                acc[row][1] = _mm256_fmadd_ps(a, b1, acc[row][1]);
+            }
+        }
+
+        for (unsigned int row = 0; row < Rows; ++row)
+        {
+            float* rowOut = out + row * N + nIdx;
+            _mm256_storeu_ps(rowOut,
+                             _mm256_add_ps(_mm256_loadu_ps(rowOut),
+                                           acc[row][0]));
+            _mm256_storeu_ps(rowOut + Width,
+                             _mm256_add_ps(_mm256_loadu_ps(rowOut + Width),
+                                           acc[row][1]));
+        }
+    }
+
+    for (; nIdx < N; nIdx += Width)
+    {
+        const auto count = N - nIdx < Width ? N - nIdx : Width;
+        const __m256i mask = TailMask(count);
+
+        __m256 acc[Rows];
+        for (unsigned int row = 0; row < Rows; ++row)
+            acc[row] = _mm256_setzero_ps();
+
+        for (unsigned int kIdx = 0; kIdx < K; ++kIdx)
+        {
+            const auto* rowB = B + static_cast<std::size_t>(kIdx) * N + nIdx;
+            const __m256 b = count == Width
+                                 ? Loader::Load(rowB)
+                                 : Loader::LoadPartial(rowB, count, mask);
+            for (unsigned int row = 0; row < Rows; ++row)
+                acc[row] = _mm256_fmadd_ps(
+                    _mm256_broadcast_ss(A + row * K + kIdx), b, acc[row]);
+        }
+
+        for (unsigned int row = 0; row < Rows; ++row)
+        {
+            float* rowOut = out + row * N + nIdx;
+            _mm256_maskstore_ps(
+                rowOut, mask,
+                _mm256_add_ps(_mm256_maskload_ps(rowOut, mask), acc[row]));
+        }
+    }
+}
+
+template <typename Loader>
+void GemmBatched(unsigned int totalSize, float* out, const float* A,
+                 const typename Loader::Element* B, unsigned int M,
+                 unsigned int N, unsigned int K)
+{
+    constexpr unsigned int blockRows = 4;
+    const auto strideA = static_cast<std::size_t>(M) * K;
+    const auto strideB = static_cast<std::size_t>(K) * N;
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+
+    for (std::size_t chunkIdx = 0; chunkIdx < totalSize / strideOut;
+         ++chunkIdx)
+    {
+        const float* batchPtrA = A + strideA * chunkIdx;
+        const auto* batchPtrB = B + strideB * chunkIdx;
+        float* batchPtrOut = out + strideOut * chunkIdx;
+
+        unsigned int mIdx = 0;
+        for (; mIdx + blockRows <= M; mIdx += blockRows)
+            GemmRows<Loader, blockRows>(batchPtrOut + mIdx * N,
+                                        batchPtrA + mIdx * K, batchPtrB, N, K);
+        for (; mIdx < M; ++mIdx)
+            GemmRows<Loader, 1>(batchPtrOut + mIdx * N, batchPtrA + mIdx * K,
+                                batchPtrB, N, K);
+    }
+}
+
+//! out[Rows x N] = epilogue(A[Rows x K] * B)
+//! vpmaddubsw multiplies 4 activations with 4 weights of each channel into
+//! two int16 sums, and vpmaddwd adds them into int32
+template <unsigned int Rows>
+void GemmInt8Rows(float* out, const std::uint8_t* A, const std::int8_t* B,
+                  unsigned int N, unsigned int K, const Int8Epilogue& epilogue)
+{
+    const auto paddedN = (N + Int8PackWidth - 1) / Int8PackWidth *
+                         Int8PackWidth;
+    const __m256i ones = _mm256_set1_epi16(1);
+
+    for (unsigned int nIdx = 0; nIdx < N; nIdx += Width)
+    {
+        __m256i acc[Rows];
+        for (unsigned int row = 0; row < Rows; ++row)
+            acc[row] = _mm256_setzero_si256();
+
+        for (unsigned int kIdx = 0; kIdx < K; kIdx += Int8PackDepth)
+        {
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                B + static_cast<std::size_t>(kIdx) * paddedN +
+                nIdx * Int8PackDepth));
+            for (unsigned int row = 0; row < Rows; ++row)
+            {
+                const __m256i a = _mm256_broadcastd_epi32(
+                    _mm_loadu_si32(A + row * K + kIdx));
+                acc[row] = _mm256_add_epi32(
+                    acc[row],
+                    _mm256_madd_epi16(_mm256_maddubs_epi16(a, b), ones));
+            }
+        }
+
+        const __m256i offset = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(epilogue.Offset + nIdx));
+        const __m256 scale = _mm256_loadu_ps(epilogue.Scale + nIdx);
+        const __m256 bias = _mm256_loadu_ps(epilogue.Bias + nIdx);
+        const auto count = N - nIdx < Width ? N - nIdx : Width;
+        const __m256i mask = TailMask(count);
+        for (unsigned int row = 0; row < Rows; ++row)
+        {
+            __m256 result = _mm256_fmadd_ps(
+                _mm256_cvtepi32_ps(_mm256_add_epi32(acc[row], offset)), scale,
+                bias);
+            if (epilogue.ReLU)
+                result = _mm256_max_ps(result, _mm256_setzero_ps());
+            _mm256_maskstore_ps(out + row * N + nIdx, mask, result);
+        }
+    }
+}
+} // namespace
+
+void Gemm(unsigned int totalSize, float* out, const float* A, const float* B,
+          unsigned int M, unsigned int N, unsigned int K)
+{
+    GemmBatched<LoadFloat>(totalSize, out, A, B, M, N, K);
+}
+
+void GemmHalf(unsigned int totalSize, float* out, const float* A,
+              const std::uint16_t* B, unsigned int M, unsigned int N,
+              unsigned int K)
+{
+    GemmBatched<LoadHalf>(totalSize, out, A, B, M, N, K);
+}
+
+void GemmBFloat16(unsigned int totalSize, float* out, const float* A,
+                  const std::uint16_t* B, unsigned int M, unsigned int N,
+                  unsigned int K)
+{
+    GemmBatched<LoadBFloat16>(totalSize, out, A, B, M, N, K);
+}
+
+void Add(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_ps(output + i,
+                         _mm256_add_ps(_mm256_loadu_ps(inputA + i),
+                                       _mm256_loadu_ps(inputB + i)));
+    for (; i < totalSize; ++i)
+        output[i] = inputA[i] + inputB[i];
+}
+
+void Sub(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_ps(output + i,
+                         _mm256_sub_ps(_mm256_loadu_ps(inputA + i),
+                                       _mm256_loadu_ps(inputB + i)));
+    for (; i < totalSize; ++i)
+        output[i] = inputA[i] - inputB[i];
+}
+
+void Dot(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_ps(output + i,
+                         _mm256_mul_ps(_mm256_loadu_ps(inputA + i),
+                                       _mm256_loadu_ps(inputB + i)));
+    for (; i < totalSize; ++i)
+        output[i] = inputA[i] * inputB[i];
+}
+
+void Scale(float* output, const float* input, float scaleFactor,
+           unsigned int totalSize)
+{
+    const __m256 factor = _mm256_set1_ps(scaleFactor);
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_ps(output + i,
+                         _mm256_mul_ps(_mm256_loadu_ps(input + i), factor));
+    for (; i < totalSize; ++i)
+        output[i] = input[i] * scaleFactor;
+}
+
+void ReLU(float* output, const float* input, unsigned int totalSize)
+{
+    //! max returns the second operand if either one is NaN, so NaN becomes 0
+    //! as in the scalar kernel
+    const __m256 zero = _mm256_setzero_ps();
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_ps(output + i,
+                         _mm256_max_ps(_mm256_loadu_ps(input + i), zero));
+    for (; i < totalSize; ++i)
+        output[i] = input[i] > 0 ? input[i] : 0;
+}
+
+void FloatToHalf(std::uint16_t* output, const float* input,
+                 unsigned int totalSize)
+{
+    constexpr int rounding = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(input + i),
+                                         rounding));
+    if (i < totalSize)
+    {
+        const auto count = totalSize - i;
+        alignas(16) std::uint16_t buffer[Width];
+        _mm_store_si128(
+            reinterpret_cast<__m128i*>(buffer),
+            _mm256_cvtps_ph(_mm256_maskload_ps(input + i, TailMask(count)),
+                            rounding));
+        for (unsigned int j = 0; j < count; ++j)
+            output[i + j] = buffer[j];
+    }
+}
+
+void HalfToFloat(float* output, const std::uint16_t* input,
+                 unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_ps(output + i, LoadHalf::Load(input + i));
+    if (i < totalSize)
+    {
+        const auto mask = TailMask(totalSize - i);
+        _mm256_maskstore_ps(
+            output + i, mask,
+            LoadHalf::LoadPartial(input + i, totalSize - i, mask));
+    }
+}
+
+void FloatToBFloat16(std::uint16_t* output, const float* input,
+                     unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                         ToBFloat16Bits(_mm256_loadu_ps(input + i)));
+    if (i < totalSize)
+    {
+        const auto count = totalSize - i;
+        alignas(16) std::uint16_t buffer[Width];
+        _mm_store_si128(reinterpret_cast<__m128i*>(buffer),
+                        ToBFloat16Bits(_mm256_maskload_ps(input + i,
+                                                          TailMask(count))));
+        for (unsigned int j = 0; j < count; ++j)
+            output[i + j] = buffer[j];
+    }
+}
+
+void BFloat16ToFloat(float* output, const std::uint16_t* input,
+                     unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_ps(output + i, LoadBFloat16::Load(input + i));
+    if (i < totalSize)
+    {
+        const auto mask = TailMask(totalSize - i);
+        _mm256_maskstore_ps(
+            output + i, mask,
+            LoadBFloat16::LoadPartial(input + i, totalSize - i, mask));
+    }
+}
+
+void GemmInt8(float* out, const std::uint8_t* A, const std::int8_t* B,
+              unsigned int M, unsigned int N, unsigned int K,
+              const Int8Epilogue& epilogue)
+{
+    constexpr unsigned int blockRows = 4;
+    unsigned int mIdx = 0;
+    for (; mIdx + blockRows <= M; mIdx += blockRows)
+        GemmInt8Rows<blockRows>(out + static_cast<std::size_t>(mIdx) * N,
+                                A + static_cast<std::size_t>(mIdx) * K, B, N,
+                                K, epilogue);
+    for (; mIdx < M; ++mIdx)
+        GemmInt8Rows<1>(out + static_cast<std::size_t>(mIdx) * N,
+                        A + static_cast<std::size_t>(mIdx) * K, B, N, K,
+                        epilogue);
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx2
+
+#endif
@@ -0,0 +1,55 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! This file is compiled with AVX-512 foundation and AVX512-BF16 enabled
+//! Kernels here are used by Avx512 kernels only if the cpu supports them
+//! (see GetSimdKernels)
+
+#ifdef WITH_AVX512BF16
+
+//! AVX-512 intrinsics of GCC 12 initialize their results with
+//! _mm512_undefined_*, which is falsely reported as maybe uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512Bf16
+{
+namespace
+{
+constexpr unsigned int Width = 16;
+} // namespace
+
+//! VCVTNEPS2BF16 rounds to nearest even, but flushes denormal inputs to zero
+void FloatToBFloat16(std::uint16_t* output, const float* input,
+                     unsigned int totalSize)
+{
+    for (unsigned int i = 0; i < totalSize; i += Width)
+    {
+        const auto count = totalSize - i < Width ? totalSize - i : Width;
+        const auto mask = static_cast<__mmask16>((1u << count) - 1u);
+        const __m256i result = reinterpret_cast<__m256i>(
+            _mm512_cvtneps_pbh(_mm512_maskz_loadu_ps(mask, input + i)));
+        if (count == Width)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                                result);
+            continue;
+        }
+
+        alignas(32) std::uint16_t buffer[Width];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(buffer), result);
+        for (unsigned int j = 0; j < count; ++j)
+            output[i + j] = buffer[j];
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512Bf16
+
+#endif
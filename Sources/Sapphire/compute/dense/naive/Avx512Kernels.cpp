@@ -0,0 +1,380 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! This file is compiled with AVX-512 foundation enabled
+//! Helpers are kept in anonymous namespace and no standard library headers
+//! with inline functions are included, so that no inline function compiled
+//! with AVX-512 can be merged with the ones used by the rest of the library
+
+#ifdef WITH_AVX512
+
+//! AVX-512 intrinsics of GCC 12 initialize their results with
+//! _mm512_undefined_*, which is falsely reported as maybe uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512
+{
+namespace
+{
+constexpr unsigned int Width = 16;
+
+//! Mask with lanes smaller than count set
+__mmask16 TailMask(unsigned int count)
+{
+    return static_cast<__mmask16>((1u << count) - 1u);
+}
+
+//! Copies count (< Width) 16 bit elements to zero padded buffer, so that full
+//! vector can be loaded without reading past the end of the data
+//! Masked loads of 16 bit elements require AVX512BW
+__m256i LoadPartial16(const std::uint16_t* src, unsigned int count)
+{
+    alignas(32) std::uint16_t buffer[Width] = {};
+    for (unsigned int i = 0; i < count; ++i)
+        buffer[i] = src[i];
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(buffer));
+}
+
+__m512 BFloat16Bits(__m256i bits)
+{
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(bits),
+                                                 16));
+}
+
+//! Rounds to nearest even keeping NaN quiet as Util::FloatToBFloat16
+__m256i ToBFloat16Bits(__m512 value)
+{
+    const __m512i bits = _mm512_castps_si512(value);
+    const __m512i odd =
+        _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+    const __m512i rounded = _mm512_srli_epi32(
+        _mm512_add_epi32(bits, _mm512_add_epi32(_mm512_set1_epi32(0x7FFF), odd)),
+        16);
+    const __m512i quietNaN = _mm512_srli_epi32(
+        _mm512_or_si512(bits, _mm512_set1_epi32(0x00400000)), 16);
+    const __mmask16 isNaN = _mm512_cmp_ps_mask(value, value, _CMP_UNORD_Q);
+    return _mm512_cvtepi32_epi16(
+        _mm512_mask_blend_epi32(isNaN, rounded, quietNaN));
+}
+
+//! Loaders of B for GemmRows
+struct LoadFloat
+{
+    using Element = float;
+
+    static __m512 Load(const float* src)
+    {
+        return _mm512_loadu_ps(src);
+    }
+
+    static __m512 LoadPartial(const float* src, unsigned int, __mmask16 mask)
+    {
+        return _mm512_maskz_loadu_ps(mask, src);
+    }
+};
+
+struct LoadHalf
+{
+    using Element = std::uint16_t;
+
+    static __m512 Load(const std::uint16_t* src)
+    {
+        return _mm512_cvtph_ps(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    }
+
+    static __m512 LoadPartial(const std::uint16_t* src, unsigned int count,
+                              __mmask16)
+    {
+        return _mm512_cvtph_ps(LoadPartial16(src, count));
+    }
+};
+
+struct LoadBFloat16
+{
+    using Element = std::uint16_t;
+
+    static __m512 Load(const std::uint16_t* src)
+    {
+        return BFloat16Bits(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    }
+
+    static __m512 LoadPartial(const std::uint16_t* src, unsigned int count,
+                              __mmask16)
+    {
+        return BFloat16Bits(LoadPartial16(src, count));
+    }
+};
+
+//! out[Rows x N] += A[Rows x K] * B[K x N]
+//! Each step accumulates (Rows x 2 * Width) block of out in registers
+//! Loader converts elements of B to float, so B can be stored in any type
+template <typename Loader, unsigned int Rows>
+void GemmRows(float* out, const float* A, const typename Loader::Element* B,
+              unsigned int N, unsigned int K)
+{
+    unsigned int nIdx = 0;
+    for (; nIdx + 2 * Width <= N; nIdx += 2 * Width)
+    {
+        __m512 acc[Rows][2];
+        for (unsigned int row = 0; row < Rows; ++row)
+            acc[row][0] = acc[row][1] = _mm512_setzero_ps();
+
+        for (unsigned int kIdx = 0; kIdx < K; ++kIdx)
+        {
+            const auto* rowB = B + static_cast<std::size_t>(kIdx) * N + nIdx;
+            const __m512 b0 = Loader::Load(rowB);
+            const __m512 b1 = Loader::Load(rowB + Width);
+            for (unsigned int row = 0; row < Rows; ++row)
+            {
+                const __m512 a = _mm512_set1_ps(A[row * K + kIdx]);
+                acc[row][0] = _mm512_fmadd_ps(a, b0, acc[row][0]);
+                acc[row][1] = _mm512_fmadd_ps(a, b1, acc[row][1]);
+            }
+        }
+
+        for (unsigned int row = 0; row < Rows; ++row)
+        {
+            float* rowOut = out + row * N + nIdx;
+            _mm512_storeu_ps(rowOut,
+                             _mm512_add_ps(_mm512_loadu_ps(rowOut),
+                                           acc[row][0]));
+            _mm512_storeu_ps(rowOut + Width,
+                             _mm512_add_ps(_mm512_loadu_ps(rowOut + Width),
+                                           acc[row][1]));
+        }
+    }
+
+    for (; nIdx < N; nIdx += Width)
+    {
+        const auto count = N - nIdx < Width ? N - nIdx : Width;
+        const __mmask16 mask = TailMask(count);
+
+        __m512 acc[Rows];
+        for (unsigned int row = 0; row < Rows; ++row)
+            acc[row] = _mm512_setzero_ps();
+
+        for (unsigned int kIdx = 0; kIdx < K; ++kIdx)
+        {
+            const auto* rowB = B + static_cast<std::size_t>(kIdx) * N + nIdx;
+            const __m512 b = count == Width
+                                 ? Loader::Load(rowB)
+                                 : Loader::LoadPartial(rowB, count, mask);
+            for (unsigned int row = 0; row < Rows; ++row)
+                acc[row] = _mm512_fmadd_ps(_mm512_set1_ps(A[row * K + kIdx]),
+                                           b, acc[row]);
+        }
+
+        for (unsigned int row = 0; row < Rows; ++row)
+        {
+            float* rowOut = out + row * N + nIdx;
+            _mm512_mask_storeu_ps(
+                rowOut, mask,
+                _mm512_add_ps(_mm512_maskz_loadu_ps(mask, rowOut), acc[row]));
+        }
+    }
+}
+
+template <typename Loader>
+void GemmBatched(unsigned int totalSize, float* out, const float* A,
+                 const typename Loader::Element* B, unsigned int M,
+                 unsigned int N, unsigned int K)
+{
+    constexpr unsigned int blockRows = 4;
+    const auto strideA = static_cast<std::size_t>(M) * K;
+    const auto strideB = static_cast<std::size_t>(K) * N;
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+
+    for (std::size_t chunkIdx = 0; chunkIdx < totalSize / strideOut;
+         ++chunkIdx)
+    {
+        const float* batchPtrA = A + strideA * chunkIdx;
+        const auto* batchPtrB = B + strideB * chunkIdx;
+        float* batchPtrOut = out + strideOut * chunkIdx;
+
+        unsigned int mIdx = 0;
+        for (; mIdx + blockRows <= M; mIdx += blockRows)
+            GemmRows<Loader, blockRows>(batchPtrOut + mIdx * N,
+                                        batchPtrA + mIdx * K, batchPtrB, N, K);
+        for (; mIdx < M; ++mIdx)
+            GemmRows<Loader, 1>(batchPtrOut + mIdx * N, batchPtrA + mIdx * K,
+                                batchPtrB, N, K);
+    }
+}
+} // namespace
+
+void Gemm(unsigned int totalSize, float* out, const float* A, const float* B,
+          unsigned int M, unsigned int N, unsigned int K)
+{
+    GemmBatched<LoadFloat>(totalSize, out, A, B, M, N, K);
+}
+
+void GemmHalf(unsigned int totalSize, float* out, const float* A,
+              const std::uint16_t* B, unsigned int M, unsigned int N,
+              unsigned int K)
+{
+    GemmBatched<LoadHalf>(totalSize, out, A, B, M, N, K);
+}
+
+void GemmBFloat16(unsigned int totalSize, float* out, const float* A,
+                  const std::uint16_t* B, unsigned int M, unsigned int N,
+                  unsigned int K)
+{
+    GemmBatched<LoadBFloat16>(totalSize, out, A, B, M, N, K);
+}
+
+void Add(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize)
+{
+    for (unsigned int i = 0; i < totalSize; i += Width)
+    {
+        const auto mask = TailMask(totalSize - i < Width ? totalSize - i
+                                                          : Width);
+        _mm512_mask_storeu_ps(
+            output + i, mask,
+            _mm512_add_ps(_mm512_maskz_loadu_ps(mask, inputA + i),
+                          _mm512_maskz_loadu_ps(mask, inputB + i)));
+    }
+}
+
+void Sub(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize)
+{
+    for (unsigned int i = 0; i < totalSize; i += Width)
+    {
+        const auto mask = TailMask(totalSize - i < Width ? totalSize - i
+                                                          : Width);
+        _mm512_mask_storeu_ps(
+            output + i, mask,
+            _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, inputA + i),
+                          _mm512_maskz_loadu_ps(mask, inputB + i)));
+    }
+}
+
+void Dot(float* output, const float* inputA, const float* inputB,
+         unsigned int totalSize)
+{
+    for (unsigned int i = 0; i < totalSize; i += Width)
+    {
+        const auto mask = TailMask(totalSize - i < Width ? totalSize - i
+                                                          : Width);
+        _mm512_mask_storeu_ps(
+            output + i, mask,
+            _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, inputA + i),
+                          _mm512_maskz_loadu_ps(mask, inputB + i)));
+    }
+}
+
+void Scale(float* output, const float* input, float scaleFactor,
+           unsigned int totalSize)
+{
+    const __m512 factor = _mm512_set1_ps(scaleFactor);
+    for (unsigned int i = 0; i < totalSize; i += Width)
+    {
+        const auto mask = TailMask(totalSize - i < Width ? totalSize - i
+                                                          : Width);
+        _mm512_mask_storeu_ps(
+            output + i, mask,
+            _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, input + i), factor));
+    }
+}
+
+void ReLU(float* output, const float* input, unsigned int totalSize)
+{
+    //! max returns the second operand if either one is NaN, so NaN becomes 0
+    //! as in the scalar kernel
+    const __m512 zero = _mm512_setzero_ps();
+    for (unsigned int i = 0; i < totalSize; i += Width)
+    {
+        const auto mask = TailMask(totalSize - i < Width ? totalSize - i
+                                                          : Width);
+        _mm512_mask_storeu_ps(
+            output + i, mask,
+            _mm512_max_ps(_mm512_maskz_loadu_ps(mask, input + i), zero));
+    }
+}
+
+void FloatToHalf(std::uint16_t* output, const float* input,
+                 unsigned int totalSize)
+{
+    constexpr int rounding = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                            _mm512_cvtps_ph(_mm512_loadu_ps(input + i),
+                                            rounding));
+    if (i < totalSize)
+    {
+        const auto count = totalSize - i;
+        alignas(32) std::uint16_t buffer[Width];
+        _mm256_store_si256(
+            reinterpret_cast<__m256i*>(buffer),
+            _mm512_cvtps_ph(_mm512_maskz_loadu_ps(TailMask(count), input + i),
+                            rounding));
+        for (unsigned int j = 0; j < count; ++j)
+            output[i + j] = buffer[j];
+    }
+}
+
+void HalfToFloat(float* output, const std::uint16_t* input,
+                 unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm512_storeu_ps(output + i, LoadHalf::Load(input + i));
+    if (i < totalSize)
+    {
+        const auto mask = TailMask(totalSize - i);
+        _mm512_mask_storeu_ps(
+            output + i, mask,
+            LoadHalf::LoadPartial(input + i, totalSize - i, mask));
+    }
+}
+
+void FloatToBFloat16(std::uint16_t* output, const float* input,
+                     unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                            ToBFloat16Bits(_mm512_loadu_ps(input + i)));
+    if (i < totalSize)
+    {
+        const auto count = totalSize - i;
+        alignas(32) std::uint16_t buffer[Width];
+        _mm256_store_si256(
+            reinterpret_cast<__m256i*>(buffer),
+            ToBFloat16Bits(_mm512_maskz_loadu_ps(TailMask(count), input + i)));
+        for (unsigned int j = 0; j < count; ++j)
+            output[i + j] = buffer[j];
+    }
+}
+
+void BFloat16ToFloat(float* output, const std::uint16_t* input,
+                     unsigned int totalSize)
+{
+    unsigned int i = 0;
+    for (; i + Width <= totalSize; i += Width)
+        _mm512_storeu_ps(output + i, LoadBFloat16::Load(input + i));
+    if (i < totalSize)
+    {
+        const auto mask = TailMask(totalSize - i);
+        _mm512_mask_storeu_ps(
+            output + i, mask,
+            LoadBFloat16::LoadPartial(input + i, totalSize - i, mask));
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512
+
+#endif
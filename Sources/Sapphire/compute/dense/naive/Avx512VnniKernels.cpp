@@ -0,0 +1,93 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+//! This file is compiled with AVX-512 foundation and AVX512-VNNI enabled
+//! Kernels here are used by Avx512 kernels only if the cpu supports them
+//! (see GetSimdKernels)
+
+#ifdef WITH_AVX512VNNI
+
+//! AVX-512 intrinsics of GCC 12 initialize their results with
+//! _mm512_undefined_*, which is falsely reported as maybe uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace Sapphire::Compute::Dense::Naive::Avx512Vnni
+{
+namespace
+{
+constexpr unsigned int Width = 16;
+
+//! out[Rows x N] = epilogue(A[Rows x K] * B)
+//! vpdpbusd adds 4 products of each channel into int32 accumulator at once
+template <unsigned int Rows>
+void GemmInt8Rows(float* out, const std::uint8_t* A, const std::int8_t* B,
+                  unsigned int N, unsigned int K, const Int8Epilogue& epilogue)
+{
+    const auto paddedN = (N + Int8PackWidth - 1) / Int8PackWidth *
+                         Int8PackWidth;
+
+    for (unsigned int nIdx = 0; nIdx < N; nIdx += Width)
+    {
+        __m512i acc[Rows];
+        for (unsigned int row = 0; row < Rows; ++row)
+            acc[row] = _mm512_setzero_si512();
+
+        for (unsigned int kIdx = 0; kIdx < K; kIdx += Int8PackDepth)
+        {
+            const __m512i b = _mm512_loadu_si512(
+                B + static_cast<std::size_t>(kIdx) * paddedN +
+                nIdx * Int8PackDepth);
+            for (unsigned int row = 0; row < Rows; ++row)
+            {
+                const __m512i a = _mm512_broadcastd_epi32(
+                    _mm_loadu_si32(A + row * K + kIdx));
+                acc[row] = _mm512_dpbusd_epi32(acc[row], a, b);
+            }
+        }
+
+        const __m512i offset = _mm512_loadu_si512(epilogue.Offset + nIdx);
+        const __m512 scale = _mm512_loadu_ps(epilogue.Scale + nIdx);
+        const __m512 bias = _mm512_loadu_ps(epilogue.Bias + nIdx);
+        const auto count = N - nIdx < Width ? N - nIdx : Width;
+        const auto mask = static_cast<__mmask16>((1u << count) - 1u);
+        for (unsigned int row = 0; row < Rows; ++row)
+        {
+            __m512 result = _mm512_fmadd_ps(
+                _mm512_cvtepi32_ps(_mm512_add_epi32(acc[row], offset)), scale,
+                bias);
+            if (epilogue.ReLU)
+                result = _mm512_max_ps(result, _mm512_setzero_ps());
+            _mm512_mask_storeu_ps(out + row * N + nIdx, mask, result);
+        }
+    }
+}
+} // namespace
+
+void GemmInt8(float* out, const std::uint8_t* A, const std::int8_t* B,
+              unsigned int M, unsigned int N, unsigned int K,
+              const Int8Epilogue& epilogue)
+{
+    constexpr unsigned int blockRows = 4;
+    unsigned int mIdx = 0;
+    for (; mIdx + blockRows <= M; mIdx += blockRows)
+        GemmInt8Rows<blockRows>(out + static_cast<std::size_t>(mIdx) * N,
+                                A + static_cast<std::size_t>(mIdx) * K, B, N,
+                                K, epilogue);
+    for (; mIdx < M; ++mIdx)
+        GemmInt8Rows<1>(out + static_cast<std::size_t>(mIdx) * N,
+                        A + static_cast<std::size_t>(mIdx) * K, B, N, K,
+                        epilogue);
+}
+} // namespace Sapphire::Compute::Dense::Naive::Avx512Vnni
+
+#endif
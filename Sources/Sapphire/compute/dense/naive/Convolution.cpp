@@ -6,19 +6,106 @@
 
 #include <cassert>
 #include <Sapphire/compute/dense/naive/Convolution.hpp>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace Sapphire::Compute::Dense::Naive
 {
 using namespace TensorUtil;
 
+namespace
+{
+//! Im2Col of a single unit of the input, laid out as (C, H, W) of inputShape
+//! Written to inputMatrix with inputMatrixCols columns
+void Im2ColUnit(float* inputMatrixDataHost, const float* inputDataHost,
+                const Shape& inputShape, const Shape& filterShape,
+                int inputMatrixCols, int outputRows, int outputCols,
+                int strideRow, int strideCol, int rowPadding, int colPadding,
+                int dilationRow, int dilationCol, float pad)
+{
+    const auto numChannels = filterShape.At(filterShape.Dim() - 3);
+    for (int channelIdx = 0; channelIdx < numChannels;
+         ++channelIdx)
+    {
+        for (int outputRowIdx = 0; outputRowIdx < outputRows;
+             outputRowIdx += 1)
+            for (int outputColIdx = 0; outputColIdx < outputCols;
+                 outputColIdx += 1)
+                for (int filterRowIdx = 0;
+                     filterRowIdx < (filterShape.Rows());
+                     ++filterRowIdx)
+                    for (int filterColIdx = 0;
+                         filterColIdx <
+                         (filterShape.Cols());
+                         ++filterColIdx)
+                    {
+                        const auto windowRowIdx = outputRowIdx * strideRow;
+                        const auto windowColIdx = outputColIdx * strideCol;
+
+                        const auto rowIdx =
+                            windowRowIdx + filterRowIdx * dilationRow;
+                        const auto colIdx =
+                            windowColIdx + filterColIdx * dilationCol;
+
+                        const auto inputRowIdx = rowIdx - rowPadding;
+                        const auto inputColIdx = colIdx - colPadding;
+
+                        const auto inputMatrixRowIdx =
+                            filterShape.Rows() * filterShape.Cols() *
+                            channelIdx +
+                            filterShape.Rows() * filterShape.Cols() -
+                            (filterRowIdx * filterShape.Cols() +
+                             filterColIdx) -
+                            1;
+                        const auto inputMatrixColIdx =
+                            outputRowIdx * outputCols + outputColIdx;
+
+                        const auto combinedInputMatrixIdx =
+                            inputMatrixRowIdx * inputMatrixCols +
+                            inputMatrixColIdx;
+                        const auto combinedInputIdx =
+                            inputShape.Rows() * inputShape.Cols() *
+                            channelIdx +
+                            inputRowIdx * inputShape.Cols() + inputColIdx;
+
+                        auto* inputMatrixDataPtr =
+                            inputMatrixDataHost + combinedInputMatrixIdx;
+
+                        const auto* inputDataPtr =
+                            inputDataHost + combinedInputIdx;
+
+                        if (inputRowIdx >= 0 &&
+                            inputRowIdx <
+                            (inputShape.Rows()) &&
+                            inputColIdx >= 0 &&
+                            inputColIdx <
+                            (inputShape.Cols()))
+                            *inputMatrixDataPtr = *inputDataPtr;
+                        else
+                            *inputMatrixDataPtr = pad;
+                    }
+    }
+}
+} // namespace
+
 void Im2Col(TensorData& inputMatrix, const TensorData& filter,
             const TensorData& input, int strideRow, int strideCol,
             int rowPadding, int colPadding, int dilationRow, int dilationCol,
             float pad)
+{
+    Im2Col(inputMatrix, filter.GetShape(), input, strideRow, strideCol,
+           rowPadding, colPadding, dilationRow, dilationCol, pad);
+}
+
+void Im2Col(TensorData& inputMatrix, const Shape& filterShape,
+            const TensorData& input, int strideRow, int strideCol,
+            int rowPadding, int colPadding, int dilationRow, int dilationCol,
+            float pad)
 {
     const auto inputShape = input.GetShape();
-    const auto filterShape = filter.GetShape();
     const auto numChannels = filterShape.At(filterShape.Dim() - 3);
     const auto inputMatrixShape = inputMatrix.GetShape();
 
@@ -44,74 +131,12 @@ void Im2Col(TensorData& inputMatrix, const TensorData& filter,
         inputMatrixShape.Rows() * inputMatrixShape.Cols();
 
     for (int nIdx = 0; nIdx < N; ++nIdx)
-    {
-        const auto* inputDataHost =
-            input.HostRawPtr() + InputSizePerBatch * nIdx;
-        auto* inputMatrixDataHost =
-            inputMatrix.HostMutableRawPtr() + InputMatrixSizePerBatch *
-            nIdx;
-        for (int channelIdx = 0; channelIdx < numChannels;
-             ++channelIdx)
-        {
-            for (int outputRowIdx = 0; outputRowIdx < outputRows;
-                 outputRowIdx += 1)
-                for (int outputColIdx = 0; outputColIdx < outputCols;
-                     outputColIdx += 1)
-                    for (int filterRowIdx = 0;
-                         filterRowIdx < (filterShape.Rows());
-                         ++filterRowIdx)
-                        for (int filterColIdx = 0;
-                             filterColIdx <
-                             (filterShape.Cols());
-                             ++filterColIdx)
-                        {
-                            const auto windowRowIdx = outputRowIdx * strideRow;
-                            const auto windowColIdx = outputColIdx * strideCol;
-
-                            const auto rowIdx =
-                                windowRowIdx + filterRowIdx * dilationRow;
-                            const auto colIdx =
-                                windowColIdx + filterColIdx * dilationCol;
-
-                            const auto inputRowIdx = rowIdx - rowPadding;
-                            const auto inputColIdx = colIdx - colPadding;
-
-                            const auto inputMatrixRowIdx =
-                                filterShape.Rows() * filterShape.Cols() *
-                                channelIdx +
-                                filterShape.Rows() * filterShape.Cols() -
-                                (filterRowIdx * filterShape.Cols() +
-                                 filterColIdx) -
-                                1;
-                            const auto inputMatrixColIdx =
-                                outputRowIdx * outputCols + outputColIdx;
-
-                            const auto combinedInputMatrixIdx =
-                                inputMatrixRowIdx * inputMatrixShape.Cols() +
-                                inputMatrixColIdx;
-                            const auto combinedInputIdx =
-                                inputShape.Rows() * inputShape.Cols() *
-                                channelIdx +
-                                inputRowIdx * inputShape.Cols() + inputColIdx;
-
-                            auto* inputMatrixDataPtr =
-                                inputMatrixDataHost + combinedInputMatrixIdx;
-
-                            const auto* inputDataPtr =
-                                inputDataHost + combinedInputIdx;
-
-                            if (inputRowIdx >= 0 &&
-                                inputRowIdx <
-                                (inputShape.Rows()) &&
-                                inputColIdx >= 0 &&
-                                inputColIdx <
-                                (inputShape.Cols()))
-                                *inputMatrixDataPtr = *inputDataPtr;
-                            else
-                                *inputMatrixDataPtr = pad;
-                        }
-        }
-    }
+        Im2ColUnit(inputMatrix.HostMutableRawPtr() +
+                   InputMatrixSizePerBatch * nIdx,
+                   input.HostRawPtr() + InputSizePerBatch * nIdx, inputShape,
+                   filterShape, inputMatrixShape.Cols(), outputRows,
+                   outputCols, strideRow, strideCol, rowPadding, colPadding,
+                   dilationRow, dilationCol, pad);
 }
 
 void Col2Im(TensorData& input, const TensorData& inputMatrix,
@@ -246,12 +271,54 @@ void Conv2D(TensorData& y, const TensorData& x, const TensorData& filter,
     rFilter.Reshape(rFilterShape);
     rY.Reshape(rYShape);
 
-    Gemm(rY, rFilter, rX);
+    Compute::Gemm(rY, rFilter, rX);
 
     rFilter.Reshape(filterShape);
     rY.Reshape(yShape);
 }
 
+void Conv2DActivation(TensorData& y, const TensorData& x,
+                      const TensorData& filter, const float* bias, bool relu,
+                      int strideRow, int strideCol, int rowPadding,
+                      int colPadding, int dilationRow, int dilationCol)
+{
+    assert(y.Mode() == ComputeMode::Host);
+    assert(x.Mode() == ComputeMode::Host);
+    assert(filter.Mode() == ComputeMode::Host);
+    const auto filterShape = filter.GetShape();
+    const auto yShape = y.GetShape();
+    const auto N = y.GetNumUnits(3);
+    const auto yChannels = yShape.At(yShape.Dim() - 3);
+    const auto yRowCols = yShape.Rows() * yShape.Cols();
+    const auto rXRows = filterShape.At(filterShape.Dim() - 3) *
+                        filterShape.Rows() * filterShape.Cols();
+    const auto xSizePerUnit = x.GetShape().Size() / x.GetNumUnits(3);
+    const auto ySizePerUnit = static_cast<std::size_t>(yChannels) * yRowCols;
+
+    //! Only a single unit is lowered at once, so its input matrix and output
+    //! are still in cache when bias and activation are applied to it
+    std::vector<float> rX(static_cast<std::size_t>(rXRows) * yRowCols);
+    for (int nIdx = 0; nIdx < N; ++nIdx)
+    {
+        Im2ColUnit(rX.data(), x.HostRawPtr() + xSizePerUnit * nIdx,
+                   x.GetShape(), filterShape, yRowCols, yShape.Rows(),
+                   yShape.Cols(), strideRow, strideCol, rowPadding,
+                   colPadding, dilationRow, dilationCol, 0.0f);
+
+        float* out = y.HostMutableRawPtr() + ySizePerUnit * nIdx;
+        std::fill(out, out + ySizePerUnit, 0.0f);
+        Gemm(static_cast<unsigned int>(ySizePerUnit), out, filter.HostRawPtr(),
+             rX.data(), static_cast<unsigned int>(yChannels),
+             static_cast<unsigned int>(yRowCols),
+             static_cast<unsigned int>(rXRows));
+        if (bias)
+            BiasActivation(out, bias, 1, static_cast<unsigned int>(yChannels),
+                           static_cast<unsigned int>(yRowCols), relu);
+        else if (relu)
+            ReLU(out, out, static_cast<unsigned int>(ySizePerUnit));
+    }
+}
+
 void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
                     const TensorData& x, const TensorData& filter,
                     int strideRow,
@@ -282,18 +349,14 @@ void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
     const Shape drYShape({ N, dyChannels, dyRows * dyCols });
 
     TensorData rX(rXShape, Type::Dense, device);
-    TensorData rXT(rXShape.GetTranspose(), Type::Dense, device);
     TensorData drX(rXShape, Type::Dense, device);
     TensorData rFilter = filter;
-    TensorData rFilterT(rFilterShape.GetTranspose(), Type::Dense, device);
     TensorData drFilter = dFilter;
     TensorData drY = dy;
 
     rX.SetMode(ComputeMode::Host);
-    rXT.SetMode(ComputeMode::Host);
     drX.SetMode(ComputeMode::Host);
     rFilter.SetMode(ComputeMode::Host);
-    rFilterT.SetMode(ComputeMode::Host);
     drFilter.SetMode(ComputeMode::Host);
     drY.SetMode(ComputeMode::Host);
 
@@ -303,10 +366,8 @@ void Conv2DBackward(TensorData& dx, TensorData& dFilter, const TensorData& dy,
     drFilter.Reshape(rFilterShape);
     drY.Reshape(drYShape);
 
-    Transpose(rFilterT, rFilter);
-    Gemm(drX, rFilterT, drY);
-    Transpose(rXT, rX);
-    Gemm(drFilter, drY, rXT);
+    Compute::Gemm(drX, rFilter.TransposeView(), drY);
+    Compute::Gemm(drFilter, drY, rX.TransposeView());
 
     rFilter.Reshape(dFilterShape);
     drFilter.Reshape(dFilterShape);
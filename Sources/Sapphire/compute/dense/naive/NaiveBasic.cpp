@@ -5,7 +5,10 @@
 // property of any third parties.
 
 #include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
 #include <limits>
@@ -16,6 +19,13 @@ void Add(unsigned int totalSize, float* output, const float* inputA,
          const float* inputB, unsigned int inputStride, bool broadcastInputA,
          bool broadcastInputB)
 {
+    if (const auto* kernels = GetSimdKernels();
+        kernels && !broadcastInputA && !broadcastInputB)
+    {
+        kernels->Add(output, inputA, inputB, totalSize);
+        return;
+    }
+
     const unsigned int leftOverA = broadcastInputA ? inputStride : totalSize;
     const unsigned int leftOverB = broadcastInputB ? inputStride : totalSize;
 
@@ -29,6 +39,13 @@ void Sub(unsigned int totalSize, float* output, const float* inputA,
          const float* inputB, unsigned int inputStride, bool broadcastInputA,
          bool broadcastInputB)
 {
+    if (const auto* kernels = GetSimdKernels();
+        kernels && !broadcastInputA && !broadcastInputB)
+    {
+        kernels->Sub(output, inputA, inputB, totalSize);
+        return;
+    }
+
     const unsigned int leftOverA = broadcastInputA ? inputStride : totalSize;
     const unsigned int leftOverB = broadcastInputB ? inputStride : totalSize;
 
@@ -42,6 +59,13 @@ void Dot(unsigned int totalSize, float* output, const float* inputA,
          const float* inputB, unsigned int inputStride, bool broadcastInputA,
          bool broadcastInputB)
 {
+    if (const auto* kernels = GetSimdKernels();
+        kernels && !broadcastInputA && !broadcastInputB)
+    {
+        kernels->Dot(output, inputA, inputB, totalSize);
+        return;
+    }
+
     const unsigned int leftOverA = broadcastInputA ? inputStride : totalSize;
     const unsigned int leftOverB = broadcastInputB ? inputStride : totalSize;
 
@@ -54,6 +78,12 @@ void Dot(unsigned int totalSize, float* output, const float* inputA,
 void Scale(float* output, const float* input, const float scaleFactor,
            unsigned int totalSize)
 {
+    if (const auto* kernels = GetSimdKernels(); kernels)
+    {
+        kernels->Scale(output, input, scaleFactor, totalSize);
+        return;
+    }
+
     for (unsigned int i = 0; i < totalSize; i++)
     {
         output[i] = input[i] * scaleFactor;
@@ -83,6 +113,53 @@ void Transpose(float* output, const float* input, unsigned int inputRows,
             }
 }
 
+void StridedCopy(float* dst, const float* src, const StridedLayout& layout,
+                 unsigned int totalSize)
+{
+    if (totalSize == 0)
+        return;
+    if (layout.Dim == 0)
+    {
+        dst[0] = src[0];
+        return;
+    }
+
+    //! Innermost dimension is copied in a single loop, while index of outer
+    //! dimensions is carried over
+    const auto innerDim = layout.Dim - 1;
+    const auto innerSize = static_cast<unsigned int>(layout.Shape[innerDim]);
+    const auto dstInnerStride = layout.DstStrides[innerDim];
+    const auto srcInnerStride = layout.SrcStrides[innerDim];
+
+    int index[StridedLayout::MaxDim] = {};
+    long dstOffset = 0;
+    long srcOffset = 0;
+
+    for (unsigned int outerIdx = 0; outerIdx < totalSize / innerSize;
+         ++outerIdx)
+    {
+        float* dstPtr = dst + dstOffset;
+        const float* srcPtr = src + srcOffset;
+        for (unsigned int i = 0; i < innerSize; ++i)
+            dstPtr[static_cast<long>(i) * dstInnerStride] =
+                srcPtr[static_cast<long>(i) * srcInnerStride];
+
+        for (int dim = innerDim - 1; dim >= 0; --dim)
+        {
+            index[dim] += 1;
+            dstOffset += layout.DstStrides[dim];
+            srcOffset += layout.SrcStrides[dim];
+            if (index[dim] < layout.Shape[dim])
+                break;
+            dstOffset -= static_cast<long>(layout.DstStrides[dim]) *
+                layout.Shape[dim];
+            srcOffset -= static_cast<long>(layout.SrcStrides[dim]) *
+                layout.Shape[dim];
+            index[dim] = 0;
+        }
+    }
+}
+
 void Pow(float* output, const float* input, const float exponent,
          unsigned int totalSize)
 {
@@ -158,6 +235,12 @@ void log10(float* output, const float* input, unsigned int totalSize)
 
 void ReLU(float* output, const float* input, unsigned int totalSize)
 {
+    if (const auto* kernels = GetSimdKernels(); kernels)
+    {
+        kernels->ReLU(output, input, totalSize);
+        return;
+    }
+
     for (unsigned int i = 0; i < totalSize; ++i)
     {
         output[i] = input[i] > 0 ? input[i] : 0;
@@ -173,6 +256,37 @@ void ReLUBackward(float* dx, const float* dy, const float* x,
     }
 }
 
+void BiasActivation(float* y, const float* bias, unsigned int numUnits,
+                    unsigned int channels, unsigned int innerSize, bool relu)
+{
+    for (std::size_t unitIdx = 0; unitIdx < numUnits; ++unitIdx)
+        for (std::size_t channelIdx = 0; channelIdx < channels; ++channelIdx)
+        {
+            float* ptr = y + (unitIdx * channels + channelIdx) * innerSize;
+            const float value = bias[channelIdx];
+            if (relu)
+            {
+#pragma omp simd
+                for (std::size_t i = 0; i < innerSize; ++i)
+                    ptr[i] = std::max(ptr[i] + value, 0.0f);
+            }
+            else
+            {
+#pragma omp simd
+                for (std::size_t i = 0; i < innerSize; ++i)
+                    ptr[i] += value;
+            }
+        }
+}
+
+void AddReLU(float* output, const float* inputA, const float* inputB,
+             unsigned int totalSize)
+{
+#pragma omp simd
+    for (unsigned int i = 0; i < totalSize; ++i)
+        output[i] = std::max(inputA[i] + inputB[i], 0.0f);
+}
+
 void LeakyReLU(float* output, const float* input, float a,
                unsigned int totalSize)
 {
@@ -5,14 +5,34 @@
 // property of any third parties.
 
 #include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <cstddef>
 #include <cstdlib>
+#include <vector>
 
 namespace Sapphire::Compute::Dense::Naive
 {
+namespace
+{
+//! Copies (rows x cols) matrix src into dst as (cols x rows) matrix
+void Pack(float* dst, const float* src, std::size_t rows, std::size_t cols)
+{
+    for (std::size_t row = 0; row < rows; ++row)
+        for (std::size_t col = 0; col < cols; ++col)
+            dst[col * rows + row] = src[row * cols + col];
+}
+} // namespace
+
 void Gemm(unsigned int totalSize, float* out, const float* A,
           const float* B, unsigned int M, unsigned int N,
           unsigned int K)
 {
+    if (const auto* kernels = GetSimdKernels(); kernels)
+    {
+        kernels->Gemm(totalSize, out, A, B, M, N, K);
+        return;
+    }
+
     const auto strideA = M * K;
     const auto strideB = K * N;
     const auto strideOut = M * N;
@@ -36,4 +56,94 @@ void Gemm(unsigned int totalSize, float* out, const float* A,
                 batchPtrOut[N * mIdx + nIdx] += sum;
             }
 }
+
+void GemmTransposed(unsigned int totalSize, float* out, const float* A,
+                    const float* B, unsigned int M, unsigned int N,
+                    unsigned int K, bool transposeA, bool transposeB)
+{
+    if (!transposeA && !transposeB)
+    {
+        Gemm(totalSize, out, A, B, M, N, K);
+        return;
+    }
+
+    const auto strideA = static_cast<std::size_t>(M) * K;
+    const auto strideB = static_cast<std::size_t>(K) * N;
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+
+    //! Vectorized kernels are much faster than the loops below, so transposed
+    //! matrices are packed into row major order for them. Packing costs
+    //! O(M*K + K*N) compared to O(M*N*K) of the multiplication
+    if (const auto* kernels = GetSimdKernels(); kernels)
+    {
+        thread_local std::vector<float> packed;
+        packed.resize((transposeA ? strideA : 0) + (transposeB ? strideB : 0));
+        float* packedA = packed.data();
+        float* packedB = packed.data() + (transposeA ? strideA : 0);
+
+        for (std::size_t chunkIdx = 0; chunkIdx < totalSize / strideOut;
+             ++chunkIdx)
+        {
+            const float* batchPtrA = A + strideA * chunkIdx;
+            const float* batchPtrB = B + strideB * chunkIdx;
+            if (transposeA)
+            {
+                Pack(packedA, batchPtrA, K, M);
+                batchPtrA = packedA;
+            }
+            if (transposeB)
+            {
+                Pack(packedB, batchPtrB, N, K);
+                batchPtrB = packedB;
+            }
+            kernels->Gemm(static_cast<unsigned int>(strideOut),
+                          out + strideOut * chunkIdx, batchPtrA, batchPtrB, M,
+                          N, K);
+        }
+        return;
+    }
+
+    for (std::size_t chunkIdx = 0; chunkIdx < totalSize / strideOut;
+         ++chunkIdx)
+    {
+        const float* batchPtrA = A + strideA * chunkIdx;
+        const float* batchPtrB = B + strideB * chunkIdx;
+        float* batchPtrOut = out + strideOut * chunkIdx;
+
+        if (!transposeA)
+        {
+            //! Rows of A and B are both contiguous along K
+            for (std::size_t mIdx = 0; mIdx < M; ++mIdx)
+                for (std::size_t nIdx = 0; nIdx < N; ++nIdx)
+                {
+                    const float* rowA = batchPtrA + mIdx * K;
+                    const float* rowB = batchPtrB + nIdx * K;
+                    float sum = 0.0f;
+#pragma omp simd reduction(+ : sum)
+                    for (std::size_t kIdx = 0; kIdx < K; ++kIdx)
+                        sum += rowA[kIdx] * rowB[kIdx];
+                    batchPtrOut[mIdx * N + nIdx] += sum;
+                }
+            continue;
+        }
+
+        //! Accumulates outer product of column of A and row of B
+        for (std::size_t kIdx = 0; kIdx < K; ++kIdx)
+            for (std::size_t mIdx = 0; mIdx < M; ++mIdx)
+            {
+                const float a = batchPtrA[kIdx * M + mIdx];
+                float* rowOut = batchPtrOut + mIdx * N;
+                if (transposeB)
+                    for (std::size_t nIdx = 0; nIdx < N; ++nIdx)
+                        rowOut[nIdx] += a * batchPtrB[nIdx * K + kIdx];
+                else
+                {
+                    const float* rowB = batchPtrB + kIdx * N;
+#pragma omp simd
+                    for (std::size_t nIdx = 0; nIdx < N; ++nIdx)
+                        rowOut[nIdx] += a * rowB[nIdx];
+                }
+            }
+    }
+}
 } // namespace Sapphire::Compute::Naive::Dense
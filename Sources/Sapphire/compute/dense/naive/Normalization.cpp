@@ -0,0 +1,186 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/Normalization.hpp>
+#include <cmath>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+void BatchNormForward(float* y, float* mean, float* invStd, float* variance,
+                      const float* x, const float* gamma, const float* beta,
+                      unsigned int numUnits, unsigned int channels,
+                      unsigned int innerSize, float epsilon)
+{
+    const std::size_t unitSize = static_cast<std::size_t>(channels) *
+                                 innerSize;
+    for (std::size_t channelIdx = 0; channelIdx < channels; ++channelIdx)
+    {
+        //! Contiguous runs of the channel are accumulated separately and
+        //! merged, so each run is a short dependency chain
+        WelfordState state;
+        for (std::size_t unitIdx = 0; unitIdx < numUnits; ++unitIdx)
+        {
+            const float* in = x + unitIdx * unitSize + channelIdx * innerSize;
+            WelfordState runState;
+            for (std::size_t i = 0; i < innerSize; ++i)
+                runState.Add(in[i]);
+            state.Merge(runState);
+        }
+
+        const float channelMean = state.Mean;
+        const float channelInvStd = 1.0f /
+                                    std::sqrt(state.Variance() + epsilon);
+        mean[channelIdx] = channelMean;
+        invStd[channelIdx] = channelInvStd;
+        variance[channelIdx] = state.Variance();
+
+        const float scale = gamma[channelIdx] * channelInvStd;
+        const float shift = beta[channelIdx] - channelMean * scale;
+        for (std::size_t unitIdx = 0; unitIdx < numUnits; ++unitIdx)
+        {
+            const auto offset = unitIdx * unitSize + channelIdx * innerSize;
+#pragma omp simd
+            for (std::size_t i = 0; i < innerSize; ++i)
+                y[offset + i] = std::fma(x[offset + i], scale, shift);
+        }
+    }
+}
+
+void BatchNormInference(float* y, const float* x, const float* runningMean,
+                        const float* runningVar, const float* gamma,
+                        const float* beta, unsigned int numUnits,
+                        unsigned int channels, unsigned int innerSize,
+                        float epsilon)
+{
+    const std::size_t unitSize = static_cast<std::size_t>(channels) *
+                                 innerSize;
+    for (std::size_t channelIdx = 0; channelIdx < channels; ++channelIdx)
+    {
+        const float scale = gamma[channelIdx] /
+                            std::sqrt(runningVar[channelIdx] + epsilon);
+        const float shift = beta[channelIdx] - runningMean[channelIdx] * scale;
+        for (std::size_t unitIdx = 0; unitIdx < numUnits; ++unitIdx)
+        {
+            const auto offset = unitIdx * unitSize + channelIdx * innerSize;
+#pragma omp simd
+            for (std::size_t i = 0; i < innerSize; ++i)
+                y[offset + i] = std::fma(x[offset + i], scale, shift);
+        }
+    }
+}
+
+void BatchNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* mean, const float* invStd,
+                       const float* gamma, unsigned int numUnits,
+                       unsigned int channels, unsigned int innerSize)
+{
+    const std::size_t unitSize = static_cast<std::size_t>(channels) *
+                                 innerSize;
+    const auto count = static_cast<float>(numUnits) *
+                       static_cast<float>(innerSize);
+    for (std::size_t channelIdx = 0; channelIdx < channels; ++channelIdx)
+    {
+        const float channelMean = mean[channelIdx];
+        const float channelInvStd = invStd[channelIdx];
+
+        float sumDy = 0.0f, sumDyXHat = 0.0f;
+        for (std::size_t unitIdx = 0; unitIdx < numUnits; ++unitIdx)
+        {
+            const auto offset = unitIdx * unitSize + channelIdx * innerSize;
+#pragma omp simd reduction(+ : sumDy, sumDyXHat)
+            for (std::size_t i = 0; i < innerSize; ++i)
+            {
+                sumDy += dy[offset + i];
+                sumDyXHat += dy[offset + i] *
+                    (x[offset + i] - channelMean) * channelInvStd;
+            }
+        }
+        dGamma[channelIdx] = sumDyXHat;
+        dBeta[channelIdx] = sumDy;
+
+        const float scale = gamma[channelIdx] * channelInvStd / count;
+        for (std::size_t unitIdx = 0; unitIdx < numUnits; ++unitIdx)
+        {
+            const auto offset = unitIdx * unitSize + channelIdx * innerSize;
+#pragma omp simd
+            for (std::size_t i = 0; i < innerSize; ++i)
+            {
+                const float xHat =
+                    (x[offset + i] - channelMean) * channelInvStd;
+                dx[offset + i] += scale * (count * dy[offset + i] - sumDy -
+                                           xHat * sumDyXHat);
+            }
+        }
+    }
+}
+
+void LayerNormForward(float* y, float* mean, float* invStd, const float* x,
+                      const float* gamma, const float* beta, unsigned int rows,
+                      unsigned int rowSize, float epsilon)
+{
+    for (std::size_t rowIdx = 0; rowIdx < rows; ++rowIdx)
+    {
+        const float* in = x + rowIdx * rowSize;
+        float* out = y + rowIdx * rowSize;
+
+        WelfordState state;
+        for (std::size_t i = 0; i < rowSize; ++i)
+            state.Add(in[i]);
+
+        const float rowMean = state.Mean;
+        const float rowInvStd = 1.0f / std::sqrt(state.Variance() + epsilon);
+        mean[rowIdx] = rowMean;
+        invStd[rowIdx] = rowInvStd;
+
+#pragma omp simd
+        for (std::size_t i = 0; i < rowSize; ++i)
+            out[i] = std::fma((in[i] - rowMean) * rowInvStd, gamma[i],
+                              beta[i]);
+    }
+}
+
+void LayerNormBackward(float* dx, float* dGamma, float* dBeta, const float* dy,
+                       const float* x, const float* mean, const float* invStd,
+                       const float* gamma, unsigned int rows,
+                       unsigned int rowSize)
+{
+    for (std::size_t i = 0; i < rowSize; ++i)
+    {
+        dGamma[i] = 0.0f;
+        dBeta[i] = 0.0f;
+    }
+
+    const auto size = static_cast<float>(rowSize);
+    for (std::size_t rowIdx = 0; rowIdx < rows; ++rowIdx)
+    {
+        const auto offset = rowIdx * rowSize;
+        const float rowMean = mean[rowIdx];
+        const float rowInvStd = invStd[rowIdx];
+
+        float sumDxHat = 0.0f, sumDxHatXHat = 0.0f;
+#pragma omp simd reduction(+ : sumDxHat, sumDxHatXHat)
+        for (std::size_t i = 0; i < rowSize; ++i)
+        {
+            const float xHat = (x[offset + i] - rowMean) * rowInvStd;
+            const float dxHat = dy[offset + i] * gamma[i];
+            sumDxHat += dxHat;
+            sumDxHatXHat += dxHat * xHat;
+            dGamma[i] += dy[offset + i] * xHat;
+            dBeta[i] += dy[offset + i];
+        }
+
+        const float scale = rowInvStd / size;
+#pragma omp simd
+        for (std::size_t i = 0; i < rowSize; ++i)
+        {
+            const float xHat = (x[offset + i] - rowMean) * rowInvStd;
+            dx[offset + i] += scale * (size * dy[offset + i] * gamma[i] -
+                                       sumDxHat - xHat * sumDxHatXHat);
+        }
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,112 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/Quantize.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+unsigned int Int8PaddedDepth(unsigned int K)
+{
+    return (K + Int8PackDepth - 1) / Int8PackDepth * Int8PackDepth;
+}
+
+unsigned int Int8PaddedWidth(unsigned int N)
+{
+    return (N + Int8PackWidth - 1) / Int8PackWidth * Int8PackWidth;
+}
+
+void QuantizeActivation(std::uint8_t* out, const float* in, unsigned int rows,
+                        unsigned int cols, unsigned int paddedCols,
+                        unsigned int rowStride, unsigned int colStride,
+                        float scale, int zeroPoint)
+{
+    const float inverseScale = 1.0f / scale;
+    const auto offset = static_cast<float>(zeroPoint);
+    constexpr auto maxValue = static_cast<float>(Int8ActivationMax);
+
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        const float* rowIn = in + row * rowStride;
+        std::uint8_t* rowOut = out + row * paddedCols;
+        for (std::size_t col = 0; col < cols; ++col)
+        {
+            const float value =
+                std::nearbyint(rowIn[col * colStride] * inverseScale) + offset;
+            rowOut[col] = static_cast<std::uint8_t>(
+                std::min(std::max(value, 0.0f), maxValue));
+        }
+        std::fill(rowOut + cols, rowOut + paddedCols, std::uint8_t(0));
+    }
+}
+
+void PackInt8Weight(std::int8_t* packed, float* scales,
+                    std::int32_t* columnSums, const float* weight,
+                    unsigned int K, unsigned int N, unsigned int rowStride,
+                    unsigned int colStride)
+{
+    const std::size_t paddedK = Int8PaddedDepth(K);
+    const std::size_t paddedN = Int8PaddedWidth(N);
+    std::fill(packed, packed + paddedK * paddedN, std::int8_t(0));
+
+    for (std::size_t nIdx = 0; nIdx < N; ++nIdx)
+    {
+        const float* channel = weight + nIdx * colStride;
+        float maxMagnitude = 0.0f;
+        for (std::size_t kIdx = 0; kIdx < K; ++kIdx)
+            maxMagnitude =
+                std::max(maxMagnitude, std::abs(channel[kIdx * rowStride]));
+
+        //! Channels of zeros are kept zero with any scale
+        const float scale = maxMagnitude > 0.0f
+                                ? maxMagnitude / Int8WeightMax
+                                : 1.0f;
+        std::int32_t sum = 0;
+        for (std::size_t kIdx = 0; kIdx < K; ++kIdx)
+        {
+            const auto value = static_cast<std::int8_t>(std::clamp(
+                static_cast<int>(
+                    std::nearbyint(channel[kIdx * rowStride] / scale)),
+                -Int8WeightMax, Int8WeightMax));
+            packed[(kIdx / Int8PackDepth * paddedN + nIdx) * Int8PackDepth +
+                   kIdx % Int8PackDepth] = value;
+            sum += value;
+        }
+        scales[nIdx] = scale;
+        columnSums[nIdx] = sum;
+    }
+}
+
+void GemmInt8(float* out, const std::uint8_t* A, const std::int8_t* B,
+              unsigned int M, unsigned int N, unsigned int K,
+              const Int8Epilogue& epilogue)
+{
+    if (const auto* kernels = GetSimdKernels(); kernels && kernels->GemmInt8)
+    {
+        kernels->GemmInt8(out, A, B, M, N, K, epilogue);
+        return;
+    }
+
+    const std::size_t paddedN = Int8PaddedWidth(N);
+    for (std::size_t mIdx = 0; mIdx < M; ++mIdx)
+        for (std::size_t nIdx = 0; nIdx < N; ++nIdx)
+        {
+            std::int32_t sum = 0;
+            for (std::size_t kIdx = 0; kIdx < K; ++kIdx)
+                sum += static_cast<std::int32_t>(A[mIdx * K + kIdx]) *
+                    B[(kIdx / Int8PackDepth * paddedN + nIdx) *
+                      Int8PackDepth + kIdx % Int8PackDepth];
+
+            const float value =
+                std::fma(static_cast<float>(sum + epilogue.Offset[nIdx]),
+                         epilogue.Scale[nIdx], epilogue.Bias[nIdx]);
+            out[mIdx * N + nIdx] =
+                epilogue.ReLU && !(value > 0.0f) ? 0.0f : value;
+        }
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,159 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/Recurrent.hpp>
+#include <cmath>
+#include <cstddef>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+float Sigmoid(float x)
+{
+    return 1.0f / (1.0f + std::exp(-x));
+}
+} // namespace
+
+void LstmCellForward(float* gates, float* cell, float* hidden,
+                     const float* cellPrev, unsigned int batchSize,
+                     unsigned int hiddenSize)
+{
+    const std::size_t H = hiddenSize;
+    for (std::size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        float* gate = gates + batchIdx * 4 * H;
+        const auto offset = batchIdx * H;
+        for (std::size_t i = 0; i < H; ++i)
+        {
+            const float inputGate = Sigmoid(gate[i]);
+            const float forgetGate = Sigmoid(gate[H + i]);
+            const float cellGate = std::tanh(gate[2 * H + i]);
+            const float outputGate = Sigmoid(gate[3 * H + i]);
+            const float prev = cellPrev ? cellPrev[offset + i] : 0.0f;
+            const float state = forgetGate * prev + inputGate * cellGate;
+
+            gate[i] = inputGate;
+            gate[H + i] = forgetGate;
+            gate[2 * H + i] = cellGate;
+            gate[3 * H + i] = outputGate;
+            cell[offset + i] = state;
+            hidden[offset + i] = outputGate * std::tanh(state);
+        }
+    }
+}
+
+void LstmCellBackward(float* dGates, float* dCell, const float* dHidden,
+                      const float* dHiddenNext, const float* gates,
+                      const float* cell, const float* cellPrev,
+                      unsigned int batchSize, unsigned int hiddenSize)
+{
+    const std::size_t H = hiddenSize;
+    for (std::size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        const float* gate = gates + batchIdx * 4 * H;
+        float* dGate = dGates + batchIdx * 4 * H;
+        const auto offset = batchIdx * H;
+        for (std::size_t i = 0; i < H; ++i)
+        {
+            const float inputGate = gate[i];
+            const float forgetGate = gate[H + i];
+            const float cellGate = gate[2 * H + i];
+            const float outputGate = gate[3 * H + i];
+            const float tanhCell = std::tanh(cell[offset + i]);
+            const float prev = cellPrev ? cellPrev[offset + i] : 0.0f;
+
+            const float dh = dHidden[offset + i] +
+                             (dHiddenNext ? dHiddenNext[offset + i] : 0.0f);
+            const float dc = dCell[offset + i] +
+                             dh * outputGate * (1.0f - tanhCell * tanhCell);
+
+            dGate[i] = dc * cellGate * inputGate * (1.0f - inputGate);
+            dGate[H + i] = dc * prev * forgetGate * (1.0f - forgetGate);
+            dGate[2 * H + i] = dc * inputGate * (1.0f - cellGate * cellGate);
+            dGate[3 * H + i] =
+                dh * tanhCell * outputGate * (1.0f - outputGate);
+            dCell[offset + i] = dc * forgetGate;
+        }
+    }
+}
+
+void GruCellForward(float* gates, float* hidden, const float* inputProj,
+                    const float* hiddenProj, const float* hiddenBias,
+                    const float* hiddenPrev, unsigned int batchSize,
+                    unsigned int hiddenSize)
+{
+    const std::size_t H = hiddenSize;
+    for (std::size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        const float* in = inputProj + batchIdx * 3 * H;
+        const float* proj = hiddenProj ? hiddenProj + batchIdx * 3 * H
+                                       : nullptr;
+        float* gate = gates + batchIdx * 4 * H;
+        const auto offset = batchIdx * H;
+        for (std::size_t i = 0; i < H; ++i)
+        {
+            const float hr = hiddenBias[i] + (proj ? proj[i] : 0.0f);
+            const float hz = hiddenBias[H + i] + (proj ? proj[H + i] : 0.0f);
+            const float hn =
+                hiddenBias[2 * H + i] + (proj ? proj[2 * H + i] : 0.0f);
+
+            const float resetGate = Sigmoid(in[i] + hr);
+            const float updateGate = Sigmoid(in[H + i] + hz);
+            const float newGate = std::tanh(in[2 * H + i] + resetGate * hn);
+            const float prev = hiddenPrev ? hiddenPrev[offset + i] : 0.0f;
+
+            gate[i] = resetGate;
+            gate[H + i] = updateGate;
+            gate[2 * H + i] = newGate;
+            gate[3 * H + i] = hn;
+            hidden[offset + i] =
+                (1.0f - updateGate) * newGate + updateGate * prev;
+        }
+    }
+}
+
+void GruCellBackward(float* dInputProj, float* dHiddenProj,
+                     float* dHiddenPrev, const float* dHidden,
+                     const float* dHiddenNext, const float* gates,
+                     const float* hiddenPrev, unsigned int batchSize,
+                     unsigned int hiddenSize)
+{
+    const std::size_t H = hiddenSize;
+    for (std::size_t batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        const float* gate = gates + batchIdx * 4 * H;
+        float* dIn = dInputProj + batchIdx * 3 * H;
+        float* dProj = dHiddenProj + batchIdx * 3 * H;
+        const auto offset = batchIdx * H;
+        for (std::size_t i = 0; i < H; ++i)
+        {
+            const float resetGate = gate[i];
+            const float updateGate = gate[H + i];
+            const float newGate = gate[2 * H + i];
+            const float hn = gate[3 * H + i];
+            const float prev = hiddenPrev ? hiddenPrev[offset + i] : 0.0f;
+
+            const float dh = dHidden[offset + i] +
+                             (dHiddenNext ? dHiddenNext[offset + i] : 0.0f);
+            const float dNewPre =
+                dh * (1.0f - updateGate) * (1.0f - newGate * newGate);
+            const float dResetPre =
+                dNewPre * hn * resetGate * (1.0f - resetGate);
+            const float dUpdatePre = dh * (prev - newGate) * updateGate *
+                                     (1.0f - updateGate);
+
+            dIn[i] = dResetPre;
+            dIn[H + i] = dUpdatePre;
+            dIn[2 * H + i] = dNewPre;
+            dProj[i] = dResetPre;
+            dProj[H + i] = dUpdatePre;
+            dProj[2 * H + i] = dNewPre * resetGate;
+            dHiddenPrev[offset + i] = dh * updateGate;
+        }
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive
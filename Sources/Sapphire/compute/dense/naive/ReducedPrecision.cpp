@@ -0,0 +1,199 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/compute/dense/naive/ReducedPrecision.hpp>
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+//! Number of elements converted at once by Elementwise
+//! Three blocks of Float32 take 12KB
+constexpr unsigned int BlockSize = 1024;
+
+void ToFloat(float* output, const std::uint16_t* input,
+             unsigned int totalSize, DataType inputType)
+{
+    const auto* kernels = GetSimdKernels();
+    if (inputType == DataType::Float16)
+    {
+        if (kernels)
+            kernels->HalfToFloat(output, input, totalSize);
+        else
+            for (unsigned int i = 0; i < totalSize; ++i)
+                output[i] = Util::HalfToFloat(input[i]);
+        return;
+    }
+
+    if (kernels)
+        kernels->BFloat16ToFloat(output, input, totalSize);
+    else
+        for (unsigned int i = 0; i < totalSize; ++i)
+            output[i] = Util::BFloat16ToFloat(input[i]);
+}
+
+void FromFloat(std::uint16_t* output, const float* input,
+               unsigned int totalSize, DataType outputType)
+{
+    const auto* kernels = GetSimdKernels();
+    if (outputType == DataType::Float16)
+    {
+        if (kernels)
+            kernels->FloatToHalf(output, input, totalSize);
+        else
+            for (unsigned int i = 0; i < totalSize; ++i)
+                output[i] = Util::FloatToHalf(input[i]);
+        return;
+    }
+
+    if (kernels)
+        kernels->FloatToBFloat16(output, input, totalSize);
+    else
+        for (unsigned int i = 0; i < totalSize; ++i)
+            output[i] = Util::FloatToBFloat16(input[i]);
+}
+
+//! Returns block of input in Float32, converting it into buffer if needed
+const float* LoadBlock(const void* input, DataType inputType,
+                       std::size_t offset, unsigned int size, float* buffer)
+{
+    if (inputType == DataType::Float32)
+        return static_cast<const float*>(input) + offset;
+    ToFloat(buffer, static_cast<const std::uint16_t*>(input) + offset, size,
+            inputType);
+    return buffer;
+}
+
+//! Returns where kernel should write block of output
+float* OutputBlock(void* output, DataType outputType, std::size_t offset,
+                   float* buffer)
+{
+    return outputType == DataType::Float32
+               ? static_cast<float*>(output) + offset
+               : buffer;
+}
+
+void StoreBlock(void* output, DataType outputType, std::size_t offset,
+                unsigned int size, const float* buffer)
+{
+    if (outputType != DataType::Float32)
+        FromFloat(static_cast<std::uint16_t*>(output) + offset, buffer, size,
+                  outputType);
+}
+} // namespace
+
+void Convert(void* output, DataType outputType, const void* input,
+             DataType inputType, unsigned int totalSize)
+{
+    if (outputType == inputType)
+    {
+        std::memcpy(output, input, totalSize * DataTypeSize(inputType));
+        return;
+    }
+
+    if (inputType == DataType::Float32)
+    {
+        FromFloat(static_cast<std::uint16_t*>(output),
+                  static_cast<const float*>(input), totalSize, outputType);
+        return;
+    }
+
+    if (outputType == DataType::Float32)
+    {
+        ToFloat(static_cast<float*>(output),
+                static_cast<const std::uint16_t*>(input), totalSize,
+                inputType);
+        return;
+    }
+
+    //! Between Float16 and BFloat16
+    Elementwise(output, outputType, input, inputType, totalSize,
+                [](float* out, const float* in, unsigned int size) {
+                    std::copy(in, in + size, out);
+                });
+}
+
+void GemmReduced(unsigned int totalSize, float* out, const float* A,
+                 const std::uint16_t* B, unsigned int M, unsigned int N,
+                 unsigned int K, bool transposeB, DataType typeB)
+{
+    const auto strideA = static_cast<std::size_t>(M) * K;
+    const auto strideB = static_cast<std::size_t>(K) * N;
+    const auto strideOut = static_cast<std::size_t>(M) * N;
+    const auto* kernels = GetSimdKernels();
+
+    for (std::size_t chunkIdx = 0; chunkIdx < totalSize / strideOut;
+         ++chunkIdx)
+    {
+        const float* batchPtrA = A + strideA * chunkIdx;
+        const std::uint16_t* batchPtrB = B + strideB * chunkIdx;
+        float* batchPtrOut = out + strideOut * chunkIdx;
+
+        if (kernels && !transposeB)
+        {
+            const auto gemm = typeB == DataType::Float16
+                                  ? kernels->GemmHalf
+                                  : kernels->GemmBFloat16;
+            gemm(static_cast<unsigned int>(strideOut), batchPtrOut, batchPtrA,
+                 batchPtrB, M, N, K);
+            continue;
+        }
+
+        //! Converting B costs O(K*N) compared to O(M*N*K) of the
+        //! multiplication, and lets Float32 kernels handle the layout
+        thread_local std::vector<float> converted;
+        converted.resize(strideB);
+        ToFloat(converted.data(), batchPtrB,
+                static_cast<unsigned int>(strideB), typeB);
+        GemmTransposed(static_cast<unsigned int>(strideOut), batchPtrOut,
+                       batchPtrA, converted.data(), M, N, K, false,
+                       transposeB);
+    }
+}
+
+void Elementwise(void* output, DataType outputType, const void* input,
+                 DataType inputType, unsigned int totalSize,
+                 const UnaryKernel& kernel)
+{
+    float inputBuffer[BlockSize];
+    float outputBuffer[BlockSize];
+
+    for (unsigned int offset = 0; offset < totalSize; offset += BlockSize)
+    {
+        const auto size = std::min(BlockSize, totalSize - offset);
+        const float* in =
+            LoadBlock(input, inputType, offset, size, inputBuffer);
+        float* out = OutputBlock(output, outputType, offset, outputBuffer);
+        kernel(out, in, size);
+        StoreBlock(output, outputType, offset, size, out);
+    }
+}
+
+void Elementwise(void* output, DataType outputType, const void* inputA,
+                 DataType typeA, const void* inputB, DataType typeB,
+                 unsigned int totalSize, const BinaryKernel& kernel)
+{
+    float bufferA[BlockSize];
+    float bufferB[BlockSize];
+    float outputBuffer[BlockSize];
+
+    for (unsigned int offset = 0; offset < totalSize; offset += BlockSize)
+    {
+        const auto size = std::min(BlockSize, totalSize - offset);
+        const float* a = LoadBlock(inputA, typeA, offset, size, bufferA);
+        const float* b = LoadBlock(inputB, typeB, offset, size, bufferB);
+        float* out = OutputBlock(output, outputType, offset, outputBuffer);
+        kernel(out, a, b, size);
+        StoreBlock(output, outputType, offset, size, out);
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,68 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/SimdKernels.hpp>
+#include <Sapphire/util/CpuFeatures.hpp>
+
+namespace Sapphire::Compute::Dense::Naive
+{
+namespace
+{
+#ifdef WITH_AVX2
+constexpr SimdKernels Avx2Kernels = {
+    Avx2::Gemm, Avx2::Add, Avx2::Sub, Avx2::Dot, Avx2::Scale, Avx2::ReLU,
+    Avx2::GemmHalf, Avx2::GemmBFloat16, Avx2::FloatToHalf, Avx2::HalfToFloat,
+    Avx2::FloatToBFloat16, Avx2::BFloat16ToFloat, Avx2::GemmInt8
+};
+#endif
+
+#ifdef WITH_AVX512
+SimdKernels MakeAvx512Kernels()
+{
+    SimdKernels kernels = {
+        Avx512::Gemm, Avx512::Add, Avx512::Sub, Avx512::Dot, Avx512::Scale,
+        Avx512::ReLU, Avx512::GemmHalf, Avx512::GemmBFloat16,
+        Avx512::FloatToHalf, Avx512::HalfToFloat, Avx512::FloatToBFloat16,
+        Avx512::BFloat16ToFloat, nullptr
+    };
+#ifdef WITH_AVX512BF16
+    if (Util::CpuFeatures::Host().Avx512Bf16)
+        kernels.FloatToBFloat16 = Avx512Bf16::FloatToBFloat16;
+#endif
+    //! Byte multiplication of AVX-512 requires AVX512-BW or AVX512-VNNI, so
+    //! 256 bit kernel is used if VNNI is not available
+#ifdef WITH_AVX2
+    kernels.GemmInt8 = Avx2::GemmInt8;
+#endif
+#ifdef WITH_AVX512VNNI
+    if (Util::CpuFeatures::Host().Avx512Vnni)
+        kernels.GemmInt8 = Avx512Vnni::GemmInt8;
+#endif
+    return kernels;
+}
+#endif
+} // namespace
+
+const SimdKernels* GetSimdKernels()
+{
+    switch (Util::GetSimdLevel())
+    {
+#ifdef WITH_AVX512
+        case Util::SimdLevel::Avx512:
+        {
+            static const SimdKernels avx512Kernels = MakeAvx512Kernels();
+            return &avx512Kernels;
+        }
+#endif
+#ifdef WITH_AVX2
+        case Util::SimdLevel::Avx2:
+            return &Avx2Kernels;
+#endif
+        default:
+            return nullptr;
+    }
+}
+} // namespace Sapphire::Compute::Dense::Naive
@@ -0,0 +1,382 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/sparse/BlockSparse.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Compute
+{
+namespace
+{
+void CheckBlockShape(uint32_t m, uint32_t n, uint32_t blockRows,
+                     uint32_t blockCols)
+{
+    if (blockRows == 0 || blockCols == 0)
+        throw std::invalid_argument(
+            "Compute::BlockSparse - block size must be larger than zero");
+    if (m % blockRows != 0 || n % blockCols != 0)
+        throw std::invalid_argument(
+            "Compute::BlockSparse - matrix shape (" + std::to_string(m) +
+            ", " + std::to_string(n) + ") is not divisible by block size (" +
+            std::to_string(blockRows) + ", " + std::to_string(blockCols) +
+            ")");
+}
+
+bool IsZeroBlock(const float* src, uint32_t paddedN, uint32_t blockRows,
+                 uint32_t blockCols)
+{
+    for (uint32_t r = 0; r < blockRows; ++r)
+        for (uint32_t c = 0; c < blockCols; ++c)
+            if (src[r * paddedN + c] != 0.0f)
+                return false;
+    return true;
+}
+
+void CopyBlockFromDense(float* block, const float* src, uint32_t paddedN,
+                        uint32_t blockRows, uint32_t blockCols)
+{
+    for (uint32_t r = 0; r < blockRows; ++r)
+        std::memcpy(block + r * blockCols, src + r * paddedN,
+                    blockCols * sizeof(float));
+}
+
+//! Fills BlockSparseMatrix from dense matrix using the given block mask
+//! The matrix must have been allocated with number of set entries in the mask
+void FillWithMask(BlockSparseMatrix* dst, const float* src, uint32_t paddedN,
+                  const std::vector<bool>& mask)
+{
+    const auto blockRows = dst->BlockRows;
+    const auto blockCols = dst->BlockCols;
+    const auto numBlockRows = dst->M / blockRows;
+    const auto numBlockCols = dst->N / blockCols;
+    const auto blockSize = blockRows * blockCols;
+
+    uint32_t nnzb = 0;
+    for (uint32_t blockRowIdx = 0; blockRowIdx < numBlockRows; ++blockRowIdx)
+    {
+        dst->ROW[blockRowIdx] = nnzb;
+        for (uint32_t blockColIdx = 0; blockColIdx < numBlockCols;
+             ++blockColIdx)
+        {
+            if (!mask[blockRowIdx * numBlockCols + blockColIdx])
+                continue;
+            const float* srcBlock = src +
+                                    static_cast<std::size_t>(blockRowIdx) *
+                                    blockRows * paddedN +
+                                    blockColIdx * blockCols;
+            CopyBlockFromDense(
+                dst->V + static_cast<std::size_t>(nnzb) * blockSize,
+                srcBlock, paddedN, blockRows, blockCols);
+            dst->COL[nnzb] = blockColIdx;
+            nnzb += 1;
+        }
+    }
+    dst->ROW[numBlockRows] = nnzb;
+}
+} // namespace
+
+void DeepAllocateBlockSparseHost(BlockSparseMatrix** blockSparseArray,
+                                 uint32_t m, uint32_t n, uint32_t blockRows,
+                                 uint32_t blockCols, const uint32_t nnzb[],
+                                 uint32_t numMatrices)
+{
+    CheckBlockShape(m, n, blockRows, blockCols);
+    *blockSparseArray = new BlockSparseMatrix[numMatrices];
+    const auto blockSize = blockRows * blockCols;
+
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        BlockSparseMatrix& matrix = (*blockSparseArray)[matrixIdx];
+        matrix.M = m;
+        matrix.N = n;
+        matrix.BlockRows = blockRows;
+        matrix.BlockCols = blockCols;
+        matrix.NNZB = nnzb[matrixIdx];
+        matrix.V = new float[static_cast<std::size_t>(nnzb[matrixIdx]) *
+                             blockSize];
+        matrix.COL = new uint32_t[nnzb[matrixIdx]];
+        matrix.ROW = new uint32_t[m / blockRows + 1];
+    }
+}
+
+void DeepFreeBlockSparseHost(BlockSparseMatrix* blockSparseArray,
+                             uint32_t numMatrices)
+{
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        delete[] blockSparseArray[matrixIdx].V;
+        delete[] blockSparseArray[matrixIdx].COL;
+        delete[] blockSparseArray[matrixIdx].ROW;
+    }
+    delete[] blockSparseArray;
+}
+
+void CreateBlockSparseMatrixWithDenseMatrix(BlockSparseMatrix** dst,
+                                            const float* src, uint32_t m,
+                                            uint32_t n, uint32_t paddedN,
+                                            uint32_t blockRows,
+                                            uint32_t blockCols,
+                                            uint32_t numMatrices)
+{
+    CheckBlockShape(m, n, blockRows, blockCols);
+    const auto numBlockRows = m / blockRows;
+    const auto numBlockCols = n / blockCols;
+    const auto matrixStride = static_cast<std::size_t>(m) * paddedN;
+
+    std::vector<std::vector<bool>> masks(numMatrices);
+    std::vector<uint32_t> nnzb(numMatrices, 0);
+
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        const float* matrixPtr = src + matrixIdx * matrixStride;
+        auto& mask = masks[matrixIdx];
+        mask.resize(static_cast<std::size_t>(numBlockRows) * numBlockCols);
+        for (uint32_t blockRowIdx = 0; blockRowIdx < numBlockRows;
+             ++blockRowIdx)
+            for (uint32_t blockColIdx = 0; blockColIdx < numBlockCols;
+                 ++blockColIdx)
+            {
+                const bool nonZero = !IsZeroBlock(
+                    matrixPtr + static_cast<std::size_t>(blockRowIdx) *
+                    blockRows * paddedN + blockColIdx * blockCols,
+                    paddedN, blockRows, blockCols);
+                mask[blockRowIdx * numBlockCols + blockColIdx] = nonZero;
+                nnzb[matrixIdx] += nonZero ? 1 : 0;
+            }
+    }
+
+    DeepAllocateBlockSparseHost(dst, m, n, blockRows, blockCols, nnzb.data(),
+                                numMatrices);
+
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+        FillWithMask(*dst + matrixIdx, src + matrixIdx * matrixStride, paddedN,
+                     masks[matrixIdx]);
+}
+
+void CreateBlockSparseMatrixWithSparseMatrix(BlockSparseMatrix** dst,
+                                             const SparseMatrix* src,
+                                             uint32_t blockRows,
+                                             uint32_t blockCols,
+                                             uint32_t numMatrices)
+{
+    if (numMatrices == 0)
+        return;
+
+    const auto m = src[0].M;
+    const auto n = src[0].N;
+    CheckBlockShape(m, n, blockRows, blockCols);
+    const auto numBlockRows = m / blockRows;
+    const auto numBlockCols = n / blockCols;
+    const auto blockSize = blockRows * blockCols;
+
+    //! Block column indices of non-zero blocks for each block row
+    std::vector<std::vector<std::vector<uint32_t>>> blockColumns(numMatrices);
+    std::vector<uint32_t> nnzb(numMatrices, 0);
+    std::vector<int> marker(numBlockCols, -1);
+
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        const SparseMatrix& matrix = src[matrixIdx];
+        if (matrix.M != m || matrix.N != n)
+            throw std::invalid_argument(
+                "Compute::CreateBlockSparseMatrixWithSparseMatrix - all "
+                "matrices must have same shape");
+
+        auto& columns = blockColumns[matrixIdx];
+        columns.resize(numBlockRows);
+        for (uint32_t blockRowIdx = 0; blockRowIdx < numBlockRows;
+             ++blockRowIdx)
+        {
+            auto& rowColumns = columns[blockRowIdx];
+            const auto firstRow = blockRowIdx * blockRows;
+            for (auto idx = matrix.ROW[firstRow];
+                 idx < matrix.ROW[firstRow + blockRows]; ++idx)
+            {
+                const auto blockColIdx = matrix.COL[idx] / blockCols;
+                if (marker[blockColIdx] != static_cast<int>(blockRowIdx))
+                {
+                    marker[blockColIdx] = static_cast<int>(blockRowIdx);
+                    rowColumns.emplace_back(blockColIdx);
+                }
+            }
+            std::sort(rowColumns.begin(), rowColumns.end());
+            nnzb[matrixIdx] += static_cast<uint32_t>(rowColumns.size());
+        }
+        std::fill(marker.begin(), marker.end(), -1);
+    }
+
+    DeepAllocateBlockSparseHost(dst, m, n, blockRows, blockCols, nnzb.data(),
+                                numMatrices);
+
+    //! Position of each block column inside current block row
+    std::vector<uint32_t> position(numBlockCols, 0);
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        const SparseMatrix& matrix = src[matrixIdx];
+        BlockSparseMatrix& blockMatrix = (*dst)[matrixIdx];
+        std::memset(blockMatrix.V, 0,
+                    static_cast<std::size_t>(blockMatrix.NNZB) * blockSize *
+                    sizeof(float));
+
+        uint32_t nnzbIdx = 0;
+        for (uint32_t blockRowIdx = 0; blockRowIdx < numBlockRows;
+             ++blockRowIdx)
+        {
+            blockMatrix.ROW[blockRowIdx] = nnzbIdx;
+            for (const auto blockColIdx :
+                 blockColumns[matrixIdx][blockRowIdx])
+            {
+                position[blockColIdx] = nnzbIdx;
+                blockMatrix.COL[nnzbIdx++] = blockColIdx;
+            }
+
+            for (uint32_t rowOffset = 0; rowOffset < blockRows; ++rowOffset)
+            {
+                const auto row = blockRowIdx * blockRows + rowOffset;
+                for (auto idx = matrix.ROW[row]; idx < matrix.ROW[row + 1];
+                     ++idx)
+                {
+                    const auto col = matrix.COL[idx];
+                    float* block =
+                        blockMatrix.V + static_cast<std::size_t>(
+                            position[col / blockCols]) * blockSize;
+                    block[rowOffset * blockCols + col % blockCols] =
+                        matrix.V[idx];
+                }
+            }
+        }
+        blockMatrix.ROW[numBlockRows] = nnzbIdx;
+    }
+}
+
+void ConvertBlockSparseMatrixToDenseMatrix(float* dst,
+                                           const BlockSparseMatrix* src,
+                                           uint32_t paddedN,
+                                           uint32_t numMatrices)
+{
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        const BlockSparseMatrix& matrix = src[matrixIdx];
+        const auto blockRows = matrix.BlockRows;
+        const auto blockCols = matrix.BlockCols;
+        const auto blockSize = blockRows * blockCols;
+        float* matrixPtr =
+            dst + static_cast<std::size_t>(matrixIdx) * matrix.M * paddedN;
+
+        for (uint32_t row = 0; row < matrix.M; ++row)
+            std::memset(matrixPtr + static_cast<std::size_t>(row) * paddedN, 0,
+                        matrix.N * sizeof(float));
+
+        for (uint32_t blockRowIdx = 0; blockRowIdx < matrix.M / blockRows;
+             ++blockRowIdx)
+            for (auto idx = matrix.ROW[blockRowIdx];
+                 idx < matrix.ROW[blockRowIdx + 1]; ++idx)
+            {
+                const float* block =
+                    matrix.V + static_cast<std::size_t>(idx) * blockSize;
+                float* dstBlock = matrixPtr +
+                                  static_cast<std::size_t>(blockRowIdx) *
+                                  blockRows * paddedN +
+                                  matrix.COL[idx] * blockCols;
+                for (uint32_t r = 0; r < blockRows; ++r)
+                    std::memcpy(dstBlock + r * paddedN, block + r * blockCols,
+                                blockCols * sizeof(float));
+            }
+    }
+}
+
+void PruneDenseMatrixToBlockSparse(BlockSparseMatrix** dst, const float* src,
+                                   uint32_t m, uint32_t n, uint32_t paddedN,
+                                   uint32_t blockRows, uint32_t blockCols,
+                                   float sparsity)
+{
+    CheckBlockShape(m, n, blockRows, blockCols);
+    if (sparsity < 0.0f || sparsity >= 1.0f)
+        throw std::invalid_argument(
+            "Compute::PruneDenseMatrixToBlockSparse - sparsity must be in "
+            "range [0, 1)");
+
+    const auto numBlockRows = m / blockRows;
+    const auto numBlockCols = n / blockCols;
+    const auto numBlocks = numBlockRows * numBlockCols;
+
+    std::vector<float> magnitudes(numBlocks, 0.0f);
+    for (uint32_t blockRowIdx = 0; blockRowIdx < numBlockRows; ++blockRowIdx)
+        for (uint32_t blockColIdx = 0; blockColIdx < numBlockCols;
+             ++blockColIdx)
+        {
+            const float* block = src + static_cast<std::size_t>(blockRowIdx) *
+                                 blockRows * paddedN +
+                                 blockColIdx * blockCols;
+            float magnitude = 0.0f;
+            for (uint32_t r = 0; r < blockRows; ++r)
+                for (uint32_t c = 0; c < blockCols; ++c)
+                    magnitude += std::abs(block[r * paddedN + c]);
+            magnitudes[blockRowIdx * numBlockCols + blockColIdx] = magnitude;
+        }
+
+    const auto numKept = static_cast<uint32_t>(std::ceil(
+        static_cast<double>(numBlocks) * (1.0 - static_cast<double>(
+                                              sparsity))));
+
+    std::vector<bool> mask(numBlocks, false);
+    if (numKept > 0)
+    {
+        std::vector<uint32_t> order(numBlocks);
+        for (uint32_t i = 0; i < numBlocks; ++i)
+            order[i] = i;
+        std::nth_element(order.begin(), order.begin() + (numKept - 1),
+                         order.end(),
+                         [&magnitudes](uint32_t a, uint32_t b) {
+                             return magnitudes[a] > magnitudes[b];
+                         });
+        for (uint32_t i = 0; i < numKept; ++i)
+            mask[order[i]] = true;
+    }
+
+    DeepAllocateBlockSparseHost(dst, m, n, blockRows, blockCols, &numKept, 1);
+    FillWithMask(*dst, src, paddedN, mask);
+}
+
+void SyncBlockSparseMatrix(BlockSparseMatrix* dst, float* src,
+                           uint32_t paddedN)
+{
+    const auto blockRows = dst->BlockRows;
+    const auto blockCols = dst->BlockCols;
+    const auto blockSize = blockRows * blockCols;
+    const auto numBlockCols = dst->N / blockCols;
+
+    for (uint32_t blockRowIdx = 0; blockRowIdx < dst->M / blockRows;
+         ++blockRowIdx)
+    {
+        float* blockRowPtr =
+            src + static_cast<std::size_t>(blockRowIdx) * blockRows * paddedN;
+        auto idx = dst->ROW[blockRowIdx];
+        for (uint32_t blockColIdx = 0; blockColIdx < numBlockCols;
+             ++blockColIdx)
+        {
+            float* srcBlock = blockRowPtr + blockColIdx * blockCols;
+            if (idx < dst->ROW[blockRowIdx + 1] &&
+                dst->COL[idx] == blockColIdx)
+            {
+                CopyBlockFromDense(
+                    dst->V + static_cast<std::size_t>(idx) * blockSize,
+                    srcBlock, paddedN, blockRows, blockCols);
+                idx += 1;
+                continue;
+            }
+            for (uint32_t r = 0; r < blockRows; ++r)
+                std::memset(srcBlock + r * paddedN, 0,
+                            blockCols * sizeof(float));
+        }
+    }
+}
+} // namespace Sapphire::Compute
@@ -0,0 +1,140 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/sparse/naive/BlockSparseGemm.hpp>
+#include <algorithm>
+#include <cstddef>
+
+namespace Sapphire::Compute::Sparse::Naive
+{
+namespace
+{
+//! Number of rows of a processed together while block row of b stays in cache
+constexpr unsigned int RowTileSize = 64;
+
+//! Dense micro-kernel for single block with compile-time block size
+//! Fixed trip counts let the compiler fully unroll and vectorize the block
+template <unsigned int BlockRows, unsigned int BlockCols>
+void BlockKernel(float* out, const float* a, const float* block,
+                 unsigned int rowBegin, unsigned int rowEnd, unsigned int N,
+                 unsigned int K)
+{
+    for (unsigned int row = rowBegin; row < rowEnd; ++row)
+    {
+        const float* aRow = a + static_cast<std::size_t>(row) * K;
+        float* outRow = out + static_cast<std::size_t>(row) * N;
+
+        if constexpr (BlockCols == 1)
+        {
+            //! Column blocks reduce over contiguous elements of a
+            //! Independent products are computed first, and summed afterwards
+            float products[BlockRows];
+            for (unsigned int r = 0; r < BlockRows; ++r)
+                products[r] = aRow[r] * block[r];
+            float sum = 0.0f;
+            for (unsigned int r = 0; r < BlockRows; ++r)
+                sum += products[r];
+            outRow[0] += sum;
+        }
+        else
+        {
+            float acc[BlockCols] = {};
+            for (unsigned int r = 0; r < BlockRows; ++r)
+                for (unsigned int c = 0; c < BlockCols; ++c)
+                    acc[c] += aRow[r] * block[r * BlockCols + c];
+            for (unsigned int c = 0; c < BlockCols; ++c)
+                outRow[c] += acc[c];
+        }
+    }
+}
+
+//! Generic micro-kernel used when block size has no specialization
+void BlockKernelGeneric(float* out, const float* a, const float* block,
+                        unsigned int rowBegin, unsigned int rowEnd,
+                        unsigned int N, unsigned int K, unsigned int blockRows,
+                        unsigned int blockCols)
+{
+    for (unsigned int row = rowBegin; row < rowEnd; ++row)
+    {
+        const float* aRow = a + static_cast<std::size_t>(row) * K;
+        float* outRow = out + static_cast<std::size_t>(row) * N;
+        for (unsigned int r = 0; r < blockRows; ++r)
+        {
+            const float aVal = aRow[r];
+            for (unsigned int c = 0; c < blockCols; ++c)
+                outRow[c] += aVal * block[r * blockCols + c];
+        }
+    }
+}
+
+template <unsigned int BlockRows, unsigned int BlockCols>
+void GemmWithBlockSize(float* out, const float* a, const BlockSparseMatrix* b,
+                       unsigned int M)
+{
+    constexpr unsigned int blockSize = BlockRows * BlockCols;
+    const auto N = b->N;
+    const auto K = b->M;
+
+    for (unsigned int rowBegin = 0; rowBegin < M; rowBegin += RowTileSize)
+    {
+        const auto rowEnd = std::min(rowBegin + RowTileSize, M);
+        for (unsigned int blockRowIdx = 0; blockRowIdx < K / BlockRows;
+             ++blockRowIdx)
+            for (auto idx = b->ROW[blockRowIdx];
+                 idx < b->ROW[blockRowIdx + 1]; ++idx)
+                BlockKernel<BlockRows, BlockCols>(
+                    out + b->COL[idx] * BlockCols, a + blockRowIdx * BlockRows,
+                    b->V + static_cast<std::size_t>(idx) * blockSize, rowBegin,
+                    rowEnd, N, K);
+    }
+}
+
+void GemmGeneric(float* out, const float* a, const BlockSparseMatrix* b,
+                 unsigned int M)
+{
+    const auto blockRows = b->BlockRows;
+    const auto blockCols = b->BlockCols;
+    const auto blockSize = blockRows * blockCols;
+    const auto N = b->N;
+    const auto K = b->M;
+
+    for (unsigned int rowBegin = 0; rowBegin < M; rowBegin += RowTileSize)
+    {
+        const auto rowEnd = std::min(rowBegin + RowTileSize, M);
+        for (unsigned int blockRowIdx = 0; blockRowIdx < K / blockRows;
+             ++blockRowIdx)
+            for (auto idx = b->ROW[blockRowIdx];
+                 idx < b->ROW[blockRowIdx + 1]; ++idx)
+                BlockKernelGeneric(
+                    out + b->COL[idx] * blockCols, a + blockRowIdx * blockRows,
+                    b->V + static_cast<std::size_t>(idx) * blockSize, rowBegin,
+                    rowEnd, N, K, blockRows, blockCols);
+    }
+}
+} // namespace
+
+void Gemm(float* out, const float* a, const BlockSparseMatrix* b,
+          unsigned int M)
+{
+    const auto blockRows = b->BlockRows;
+    const auto blockCols = b->BlockCols;
+
+    if (blockRows == 4 && blockCols == 4)
+        GemmWithBlockSize<4, 4>(out, a, b, M);
+    else if (blockRows == 8 && blockCols == 8)
+        GemmWithBlockSize<8, 8>(out, a, b, M);
+    else if (blockRows == 8 && blockCols == 1)
+        GemmWithBlockSize<8, 1>(out, a, b, M);
+    else if (blockRows == 16 && blockCols == 1)
+        GemmWithBlockSize<16, 1>(out, a, b, M);
+    else if (blockRows == 1 && blockCols == 8)
+        GemmWithBlockSize<1, 8>(out, a, b, M);
+    else if (blockRows == 1 && blockCols == 16)
+        GemmWithBlockSize<1, 16>(out, a, b, M);
+    else
+        GemmGeneric(out, a, b, M);
+}
+} // namespace Sapphire::Compute::Sparse::Naive
@@ -0,0 +1,53 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/AttentionOps.hpp>
+#include <Sapphire/operations/Backward/AttentionBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+namespace
+{
+constexpr int dQueryIdx = 0;
+constexpr int dKeyIdx = 1;
+constexpr int dValueIdx = 2;
+constexpr int dyIdx = 0;
+constexpr int queryIdx = 0;
+constexpr int keyIdx = 1;
+constexpr int valueIdx = 2;
+constexpr int yIdx = 3;
+constexpr int logSumExpIdx = 4;
+} // namespace
+
+AttentionBackProp::AttentionBackProp(
+    std::string name, TensorUtil::TensorData dQuery,
+    TensorUtil::TensorData dKey, TensorUtil::TensorData dValue,
+    TensorUtil::TensorData dy, TensorUtil::TensorData query,
+    TensorUtil::TensorData key, TensorUtil::TensorData value,
+    TensorUtil::TensorData y, TensorUtil::TensorData logSumExp, float scale,
+    bool causal)
+    : BackPropWrapper(std::move(name),
+                      { std::move(dQuery), std::move(dKey),
+                        std::move(dValue) },
+                      { std::move(dy) }, {},
+                      { std::move(query), std::move(key), std::move(value),
+                        std::move(y), std::move(logSumExp) },
+                      {}),
+      m_scale(scale),
+      m_causal(causal)
+{
+}
+
+void AttentionBackProp::m_runBackProp()
+{
+    Compute::AttentionBackward(
+        m_dxVector[dQueryIdx], m_dxVector[dKeyIdx], m_dxVector[dValueIdx],
+        m_dyVector[dyIdx], m_constants[queryIdx], m_constants[keyIdx],
+        m_constants[valueIdx], m_constants[yIdx], m_constants[logSumExpIdx],
+        m_scale, m_causal);
+    m_constants[logSumExpIdx].ReleaseMemory();
+}
+} // namespace Sapphire::BackProp
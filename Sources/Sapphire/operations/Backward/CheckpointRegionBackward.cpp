@@ -0,0 +1,49 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/operations/Backward/CheckpointRegionBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+CheckpointRegionBackward::CheckpointRegionBackward(
+    std::string name, TensorUtil::TensorData dx, TensorUtil::TensorData dy,
+    TensorUtil::TensorData x, NN::CheckpointRegion::RegionFunction region)
+    : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
+                      { std::move(x) }, {}),
+      m_region(std::move(region))
+{
+}
+
+void CheckpointRegionBackward::m_runBackProp()
+{
+    auto x = m_constants[0];
+    auto dx = m_dxVector[0];
+    auto dy = m_dyVector[0];
+    auto& model = ModelManager::CurModel();
+
+    //! Region is computed again on a copy of the input, so history of the
+    //! recomputed units ends at the copy instead of the input
+    const Tensor input(x.GetShape(), x.GetCudaDevice(), x.GetType());
+    auto& inputDesc = model.GetDescriptor(input.TensorDescriptorKey());
+    inputDesc.SetMode(x.Mode());
+    auto inputData = inputDesc.GetForwardData();
+    TensorUtil::TensorData::DeepCopy(inputData, x);
+
+    model.SetRecomputing(true);
+    const Tensor output = m_region(input);
+    model.SetRecomputing(false);
+    auto outputGradient =
+        model.GetDescriptor(output.TensorDescriptorKey()).GetBackwardData();
+    TensorUtil::TensorData::DeepCopy(outputGradient, dy);
+    model.BackProp(output);
+
+    auto inputGradient = inputDesc.GetBackwardData();
+    Compute::Add(dx, dx, inputGradient);
+    model.ReleaseTensor(input);
+}
+} // namespace Sapphire::BackProp
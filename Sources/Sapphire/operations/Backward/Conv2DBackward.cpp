@@ -8,6 +8,7 @@
 #include <Sapphire/operations/Backward/Conv2DBackward.hpp>
 #include <Sapphire/compute/ConvolutionOps.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
 #include <Sapphire/Model.hpp>
 
 namespace Sapphire::BackProp
@@ -17,6 +18,7 @@ constexpr int dyIdx = 0;
 constexpr int kernelIdx = 0;
 constexpr int biasIdx = 1;
 constexpr int xIdx = 0;
+constexpr int yIdx = 1;
 
 Conv2DBackProp::Conv2DBackProp(std::string name,
                                TensorData dx,
@@ -26,14 +28,17 @@ Conv2DBackProp::Conv2DBackProp(std::string name,
                                TensorData x,
                                std::pair<int, int> stride,
                                std::pair<int, int> dilation,
-                               std::pair<int, int> padding)
+                               std::pair<int, int> padding,
+                               Compute::Activation activation,
+                               TensorData y)
     : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
-                      { std::move(filter), std::move(bias) }, { std::move(x) },
-                      {}),
+                      { std::move(filter), std::move(bias) },
+                      { std::move(x), std::move(y) }, {}),
       m_stride(std::move(stride)),
       m_dilation(std::move(dilation)),
       m_padding(std::move(padding)),
-      m_hasBias(true)
+      m_hasBias(true),
+      m_activation(activation)
 {
 }
 
@@ -44,13 +49,17 @@ Conv2DBackProp::Conv2DBackProp(std::string name,
                                TensorData x,
                                std::pair<int, int> stride,
                                std::pair<int, int> dilation,
-                               std::pair<int, int> padding)
+                               std::pair<int, int> padding,
+                               Compute::Activation activation,
+                               TensorData y)
     : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
-                      { std::move(filter) }, { std::move(x) }, {}),
+                      { std::move(filter) }, { std::move(x), std::move(y) },
+                      {}),
       m_stride(std::move(stride)),
       m_dilation(std::move(dilation)),
       m_padding(std::move(padding)),
-      m_hasBias(false)
+      m_hasBias(false),
+      m_activation(activation)
 {
 }
 
@@ -61,6 +70,18 @@ void Conv2DBackProp::m_runBackProp()
     auto dy = m_dyVector[dyIdx];
     const auto& x = m_constants[xIdx];
 
+    //! Gradient before the fused activation replaces dy
+    const bool fused = m_activation != Compute::Activation::None;
+    if (fused)
+    {
+        TensorData dPre(dy.GetShape(), dy.GetType(), dy.GetCudaDevice());
+        dPre.SetMode(dy.Mode());
+        Compute::Initialize::Zeros(dPre);
+        Compute::ActivationBackward(dPre, dy, m_constants[yIdx],
+                                    m_activation);
+        dy = dPre;
+    }
+
     const auto [strideRow, strideCol] = m_stride;
     const auto [dilationRow, dilationCol] = m_dilation;
     const auto [rowPadding, colPadding] = m_padding;
@@ -73,6 +94,8 @@ void Conv2DBackProp::m_runBackProp()
                             rowPadding, colPadding, dilationRow, dilationCol);
     ModelManager::CurModel().GetOptimizer()->operator()(kernel, dKernel,
         m_name);
+    //! Gradient of the kernel is consumed by the optimizer
+    dKernel.ReleaseMemory();
 
     if (m_hasBias)
     {
@@ -96,6 +119,12 @@ void Conv2DBackProp::m_runBackProp()
 
         ModelManager::CurModel().GetOptimizer()->operator()(bias, mean1,
             m_name);
+        mean0.ReleaseMemory();
+        mean1.ReleaseMemory();
+        mean2.ReleaseMemory();
     }
+
+    if (fused)
+        dy.ReleaseMemory();
 }
 }
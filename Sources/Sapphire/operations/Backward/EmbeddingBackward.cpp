@@ -0,0 +1,36 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/IndexingOps.hpp>
+#include <Sapphire/operations/Backward/EmbeddingBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+EmbeddingBackProp::EmbeddingBackProp(std::string name,
+                                     TensorUtil::TensorData dy,
+                                     TensorUtil::TensorData weight,
+                                     TensorUtil::TensorData indices,
+                                     int bagSize, bool mean)
+    : BackPropWrapper(std::move(name), {}, { std::move(dy) },
+                      { std::move(weight) }, { std::move(indices) }, {}),
+      m_bagSize(bagSize),
+      m_mean(mean)
+{
+}
+
+void EmbeddingBackProp::m_runBackProp()
+{
+    auto weight = m_trainableData[0];
+    const auto& dy = m_dyVector[0];
+    const auto& indices = m_constants[0];
+
+    TensorUtil::RowSparseData dWeight;
+    Compute::EmbeddingBackward(dWeight, dy, indices, m_bagSize, m_mean);
+    ModelManager::CurModel().GetOptimizer()->operator()(weight, dWeight,
+                                                        m_name);
+}
+} // namespace Sapphire::BackProp
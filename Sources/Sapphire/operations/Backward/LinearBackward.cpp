@@ -15,12 +15,14 @@ LinearBackProp::LinearBackProp(std::string name, TensorUtil::TensorData dx,
                                TensorUtil::TensorData weight,
                                TensorUtil::TensorData bias,
                                TensorUtil::TensorData x,
-                               int batchSize)
+                               int batchSize, Compute::Activation activation,
+                               TensorUtil::TensorData y)
     : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
                       { std::move(weight), std::move(bias) },
-                      { std::move(x) },
+                      { std::move(x), std::move(y) },
                       {}),
-      m_batchSize(batchSize)
+      m_batchSize(batchSize),
+      m_activation(activation)
 {
 }
 
@@ -28,56 +30,60 @@ void LinearBackProp::m_runBackProp()
 {
     auto weight = m_trainableData[weightIdx];
     auto bias = m_trainableData[biasIdx];
-
-    m_backProp(weight);
-    m_updateWeight(weight);
-    m_updateBias(bias);
+    const auto& dy = m_dyVector[dyIdx];
+
+    if (m_activation == Compute::Activation::None)
+    {
+        m_backProp(weight, dy);
+        m_updateWeight(weight, dy);
+        m_updateBias(bias, dy);
+        return;
+    }
+
+    //! Gradient before the fused activation
+    TensorUtil::TensorData dPre(dy.GetShape(), dy.GetType(),
+                                dy.GetCudaDevice());
+    dPre.SetMode(dy.Mode());
+    Compute::Initialize::Zeros(dPre);
+    Compute::ActivationBackward(dPre, dy, m_constants[yIdx], m_activation);
+
+    m_backProp(weight, dPre);
+    m_updateWeight(weight, dPre);
+    m_updateBias(bias, dPre);
+    dPre.ReleaseMemory();
 }
 
-void LinearBackProp::m_backProp(TensorUtil::TensorData& weight)
+void LinearBackProp::m_backProp(TensorUtil::TensorData& weight,
+                                const TensorUtil::TensorData& dy)
 {
     TensorUtil::TensorData& dx = m_dxVector[dxIdx];
-    TensorUtil::TensorData& dy = m_dyVector[dyIdx];
-    TensorUtil::TensorData weightTranspose(
-        weight.GetShape().GetTranspose(), weight.GetType(), weight.GetCudaDevice());
-    weightTranspose.SetMode(weight.Mode());
-
-    const auto shape0 = dx.GetShape();
-    const auto shape1 = weightTranspose.GetShape();
-    const auto shape3 = dy.GetShape();
 
-    Compute::Transpose(weightTranspose, weight);
-    Compute::Gemm(dx, dy, weightTranspose);
+    Compute::Gemm(dx, dy, weight.TransposeView());
 }
 
-void LinearBackProp::m_updateWeight(TensorUtil::TensorData& weight) const
+void LinearBackProp::m_updateWeight(TensorUtil::TensorData& weight,
+                                    const TensorUtil::TensorData& dy) const
 {
-    const TensorUtil::TensorData& dy = m_dyVector[dyIdx];
     const TensorUtil::TensorData& x = m_constants[xIdx];
-    TensorUtil::TensorData xTranspose(x.GetShape().GetTranspose(),
-                                      x.GetType(),
-                                      x.GetCudaDevice());
     TensorUtil::TensorData dw(weight.GetShape(),
                               weight.GetType(), weight.GetCudaDevice());
 
-    xTranspose.SetMode(x.Mode());
     dw.SetMode(weight.Mode());
 
-    const auto shape0 = xTranspose.GetShape();
-    const auto shape1 = dw.GetShape();
-    const auto shape2 = dy.GetShape();
-
-    Compute::Transpose(xTranspose, x);
     Compute::Initialize::Zeros(dw);
-    Compute::Gemm(dw, xTranspose, dy);
+    Compute::Gemm(dw, x.TransposeView(), dy);
     //Compute::Scale(dw, dw, 1.0f / static_cast<float>(m_batchSize));
 
-    ModelManager::CurModel().GetOptimizer()->operator()(weight, dw, m_name);
+    auto& model = ModelManager::CurModel();
+    model.GetOptimizer()->operator()(weight, dw, m_name);
+    model.GetDescriptor(weight.GetDescriptorKey()).MarkForwardDataWritten();
+    //! Gradient of the weight is consumed by the optimizer
+    dw.ReleaseMemory();
 }
 
-void LinearBackProp::m_updateBias(TensorUtil::TensorData& bias) const
+void LinearBackProp::m_updateBias(TensorUtil::TensorData& bias,
+                                  const TensorUtil::TensorData& dy) const
 {
-    const TensorUtil::TensorData& dy = m_dyVector[dyIdx];
     TensorUtil::TensorData transposedOnes(Shape({ 1, m_batchSize }),
                                           dy.GetType(), dy.GetCudaDevice());
     TensorUtil::TensorData dB(bias.GetShape(), bias.GetType(),
@@ -96,5 +102,7 @@ void LinearBackProp::m_updateBias(TensorUtil::TensorData& bias) const
 
     Compute::Scale(dB, dB, 1.0f / static_cast<float>(m_batchSize));
     ModelManager::CurModel().GetOptimizer()->operator()(bias, dB, m_name);
+    transposedOnes.ReleaseMemory();
+    dB.ReleaseMemory();
 }
 } // namespace Sapphire::BackProp
@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
 #include <Sapphire/operations/Backward/MathBackward.hpp>
 #include <iostream>
 
@@ -16,20 +17,8 @@ MulBackProp::MulBackProp(std::string name, const TensorUtil::TensorData& a,
                          TensorUtil::TensorData db, TensorUtil::TensorData dy)
     : BackPropWrapper(std::move(name), { std::move(da), std::move(db) },
                       { std::move(dy) },
-                      { a, b },
-                      { TensorUtil::TensorData(a.GetShape().GetTranspose(),
-                                               a.GetType(),
-                                               a.GetCudaDevice()),
-                        TensorUtil::TensorData(b.GetShape().GetTranspose(),
-                                               b.GetType(),
-                                               b.GetCudaDevice()) })
+                      { a, b }, {})
 {
-    auto& aData = m_constants[0];
-    auto& bData = m_constants[1];
-    auto& transposedA = m_mutables[0];
-    auto& transposedB = m_mutables[1];
-    transposedA.SetMode(aData.Mode());
-    transposedB.SetMode(bData.Mode());
 }
 
 void MulBackProp::m_runBackProp()
@@ -38,16 +27,11 @@ void MulBackProp::m_runBackProp()
     auto& da = m_dxVector[0];
     auto& db = m_dxVector[1];
 
-    auto& a = m_constants[0];
-    auto& b = m_constants[1];
-    auto& transposedA = m_mutables[0];
-    auto& transposedB = m_mutables[1];
-
-    Compute::Transpose(transposedA, a);
-    Compute::Transpose(transposedB, b);
+    const auto& a = m_constants[0];
+    const auto& b = m_constants[1];
 
-    Compute::Gemm(da, dy, transposedB);
-    Compute::Gemm(db, transposedA, dy);
+    Compute::Gemm(da, dy, b.TransposeView());
+    Compute::Gemm(db, a.TransposeView(), dy);
 }
 
 AddBackProp::AddBackProp(std::string name, TensorUtil::TensorData da,
@@ -67,6 +51,27 @@ void AddBackProp::m_runBackProp()
     Compute::Add(db, db, dy);
 }
 
+AddReLUBackProp::AddReLUBackProp(std::string name,
+                                 TensorUtil::TensorData da,
+                                 TensorUtil::TensorData db,
+                                 TensorUtil::TensorData dy,
+                                 TensorUtil::TensorData y)
+    : BackPropWrapper(std::move(name), { std::move(da), std::move(db) },
+                      { std::move(dy) }, { std::move(y) }, {})
+{
+}
+
+void AddReLUBackProp::m_runBackProp()
+{
+    const auto& dy = m_dyVector[0];
+    const auto& y = m_constants[0];
+    auto& da = m_dxVector[0];
+    auto& db = m_dxVector[1];
+    //! Masked gradient is accumulated to both inputs without a buffer
+    Compute::ActivationBackward(da, dy, y, Compute::Activation::ReLU);
+    Compute::ActivationBackward(db, dy, y, Compute::Activation::ReLU);
+}
+
 SubBackProp::SubBackProp(std::string name, TensorUtil::TensorData da,
                          TensorUtil::TensorData db, TensorUtil::TensorData dy)
     : BackPropWrapper(std::move(name), { std::move(da), std::move(db) },
@@ -35,5 +35,6 @@ void MSEBackward::m_runBackProp()
 
     Compute::Sub(diff, x, label);
     Compute::Scale(dx, diff, 2.0f / static_cast<float>(dx.GetShape().At(-1)));
+    diff.ReleaseMemory();
 }
 } // namespace Sapphire::BackProp
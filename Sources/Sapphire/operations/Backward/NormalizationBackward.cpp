@@ -0,0 +1,97 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/NormalizationOps.hpp>
+#include <Sapphire/operations/Backward/NormalizationBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+namespace
+{
+constexpr int dxIdx = 0;
+constexpr int dyIdx = 0;
+constexpr int gammaIdx = 0;
+constexpr int betaIdx = 1;
+constexpr int xIdx = 0;
+constexpr int meanIdx = 1;
+constexpr int invStdIdx = 2;
+
+using NormalizationBackward = void (*)(TensorData&, TensorData&, TensorData&,
+                                       const TensorData&, const TensorData&,
+                                       const TensorData&, const TensorData&,
+                                       const TensorData&);
+
+//! Computes gradients with backward, updates gamma and beta, and releases
+//! the gradients and saved statistics
+void RunNormalizationBackward(const std::string& name,
+                              NormalizationBackward backward,
+                              TensorData& dx, const TensorData& dy,
+                              std::vector<TensorData>& trainableData,
+                              std::vector<TensorData>& constants)
+{
+    auto& gamma = trainableData[gammaIdx];
+    auto& beta = trainableData[betaIdx];
+
+    TensorData dGamma(gamma.GetShape(), gamma.GetType(),
+                      gamma.GetCudaDevice());
+    TensorData dBeta(beta.GetShape(), beta.GetType(), beta.GetCudaDevice());
+    dGamma.SetMode(gamma.Mode());
+    dBeta.SetMode(beta.Mode());
+
+    backward(dx, dGamma, dBeta, dy, constants[xIdx], gamma,
+             constants[meanIdx], constants[invStdIdx]);
+
+    auto* optimizer = ModelManager::CurModel().GetOptimizer();
+    optimizer->operator()(gamma, dGamma, name);
+    optimizer->operator()(beta, dBeta, name);
+    dGamma.ReleaseMemory();
+    dBeta.ReleaseMemory();
+    constants[meanIdx].ReleaseMemory();
+    constants[invStdIdx].ReleaseMemory();
+}
+} // namespace
+
+BatchNorm2DBackProp::BatchNorm2DBackProp(std::string name, TensorData dx,
+                                         TensorData dy, TensorData gamma,
+                                         TensorData beta, TensorData x,
+                                         TensorData savedMean,
+                                         TensorData savedInvStd)
+    : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
+                      { std::move(gamma), std::move(beta) },
+                      { std::move(x), std::move(savedMean),
+                        std::move(savedInvStd) },
+                      {})
+{
+}
+
+void BatchNorm2DBackProp::m_runBackProp()
+{
+    RunNormalizationBackward(m_name, Compute::BatchNormBackward,
+                             m_dxVector[dxIdx], m_dyVector[dyIdx],
+                             m_trainableData, m_constants);
+}
+
+LayerNormBackProp::LayerNormBackProp(std::string name, TensorData dx,
+                                     TensorData dy, TensorData gamma,
+                                     TensorData beta, TensorData x,
+                                     TensorData savedMean,
+                                     TensorData savedInvStd)
+    : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
+                      { std::move(gamma), std::move(beta) },
+                      { std::move(x), std::move(savedMean),
+                        std::move(savedInvStd) },
+                      {})
+{
+}
+
+void LayerNormBackProp::m_runBackProp()
+{
+    RunNormalizationBackward(m_name, Compute::LayerNormBackward,
+                             m_dxVector[dxIdx], m_dyVector[dyIdx],
+                             m_trainableData, m_constants);
+}
+} // namespace Sapphire::BackProp
@@ -0,0 +1,108 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/RecurrentOps.hpp>
+#include <Sapphire/operations/Backward/RecurrentBackward.hpp>
+
+namespace Sapphire::BackProp
+{
+namespace
+{
+constexpr int dxIdx = 0;
+constexpr int dyIdx = 0;
+constexpr int weightIhIdx = 0;
+constexpr int weightHhIdx = 1;
+constexpr int xIdx = 0;
+constexpr int yIdx = 1;
+constexpr int gatesIdx = 2;
+constexpr int cellsIdx = 3;
+
+//! Creates gradient buffers of every trainable data
+std::vector<TensorData> CreateGradients(
+    const std::vector<TensorData>& trainableData)
+{
+    std::vector<TensorData> gradients;
+    gradients.reserve(trainableData.size());
+    for (const auto& data : trainableData)
+    {
+        TensorData gradient(data.GetShape(), data.GetType(),
+                            data.GetCudaDevice());
+        gradient.SetMode(data.Mode());
+        gradients.emplace_back(std::move(gradient));
+    }
+    return gradients;
+}
+
+//! Updates trainable data with the optimizer and releases the gradients
+void ApplyGradients(const std::string& name,
+                    std::vector<TensorData>& trainableData,
+                    std::vector<TensorData>& gradients)
+{
+    auto* optimizer = ModelManager::CurModel().GetOptimizer();
+    for (std::size_t idx = 0; idx < trainableData.size(); ++idx)
+    {
+        optimizer->operator()(trainableData[idx], gradients[idx], name);
+        gradients[idx].ReleaseMemory();
+    }
+}
+} // namespace
+
+LstmBackProp::LstmBackProp(std::string name, TensorData dx, TensorData dy,
+                           TensorData weightIh, TensorData weightHh,
+                           TensorData bias, TensorData x, TensorData y,
+                           TensorData gates, TensorData cells)
+    : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
+                      { std::move(weightIh), std::move(weightHh),
+                        std::move(bias) },
+                      { std::move(x), std::move(y), std::move(gates),
+                        std::move(cells) },
+                      {})
+{
+}
+
+void LstmBackProp::m_runBackProp()
+{
+    constexpr int biasIdx = 2;
+    auto gradients = CreateGradients(m_trainableData);
+    Compute::LstmBackward(
+        m_dxVector[dxIdx], gradients[weightIhIdx], gradients[weightHhIdx],
+        gradients[biasIdx], m_dyVector[dyIdx], m_constants[xIdx],
+        m_constants[yIdx], m_trainableData[weightIhIdx],
+        m_trainableData[weightHhIdx], m_constants[gatesIdx],
+        m_constants[cellsIdx]);
+
+    ApplyGradients(m_name, m_trainableData, gradients);
+    m_constants[gatesIdx].ReleaseMemory();
+    m_constants[cellsIdx].ReleaseMemory();
+}
+
+GruBackProp::GruBackProp(std::string name, TensorData dx, TensorData dy,
+                         TensorData weightIh, TensorData weightHh,
+                         TensorData biasIh, TensorData biasHh, TensorData x,
+                         TensorData y, TensorData gates)
+    : BackPropWrapper(std::move(name), { std::move(dx) }, { std::move(dy) },
+                      { std::move(weightIh), std::move(weightHh),
+                        std::move(biasIh), std::move(biasHh) },
+                      { std::move(x), std::move(y), std::move(gates) }, {})
+{
+}
+
+void GruBackProp::m_runBackProp()
+{
+    constexpr int biasIhIdx = 2;
+    constexpr int biasHhIdx = 3;
+    auto gradients = CreateGradients(m_trainableData);
+    Compute::GruBackward(
+        m_dxVector[dxIdx], gradients[weightIhIdx], gradients[weightHhIdx],
+        gradients[biasIhIdx], gradients[biasHhIdx], m_dyVector[dyIdx],
+        m_constants[xIdx], m_constants[yIdx], m_trainableData[weightIhIdx],
+        m_trainableData[weightHhIdx], m_constants[gatesIdx]);
+
+    ApplyGradients(m_name, m_trainableData, gradients);
+    m_constants[gatesIdx].ReleaseMemory();
+}
+} // namespace Sapphire::BackProp
@@ -0,0 +1,178 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/NormalizationOps.hpp>
+#include <Sapphire/operations/Backward/NormalizationBackward.hpp>
+#include <Sapphire/operations/Forward/BatchNorm2D.hpp>
+#include <Sapphire/tensor/CreateTensor.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+#include <cmath>
+
+namespace Sapphire::NN
+{
+std::atomic<int> BatchNorm2D::m_unitIdCount = 0;
+
+BatchNorm2D::BatchNorm2D(int channels, float momentum, float epsilon)
+    : BatchNorm2D(std::string("BatchNorm2D") +
+                  std::to_string(m_unitIdCount++),
+                  channels, momentum, epsilon)
+{
+}
+
+BatchNorm2D::BatchNorm2D(std::string name, int channels, float momentum,
+                         float epsilon)
+    : Unit(std::move(name)),
+      m_channels(channels),
+      m_momentum(momentum),
+      m_epsilon(epsilon)
+{
+    if (channels <= 0)
+        throw std::invalid_argument(
+            "NN::BatchNorm2D - Number of channels must be positive");
+
+    const Shape shape({ channels });
+    m_trainableTensorMap["gamma"] =
+        MakeTensor(shape, M<Initialize::Ones>(), true);
+    m_trainableTensorMap["beta"] =
+        MakeTensor(shape, M<Initialize::Zeros>(), true);
+    m_bufferTensorMap["runningMean"] =
+        MakeTensor(shape, M<Initialize::Zeros>(), true);
+    m_bufferTensorMap["runningVar"] =
+        MakeTensor(shape, M<Initialize::Ones>(), true);
+}
+
+Tensor BatchNorm2D::operator()(Tensor& x)
+{
+    if (m_folded)
+        return x;
+
+    SAPPHIRE_PROFILE_UNIT(m_name);
+    const auto mode = x.Mode();
+    const Tensor gamma = m_trainableTensorMap.at("gamma");
+    const Tensor beta = m_trainableTensorMap.at("beta");
+    const Tensor runningMean = m_bufferTensorMap.at("runningMean");
+    const Tensor runningVar = m_bufferTensorMap.at("runningVar");
+    for (const auto& tensor : { gamma, beta, runningMean, runningVar })
+    {
+        tensor.SetDevice(x.GetDevice());
+        if (mode == ComputeMode::Cuda)
+            tensor.ToCuda();
+        else
+            tensor.ToHost();
+    }
+
+    auto& model = ModelManager::CurModel();
+    auto& xDesc = model.GetDescriptor(x.TensorDescriptorKey());
+    m_checkArguments({ &xDesc });
+    auto gammaData =
+        model.GetDescriptor(gamma.TensorDescriptorKey()).GetForwardData();
+    auto betaData =
+        model.GetDescriptor(beta.TensorDescriptorKey()).GetForwardData();
+    auto meanData = model.GetDescriptor(runningMean.TensorDescriptorKey())
+                         .GetForwardData();
+    auto varData = model.GetDescriptor(runningVar.TensorDescriptorKey())
+                        .GetForwardData();
+
+    auto xData = xDesc.GetForwardData();
+    auto dxData = xDesc.GetBackwardData();
+    const auto yKey = model.RegisterTensorDescriptor(
+        xDesc.GetShape(), xData.GetType(), xDesc.GetDevice());
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(mode);
+    auto yData = yDesc.GetForwardData();
+    auto dyData = yDesc.GetBackwardData();
+
+    Util::ChangeTensorDataDimension(4, xData, dxData, yData, dyData);
+
+    if (!m_training)
+    {
+        Compute::BatchNormInference(yData, xData, gammaData, betaData,
+                                    meanData, varData, m_epsilon);
+        return Tensor(yKey);
+    }
+
+    TensorUtil::TensorData savedMean(Shape({ m_channels }), Type::Dense,
+                                     xData.GetCudaDevice());
+    TensorUtil::TensorData savedInvStd(Shape({ m_channels }), Type::Dense,
+                                       xData.GetCudaDevice());
+    savedMean.SetMode(mode);
+    savedInvStd.SetMode(mode);
+    //! Running statistics were updated when the checkpoint region containing
+    //! this unit was first computed
+    const float momentum = model.IsRecomputing() ? 0.0f : m_momentum;
+    Compute::BatchNormForward(yData, savedMean, savedInvStd, meanData,
+                              varData, xData, gammaData, betaData, momentum,
+                              m_epsilon);
+
+    const bool recording = model.IsRecordingHistory();
+    auto* backPropWrapper = new BackProp::BatchNorm2DBackProp(
+        m_name, dxData, dyData, gammaData, betaData, xData, savedMean,
+        savedInvStd);
+    Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
+                      std::make_tuple(&yDesc));
+    //! Statistics are not needed if back propagation was not recorded
+    if (!recording)
+    {
+        savedMean.ReleaseMemory();
+        savedInvStd.ReleaseMemory();
+    }
+
+    return Tensor(yKey);
+}
+
+Tensor BatchNorm2D::GetGamma() const
+{
+    return m_trainableTensorMap.at("gamma");
+}
+
+Tensor BatchNorm2D::GetBeta() const
+{
+    return m_trainableTensorMap.at("beta");
+}
+
+Tensor BatchNorm2D::GetRunningMean() const
+{
+    return m_bufferTensorMap.at("runningMean");
+}
+
+Tensor BatchNorm2D::GetRunningVar() const
+{
+    return m_bufferTensorMap.at("runningVar");
+}
+
+std::pair<std::vector<float>, std::vector<float>>
+BatchNorm2D::GetScaleAndShift() const
+{
+    const auto gamma = GetGamma().GetData();
+    const auto beta = GetBeta().GetData();
+    const auto runningMean = GetRunningMean().GetData();
+    const auto runningVar = GetRunningVar().GetData();
+
+    std::vector<float> scale(m_channels), shift(m_channels);
+    for (std::size_t channelIdx = 0; channelIdx < scale.size(); ++channelIdx)
+    {
+        scale[channelIdx] = gamma[channelIdx] /
+                            std::sqrt(runningVar[channelIdx] + m_epsilon);
+        shift[channelIdx] =
+            beta[channelIdx] - runningMean[channelIdx] * scale[channelIdx];
+    }
+    return { scale, shift };
+}
+
+void BatchNorm2D::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto xShape = arguments.at(0)->GetShape();
+    if (xShape.Dim() < 4)
+        throw std::invalid_argument(
+            "NN::BatchNorm2D - input should have shape of (*, C, H, W)");
+    if (xShape.At(-3) != m_channels)
+        throw std::invalid_argument(
+            "NN::BatchNorm2D - size of x channels does not match");
+}
+} // namespace Sapphire::NN
@@ -0,0 +1,76 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Backward/CheckpointRegionBackward.hpp>
+#include <Sapphire/operations/Forward/CheckpointRegion.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+#include <Sapphire/util/Profiler.hpp>
+
+namespace Sapphire::NN
+{
+std::atomic<int> CheckpointRegion::m_unitIdCount = 0;
+
+CheckpointRegion::CheckpointRegion(RegionFunction region)
+    : Unit(std::string("CheckpointRegion") +
+           std::to_string(m_unitIdCount++)),
+      m_region(std::move(region))
+{
+}
+
+CheckpointRegion::CheckpointRegion(std::string name, RegionFunction region)
+    : Unit(std::move(name)),
+      m_region(std::move(region))
+{
+}
+
+Tensor CheckpointRegion::operator()(const Tensor& x)
+{
+    SAPPHIRE_PROFILE_UNIT(m_name);
+    auto& model = ModelManager::CurModel();
+    const auto xKey = x.TensorDescriptorKey();
+
+    model.BeginCheckpointRegion();
+    Tensor y;
+    try
+    {
+        y = m_region(x);
+    }
+    catch (...)
+    {
+        model.EndCheckpointRegion(-1);
+        throw;
+    }
+    const auto yKey = y.TensorDescriptorKey();
+    const bool computedInRegion = model.IsInCheckpointRegion(yKey);
+    model.EndCheckpointRegion(computedInRegion ? yKey : -1);
+    if (!computedInRegion)
+        throw std::invalid_argument(
+            "NN::CheckpointRegion - Output must be computed inside the region");
+
+    auto& xDesc = model.GetDescriptor(xKey);
+    auto& yDesc = model.GetDescriptor(yKey);
+    m_checkArguments({ &xDesc, &yDesc });
+
+    auto* wrapper = new BackProp::CheckpointRegionBackward(
+        m_name, xDesc.GetBackwardData(), yDesc.GetBackwardData(),
+        xDesc.GetForwardData(), m_region);
+    Util::SaveHistory(wrapper, std::make_tuple(&xDesc),
+                      std::make_tuple(&yDesc));
+
+    return y;
+}
+
+void CheckpointRegion::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto& xDesc = *arguments.at(0);
+    const auto& yDesc = *arguments.at(1);
+    if (xDesc.Mode() != yDesc.Mode())
+        throw std::invalid_argument(
+            "NN::CheckpointRegion - Mode of input and output must be same");
+}
+} // namespace Sapphire::NN
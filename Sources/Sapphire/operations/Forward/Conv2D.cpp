@@ -4,17 +4,20 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Sapphire/compute/ActivationOps.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
 #include <Sapphire/compute/ConvolutionOps.hpp>
 #include <Sapphire/operations/Backward/Conv2DBackward.hpp>
 #include <Sapphire/tensor/CreateTensor.hpp>
+#include <Sapphire/operations/Forward/BatchNorm2D.hpp>
 #include <Sapphire/operations/Forward/Conv2D.hpp>
 #include <Sapphire/util/Shape.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
+#include <Sapphire/util/Profiler.hpp>
 
 namespace Sapphire::NN
 {
-int Conv2D::m_unitIdCount = 0;
+std::atomic<int> Conv2D::m_unitIdCount = 0;
 
 Conv2D::Conv2D(int yChannels, int xChannels, std::pair<int, int> filterSize,
                std::pair<int, int> stride, std::pair<int, int> padSize,
@@ -130,6 +133,7 @@ Tensor Conv2D::operator()(Tensor& x)
 
 Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter, Tensor& bias)
 {
+    SAPPHIRE_PROFILE_UNIT(m_name);
     if (!m_useBias)
         throw std::runtime_error(
             "Conv2D::operator() - This unit was not configured to use bias, "
@@ -181,22 +185,33 @@ Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter, Tensor& bias)
 
     Util::ChangeTensorDataDimension(4, x, dx, y, dy);
 
-    Compute::Initialize::Zeros(y);
-    Compute::Conv2DForward(y, x, filterData, strideRows, strideCols,
-                           dilationRows, dilationCols, rowPadding, colPadding);
-
     if (device != bias.GetDevice())
         throw std::runtime_error(
             "NN::Conv2D::operator() - bias and tensor device mismatch");
-    biasData.Reshape(Shape({ 1, m_yChannels, 1, 1 }));
 
-    auto copy = y.GetDataCopy();
-    auto biasCopy = biasData.GetDataCopy();
-    Compute::Add(y, y, biasData);
-    auto yCopy = y.GetDataCopy();
+    if (m_inputObserver && mode == ComputeMode::Host)
+        m_inputObserver->Observe(x);
+
+    const bool relu = m_activation == Compute::Activation::ReLU;
+    if (m_useInt8(filter, mode))
+    {
+        //! Bias and activation are added in the epilogue of int8 convolution
+        Compute::Conv2DInt8(y, x, *m_int8Filter, biasData, m_inputParams,
+                            strideRows, strideCols, dilationRows, dilationCols,
+                            rowPadding, colPadding, relu);
+        biasData.Reshape(Shape({ 1, m_yChannels, 1, 1 }));
+    }
+    else
+    {
+        biasData.Reshape(Shape({ 1, m_yChannels, 1, 1 }));
+        Compute::Conv2DActivation(y, x, filterData, biasData, m_activation,
+                                  strideRows, strideCols, dilationRows,
+                                  dilationCols, rowPadding, colPadding);
+    }
     auto* backPropWrapper =
         new BackProp::Conv2DBackProp(m_name, dx, dy, filterData, biasData, x,
-                                     m_stride, m_dilation, m_padSize);
+                                     m_stride, m_dilation, m_padSize,
+                                     m_activation, y);
     Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
                       std::make_tuple(&yDesc));
 
@@ -205,6 +220,7 @@ Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter, Tensor& bias)
 
 Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter)
 {
+    SAPPHIRE_PROFILE_UNIT(m_name);
     if (m_useBias == true)
         throw std::runtime_error(
             "Conv2D::operator() - This unit was configured to use bias, but it "
@@ -236,13 +252,22 @@ Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter)
 
     Util::ChangeTensorDataDimension(4, x, dx, y, dy);
 
-    //! TODO : Do we need this?
-    Compute::Initialize::Zeros(y);
-    Compute::Conv2DForward(y, x, filterData, strideRows, strideCols,
-                           dilationRows, dilationCols, rowPadding, colPadding);
+    if (m_inputObserver && mode == ComputeMode::Host)
+        m_inputObserver->Observe(x);
+
+    const bool relu = m_activation == Compute::Activation::ReLU;
+    if (m_useInt8(filter, mode))
+        Compute::Conv2DInt8(y, x, *m_int8Filter, m_inputParams, strideRows,
+                            strideCols, dilationRows, dilationCols, rowPadding,
+                            colPadding, relu);
+    else
+        Compute::Conv2DActivation(y, x, filterData, m_activation, strideRows,
+                                  strideCols, dilationRows, dilationCols,
+                                  rowPadding, colPadding);
 
     auto* backPropWrapper = new BackProp::Conv2DBackProp(m_name,
-        dx, dy, filterData, x, m_stride, m_dilation, m_padSize);
+        dx, dy, filterData, x, m_stride, m_dilation, m_padSize, m_activation,
+        y);
 
     Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
                       std::make_tuple(&yDesc));
@@ -250,7 +275,79 @@ Tensor Conv2D::operator()(Tensor& tensor, Tensor& filter)
     return Tensor(yKey);
 }
 
-int Conv2D::m_registerOutputTensor(
+void Conv2D::Calibrate()
+{
+    m_inputObserver = std::make_shared<Compute::RangeObserver>();
+}
+
+void Conv2D::Quantize()
+{
+    if (!m_inputObserver || m_inputObserver->Empty())
+        throw std::runtime_error(
+            "NN::Conv2D::Quantize - No inputs were recorded. Call Calibrate() "
+            "and run forward propagation on the host first");
+
+    const Tensor filter = m_trainableTensorMap.at("filter");
+    filter.ToHost();
+    const auto& filterDesc =
+        ModelManager::CurModel().GetDescriptor(filter.TensorDescriptorKey());
+    m_int8Filter = std::make_shared<Compute::Int8Weight>(
+        filterDesc.GetForwardData(), true);
+    m_inputParams = m_inputObserver->GetParams();
+    m_inputObserver = nullptr;
+}
+
+void Conv2D::FoldBatchNorm(BatchNorm2D& batchNorm)
+{
+    if (batchNorm.GetChannels() != m_yChannels)
+        throw std::invalid_argument(
+            "NN::Conv2D::FoldBatchNorm - Number of channels does not match");
+    if (batchNorm.IsFolded())
+        throw std::runtime_error(
+            "NN::Conv2D::FoldBatchNorm - Batch normalization is already "
+            "folded");
+    if (m_activation != Compute::Activation::None)
+        throw std::runtime_error(
+            "NN::Conv2D::FoldBatchNorm - Fused activation is applied before "
+            "batch normalization");
+    if (IsQuantized())
+        throw std::runtime_error(
+            "NN::Conv2D::FoldBatchNorm - Filter is already quantized. Fold "
+            "batch normalization before Quantize()");
+
+    const auto [scale, shift] = batchNorm.GetScaleAndShift();
+    const Tensor filter = m_trainableTensorMap.at("filter");
+    auto filterData = filter.GetData();
+    const auto unitSize = filterData.size() / m_yChannels;
+    for (std::size_t idx = 0; idx < filterData.size(); ++idx)
+        filterData[idx] *= scale[idx / unitSize];
+    filter.LoadData(filterData);
+
+    if (!m_useBias)
+    {
+        m_trainableTensorMap["bias"] = MakeTensor(
+            Shape({ m_yChannels }), M<Initialize::Zeros>(), true);
+        m_useBias = true;
+    }
+    const Tensor bias = m_trainableTensorMap.at("bias");
+    auto biasData = bias.GetData();
+    for (std::size_t channelIdx = 0; channelIdx < biasData.size();
+         ++channelIdx)
+        biasData[channelIdx] =
+            biasData[channelIdx] * scale[channelIdx] + shift[channelIdx];
+    bias.LoadData(biasData);
+
+    batchNorm.MarkFolded();
+}
+
+bool Conv2D::m_useInt8(const Tensor& filter, ComputeMode mode) const
+{
+    return m_int8Filter && mode == ComputeMode::Host &&
+           filter.TensorDescriptorKey() ==
+           m_trainableTensorMap.at("filter").TensorDescriptorKey();
+}
+
+std::int64_t Conv2D::m_registerOutputTensor(
     const TensorUtil::TensorDescriptor& xDesc) const
 {
     auto& model = ModelManager::CurModel();
@@ -0,0 +1,118 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/IndexingOps.hpp>
+#include <Sapphire/operations/Backward/EmbeddingBackward.hpp>
+#include <Sapphire/operations/Forward/Embedding.hpp>
+#include <Sapphire/tensor/CreateTensor.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+#include <Sapphire/util/Profiler.hpp>
+
+namespace Sapphire::NN
+{
+std::atomic<int> Embedding::m_unitIdCount = 0;
+
+Embedding::Embedding(int numEmbeddings, int embeddingDim, EmbeddingBag bag)
+    : Unit(std::string("Embedding") + std::to_string(m_unitIdCount++)),
+      m_numEmbeddings(numEmbeddings),
+      m_embeddingDim(embeddingDim),
+      m_bag(bag)
+{
+    const Tensor weight = MakeTensor(Shape({ numEmbeddings, embeddingDim }),
+                                     M<Initialize::Normal>(0.0f, 1.0f), true);
+    m_trainableTensorMap["weight"] = weight;
+}
+
+Embedding::Embedding(std::string name, int numEmbeddings, int embeddingDim,
+                     EmbeddingBag bag)
+    : Unit(std::move(name)),
+      m_numEmbeddings(numEmbeddings),
+      m_embeddingDim(embeddingDim),
+      m_bag(bag)
+{
+    const Tensor weight = MakeTensor(Shape({ numEmbeddings, embeddingDim }),
+                                     M<Initialize::Normal>(0.0f, 1.0f), true);
+    m_trainableTensorMap["weight"] = weight;
+}
+
+Tensor Embedding::operator()(Tensor& indices)
+{
+    const Tensor weight = m_trainableTensorMap.at("weight");
+    return this->operator()(indices, weight);
+}
+
+Tensor Embedding::operator()(Tensor& indices, Tensor weight)
+{
+    SAPPHIRE_PROFILE_UNIT(m_name);
+    if (indices.Mode() != ComputeMode::Host ||
+        weight.Mode() != ComputeMode::Host)
+        throw std::invalid_argument(
+            "NN::Embedding - Embedding is only available on the host");
+
+    auto& model = ModelManager::CurModel();
+    auto& indicesDesc = model.GetDescriptor(indices.TensorDescriptorKey());
+    auto& weightDesc = model.GetDescriptor(weight.TensorDescriptorKey());
+    m_checkArguments({ &indicesDesc, &weightDesc });
+
+    const auto yKey = m_registerOutputTensor(indicesDesc);
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(ComputeMode::Host);
+
+    auto weightData = weightDesc.GetForwardData();
+    auto indicesData = indicesDesc.GetForwardData();
+    auto yData = yDesc.GetForwardData();
+    auto dyData = yDesc.GetBackwardData();
+
+    const auto bagSize =
+        m_bag == EmbeddingBag::None ? 1 : indices.GetShape().At(-1);
+    const bool mean = m_bag == EmbeddingBag::Mean;
+
+    Compute::EmbeddingForward(yData, weightData, indicesData, bagSize, mean);
+
+    auto* backPropWrapper = new BackProp::EmbeddingBackProp(
+        m_name, dyData, weightData, indicesData, bagSize, mean);
+    Util::SaveHistory(backPropWrapper, std::make_tuple(),
+                      std::make_tuple(&yDesc));
+
+    return Tensor(yKey);
+}
+
+Tensor Embedding::GetWeight() const
+{
+    return m_trainableTensorMap.at("weight");
+}
+
+std::int64_t Embedding::m_registerOutputTensor(
+    const TensorUtil::TensorDescriptor& indicesDesc) const
+{
+    auto& model = ModelManager::CurModel();
+    auto shapeVector = indicesDesc.GetShape().GetShapeVector();
+    if (m_bag == EmbeddingBag::None)
+        shapeVector.emplace_back(m_embeddingDim);
+    else
+        shapeVector.back() = m_embeddingDim;
+
+    const auto yKey = model.RegisterTensorDescriptor(
+        Shape(shapeVector), indicesDesc.GetType(), indicesDesc.GetDevice());
+    return yKey;
+}
+
+void Embedding::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto indices = arguments.at(0);
+    const auto weight = arguments.at(1);
+    if (weight->GetShape() != Shape({ m_numEmbeddings, m_embeddingDim }))
+        throw std::invalid_argument(
+            "NN::Embedding - Weight shape mismatch : " +
+            weight->GetShape().ToString());
+    if (m_bag != EmbeddingBag::None && indices->GetShape().Dim() < 2)
+        throw std::invalid_argument(
+            "NN::Embedding - Indices must have at least 2 dimensions for "
+            "pooling");
+}
+} // namespace Sapphire::NN
@@ -0,0 +1,74 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/AttentionOps.hpp>
+#include <Sapphire/operations/Backward/AttentionBackward.hpp>
+#include <Sapphire/operations/Forward/Functional/Attention.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+#include <atomic>
+#include <cmath>
+
+namespace Sapphire::F
+{
+Tensor ScaledDotProductAttention(const Tensor& query, const Tensor& key,
+                                 const Tensor& value, bool causal)
+{
+    static std::atomic<int> unitIdCount = 0;
+    const auto name = "Attention" + std::to_string(unitIdCount++);
+    SAPPHIRE_PROFILE_UNIT(name);
+    Model& model = ModelManager::CurModel();
+
+    if (query.Mode() != ComputeMode::Host || key.Mode() != query.Mode() ||
+        value.Mode() != query.Mode())
+        throw std::invalid_argument(
+            "NN::Functional::ScaledDotProductAttention - Only available in "
+            "host mode");
+
+    auto& queryDesc = model.GetDescriptor(query.TensorDescriptorKey());
+    auto& keyDesc = model.GetDescriptor(key.TensorDescriptorKey());
+    auto& valueDesc = model.GetDescriptor(value.TensorDescriptorKey());
+    const auto queryShape = queryDesc.GetShape();
+    const auto valueShape = valueDesc.GetShape();
+    if (queryShape.Dim() < 2 || valueShape.Dim() != queryShape.Dim())
+        throw std::invalid_argument(
+            "NN::Functional::ScaledDotProductAttention - Shape mismatch");
+
+    auto yShape = queryShape;
+    yShape[-1] = valueShape.Cols();
+    const auto yKey = model.RegisterTensorDescriptor(
+        yShape, queryDesc.GetType(), queryDesc.GetDevice());
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(ComputeMode::Host);
+
+    auto queryData = queryDesc.GetForwardData();
+    auto keyData = keyDesc.GetForwardData();
+    auto valueData = valueDesc.GetForwardData();
+    auto y = yDesc.GetForwardData();
+    auto dy = yDesc.GetBackwardData();
+
+    TensorUtil::TensorData logSumExp(
+        Shape({ queryData.GetNumUnits(2), queryShape.Rows() }), Type::Dense);
+    const float scale =
+        1.0f / std::sqrt(static_cast<float>(queryShape.Cols()));
+    Compute::AttentionForward(y, logSumExp, queryData, keyData, valueData,
+                              scale, causal);
+
+    const bool recording = model.IsRecordingHistory();
+    auto* backPropWrapper = new BackProp::AttentionBackProp(
+        name, queryDesc.GetBackwardData(), keyDesc.GetBackwardData(),
+        valueDesc.GetBackwardData(), dy, queryData, keyData, valueData, y,
+        logSumExp, scale, causal);
+    Util::SaveHistory(backPropWrapper,
+                      std::make_tuple(&queryDesc, &keyDesc, &valueDesc),
+                      std::make_tuple(&yDesc));
+    if (!recording)
+        logSumExp.ReleaseMemory();
+
+    return Tensor(yKey);
+}
+} // namespace Sapphire::F
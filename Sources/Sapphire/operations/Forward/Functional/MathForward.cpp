@@ -6,15 +6,17 @@
 
 #include <Sapphire/Model.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
 #include <Sapphire/operations/Backward/MathBackward.hpp>
 #include <Sapphire/operations/Forward/Functional/MathForward.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
+#include <atomic>
 
 namespace Sapphire::F
 {
 Tensor MatMul(const Tensor& inputA, const Tensor& inputB)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     Model& model = ModelManager::CurModel();
 
     if (inputA.Mode() != inputB.Mode())
@@ -50,7 +52,7 @@ Tensor MatMul(const Tensor& inputA, const Tensor& inputB)
 
     const Type type = aDesc.GetType();
     const CudaDevice device = aDesc.GetDevice();
-    const int outputKey = model.RegisterTensorDescriptor(
+    const auto outputKey = model.RegisterTensorDescriptor(
         yShape, type, device);
 
     auto& yDesc = model.GetDescriptor(outputKey);
@@ -75,7 +77,7 @@ Tensor MatMul(const Tensor& inputA, const Tensor& inputB)
 
 Tensor Add(const Tensor& inputA, const Tensor& inputB)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     Model& model = ModelManager::CurModel();
 
     if (inputA.Mode() != inputB.Mode())
@@ -124,9 +126,52 @@ Tensor Add(const Tensor& inputA, const Tensor& inputB)
     return Tensor(yDesc.GetKey());
 }
 
+Tensor AddReLU(const Tensor& inputA, const Tensor& inputB)
+{
+    static std::atomic<int> unitIdCount = 0;
+    Model& model = ModelManager::CurModel();
+
+    if (inputA.Mode() != inputB.Mode())
+        throw std::invalid_argument("NN::Functional::AddReLU - Mode mismatch");
+
+    if (inputA.GetDevice() != inputB.GetDevice())
+        throw std::invalid_argument(
+            "NN::Functional::AddReLU - Device mismatch");
+
+    TensorUtil::TensorDescriptor& aDesc =
+        model.GetDescriptor(inputA.TensorDescriptorKey());
+    TensorUtil::TensorDescriptor& bDesc =
+        model.GetDescriptor(inputB.TensorDescriptorKey());
+
+    //! Gradients are not reduced over broadcast dimensions
+    if (aDesc.GetShape() != bDesc.GetShape())
+        throw std::invalid_argument(
+            "NN::Functional::AddReLU - Shape mismatch");
+
+    const auto outKey = model.RegisterTensorDescriptor(
+        aDesc.GetShape(), aDesc.GetType(), aDesc.GetDevice());
+    auto& yDesc = model.GetDescriptor(outKey);
+    yDesc.SetMode(inputA.Mode());
+
+    auto a = aDesc.GetForwardData();
+    auto da = aDesc.GetBackwardData();
+    auto b = bDesc.GetForwardData();
+    auto db = bDesc.GetBackwardData();
+    auto y = yDesc.GetForwardData();
+    auto dy = yDesc.GetBackwardData();
+
+    auto* backPropWrapper = new BackProp::AddReLUBackProp(
+        "AddReLU" + std::to_string(unitIdCount++), da, db, dy, y);
+    Util::SaveHistory(backPropWrapper, std::make_tuple(&aDesc, &bDesc),
+                      std::make_tuple(&yDesc));
+
+    Compute::AddActivation(y, a, b, Compute::Activation::ReLU);
+    return Tensor(yDesc.GetKey());
+}
+
 Tensor Sub(const Tensor& inputA, const Tensor& inputB)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     Model& model = ModelManager::CurModel();
 
     if (inputA.Mode() != inputB.Mode())
@@ -176,7 +221,7 @@ Tensor Sub(const Tensor& inputA, const Tensor& inputB)
 
 Tensor Dot(const Tensor& inputA, const Tensor& inputB)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     Model& model = ModelManager::CurModel();
 
     if (inputA.Mode() != inputB.Mode())
@@ -226,7 +271,7 @@ Tensor Dot(const Tensor& inputA, const Tensor& inputB)
 
 Tensor Mean(const Tensor& input, int dim)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     if (dim < 0 || dim >= input.GetShape().Dim())
         throw std::invalid_argument("NN::Functional::Mean - Invalid dim");
 
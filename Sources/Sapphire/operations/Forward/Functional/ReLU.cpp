@@ -11,12 +11,13 @@
 #include <Sapphire/Model.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
 #include <Sapphire/compute/ActivationOps.hpp>
+#include <atomic>
 
 namespace Sapphire::F
 {
 Tensor ReLU(Tensor xTensor)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     Model& model = ModelManager::CurModel();
     auto& xDesc = model.GetDescriptor(xTensor.TensorDescriptorKey());
     const auto yDescKey = model.RegisterTensorDescriptor(
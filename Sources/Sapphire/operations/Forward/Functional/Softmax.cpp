@@ -9,12 +9,13 @@
 #include <Sapphire/util/UnitUtils.hpp>
 #include <Sapphire/operations/Backward/SoftmaxBackward.hpp>
 #include <Sapphire/Model.hpp>
+#include <atomic>
 
 namespace Sapphire::F
 {
 Tensor SoftMax(const Tensor& input)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     Model& model = ModelManager::CurModel();
     auto& xDesc = model.GetDescriptor(input.TensorDescriptorKey());
     const auto yDescKey = model.RegisterTensorDescriptor(
@@ -0,0 +1,139 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/RecurrentOps.hpp>
+#include <Sapphire/operations/Backward/RecurrentBackward.hpp>
+#include <Sapphire/operations/Forward/GRU.hpp>
+#include <Sapphire/tensor/CreateTensor.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+#include <cmath>
+
+namespace Sapphire::NN
+{
+std::atomic<int> GRU::m_unitIdCount = 0;
+
+GRU::GRU(int inputSize, int hiddenSize)
+    : GRU(std::string("GRU") + std::to_string(m_unitIdCount++), inputSize,
+          hiddenSize)
+{
+}
+
+GRU::GRU(std::string name, int inputSize, int hiddenSize)
+    : Unit(std::move(name)),
+      m_inputSize(inputSize),
+      m_hiddenSize(hiddenSize)
+{
+    if (inputSize <= 0 || hiddenSize <= 0)
+        throw std::invalid_argument(
+            "NN::GRU - Input and hidden size must be positive");
+
+    const auto sd = 1.0f / std::sqrt(static_cast<float>(hiddenSize));
+    m_trainableTensorMap["weightIh"] =
+        MakeTensor(Shape({ inputSize, 3 * hiddenSize }),
+                   M<Initialize::Uniform>(-sd, sd), true);
+    m_trainableTensorMap["weightHh"] =
+        MakeTensor(Shape({ hiddenSize, 3 * hiddenSize }),
+                   M<Initialize::Uniform>(-sd, sd), true);
+    m_trainableTensorMap["biasIh"] = MakeTensor(
+        Shape({ 3 * hiddenSize }), M<Initialize::Uniform>(-sd, sd), true);
+    m_trainableTensorMap["biasHh"] = MakeTensor(
+        Shape({ 3 * hiddenSize }), M<Initialize::Uniform>(-sd, sd), true);
+}
+
+Tensor GRU::operator()(Tensor& x)
+{
+    SAPPHIRE_PROFILE_UNIT(m_name);
+    const auto mode = x.Mode();
+    const Tensor weightIh = m_trainableTensorMap.at("weightIh");
+    const Tensor weightHh = m_trainableTensorMap.at("weightHh");
+    const Tensor biasIh = m_trainableTensorMap.at("biasIh");
+    const Tensor biasHh = m_trainableTensorMap.at("biasHh");
+    for (const auto& tensor : { weightIh, weightHh, biasIh, biasHh })
+    {
+        tensor.SetDevice(x.GetDevice());
+        if (mode == ComputeMode::Cuda)
+            tensor.ToCuda();
+        else
+            tensor.ToHost();
+    }
+
+    auto& model = ModelManager::CurModel();
+    auto& xDesc = model.GetDescriptor(x.TensorDescriptorKey());
+    m_checkArguments({ &xDesc });
+    auto weightIhData =
+        model.GetDescriptor(weightIh.TensorDescriptorKey()).GetForwardData();
+    auto weightHhData =
+        model.GetDescriptor(weightHh.TensorDescriptorKey()).GetForwardData();
+    auto biasIhData =
+        model.GetDescriptor(biasIh.TensorDescriptorKey()).GetForwardData();
+    auto biasHhData =
+        model.GetDescriptor(biasHh.TensorDescriptorKey()).GetForwardData();
+
+    auto xData = xDesc.GetForwardData();
+    auto dxData = xDesc.GetBackwardData();
+    const auto xShape = xDesc.GetShape();
+    const auto steps = xShape.At(0);
+    const auto batchSize = xShape.At(1);
+    const auto yKey = model.RegisterTensorDescriptor(
+        Shape({ steps, batchSize, m_hiddenSize }), xData.GetType(),
+        xDesc.GetDevice());
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(mode);
+    auto yData = yDesc.GetForwardData();
+    auto dyData = yDesc.GetBackwardData();
+
+    TensorUtil::TensorData gates(
+        Shape({ steps, batchSize, 4 * m_hiddenSize }), Type::Dense,
+        xData.GetCudaDevice());
+    gates.SetMode(mode);
+    Compute::GruForward(yData, gates, xData, weightIhData, weightHhData,
+                        biasIhData, biasHhData);
+
+    const bool recording = model.IsRecordingHistory();
+    auto* backPropWrapper = new BackProp::GruBackProp(
+        m_name, dxData, dyData, weightIhData, weightHhData, biasIhData,
+        biasHhData, xData, yData, gates);
+    Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
+                      std::make_tuple(&yDesc));
+    //! Gates are not needed if back propagation was not recorded
+    if (!recording)
+        gates.ReleaseMemory();
+
+    return Tensor(yKey);
+}
+
+Tensor GRU::GetWeightIh() const
+{
+    return m_trainableTensorMap.at("weightIh");
+}
+
+Tensor GRU::GetWeightHh() const
+{
+    return m_trainableTensorMap.at("weightHh");
+}
+
+Tensor GRU::GetBiasIh() const
+{
+    return m_trainableTensorMap.at("biasIh");
+}
+
+Tensor GRU::GetBiasHh() const
+{
+    return m_trainableTensorMap.at("biasHh");
+}
+
+void GRU::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto xShape = arguments.at(0)->GetShape();
+    if (xShape.Dim() != 3 || xShape.At(2) != m_inputSize)
+        throw std::invalid_argument(
+            "NN::GRU - x should have shape of (T, N, " +
+            std::to_string(m_inputSize) + ")");
+}
+} // namespace Sapphire::NN
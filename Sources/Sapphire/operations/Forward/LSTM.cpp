@@ -0,0 +1,136 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/RecurrentOps.hpp>
+#include <Sapphire/operations/Backward/RecurrentBackward.hpp>
+#include <Sapphire/operations/Forward/LSTM.hpp>
+#include <Sapphire/tensor/CreateTensor.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+#include <cmath>
+
+namespace Sapphire::NN
+{
+std::atomic<int> LSTM::m_unitIdCount = 0;
+
+LSTM::LSTM(int inputSize, int hiddenSize)
+    : LSTM(std::string("LSTM") + std::to_string(m_unitIdCount++), inputSize,
+           hiddenSize)
+{
+}
+
+LSTM::LSTM(std::string name, int inputSize, int hiddenSize)
+    : Unit(std::move(name)),
+      m_inputSize(inputSize),
+      m_hiddenSize(hiddenSize)
+{
+    if (inputSize <= 0 || hiddenSize <= 0)
+        throw std::invalid_argument(
+            "NN::LSTM - Input and hidden size must be positive");
+
+    const auto sd = 1.0f / std::sqrt(static_cast<float>(hiddenSize));
+    m_trainableTensorMap["weightIh"] =
+        MakeTensor(Shape({ inputSize, 4 * hiddenSize }),
+                   M<Initialize::Uniform>(-sd, sd), true);
+    m_trainableTensorMap["weightHh"] =
+        MakeTensor(Shape({ hiddenSize, 4 * hiddenSize }),
+                   M<Initialize::Uniform>(-sd, sd), true);
+    m_trainableTensorMap["bias"] = MakeTensor(
+        Shape({ 4 * hiddenSize }), M<Initialize::Uniform>(-sd, sd), true);
+}
+
+Tensor LSTM::operator()(Tensor& x)
+{
+    SAPPHIRE_PROFILE_UNIT(m_name);
+    const auto mode = x.Mode();
+    const Tensor weightIh = m_trainableTensorMap.at("weightIh");
+    const Tensor weightHh = m_trainableTensorMap.at("weightHh");
+    const Tensor bias = m_trainableTensorMap.at("bias");
+    for (const auto& tensor : { weightIh, weightHh, bias })
+    {
+        tensor.SetDevice(x.GetDevice());
+        if (mode == ComputeMode::Cuda)
+            tensor.ToCuda();
+        else
+            tensor.ToHost();
+    }
+
+    auto& model = ModelManager::CurModel();
+    auto& xDesc = model.GetDescriptor(x.TensorDescriptorKey());
+    m_checkArguments({ &xDesc });
+    auto weightIhData =
+        model.GetDescriptor(weightIh.TensorDescriptorKey()).GetForwardData();
+    auto weightHhData =
+        model.GetDescriptor(weightHh.TensorDescriptorKey()).GetForwardData();
+    auto biasData =
+        model.GetDescriptor(bias.TensorDescriptorKey()).GetForwardData();
+
+    auto xData = xDesc.GetForwardData();
+    auto dxData = xDesc.GetBackwardData();
+    const auto xShape = xDesc.GetShape();
+    const auto steps = xShape.At(0);
+    const auto batchSize = xShape.At(1);
+    const auto yKey = model.RegisterTensorDescriptor(
+        Shape({ steps, batchSize, m_hiddenSize }), xData.GetType(),
+        xDesc.GetDevice());
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(mode);
+    auto yData = yDesc.GetForwardData();
+    auto dyData = yDesc.GetBackwardData();
+
+    TensorUtil::TensorData gates(
+        Shape({ steps, batchSize, 4 * m_hiddenSize }), Type::Dense,
+        xData.GetCudaDevice());
+    TensorUtil::TensorData cells(Shape({ steps, batchSize, m_hiddenSize }),
+                                 Type::Dense, xData.GetCudaDevice());
+    gates.SetMode(mode);
+    cells.SetMode(mode);
+    Compute::LstmForward(yData, gates, cells, xData, weightIhData,
+                         weightHhData, biasData);
+
+    const bool recording = model.IsRecordingHistory();
+    auto* backPropWrapper = new BackProp::LstmBackProp(
+        m_name, dxData, dyData, weightIhData, weightHhData, biasData, xData,
+        yData, gates, cells);
+    Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
+                      std::make_tuple(&yDesc));
+    //! Gates and cell states are not needed if back propagation was not
+    //! recorded
+    if (!recording)
+    {
+        gates.ReleaseMemory();
+        cells.ReleaseMemory();
+    }
+
+    return Tensor(yKey);
+}
+
+Tensor LSTM::GetWeightIh() const
+{
+    return m_trainableTensorMap.at("weightIh");
+}
+
+Tensor LSTM::GetWeightHh() const
+{
+    return m_trainableTensorMap.at("weightHh");
+}
+
+Tensor LSTM::GetBias() const
+{
+    return m_trainableTensorMap.at("bias");
+}
+
+void LSTM::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto xShape = arguments.at(0)->GetShape();
+    if (xShape.Dim() != 3 || xShape.At(2) != m_inputSize)
+        throw std::invalid_argument(
+            "NN::LSTM - x should have shape of (T, N, " +
+            std::to_string(m_inputSize) + ")");
+}
+} // namespace Sapphire::NN
@@ -0,0 +1,122 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/NormalizationOps.hpp>
+#include <Sapphire/operations/Backward/NormalizationBackward.hpp>
+#include <Sapphire/operations/Forward/LayerNorm.hpp>
+#include <Sapphire/tensor/CreateTensor.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <Sapphire/util/UnitUtils.hpp>
+
+namespace Sapphire::NN
+{
+std::atomic<int> LayerNorm::m_unitIdCount = 0;
+
+LayerNorm::LayerNorm(Shape normalizedShape, float epsilon)
+    : LayerNorm(std::string("LayerNorm") + std::to_string(m_unitIdCount++),
+                std::move(normalizedShape), epsilon)
+{
+}
+
+LayerNorm::LayerNorm(std::string name, Shape normalizedShape, float epsilon)
+    : Unit(std::move(name)),
+      m_normalizedShape(std::move(normalizedShape)),
+      m_epsilon(epsilon)
+{
+    if (m_normalizedShape.Dim() == 0 || m_normalizedShape.Size() <= 0)
+        throw std::invalid_argument(
+            "NN::LayerNorm - Normalized shape must not be empty");
+
+    m_trainableTensorMap["gamma"] =
+        MakeTensor(m_normalizedShape, M<Initialize::Ones>(), true);
+    m_trainableTensorMap["beta"] =
+        MakeTensor(m_normalizedShape, M<Initialize::Zeros>(), true);
+}
+
+Tensor LayerNorm::operator()(Tensor& x)
+{
+    SAPPHIRE_PROFILE_UNIT(m_name);
+    const auto mode = x.Mode();
+    const Tensor gamma = m_trainableTensorMap.at("gamma");
+    const Tensor beta = m_trainableTensorMap.at("beta");
+    for (const auto& tensor : { gamma, beta })
+    {
+        tensor.SetDevice(x.GetDevice());
+        if (mode == ComputeMode::Cuda)
+            tensor.ToCuda();
+        else
+            tensor.ToHost();
+    }
+
+    auto& model = ModelManager::CurModel();
+    auto& xDesc = model.GetDescriptor(x.TensorDescriptorKey());
+    m_checkArguments({ &xDesc });
+    auto gammaData =
+        model.GetDescriptor(gamma.TensorDescriptorKey()).GetForwardData();
+    auto betaData =
+        model.GetDescriptor(beta.TensorDescriptorKey()).GetForwardData();
+
+    auto xData = xDesc.GetForwardData();
+    auto dxData = xDesc.GetBackwardData();
+    const auto yKey = model.RegisterTensorDescriptor(
+        xDesc.GetShape(), xData.GetType(), xDesc.GetDevice());
+    auto& yDesc = model.GetDescriptor(yKey);
+    yDesc.SetMode(mode);
+    auto yData = yDesc.GetForwardData();
+    auto dyData = yDesc.GetBackwardData();
+
+    const auto rows = xData.Size() / m_normalizedShape.Size();
+    TensorUtil::TensorData savedMean(Shape({ rows }), Type::Dense,
+                                     xData.GetCudaDevice());
+    TensorUtil::TensorData savedInvStd(Shape({ rows }), Type::Dense,
+                                       xData.GetCudaDevice());
+    savedMean.SetMode(mode);
+    savedInvStd.SetMode(mode);
+    Compute::LayerNormForward(yData, savedMean, savedInvStd, xData, gammaData,
+                              betaData, m_epsilon);
+
+    const bool recording = model.IsRecordingHistory();
+    auto* backPropWrapper = new BackProp::LayerNormBackProp(
+        m_name, dxData, dyData, gammaData, betaData, xData, savedMean,
+        savedInvStd);
+    Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
+                      std::make_tuple(&yDesc));
+    //! Statistics are not needed if back propagation was not recorded
+    if (!recording)
+    {
+        savedMean.ReleaseMemory();
+        savedInvStd.ReleaseMemory();
+    }
+
+    return Tensor(yKey);
+}
+
+Tensor LayerNorm::GetGamma() const
+{
+    return m_trainableTensorMap.at("gamma");
+}
+
+Tensor LayerNorm::GetBeta() const
+{
+    return m_trainableTensorMap.at("beta");
+}
+
+void LayerNorm::m_checkArguments(
+    std::vector<TensorUtil::TensorDescriptor*> arguments) const
+{
+    const auto xShape = arguments.at(0)->GetShape();
+    const auto normalizedDim = m_normalizedShape.Dim();
+    bool match = xShape.Dim() >= normalizedDim;
+    for (int axis = 1; match && axis <= normalizedDim; ++axis)
+        match = xShape.At(xShape.Dim() - axis) ==
+                m_normalizedShape.At(normalizedDim - axis);
+    if (!match)
+        throw std::invalid_argument(
+            "NN::LayerNorm - Last dimensions of x should match normalized "
+            "shape " + m_normalizedShape.ToString());
+}
+} // namespace Sapphire::NN
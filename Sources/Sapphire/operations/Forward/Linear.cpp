@@ -6,17 +6,20 @@
 
 #include <Sapphire/Model.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
 #include <Sapphire/operations/Backward/LinearBackward.hpp>
 #include <Sapphire/operations/Forward/Linear.hpp>
 #include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/sparse/BlockSparse.hpp>
 #include <Sapphire/operations/Unit.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
 #include <Sapphire/tensor/CreateTensor.hpp>
+#include <Sapphire/util/Profiler.hpp>
 
 namespace Sapphire::NN
 {
-int Linear::m_unitIdCount = 0;
+std::atomic<int> Linear::m_unitIdCount = 0;
 
 Linear::Linear(int inputFeatureSize, int outputFeatureSize,
                bool isSparse)
@@ -89,6 +92,7 @@ Tensor Linear::operator()(Tensor& x)
 
 Tensor Linear::operator()(Tensor& x, Tensor weight, Tensor bias)
 {
+    SAPPHIRE_PROFILE_UNIT(m_name);
     auto mode = x.Mode();
     if (!Util::CheckModeEquality(mode, weight, bias))
         throw std::invalid_argument("NN::Linear - Device mode inequality");
@@ -111,34 +115,50 @@ Tensor Linear::operator()(Tensor& x, Tensor weight, Tensor bias)
     auto dyData = yDesc.GetBackwardData();
 
     const auto batchSize = x.GetShape().GetNumUnits(1);
-    auto transposedOnes = TensorUtil::TensorData(
-        Shape({ batchSize, 1 }), Type::Dense,
-        bias.GetDevice());
-    transposedOnes.SetMode(bias.Mode());
-    Compute::Initialize::Ones(transposedOnes);
+    const bool isOwnWeight =
+        weight.TensorDescriptorKey() ==
+        m_trainableTensorMap.at("weight").TensorDescriptorKey();
 
     //! Change the dimension of the data to match the requirements
     Util::ChangeTensorDataDimension(2, xData, dxData, yData, dyData, biasData);
 
-    auto expandedBias = TensorUtil::TensorData(
-        yData.GetShape(), Type::Dense, bias.GetDevice());
-    expandedBias.SetMode(bias.Mode());
+    if (m_inputObserver && mode == ComputeMode::Host)
+        m_inputObserver->Observe(xData);
 
-    const auto shape0 = expandedBias.GetShape();
-    const auto shape1 = transposedOnes.GetShape(); // check
-    const auto shape2 = biasData.GetShape();
-    const auto shape3 = yData.GetShape();
-    const auto shape4 = weightData.GetShape();
-
-    Compute::Initialize::Zeros(expandedBias);
-    Compute::Gemm(yData, transposedOnes,
-                  biasData);
-    Compute::Gemm(yData, xData, weightData);
+    if (m_int8Weight && mode == ComputeMode::Host && isOwnWeight)
+    {
+        //! Bias and activation are applied in the epilogue of int8 gemm
+        Compute::GemmInt8(yData, xData, *m_int8Weight, biasData,
+                          m_inputParams,
+                          m_activation == Compute::Activation::ReLU);
+    }
+    else if (m_sparseWeight && isOwnWeight)
+    {
+        if (mode != ComputeMode::Host)
+            throw std::runtime_error(
+                "NN::Linear - Pruned weight is only available on host");
+        //! Blocks are synced only if the dense weight has been written since
+        //! last forward
+        const auto version = weightDesc.GetForwardDataVersion();
+        if (version != m_sparseWeightVersion)
+        {
+            Compute::SyncBlockSparseMatrix(m_sparseWeight.get(),
+                                           weightData.HostMutableRawPtr(),
+                                           m_outputs);
+            m_sparseWeightVersion = version;
+        }
+        Compute::Initialize::Zeros(yData);
+        Compute::Gemm(yData, xData, *m_sparseWeight);
+        Compute::BiasActivation(yData, biasData, m_activation);
+    }
+    else
+        Compute::LinearActivation(yData, xData, weightData, biasData,
+                                  m_activation);
 
     auto* backPropWrapper =
         new BackProp::LinearBackProp(m_name,
                                      dxData, dyData, weightData, biasData,
-                                     xData, batchSize);
+                                     xData, batchSize, m_activation, yData);
     Util::SaveHistory(backPropWrapper, std::make_tuple(&xDesc),
                       std::make_tuple(&yDesc));
 
@@ -155,7 +175,59 @@ Tensor Linear::GetBias() const
     return m_trainableTensorMap.at("bias");
 }
 
-int Linear::m_registerOutputTensor(
+void Linear::Prune(float sparsity, std::pair<int, int> blockSize)
+{
+    const auto [blockRows, blockCols] = blockSize;
+    if (blockRows <= 0 || blockCols <= 0 || m_inputs % blockRows != 0 ||
+        m_outputs % blockCols != 0)
+        throw std::invalid_argument(
+            "NN::Linear::Prune - Weight shape is not divisible by block size");
+
+    const Tensor weight = m_trainableTensorMap.at("weight");
+    const auto weightData = weight.GetData();
+
+    BlockSparseMatrix* sparseWeight = nullptr;
+    Compute::PruneDenseMatrixToBlockSparse(
+        &sparseWeight, weightData.data(), m_inputs, m_outputs, m_outputs,
+        blockRows, blockCols, sparsity);
+    m_sparseWeight = std::shared_ptr<BlockSparseMatrix>(
+        sparseWeight, [](BlockSparseMatrix* ptr)
+        {
+            Compute::DeepFreeBlockSparseHost(ptr, 1);
+        });
+
+    std::vector<float> prunedData(weightData.size());
+    Compute::ConvertBlockSparseMatrixToDenseMatrix(
+        prunedData.data(), m_sparseWeight.get(), m_outputs, 1);
+    weight.LoadData(prunedData);
+    m_sparseWeightVersion = ModelManager::CurModel()
+                            .GetDescriptor(weight.TensorDescriptorKey())
+                            .GetForwardDataVersion();
+}
+
+void Linear::Calibrate()
+{
+    m_inputObserver = std::make_shared<Compute::RangeObserver>();
+}
+
+void Linear::Quantize()
+{
+    if (!m_inputObserver || m_inputObserver->Empty())
+        throw std::runtime_error(
+            "NN::Linear::Quantize - No inputs were recorded. Call Calibrate() "
+            "and run forward propagation on the host first");
+
+    const Tensor weight = m_trainableTensorMap.at("weight");
+    weight.ToHost();
+    const auto& weightDesc =
+        ModelManager::CurModel().GetDescriptor(weight.TensorDescriptorKey());
+    m_int8Weight = std::make_shared<Compute::Int8Weight>(
+        weightDesc.GetForwardData(), false);
+    m_inputParams = m_inputObserver->GetParams();
+    m_inputObserver = nullptr;
+}
+
+std::int64_t Linear::m_registerOutputTensor(
     const TensorUtil::TensorDescriptor& xDesc) const
 {
     auto& model = ModelManager::CurModel();
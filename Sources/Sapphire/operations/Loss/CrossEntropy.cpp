@@ -10,13 +10,14 @@
 #include <Sapphire/operations/Backward/CrossEntropyBackward.hpp>
 #include <Sapphire/compute/LossOps.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
+#include <atomic>
 
 
 namespace Sapphire::NN::Loss
 {
 Tensor CrossEntropy(const Tensor& input, const Tensor& label)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     auto mode = input.Mode();
     if (!Util::CheckModeEquality(mode, label))
         throw std::invalid_argument(
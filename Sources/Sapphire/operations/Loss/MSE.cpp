@@ -9,12 +9,13 @@
 #include <Sapphire/operations/Backward/MSEBackward.hpp>
 #include <Sapphire/operations/Loss/MSE.hpp>
 #include <Sapphire/util/UnitUtils.hpp>
+#include <atomic>
 
 namespace Sapphire::NN::Loss
 {
 Tensor MSE(const Tensor& input, const Tensor& label)
 {
-    static int unitIdCount = 0;
+    static std::atomic<int> unitIdCount = 0;
     auto mode = input.Mode();
     if (!Util::CheckModeEquality(mode, label))
         throw std::invalid_argument("NN::Loss::MSE - Device mode inequality");
@@ -0,0 +1,92 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/compute/dense/naive/ReducedPrecision.hpp>
+#include <Sapphire/operations/optimizers/MixedPrecision.hpp>
+#include <stdexcept>
+
+namespace Sapphire::Optimizer
+{
+MixedPrecision::MixedPrecision(Optimizer* optimizer)
+    : m_optimizer(optimizer)
+{
+    if (m_optimizer == nullptr)
+        throw std::invalid_argument(
+            "Optimizer::MixedPrecision::MixedPrecision - optimizer was null");
+}
+
+void MixedPrecision::operator()(TensorData& z, const TensorData& dz,
+                                std::string name)
+{
+    if (z.GetDataType() == DataType::Float32)
+    {
+        m_optimizer->operator()(z, dz, std::move(name));
+        return;
+    }
+
+    auto& master = m_masterWeight(z);
+    m_optimizer->operator()(master, dz, std::move(name));
+    TensorData::DeepCopy(z, master);
+}
+
+void MixedPrecision::operator()(TensorData& z, const RowSparseData& dz,
+                                std::string name)
+{
+    if (z.GetDataType() == DataType::Float32)
+    {
+        m_optimizer->operator()(z, dz, std::move(name));
+        return;
+    }
+
+    auto& master = m_masterWeight(z);
+    m_optimizer->operator()(master, dz, std::move(name));
+
+    //! Only the rows updated by dz are rounded again
+    const auto cols = static_cast<std::size_t>(dz.Cols);
+    for (std::size_t i = 0; i < dz.NumRows(); ++i)
+        Compute::Dense::Naive::Convert(
+            z.HostReducedMutableRawPtr() + dz.Indices[i] * cols,
+            z.GetDataType(), master.HostRawPtr() + dz.Indices[i] * cols,
+            DataType::Float32, static_cast<unsigned int>(cols));
+}
+
+std::unordered_map<std::string, std::vector<float>>
+MixedPrecision::GetState() const
+{
+    return m_optimizer->GetState();
+}
+
+void MixedPrecision::SetState(const std::string& name, const float* data,
+                              std::size_t size)
+{
+    m_optimizer->SetState(name, data, size);
+}
+
+const TensorData& MixedPrecision::GetMasterWeight(const TensorData& z) const
+{
+    const auto itr = m_masterWeights.find(z.HostRawData());
+    if (itr == m_masterWeights.end())
+        throw std::invalid_argument(
+            "Optimizer::MixedPrecision::GetMasterWeight - Weight has not been "
+            "updated");
+    return itr->second;
+}
+
+TensorData& MixedPrecision::m_masterWeight(const TensorData& z)
+{
+    if (!z.IsContiguous())
+        throw std::invalid_argument(
+            "Optimizer::MixedPrecision - Weight must be contiguous");
+
+    const auto* key = z.HostRawData();
+    auto itr = m_masterWeights.find(key);
+    if (itr == m_masterWeights.end())
+        itr = m_masterWeights
+              .emplace(key, z.ConvertTo(DataType::Float32, true))
+              .first;
+    return itr->second;
+}
+} // namespace Sapphire::Optimizer
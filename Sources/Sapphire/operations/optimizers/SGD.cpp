@@ -25,5 +25,36 @@ void SGD::operator()(TensorData& z, const TensorData& dz, std::string name)
     temp.SetMode(dz.Mode());
     Compute::Scale(temp, dz, m_learningRate);
     Compute::Sub(z, z, temp);
+    temp.ReleaseMemory();
+}
+
+void SGD::operator()(TensorData& z, const RowSparseData& dz, std::string name)
+{
+    if (z.Mode() == ComputeMode::Cuda)
+        throw std::runtime_error(
+            "Optimizer::SGD::operator() - Row sparse update is not implemented "
+            "on Cuda");
+
+    float* zPtr = z.HostMutableRawPtr();
+    const auto cols = static_cast<std::size_t>(dz.Cols);
+    for (std::size_t i = 0; i < dz.NumRows(); ++i)
+    {
+        float* row = zPtr + dz.Indices[i] * cols;
+        const float* gradRow = dz.Rows.data() + i * cols;
+        for (std::size_t col = 0; col < cols; ++col)
+            row[col] -= m_learningRate * gradRow[col];
+    }
+}
+
+std::unordered_map<std::string, std::vector<float>> SGD::GetState() const
+{
+    return { { "LearningRate", { m_learningRate } } };
+}
+
+void SGD::SetState(const std::string& name, const float* data,
+                   std::size_t size)
+{
+    if (name == "LearningRate" && size == 1)
+        m_learningRate = data[0];
 }
 }
@@ -32,7 +32,7 @@ Tensor::Tensor(const Shape& shape, const CudaDevice& device,
         shape, type, device, preserve);
 }
 
-Tensor::Tensor(int descKey)
+Tensor::Tensor(std::int64_t descKey)
     : m_tensorDescKey(descKey)
 {
 }
@@ -62,7 +62,7 @@ CudaDevice Tensor::GetDevice() const
     return desc.GetDevice();
 }
 
-int Tensor::TensorDescriptorKey() const
+std::int64_t Tensor::TensorDescriptorKey() const
 {
     return m_tensorDescKey;
 }
@@ -91,6 +91,20 @@ void Tensor::ToHost() const
     desc.SetMode(ComputeMode::Host);
 }
 
+DataType Tensor::GetDataType() const
+{
+    Model& model = ModelManager::CurModel();
+    TensorUtil::TensorDescriptor& desc = model.GetDescriptor(m_tensorDescKey);
+    return desc.GetForwardData().GetDataType();
+}
+
+void Tensor::ConvertTo(DataType dataType) const
+{
+    Model& model = ModelManager::CurModel();
+    TensorUtil::TensorDescriptor& desc = model.GetDescriptor(m_tensorDescKey);
+    desc.ConvertForwardData(dataType);
+}
+
 ComputeMode Tensor::Mode() const
 {
     Model& model = ModelManager::CurModel();
@@ -164,6 +178,7 @@ void Tensor::LoadData(const std::vector<float>& data) const
 
     TensorUtil::TensorData tensorData = desc.GetForwardData();
     tensorData.SetData(data);
+    desc.MarkForwardDataWritten();
 }
 
 void Tensor::LoadGradient(const std::vector<float>& data) const
@@ -5,34 +5,145 @@
 // property of any third parties.
 
 #include <Sapphire/compute/cudaUtil/Memory.hpp>
-#include <Sapphire/compute/dense/cuda/Initialize.cuh>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/ReducedPrecision.hpp>
 #include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/util/MappedFile.hpp>
 #include <Sapphire/util/ResourceManager.hpp>
 #include <algorithm>
 #include <cstring>
 #include <stdexcept>
+#include <string>
+
+#ifdef WITH_CUDA
+#include <Sapphire/compute/dense/cuda/Basic.cuh>
+#include <Sapphire/compute/dense/cuda/Initialize.cuh>
+#endif
 
 namespace Sapphire::TensorUtil
 {
+namespace
+{
+std::vector<int> ContiguousStrides(const Shape& shape)
+{
+    std::vector<int> strides(shape.Dim());
+    int stride = 1;
+    for (int dim = shape.Dim() - 1; dim >= 0; --dim)
+    {
+        strides[dim] = stride;
+        stride *= shape.At(dim);
+    }
+    return strides;
+}
+
+//! Dimensions of size 1 can have any stride
+bool IsContiguousLayout(const std::vector<int>& shape,
+                        const std::vector<int>& strides)
+{
+    int expected = 1;
+    for (int dim = static_cast<int>(shape.size()) - 1; dim >= 0; --dim)
+    {
+        if (shape[dim] != 1 && strides[dim] != expected)
+            return false;
+        expected *= shape[dim];
+    }
+    return true;
+}
+
+//! Converts negative index counting from the last dimension
+int ToDimIndex(int dim, int numDims, const std::string& caller)
+{
+    if (dim < -numDims || dim >= numDims)
+        throw std::invalid_argument(
+            caller + " - Given dimension " + std::to_string(dim) +
+            " is out of range (Shape dimension : " + std::to_string(numDims) +
+            ")");
+    return dim < 0 ? numDims + dim : dim;
+}
+
+//! Copies each element of shape from src to dst following their strides
+void StridedCopy(float* dst, const std::vector<int>& dstStrides,
+                 const float* src, const std::vector<int>& srcStrides,
+                 const Shape& shape, ComputeMode mode)
+{
+    if (shape.Dim() > Compute::Dense::StridedLayout::MaxDim)
+        throw std::runtime_error(
+            "TensorData - Copying views with more than " +
+            std::to_string(Compute::Dense::StridedLayout::MaxDim) +
+            " dimensions is not supported");
+
+    Compute::Dense::StridedLayout layout;
+    layout.Dim = shape.Dim();
+    for (int dim = 0; dim < shape.Dim(); ++dim)
+    {
+        layout.Shape[dim] = shape.At(dim);
+        layout.DstStrides[dim] = dstStrides[dim];
+        layout.SrcStrides[dim] = srcStrides[dim];
+    }
+
+#ifdef WITH_CUDA
+    if (mode == ComputeMode::Cuda)
+        Compute::Dense::Cuda::StridedCopy(dst, src, layout, shape.Size());
+    else
+#endif
+        Compute::Dense::Naive::StridedCopy(dst, src, layout, shape.Size());
+}
+
+//! StridedCopy of 16 bit elements of Float16 and BFloat16 data on host
+void StridedCopyReduced(std::uint16_t* dst, const std::vector<int>& dstStrides,
+                        const std::uint16_t* src,
+                        const std::vector<int>& srcStrides, const Shape& shape)
+{
+    for (int idx = 0; idx < shape.Size(); ++idx)
+    {
+        std::size_t dstOffset = 0;
+        std::size_t srcOffset = 0;
+        int remaining = idx;
+        for (int dim = shape.Dim() - 1; dim >= 0; --dim)
+        {
+            const auto coordinate = remaining % shape.At(dim);
+            remaining /= shape.At(dim);
+            dstOffset += static_cast<std::size_t>(coordinate) * dstStrides[dim];
+            srcOffset += static_cast<std::size_t>(coordinate) * srcStrides[dim];
+        }
+        dst[dstOffset] = src[srcOffset];
+    }
+}
+} // namespace
+
 TensorData::TensorData(Shape shape, Type type, bool preserve)
     : m_shape(std::move(shape)),
       m_type(type),
       m_mode(ComputeMode::Host),
       m_preserve(preserve)
 {
+    m_setContiguousStrides();
     m_allocateHost();
 }
 
-TensorData::TensorData(Shape shape, Type type, int parentDescKey, bool preserve)
+TensorData::TensorData(Shape shape, Type type, std::int64_t parentDescKey,
+                       bool preserve)
     : m_shape(std::move(shape)),
       m_parentDescKey(parentDescKey),
       m_type(type),
       m_mode(ComputeMode::Host),
       m_preserve(preserve)
 {
+    m_setContiguousStrides();
     m_allocateHost();
 }
 
+TensorData::TensorData(Shape shape, Type type, DataType dataType,
+                       bool preserve)
+    : m_shape(std::move(shape)),
+      m_dataType(dataType),
+      m_type(type),
+      m_mode(ComputeMode::Host),
+      m_preserve(preserve)
+{
+    m_setContiguousStrides();
+    m_allocateHost();
+}
 
 TensorData::TensorData(Shape shape, Type type, CudaDevice device, bool preserve)
     : m_shape(std::move(shape)),
@@ -40,6 +151,7 @@ TensorData::TensorData(Shape shape, Type type, CudaDevice device, bool preserve)
       m_device(std::move(device)),
       m_preserve(preserve)
 {
+    m_setContiguousStrides();
     if (device.GetID() >= 0)
     {
         m_mode = ComputeMode::Cuda;
@@ -50,13 +162,14 @@ TensorData::TensorData(Shape shape, Type type, CudaDevice device, bool preserve)
 }
 
 TensorData::TensorData(Shape shape, Type type, CudaDevice device,
-                       int parentDescKey, bool preserve)
+                       std::int64_t parentDescKey, bool preserve)
     : m_shape(std::move(shape)),
       m_parentDescKey(parentDescKey),
       m_type(type),
       m_device(std::move(device)),
       m_preserve(preserve)
 {
+    m_setContiguousStrides();
     if (device.GetID() >= 0)
     {
         m_allocateCuda();
@@ -74,18 +187,25 @@ TensorData::TensorData(TensorData&& tensorData) noexcept
       SparseMatHost(tensorData.SparseMatHost),
       SparseMatCuda(tensorData.SparseMatCuda),
       m_shape(std::move(tensorData.m_shape)),
+      m_strides(std::move(tensorData.m_strides)),
+      m_offset(tensorData.m_offset),
+      m_storageSize(tensorData.m_storageSize),
       m_denseHost(tensorData.m_denseHost),
       m_denseCuda(tensorData.m_denseCuda),
+      m_reducedHost(tensorData.m_reducedHost),
+      m_dataType(tensorData.m_dataType),
       m_parentDescKey(tensorData.m_parentDescKey),
       m_type(tensorData.m_type),
       m_mode(tensorData.m_mode),
       m_device(std::move(tensorData.m_device)),
-      m_preserve(tensorData.m_preserve)
+      m_preserve(tensorData.m_preserve),
+      m_mappedFile(std::move(tensorData.m_mappedFile))
 {
     tensorData.HostTotalSize = 0;
     tensorData.SparseTotalLength = 0;
     tensorData.m_denseHost = nullptr;
     tensorData.m_denseCuda = nullptr;
+    tensorData.m_reducedHost = nullptr;
     tensorData.SparseMatHost = nullptr;
     tensorData.SparseMatCuda = nullptr;
 }
@@ -96,19 +216,26 @@ TensorData& TensorData::operator=(TensorData&& tensorData) noexcept
     SparseTotalLength = tensorData.SparseTotalLength;
     m_denseHost = tensorData.m_denseHost;
     m_denseCuda = tensorData.m_denseCuda;
+    m_reducedHost = tensorData.m_reducedHost;
+    m_dataType = tensorData.m_dataType;
     SparseMatHost = tensorData.SparseMatHost;
     SparseMatCuda = tensorData.SparseMatCuda;
     m_shape = std::move(tensorData.m_shape);
+    m_strides = std::move(tensorData.m_strides);
+    m_offset = tensorData.m_offset;
+    m_storageSize = tensorData.m_storageSize;
     m_parentDescKey = tensorData.m_parentDescKey;
     m_type = tensorData.m_type;
     m_mode = tensorData.m_mode;
     m_device = std::move(tensorData.m_device);
     m_preserve = tensorData.m_preserve;
+    m_mappedFile = std::move(tensorData.m_mappedFile);
 
     tensorData.HostTotalSize = 0;
     tensorData.SparseTotalLength = 0;
     tensorData.m_denseHost = nullptr;
     tensorData.m_denseCuda = nullptr;
+    tensorData.m_reducedHost = nullptr;
     tensorData.SparseMatHost = nullptr;
     tensorData.SparseMatCuda = nullptr;
 
@@ -124,15 +251,159 @@ void TensorData::Reshape(const Shape& shape)
             "size");
     }
 
-    if (m_mode == ComputeMode::Cuda)
-    {
-        m_shape = shape;
-    }
+    if (!IsContiguous())
+        throw std::runtime_error(
+            "TensorData::Reshape - Attempt to reshape view that is not "
+            "contiguous");
 
-    if (m_mode == ComputeMode::Host)
+    m_shape = shape;
+    m_setContiguousStrides();
+}
+
+TensorData TensorData::TransposeView() const
+{
+    auto shapeVector = m_shape.GetShapeVector();
+    auto strides = m_strides;
+    if (shapeVector.empty())
+        throw std::runtime_error(
+            "TensorData::TransposeView - Shape cannot be empty to perform "
+            "transpose");
+
+    if (shapeVector.size() == 1)
     {
-        m_shape = shape;
+        shapeVector.insert(shapeVector.begin(), 1);
+        strides.insert(strides.begin(), shapeVector[1] * strides[0]);
     }
+
+    const auto rowIdx = shapeVector.size() - 2;
+    std::swap(shapeVector[rowIdx], shapeVector[rowIdx + 1]);
+    std::swap(strides[rowIdx], strides[rowIdx + 1]);
+    return m_createView(Shape(shapeVector), strides, m_offset);
+}
+
+TensorData TensorData::NarrowView(int dim, int start, int length) const
+{
+    dim = ToDimIndex(dim, m_shape.Dim(), "TensorData::NarrowView");
+    if (start < 0 || length < 0 || start + length > m_shape.At(dim))
+        throw std::invalid_argument(
+            "TensorData::NarrowView - Range [" + std::to_string(start) + ", " +
+            std::to_string(start + length) + ") is out of range of dimension " +
+            std::to_string(dim) + " with size " +
+            std::to_string(m_shape.At(dim)));
+
+    auto shape = m_shape;
+    shape.Set(dim, length);
+    return m_createView(shape, m_strides,
+                        m_offset + static_cast<std::size_t>(start) *
+                        m_strides[dim]);
+}
+
+TensorData TensorData::ExpandView(int dim) const
+{
+    if (dim < 0)
+        throw std::invalid_argument(
+            "TensorData::ExpandView - Given dimension " + std::to_string(dim) +
+            " must be greater than zero");
+    if (dim <= m_shape.Dim())
+        return *this;
+
+    auto shape = m_shape;
+    shape.Expand(dim);
+    auto strides = m_strides;
+    strides.insert(strides.begin(), dim - m_shape.Dim(), m_shape.Size());
+    return m_createView(shape, strides, m_offset);
+}
+
+TensorData TensorData::SqueezeView(int dim) const
+{
+    dim = ToDimIndex(dim, m_shape.Dim(), "TensorData::SqueezeView");
+    if (m_shape.At(dim) != 1)
+        return *this;
+
+    auto shapeVector = m_shape.GetShapeVector();
+    auto strides = m_strides;
+    shapeVector.erase(shapeVector.begin() + dim);
+    strides.erase(strides.begin() + dim);
+    return m_createView(Shape(shapeVector), strides, m_offset);
+}
+
+TensorData TensorData::SqueezeView() const
+{
+    std::vector<int> shapeVector;
+    std::vector<int> strides;
+    for (int dim = 0; dim < m_shape.Dim(); ++dim)
+        if (m_shape.At(dim) != 1)
+        {
+            shapeVector.emplace_back(m_shape.At(dim));
+            strides.emplace_back(m_strides[dim]);
+        }
+    return m_createView(Shape(shapeVector), strides, m_offset);
+}
+
+TensorData TensorData::UnSqueezeView(int dim) const
+{
+    dim = ToDimIndex(dim, m_shape.Dim() + 1, "TensorData::UnSqueezeView");
+
+    auto shapeVector = m_shape.GetShapeVector();
+    auto strides = m_strides;
+    const int stride =
+        dim < m_shape.Dim() ? m_shape.At(dim) * m_strides[dim] : 1;
+    shapeVector.insert(shapeVector.begin() + dim, 1);
+    strides.insert(strides.begin() + dim, stride);
+    return m_createView(Shape(shapeVector), strides, m_offset);
+}
+
+TensorData TensorData::Contiguous() const
+{
+    if (IsContiguous())
+        return *this;
+    return CreateCopy();
+}
+
+bool TensorData::IsContiguous() const
+{
+    return IsContiguousLayout(m_shape.GetShapeVector(), m_strides);
+}
+
+TensorData TensorData::ContiguousFloat() const
+{
+    if (IsContiguousFloat())
+        return *this;
+    if (m_dataType == DataType::Float32)
+        return CreateCopy();
+    return ConvertTo(DataType::Float32);
+}
+
+bool TensorData::IsContiguousFloat() const
+{
+    return m_dataType == DataType::Float32 && IsContiguous();
+}
+
+TensorData TensorData::ConvertTo(DataType dataType, bool preserve) const
+{
+    if (m_mode != ComputeMode::Host)
+        throw std::runtime_error(
+            "TensorData::ConvertTo - Conversion is only available in host "
+            "mode");
+
+    TensorData tensorData(m_shape, m_type, dataType, preserve);
+    tensorData.m_parentDescKey = m_parentDescKey;
+    tensorData.m_device = m_device;
+    DeepCopy(tensorData, *this);
+    return tensorData;
+}
+
+bool TensorData::IsTransposed() const
+{
+    if (m_shape.Dim() < 2)
+        return false;
+
+    auto shapeVector = m_shape.GetShapeVector();
+    auto strides = m_strides;
+    const auto rowIdx = shapeVector.size() - 2;
+    std::swap(shapeVector[rowIdx], shapeVector[rowIdx + 1]);
+    std::swap(strides[rowIdx], strides[rowIdx + 1]);
+    return IsContiguousLayout(shapeVector, strides);
 }
 
 std::vector<float> TensorData::GetDataCopy()
@@ -142,8 +413,22 @@ std::vector<float> TensorData::GetDataCopy()
 
     auto dataPtr = std::vector<float>(m_shape.Size());
 
-    for (std::size_t i = 0; i < HostTotalSize; ++i)
-        dataPtr[i] = m_denseHost[i];
+    if (m_dataType != DataType::Float32)
+    {
+        const auto contiguous = Contiguous();
+        Compute::Dense::Naive::Convert(dataPtr.data(), DataType::Float32,
+                                       contiguous.HostReducedRawPtr(),
+                                       m_dataType, m_shape.Size());
+        return dataPtr;
+    }
+
+    if (IsContiguous())
+        std::memcpy(dataPtr.data(), m_denseHost + m_offset,
+                    dataPtr.size() * sizeof(float));
+    else
+        StridedCopy(dataPtr.data(), ContiguousStrides(m_shape),
+                    m_denseHost + m_offset, m_strides, m_shape,
+                    ComputeMode::Host);
 
     return dataPtr;
 }
@@ -159,19 +444,112 @@ void TensorData::SetData(std::vector<float> data)
             std::to_string(shape.Size()) + ")");
     }
 
+    if (m_dataType != DataType::Float32)
+    {
+        if (IsContiguous())
+        {
+            Compute::Dense::Naive::Convert(HostReducedMutableRawPtr(),
+                                           m_dataType, data.data(),
+                                           DataType::Float32, shape.Size());
+            return;
+        }
+
+        //! Data is given in row major order of the view
+        TensorData buffer(m_shape, m_type, m_dataType);
+        Compute::Dense::Naive::Convert(buffer.HostReducedMutableRawPtr(),
+                                       m_dataType, data.data(),
+                                       DataType::Float32, shape.Size());
+        StridedCopyReduced(HostReducedMutableRawPtr(), m_strides,
+                           buffer.HostReducedRawPtr(), buffer.m_strides,
+                           m_shape);
+        return;
+    }
+
+    if (!IsContiguous())
+    {
+        //! Data is given in row major order of the view
+        TensorData buffer(m_shape, m_type, m_device);
+        buffer.SetMode(m_mode);
+        buffer.SetData(std::move(data));
+        const auto* bufferPtr = m_mode == ComputeMode::Cuda
+                                    ? buffer.CudaRawPtr()
+                                    : buffer.HostRawPtr();
+        auto* ptr = m_mode == ComputeMode::Cuda
+                        ? CudaMutableRawPtr()
+                        : HostMutableRawPtr();
+        StridedCopy(ptr, m_strides, bufferPtr, buffer.m_strides, m_shape,
+                    m_mode);
+        return;
+    }
+
     if (m_mode == ComputeMode::Cuda)
     {
-        Compute::Cuda::CopyHostToDevice(m_denseCuda, &data.front(),
+        Compute::Cuda::CopyHostToDevice(m_denseCuda + m_offset, &data.front(),
                                         sizeof(float) * shape.Size());
     }
 
     if (m_mode == ComputeMode::Host)
     {
-        for (std::size_t i = 0; i < HostTotalSize; ++i)
-            m_denseHost[i] = data.at(i);
+        std::memcpy(m_denseHost + m_offset, data.data(),
+                    sizeof(float) * shape.Size());
     }
 }
 
+void TensorData::MapHostData(std::shared_ptr<Util::MappedFile> mappedFile,
+                             std::size_t byteOffset)
+{
+    if (m_type == Type::Sparse)
+        throw std::runtime_error(
+            "TensorData::MapHostData - Sparse matrix not implemented");
+    if (m_offset != 0 || m_storageSize != static_cast<std::size_t>(Size()))
+        throw std::invalid_argument(
+            "TensorData::MapHostData - Cannot map data of a view");
+    if (!mappedFile || mappedFile->Mode() !=
+        Util::MappedFile::MapMode::CopyOnWrite)
+        throw std::invalid_argument(
+            "TensorData::MapHostData - File must be mapped as copy-on-write");
+
+    const auto byteSize = m_shape.Size() * DataTypeSize(m_dataType);
+    if (byteOffset % DataTypeSize(m_dataType) != 0 ||
+        byteOffset + byteSize > mappedFile->Size())
+        throw std::invalid_argument(
+            "TensorData::MapHostData - Region at offset (" +
+            std::to_string(byteOffset) + ") with size (" +
+            std::to_string(byteSize) + ") is not a valid region of the file");
+
+    //! Memory allocated before stays in its pool until the pool is cleared,
+    //! since shallow copies made before mapping may still refer to it
+    auto* data = mappedFile->MutableData() + byteOffset;
+    if (m_dataType == DataType::Float32)
+        m_denseHost = reinterpret_cast<float*>(data);
+    else
+        m_reducedHost = reinterpret_cast<std::uint16_t*>(data);
+    HostTotalSize = m_shape.Size();
+    m_mappedFile = std::move(mappedFile);
+
+    if (m_mode == ComputeMode::Cuda)
+        m_toCuda();
+}
+
+void TensorData::ReleaseMemory()
+{
+    if (m_preserve)
+        return;
+
+    if (m_denseHost && !m_mappedFile)
+        Util::ResourceManager::FreeVolatileHost(m_denseHost);
+    if (m_reducedHost && !m_mappedFile)
+        Util::ResourceManager::FreeVolatileHost(m_reducedHost);
+    if (m_denseCuda)
+        Util::ResourceManager::FreeVolatileCuda(m_denseCuda);
+
+    m_denseHost = nullptr;
+    m_reducedHost = nullptr;
+    m_denseCuda = nullptr;
+    HostTotalSize = 0;
+    DenseTotalLengthCuda = 0;
+}
+
 void TensorData::SetDevice(CudaDevice device)
 {
     if (device != m_device)
@@ -201,6 +579,9 @@ int TensorData::GetUnitSize(int requiredDim) const
 
 TensorData TensorData::CreateCopy() const
 {
+    if (m_dataType != DataType::Float32)
+        return ConvertTo(m_dataType);
+
     TensorData tensorData(m_shape, GetType(), GetCudaDevice(), m_parentDescKey);
     tensorData.SetMode(m_mode);
 
@@ -210,8 +591,14 @@ TensorData TensorData::CreateCopy() const
 
 void TensorData::SetMode(ComputeMode type)
 {
+    if (type == ComputeMode::Cuda && m_dataType != DataType::Float32)
+        throw std::runtime_error(
+            "TensorData::SetMode - " + DataTypeToString(m_dataType) +
+            " data is only available on host");
+
     m_mode = type;
-    if (m_mode == ComputeMode::Host && m_denseHost == nullptr)
+    if (m_mode == ComputeMode::Host && m_denseHost == nullptr &&
+        m_reducedHost == nullptr)
         m_allocateHost();
     if (m_mode == ComputeMode::Cuda && m_denseCuda == nullptr)
     {
@@ -256,22 +643,66 @@ void TensorData::DeepCopy(TensorData& dst, const TensorData& src)
         throw std::invalid_argument(
             "DeepCopy - size of dst must be multiple of src");
 
+    if (!dst.IsContiguous())
+        throw std::invalid_argument("DeepCopy - dst must be contiguous");
+
     const auto mode = dst.Mode();
     const auto matrixType = dst.GetType();
+    const auto srcStrides = ContiguousStrides(src.GetShape());
+
+    if (dst.m_dataType != DataType::Float32 ||
+        src.m_dataType != DataType::Float32)
+    {
+        if (mode != ComputeMode::Host)
+            throw std::invalid_argument(
+                "DeepCopy - Reduced precision data is only available on host");
+
+        //! Views are gathered in their own type before conversion
+        if (dst.m_dataType != src.m_dataType && !src.IsContiguous())
+        {
+            DeepCopy(dst, src.CreateCopy());
+            return;
+        }
+
+        const auto byteSize = DataTypeSize(dst.m_dataType) * src.Size();
+        for (int i = 0; i < dst.Size() / src.Size(); ++i)
+        {
+            auto* dstPtr =
+                static_cast<char*>(dst.HostMutableRawData()) + byteSize * i;
+            if (dst.m_dataType != src.m_dataType)
+                Compute::Dense::Naive::Convert(dstPtr, dst.m_dataType,
+                                               src.HostRawData(),
+                                               src.m_dataType, src.Size());
+            else if (src.IsContiguous())
+                std::memcpy(dstPtr, src.HostRawData(), byteSize);
+            else
+                StridedCopyReduced(reinterpret_cast<std::uint16_t*>(dstPtr),
+                                   srcStrides, src.HostReducedRawPtr(),
+                                   src.m_strides, src.m_shape);
+        }
+        return;
+    }
 
     for (int i = 0; i < dst.Size() / src.Size(); ++i)
         if (mode == ComputeMode::Cuda && matrixType == Type::Dense)
         {
-            auto* dstPtr = dst.m_denseCuda + src.Size() * i;
-            Compute::Cuda::CopyDeviceToDevice(
-                dstPtr, src.m_denseCuda,
-                dst.DenseTotalLengthCuda * sizeof(float));
+            auto* dstPtr = dst.CudaMutableRawPtr() + src.Size() * i;
+            if (src.IsContiguous())
+                Compute::Cuda::CopyDeviceToDevice(
+                    dstPtr, src.CudaRawPtr(), src.Size() * sizeof(float));
+            else
+                StridedCopy(dstPtr, srcStrides, src.CudaRawPtr(),
+                            src.m_strides, src.m_shape, mode);
         }
         else if (mode == ComputeMode::Host && matrixType == Type::Dense)
         {
-            auto* dstPtr = dst.m_denseHost + src.Size() * i;
-            std::memcpy(dstPtr, src.m_denseHost,
-                        dst.HostTotalSize * sizeof(float));
+            auto* dstPtr = dst.HostMutableRawPtr() + src.Size() * i;
+            if (src.IsContiguous())
+                std::memcpy(dstPtr, src.HostRawPtr(),
+                            src.Size() * sizeof(float));
+            else
+                StridedCopy(dstPtr, srcStrides, src.HostRawPtr(),
+                            src.m_strides, src.m_shape, mode);
         }
         else if (mode == ComputeMode::Cuda && matrixType == Type::Sparse)
             throw std::runtime_error(
@@ -293,7 +724,7 @@ void TensorData::m_toCuda()
         m_allocateCuda();
 
     Compute::Cuda::CopyHostToDevice(m_denseCuda, m_denseHost,
-                                    HostTotalSize * sizeof(float));
+                                    m_storageSize * sizeof(float));
 }
 
 void TensorData::m_toHost()
@@ -308,7 +739,7 @@ void TensorData::m_toHost()
         m_allocateHost();
 
     Compute::Cuda::CopyDeviceToHost(m_denseHost, m_denseCuda,
-                                    HostTotalSize * sizeof(float));
+                                    m_storageSize * sizeof(float));
 }
 
 void TensorData::m_allocateHost()
@@ -316,18 +747,20 @@ void TensorData::m_allocateHost()
     if (m_type == Type::Sparse)
         throw std::runtime_error("m_allocate - Sparse not implemented");
 
-    HostTotalSize = m_shape.Size();
+    HostTotalSize = m_storageSize;
+    const auto byteSize = HostTotalSize * DataTypeSize(m_dataType);
 
+    void* memory;
     if (m_preserve)
-        m_denseHost = static_cast<float*>(
-            Util::ResourceManager::GetMemoryHost(
-                HostTotalSize * sizeof(float), true));
+        memory = Util::ResourceManager::GetMemoryHost(byteSize, true);
     else
-        m_denseHost = static_cast<float*>(
-            Util::ResourceManager::GetMemoryHost(
-                HostTotalSize * sizeof(float)));
+        memory = Util::ResourceManager::GetMemoryHost(byteSize);
 
-    std::memset(m_denseHost, 0, HostTotalSize * sizeof(float));
+    std::memset(memory, 0, byteSize);
+    if (m_dataType == DataType::Float32)
+        m_denseHost = static_cast<float*>(memory);
+    else
+        m_reducedHost = static_cast<std::uint16_t*>(memory);
 }
 
 void TensorData::m_allocateCuda()
@@ -337,7 +770,7 @@ void TensorData::m_allocateCuda()
         throw std::runtime_error("m_allocate - Sparse not implemented");
     }
 
-    const unsigned long totalSize = m_shape.Size();
+    const unsigned long totalSize = m_storageSize;
 
     if (m_preserve)
     {
@@ -351,6 +784,29 @@ void TensorData::m_allocateCuda()
                 totalSize * sizeof(float)));
     DenseTotalLengthCuda = totalSize;
 
+#ifdef WITH_CUDA
     Compute::Dense::Cuda::Scalar(m_denseCuda, 0.0f, DenseTotalLengthCuda);
+#endif
+}
+
+void TensorData::m_setContiguousStrides()
+{
+    m_strides = ContiguousStrides(m_shape);
+    if (m_storageSize == 0)
+        m_storageSize = m_shape.Size();
+}
+
+TensorData TensorData::m_createView(Shape shape, std::vector<int> strides,
+                                    std::size_t offset) const
+{
+    if (m_type == Type::Sparse)
+        throw std::runtime_error(
+            "TensorData::m_createView - Sparse matrix not implemented");
+
+    TensorData view(*this);
+    view.m_shape = std::move(shape);
+    view.m_strides = std::move(strides);
+    view.m_offset = offset;
+    return view;
 }
 } // namespace Sapphire::TensorUtil
@@ -9,7 +9,8 @@
 
 namespace Sapphire::TensorUtil
 {
-TensorDescriptor::TensorDescriptor(const Shape& shape, Type type, int key,
+TensorDescriptor::TensorDescriptor(const Shape& shape, Type type,
+                                   std::int64_t key,
                                    bool preserve)
     : m_forwardData(shape, type, key, preserve),
       m_backwardData(shape, type, key, preserve),
@@ -20,7 +21,7 @@ TensorDescriptor::TensorDescriptor(const Shape& shape, Type type, int key,
 
 TensorDescriptor::TensorDescriptor(const Shape& shape, Type type,
                                    const CudaDevice& device,
-                                   int key, bool preserve)
+                                   std::int64_t key, bool preserve)
     : m_forwardData(shape, type, device, key, preserve),
       m_backwardData(shape, type, device, key, preserve),
       m_key(key),
@@ -32,6 +33,7 @@ TensorDescriptor::TensorDescriptor(TensorDescriptor&& tensorData) noexcept
     : m_forwardData(std::move(tensorData.m_forwardData)),
       m_backwardData(std::move(tensorData.m_backwardData)),
       m_key(tensorData.m_key),
+      m_forwardDataVersion(tensorData.m_forwardDataVersion.load()),
       m_batchSize(tensorData.m_batchSize),
       m_trainable(tensorData.m_trainable),
       m_history(std::move(tensorData.m_history))
@@ -44,6 +46,7 @@ TensorDescriptor& TensorDescriptor::operator=(
     m_forwardData = tensorDesc.m_forwardData;
     m_backwardData = tensorDesc.m_backwardData;
     m_key = tensorDesc.m_key;
+    m_forwardDataVersion = tensorDesc.m_forwardDataVersion.load();
     m_batchSize = tensorDesc.m_batchSize;
     m_trainable = tensorDesc.m_trainable;
     m_history = std::move(tensorDesc.m_history);
@@ -99,6 +102,22 @@ void TensorDescriptor::Reshape(Shape shape)
     m_backwardData.Reshape(shape);
 }
 
+void TensorDescriptor::MapForwardData(
+    std::shared_ptr<Util::MappedFile> mappedFile, std::size_t byteOffset)
+{
+    m_forwardData.MapHostData(std::move(mappedFile), byteOffset);
+    MarkForwardDataWritten();
+}
+
+void TensorDescriptor::ConvertForwardData(DataType dataType)
+{
+    if (m_forwardData.GetDataType() == dataType)
+        return;
+    m_forwardData =
+        m_forwardData.ConvertTo(dataType, m_forwardData.IsPreserved());
+    MarkForwardDataWritten();
+}
+
 void TensorDescriptor::ToCuda()
 {
     m_forwardData.ToCuda();
@@ -130,14 +149,20 @@ void TensorDescriptor::InitGradient()
     zeroInitializer(m_backwardData);
 }
 
+void TensorDescriptor::ReleaseMemory()
+{
+    m_forwardData.ReleaseMemory();
+    m_backwardData.ReleaseMemory();
+}
+
 void TensorDescriptor::AppendOutputHistory(
-    int backPropWrapperKey,
+    std::int64_t backPropWrapperKey,
     int location)
 {
     m_history.emplace_back(History(backPropWrapperKey, location));
 }
 
-void TensorDescriptor::AppendOperandHistory(int tensorDescKey)
+void TensorDescriptor::AppendOperandHistory(std::int64_t tensorDescKey)
 {
     if (m_history.empty() || m_history.back().IsOutput)
     {
@@ -150,7 +175,7 @@ void TensorDescriptor::AppendOperandHistory(int tensorDescKey)
     m_history.back().AddOperand(tensorDescKey);
 }
 
-void TensorDescriptor::RemoveOperand(int tensorDescKey)
+void TensorDescriptor::RemoveOperand(std::int64_t tensorDescKey)
 {
     if (m_history.empty() || m_history.back().IsOutput)
     {
@@ -0,0 +1,433 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/Checkpoint.hpp>
+#include <Sapphire/compute/cudaUtil/Memory.hpp>
+#include <Sapphire/Model.hpp>
+#include <cstring>
+#include <fstream>
+
+namespace Sapphire::Util
+{
+namespace
+{
+constexpr char CheckpointMagic[8] = "SPHRCKP";
+constexpr std::uint32_t CheckpointVersion = 1;
+//! Size of the stream buffer used for writing
+constexpr std::size_t WriteBufferSize = 1 << 20;
+
+std::uint64_t AlignUp(std::uint64_t offset)
+{
+    return (offset + CheckpointAlignment - 1) / CheckpointAlignment *
+           CheckpointAlignment;
+}
+
+template <typename T>
+void AppendValue(std::vector<char>& buffer, T value)
+{
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+//! Reads value from the index and advances offset
+//! Throws if the value exceeds the index
+template <typename T>
+T ReadValue(const char* index, std::size_t indexSize, std::size_t& offset)
+{
+    if (offset + sizeof(T) > indexSize)
+        throw std::runtime_error(
+            "Util::CheckpointReader - Checkpoint index is corrupted");
+    T value;
+    std::memcpy(&value, index + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+CheckpointDataType ToCheckpointDataType(DataType dataType)
+{
+    switch (dataType)
+    {
+        case DataType::Float16:
+            return CheckpointDataType::Float16;
+        case DataType::BFloat16:
+            return CheckpointDataType::BFloat16;
+        default:
+            return CheckpointDataType::Float32;
+    }
+}
+
+DataType ToDataType(CheckpointDataType dataType)
+{
+    switch (dataType)
+    {
+        case CheckpointDataType::Float16:
+            return DataType::Float16;
+        case CheckpointDataType::BFloat16:
+            return DataType::BFloat16;
+        default:
+            return DataType::Float32;
+    }
+}
+
+bool IsValidDataType(CheckpointDataType dataType)
+{
+    return dataType == CheckpointDataType::Float32 ||
+           dataType == CheckpointDataType::Float16 ||
+           dataType == CheckpointDataType::BFloat16;
+}
+
+std::string OptimizerStateName(const std::string& name)
+{
+    return "Optimizer/" + name;
+}
+
+//! Calls func(name, tensor) for trainable tensors and buffers of the unit
+template <typename Func>
+void ForEachTensor(const Unit* unit, Func func)
+{
+    for (const auto& [tensorName, tensor] : unit->GetTrainableTensors())
+        func(unit->GetName() + "/" + tensorName, tensor);
+    for (const auto& [tensorName, tensor] : unit->GetBufferTensors())
+        func(unit->GetName() + "/" + tensorName, tensor);
+}
+} // namespace
+
+void CheckpointWriter::Add(std::string name, TensorUtil::TensorData tensorData)
+{
+    Pending pending;
+    pending.Name = std::move(name);
+    pending.TensorShape = tensorData.GetShape();
+    pending.StoredType = tensorData.GetDataType();
+    pending.TensorData = std::move(tensorData);
+    m_pending.emplace_back(std::move(pending));
+}
+
+void CheckpointWriter::Add(std::string name, Shape shape,
+                           std::vector<float> data)
+{
+    if (static_cast<std::size_t>(shape.Size()) != data.size())
+        throw std::invalid_argument(
+            "Util::CheckpointWriter::Add - Size of the data (" +
+            std::to_string(data.size()) + ") does not match shape (" +
+            shape.ToString() + ")");
+    Pending pending;
+    pending.Name = std::move(name);
+    pending.TensorShape = std::move(shape);
+    pending.Data = std::move(data);
+    pending.Owned = true;
+    m_pending.emplace_back(std::move(pending));
+}
+
+void CheckpointWriter::Write(const std::filesystem::path& filePath) const
+{
+    //! Offsets of the payloads depend on the size of the index, which does
+    //! not depend on the offsets since they have fixed size
+    std::vector<char> index;
+    std::vector<std::size_t> offsetPositions;
+    std::vector<std::uint64_t> byteSizes;
+    for (const auto& pending : m_pending)
+    {
+        const auto shapeVector = pending.TensorShape.GetShapeVector();
+        byteSizes.emplace_back(pending.TensorShape.Size() *
+                               DataTypeSize(pending.StoredType));
+        AppendValue(index, static_cast<std::uint32_t>(pending.Name.size()));
+        index.insert(index.end(), pending.Name.begin(), pending.Name.end());
+        AppendValue(index, static_cast<std::uint32_t>(
+                        ToCheckpointDataType(pending.StoredType)));
+        AppendValue(index, static_cast<std::uint32_t>(shapeVector.size()));
+        for (const auto dim : shapeVector)
+            AppendValue(index, static_cast<std::int32_t>(dim));
+        offsetPositions.emplace_back(index.size());
+        AppendValue(index, std::uint64_t{ 0 });
+        AppendValue(index, byteSizes.back());
+    }
+
+    CheckpointHeader header{};
+    std::memcpy(header.Magic, CheckpointMagic, sizeof(header.Magic));
+    header.Version = CheckpointVersion;
+    header.NumEntries = static_cast<std::uint32_t>(m_pending.size());
+    header.IndexOffset = sizeof(CheckpointHeader);
+    header.IndexSize = index.size();
+    header.PayloadOffset = AlignUp(header.IndexOffset + header.IndexSize);
+
+    std::vector<std::uint64_t> offsets(m_pending.size());
+    auto offset = header.PayloadOffset;
+    for (std::size_t i = 0; i < m_pending.size(); ++i)
+    {
+        offsets[i] = offset;
+        std::memcpy(index.data() + offsetPositions[i], &offset,
+                    sizeof(offset));
+        offset = AlignUp(offset + byteSizes[i]);
+    }
+    header.FileSize = offset;
+
+    auto tempPath = filePath;
+    tempPath += ".tmp";
+    {
+        std::vector<char> streamBuffer(WriteBufferSize);
+        std::ofstream file;
+        file.rdbuf()->pubsetbuf(streamBuffer.data(),
+                                static_cast<std::streamsize>(
+                                    streamBuffer.size()));
+        file.open(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            throw std::runtime_error(
+                "Util::CheckpointWriter::Write - Could not open file (" +
+                tempPath.string() + ")");
+
+        const char padding[CheckpointAlignment] = {};
+        std::uint64_t position = 0;
+        auto write = [&file, &position](const void* data, std::size_t size) {
+            file.write(static_cast<const char*>(data),
+                       static_cast<std::streamsize>(size));
+            position += size;
+        };
+        auto pad = [&write, &position, &padding](std::uint64_t target) {
+            write(padding, target - position);
+        };
+
+        write(&header, sizeof(header));
+        write(index.data(), index.size());
+        for (std::size_t i = 0; i < m_pending.size(); ++i)
+        {
+            pad(offsets[i]);
+            const auto& pending = m_pending[i];
+            const auto byteSize = byteSizes[i];
+            if (pending.Owned)
+                write(pending.Data.data(), byteSize);
+            else if (pending.TensorData.Mode() == ComputeMode::Host &&
+                     pending.TensorData.IsContiguous())
+                write(pending.TensorData.HostRawData(), byteSize);
+            else if (pending.TensorData.Mode() == ComputeMode::Host)
+            {
+                //! Views are gathered in row major order of the view
+                auto contiguous = pending.TensorData.Contiguous();
+                write(contiguous.HostRawData(), byteSize);
+                contiguous.ReleaseMemory();
+            }
+            else
+            {
+                auto tensorData = pending.TensorData;
+                const auto data = tensorData.GetDataCopy();
+                write(data.data(), byteSize);
+            }
+        }
+        pad(header.FileSize);
+
+        if (!file.good())
+            throw std::runtime_error(
+                "Util::CheckpointWriter::Write - Failed to write file (" +
+                tempPath.string() + ")");
+    }
+    std::filesystem::rename(tempPath, filePath);
+}
+
+CheckpointReader::CheckpointReader(const std::filesystem::path& filePath)
+    : m_filePath(filePath),
+      m_file(std::make_shared<MappedFile>(
+          filePath, MappedFile::MapMode::CopyOnWrite))
+{
+    CheckpointHeader header{};
+    if (m_file->Size() < sizeof(header))
+        throw std::runtime_error(
+            "Util::CheckpointReader - File is too small to be a checkpoint (" +
+            filePath.string() + ")");
+    std::memcpy(&header, m_file->Data(), sizeof(header));
+    if (std::memcmp(header.Magic, CheckpointMagic, sizeof(header.Magic)) != 0)
+        throw std::runtime_error(
+            "Util::CheckpointReader - File is not a checkpoint (" +
+            filePath.string() + ")");
+    if (header.Version != CheckpointVersion)
+        throw std::runtime_error(
+            "Util::CheckpointReader - Unsupported checkpoint version (" +
+            std::to_string(header.Version) + ")");
+    if (header.FileSize != m_file->Size() ||
+        header.IndexOffset + header.IndexSize > m_file->Size())
+        throw std::runtime_error(
+            "Util::CheckpointReader - Checkpoint is truncated (" +
+            filePath.string() + ")");
+
+    const auto* index = m_file->Data() + header.IndexOffset;
+    const auto indexSize = static_cast<std::size_t>(header.IndexSize);
+    std::size_t offset = 0;
+    m_entries.reserve(header.NumEntries);
+    for (std::uint32_t i = 0; i < header.NumEntries; ++i)
+    {
+        CheckpointEntry entry;
+        const auto nameSize = ReadValue<std::uint32_t>(index, indexSize,
+                                                       offset);
+        if (offset + nameSize > indexSize)
+            throw std::runtime_error(
+                "Util::CheckpointReader - Checkpoint index is corrupted");
+        entry.Name.assign(index + offset, nameSize);
+        offset += nameSize;
+
+        entry.DataType = static_cast<CheckpointDataType>(
+            ReadValue<std::uint32_t>(index, indexSize, offset));
+        const auto rank = ReadValue<std::uint32_t>(index, indexSize, offset);
+        std::vector<int> shapeVector(rank);
+        for (auto& dim : shapeVector)
+            dim = ReadValue<std::int32_t>(index, indexSize, offset);
+        entry.TensorShape = Shape(shapeVector);
+        entry.Offset = ReadValue<std::uint64_t>(index, indexSize, offset);
+        entry.ByteSize = ReadValue<std::uint64_t>(index, indexSize, offset);
+
+        if (!IsValidDataType(entry.DataType) ||
+            entry.ByteSize != entry.TensorShape.Size() *
+            DataTypeSize(ToDataType(entry.DataType)) ||
+            entry.Offset % CheckpointAlignment != 0 ||
+            entry.Offset + entry.ByteSize > m_file->Size())
+            throw std::runtime_error(
+                "Util::CheckpointReader - Invalid entry (" + entry.Name +
+                ") in checkpoint (" + filePath.string() + ")");
+
+        m_entryMap[entry.Name] = m_entries.size();
+        m_entries.emplace_back(std::move(entry));
+    }
+}
+
+bool CheckpointReader::Contains(const std::string& name) const
+{
+    return m_entryMap.find(name) != m_entryMap.end();
+}
+
+const CheckpointEntry& CheckpointReader::GetEntry(
+    const std::string& name) const
+{
+    const auto it = m_entryMap.find(name);
+    if (it == m_entryMap.end())
+        throw std::invalid_argument(
+            "Util::CheckpointReader::GetEntry - Tensor (" + name +
+            ") does not exist in checkpoint (" + m_filePath.string() + ")");
+    return m_entries[it->second];
+}
+
+const float* CheckpointReader::Data(const std::string& name) const
+{
+    const auto& entry = GetEntry(name);
+    if (entry.DataType != CheckpointDataType::Float32)
+        throw std::invalid_argument(
+            "Util::CheckpointReader::Data - Tensor (" + name +
+            ") is stored in " + DataTypeToString(ToDataType(entry.DataType)));
+    return reinterpret_cast<const float*>(m_file->Data() + entry.Offset);
+}
+
+void CheckpointReader::Load(const std::string& name,
+                            TensorUtil::TensorData& tensorData) const
+{
+    const auto& entry = GetEntry(name);
+    if (tensorData.GetShape() != entry.TensorShape)
+        throw std::invalid_argument(
+            "Util::CheckpointReader::Load - Shape of tensor (" + name + ") " +
+            tensorData.GetShape().ToString() +
+            " does not match shape in checkpoint " +
+            entry.TensorShape.ToString());
+
+    const auto storedType = ToDataType(entry.DataType);
+    const auto* payload = m_file->Data() + entry.Offset;
+    if (tensorData.IsContiguous() && tensorData.GetDataType() == storedType)
+    {
+        if (tensorData.Mode() == ComputeMode::Host)
+            std::memcpy(tensorData.HostMutableRawData(), payload,
+                        entry.ByteSize);
+        else
+            Compute::Cuda::CopyHostToDevice(
+                tensorData.CudaMutableRawPtr(),
+                reinterpret_cast<float*>(const_cast<char*>(payload)),
+                static_cast<unsigned int>(entry.ByteSize));
+        return;
+    }
+
+    //! Payloads are converted, or scattered to the view, through Float32
+    TensorUtil::TensorData stored(entry.TensorShape, Type::Dense, storedType);
+    std::memcpy(stored.HostMutableRawData(), payload, entry.ByteSize);
+    tensorData.SetData(stored.GetDataCopy());
+    stored.ReleaseMemory();
+}
+
+void CheckpointReader::Map(const std::string& name,
+                           TensorUtil::TensorDescriptor& descriptor) const
+{
+    const auto& entry = GetEntry(name);
+    if (descriptor.GetShape() != entry.TensorShape)
+        throw std::invalid_argument(
+            "Util::CheckpointReader::Map - Shape of tensor (" + name + ") " +
+            descriptor.GetShape().ToString() +
+            " does not match shape in checkpoint " +
+            entry.TensorShape.ToString());
+    const auto dataType = descriptor.GetForwardData().GetDataType();
+    if (dataType != ToDataType(entry.DataType))
+        throw std::invalid_argument(
+            "Util::CheckpointReader::Map - Data type of tensor (" + name +
+            ") " + DataTypeToString(dataType) +
+            " does not match data type in checkpoint " +
+            DataTypeToString(ToDataType(entry.DataType)));
+    descriptor.MapForwardData(m_file, entry.Offset);
+}
+
+void SaveCheckpoint(const std::filesystem::path& filePath,
+                    const std::vector<const Unit*>& units,
+                    const Optimizer::Optimizer* optimizer)
+{
+    auto& model = ModelManager::CurModel();
+    CheckpointWriter writer;
+    for (const auto* unit : units)
+        ForEachTensor(unit, [&](std::string name, const Tensor& tensor) {
+            writer.Add(std::move(name),
+                       model.GetDescriptor(tensor.TensorDescriptorKey())
+                            .GetForwardData());
+        });
+
+    if (optimizer)
+        for (auto& [stateName, state] : optimizer->GetState())
+        {
+            const auto size = static_cast<int>(state.size());
+            writer.Add(OptimizerStateName(stateName), Shape({ size }),
+                       std::move(state));
+        }
+
+    writer.Write(filePath);
+}
+
+void LoadCheckpoint(const std::filesystem::path& filePath,
+                    const std::vector<Unit*>& units,
+                    Optimizer::Optimizer* optimizer)
+{
+    auto& model = ModelManager::CurModel();
+    const CheckpointReader reader(filePath);
+    for (const auto* unit : units)
+        ForEachTensor(unit, [&](const std::string& name,
+                                const Tensor& tensor) {
+            auto& descriptor = model.GetDescriptor(
+                tensor.TensorDescriptorKey());
+            auto tensorData = descriptor.GetForwardData();
+            reader.Load(name, tensorData);
+            descriptor.MarkForwardDataWritten();
+        });
+
+    if (optimizer)
+    {
+        const std::string prefix = OptimizerStateName("");
+        for (const auto& entry : reader.Entries())
+            if (entry.Name.compare(0, prefix.size(), prefix) == 0)
+                optimizer->SetState(entry.Name.substr(prefix.size()),
+                                    reader.Data(entry.Name),
+                                    entry.ByteSize / sizeof(float));
+    }
+}
+
+void MapCheckpoint(const std::filesystem::path& filePath,
+                   const std::vector<Unit*>& units)
+{
+    auto& model = ModelManager::CurModel();
+    const CheckpointReader reader(filePath);
+    for (const auto* unit : units)
+        ForEachTensor(unit, [&](const std::string& name,
+                                const Tensor& tensor) {
+            reader.Map(name, model.GetDescriptor(tensor.TensorDescriptorKey()));
+        });
+}
+} // namespace Sapphire::Util
@@ -0,0 +1,216 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/CpuFeatures.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define SAPPHIRE_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Sapphire::Util
+{
+namespace
+{
+#ifdef SAPPHIRE_X86
+void CpuId(unsigned int leaf, unsigned int subLeaf, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subLeaf));
+    for (int i = 0; i < 4; ++i)
+        regs[i] = static_cast<unsigned int>(info[i]);
+#else
+    if (!__get_cpuid_count(leaf, subLeaf, &regs[0], &regs[1], &regs[2],
+                           &regs[3]))
+        regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#endif
+}
+
+//! Reads XCR0, which tells register states saved by the OS
+//! Must only be called if OSXSAVE is set
+std::uint64_t ReadXcr0()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int eax = 0, edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+CpuFeatures DetectFeatures()
+{
+    CpuFeatures features;
+#ifdef SAPPHIRE_X86
+    unsigned int regs[4] = { 0, 0, 0, 0 };
+    CpuId(0, 0, regs);
+    const auto maxLeaf = regs[0];
+    if (maxLeaf < 1)
+        return features;
+
+    CpuId(1, 0, regs);
+    const bool osXSave = (regs[2] >> 27) & 1;
+    features.Avx = (regs[2] >> 28) & 1;
+    features.Fma = (regs[2] >> 12) & 1;
+    features.F16c = (regs[2] >> 29) & 1;
+
+    if (osXSave)
+    {
+        const auto xcr0 = ReadXcr0();
+        //! SSE and AVX state
+        features.OsYmm = (xcr0 & 0x6) == 0x6;
+        //! Opmask, upper halves of ZMM0-15 and ZMM16-31 in addition to YMM
+        features.OsZmm = (xcr0 & 0xE6) == 0xE6;
+    }
+
+    if (maxLeaf >= 7)
+    {
+        CpuId(7, 0, regs);
+        features.Avx2 = (regs[1] >> 5) & 1;
+        features.Avx512F = (regs[1] >> 16) & 1;
+        features.Avx512Vnni = (regs[2] >> 11) & 1;
+        const auto maxSubLeaf = regs[0];
+
+        if (maxSubLeaf >= 1)
+        {
+            CpuId(7, 1, regs);
+            features.Avx512Bf16 = (regs[0] >> 5) & 1;
+        }
+    }
+#endif
+    return features;
+}
+
+SimdLevel ResolveLevel()
+{
+    const auto available =
+        std::min(CpuFeatures::Host().SupportedLevel(), CompiledSimdLevel());
+
+    const char* requested = std::getenv("SAPPHIRE_SIMD_LEVEL");
+    if (requested == nullptr || *requested == '\0')
+        return available;
+
+    SimdLevel level;
+    try
+    {
+        level = SimdLevelFromString(requested);
+    }
+    catch (const std::invalid_argument&)
+    {
+        std::cerr << "SAPPHIRE_SIMD_LEVEL - Unknown level (" << requested
+                  << "). Using " << SimdLevelToString(available) << std::endl;
+        return available;
+    }
+
+    if (level > available)
+    {
+        std::cerr << "SAPPHIRE_SIMD_LEVEL - " << SimdLevelToString(level)
+                  << " is not available on this machine. Using "
+                  << SimdLevelToString(available) << std::endl;
+        return available;
+    }
+    return level;
+}
+
+std::atomic<SimdLevel>& LevelStorage()
+{
+    static std::atomic<SimdLevel> level(ResolveLevel());
+    return level;
+}
+} // namespace
+
+const CpuFeatures& CpuFeatures::Host()
+{
+    static const CpuFeatures features = DetectFeatures();
+    return features;
+}
+
+SimdLevel CpuFeatures::SupportedLevel() const
+{
+    if (Avx512F && Avx2 && Fma && F16c && OsZmm)
+        return SimdLevel::Avx512;
+    if (Avx2 && Fma && F16c && Avx && OsYmm)
+        return SimdLevel::Avx2;
+    return SimdLevel::Scalar;
+}
+
+SimdLevel CompiledSimdLevel()
+{
+#if defined(WITH_AVX512)
+    return SimdLevel::Avx512;
+#elif defined(WITH_AVX2)
+    return SimdLevel::Avx2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+SimdLevel GetSimdLevel()
+{
+    return LevelStorage().load(std::memory_order_relaxed);
+}
+
+void SetSimdLevel(SimdLevel level)
+{
+    if (!IsSimdLevelAvailable(level))
+        throw std::invalid_argument(
+            "Util::SetSimdLevel - " + SimdLevelToString(level) +
+            " is not available on this machine");
+    LevelStorage().store(level, std::memory_order_relaxed);
+}
+
+bool IsSimdLevelAvailable(SimdLevel level)
+{
+    return level <= CpuFeatures::Host().SupportedLevel() &&
+           level <= CompiledSimdLevel();
+}
+
+std::string SimdLevelToString(SimdLevel level)
+{
+    switch (level)
+    {
+        case SimdLevel::Scalar:
+            return "scalar";
+        case SimdLevel::Avx2:
+            return "avx2";
+        case SimdLevel::Avx512:
+            return "avx512";
+    }
+    return "unknown";
+}
+
+SimdLevel SimdLevelFromString(const std::string& name)
+{
+    std::string lower(name);
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) {
+                       return static_cast<char>(std::tolower(c));
+                   });
+    if (lower == "scalar")
+        return SimdLevel::Scalar;
+    if (lower == "avx2")
+        return SimdLevel::Avx2;
+    if (lower == "avx512")
+        return SimdLevel::Avx512;
+    throw std::invalid_argument(
+        "Util::SimdLevelFromString - Unknown level (" + name + ")");
+}
+} // namespace Sapphire::Util
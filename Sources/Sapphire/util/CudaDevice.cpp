@@ -7,6 +7,10 @@
 #include <Sapphire/util/CudaDevice.hpp>
 #include <stdexcept>
 
+#ifdef WITH_CUDA
+#include <cuda_runtime.h>
+#endif
+
 namespace Sapphire
 {
 CudaDevice::CudaDevice(int id, std::string name)
@@ -18,6 +22,7 @@ CudaDevice::CudaDevice(int id, std::string name)
         throw std::runtime_error("Cuda device has not been detected");
     }
 
+#ifdef WITH_CUDA
     int majorCapability;
     int minorCapability;
     cudaDeviceGetAttribute(&majorCapability, cudaDevAttrComputeCapabilityMajor,
@@ -25,6 +30,19 @@ CudaDevice::CudaDevice(int id, std::string name)
     cudaDeviceGetAttribute(&minorCapability, cudaDevAttrComputeCapabilityMinor,
                            m_id);
     m_cudaCapability = majorCapability * 10 + minorCapability;
+#endif
+}
+
+int CudaDevice::GetAvailableCudaDeviceCount()
+{
+#ifdef WITH_CUDA
+    int count = 0;
+    if (cudaGetDeviceCount(&count) != cudaSuccess)
+        return 0;
+    return count;
+#else
+    return 0;
+#endif
 }
 
 bool CudaDevice::operator==(const CudaDevice& device) const
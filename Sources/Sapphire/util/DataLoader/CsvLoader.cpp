@@ -6,11 +6,35 @@
 
 #include <Sapphire/util/DataLoader/DataLoader.hpp>
 #include <Sapphire/util/DataLoader/CsvLoader.hpp>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
 namespace Sapphire::Util
 {
+std::vector<std::size_t> SplitCsvChunks(const char* data, std::size_t size,
+                                        std::size_t numChunks)
+{
+    std::vector<std::size_t> boundaries = { 0 };
+    if (numChunks == 0)
+        numChunks = 1;
+    const auto chunkSize = size / numChunks;
+    for (std::size_t chunkIdx = 1; chunkIdx < numChunks; ++chunkIdx)
+    {
+        const auto target =
+            std::max(chunkIdx * chunkSize, boundaries.back());
+        const auto* newline = std::find(data + target, data + size, '\n');
+        if (newline == data + size)
+            break;
+        const auto boundary = static_cast<std::size_t>(newline - data) + 1;
+        if (boundary > boundaries.back())
+            boundaries.emplace_back(boundary);
+    }
+    if (boundaries.back() != size)
+        boundaries.emplace_back(size);
+    return boundaries;
+}
+
 std::string_view CSVRow::operator[](std::size_t index) const
 {
     return std::string_view(&m_line[m_data[index] + 1],
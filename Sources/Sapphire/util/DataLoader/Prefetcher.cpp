@@ -0,0 +1,181 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/cudaUtil/Memory.hpp>
+#include <Sapphire/util/DataLoader/Prefetcher.hpp>
+
+namespace Sapphire::Util
+{
+Prefetcher::Prefetcher(std::vector<Shape> shapes, const CudaDevice& device,
+                       ComputeMode mode, std::size_t numBatches,
+                       FillFunction fill, int numWorkers, int prefetchDepth)
+    : m_shapes(std::move(shapes)),
+      m_device(device),
+      m_mode(mode),
+      m_numBatches(numBatches),
+      m_fill(std::move(fill)),
+      m_numWorkers(numWorkers)
+{
+    if (numWorkers < 1 || prefetchDepth < 1)
+        throw std::invalid_argument(
+            "Util::Prefetcher - numWorkers and prefetchDepth must be larger "
+            "than zero");
+
+    auto& model = ModelManager::CurModel();
+    m_slots.resize(prefetchDepth);
+    for (std::size_t slotIdx = 0; slotIdx < m_slots.size(); ++slotIdx)
+    {
+        auto& slot = m_slots[slotIdx];
+        for (const auto& shape : m_shapes)
+        {
+            Tensor tensor(shape, device, Type::Dense, true);
+            if (mode == ComputeMode::Host)
+                tensor.ToHost();
+            else
+                tensor.ToCuda();
+
+            auto tensorData = model.GetDescriptor(tensor.TensorDescriptorKey())
+                                   .GetForwardData();
+            if (mode == ComputeMode::Host)
+                slot.Buffers.emplace_back(tensorData.HostMutableRawPtr());
+            else
+            {
+                void* staging = nullptr;
+                Compute::Cuda::CudaMallocHost(
+                    &staging, shape.Size() * sizeof(float));
+                slot.Staging.emplace_back(static_cast<float*>(staging));
+                slot.Buffers.emplace_back(slot.Staging.back());
+            }
+            slot.Tensors.emplace_back(tensor);
+            slot.TensorData.emplace_back(std::move(tensorData));
+        }
+        m_freeSlots.emplace_back(slotIdx);
+    }
+}
+
+Prefetcher::~Prefetcher()
+{
+    Stop();
+    for (auto& slot : m_slots)
+        for (auto* staging : slot.Staging)
+            Compute::Cuda::CudaFreeHost(staging);
+}
+
+void Prefetcher::Start()
+{
+    std::lock_guard lock(m_mtx);
+    if (!m_workers.empty())
+        throw std::runtime_error("Util::Prefetcher::Start - Already started");
+    m_stop = false;
+    for (int i = 0; i < m_numWorkers; ++i)
+        m_workers.emplace_back(&Prefetcher::m_workerLoop, this);
+}
+
+void Prefetcher::Stop()
+{
+    {
+        std::lock_guard lock(m_mtx);
+        m_stop = true;
+    }
+    m_freeCond.notify_all();
+    m_readyCond.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+}
+
+std::vector<Tensor> Prefetcher::Next()
+{
+    std::unique_lock lock(m_mtx);
+    if (m_workers.empty())
+        throw std::runtime_error(
+            "Util::Prefetcher::Next - Prefetcher has not been started");
+
+    if (m_currentSlot)
+    {
+        m_freeSlots.emplace_back(m_currentSlot.value());
+        m_currentSlot.reset();
+        m_freeCond.notify_one();
+    }
+
+    if (m_consumeBatchIdx >= m_numBatches)
+        return {};
+
+    //! Batches loaded before the failed one are still delivered
+    m_readyCond.wait(lock, [this]() {
+        return m_readySlots.find(m_consumeBatchIdx) != m_readySlots.end() ||
+               (m_error != nullptr && m_consumeBatchIdx >= m_errorBatchIdx);
+    });
+
+    if (m_readySlots.find(m_consumeBatchIdx) == m_readySlots.end())
+        std::rethrow_exception(m_error);
+
+    const auto slotIdx = m_readySlots.at(m_consumeBatchIdx);
+    m_readySlots.erase(m_consumeBatchIdx);
+    m_consumeBatchIdx += 1;
+    m_currentSlot = slotIdx;
+    return m_slots[slotIdx].Tensors;
+}
+
+void Prefetcher::m_workerLoop()
+{
+    if (m_mode == ComputeMode::Cuda)
+        Compute::Cuda::CudaSetDevice(m_device.GetID());
+
+    while (true)
+    {
+        std::unique_lock lock(m_mtx);
+        //! Slot and batch index are taken together, so loaded slots always
+        //! hold the oldest batches that have not been consumed
+        m_freeCond.wait(lock, [this]() {
+            return m_stop || m_nextBatchIdx >= m_numBatches ||
+                   !m_freeSlots.empty();
+        });
+        if (m_stop || m_nextBatchIdx >= m_numBatches)
+            return;
+
+        const auto slotIdx = m_freeSlots.front();
+        m_freeSlots.pop_front();
+        const auto batchIdx = m_nextBatchIdx++;
+        lock.unlock();
+
+        try
+        {
+            m_fill(batchIdx, m_slots[slotIdx].Buffers);
+            if (m_mode == ComputeMode::Cuda)
+                m_upload(m_slots[slotIdx]);
+        }
+        catch (...)
+        {
+            lock.lock();
+            if (m_error == nullptr || batchIdx < m_errorBatchIdx)
+            {
+                m_error = std::current_exception();
+                m_errorBatchIdx = batchIdx;
+            }
+            m_stop = true;
+            lock.unlock();
+            m_readyCond.notify_all();
+            m_freeCond.notify_all();
+            return;
+        }
+
+        lock.lock();
+        m_readySlots[batchIdx] = slotIdx;
+        lock.unlock();
+        m_readyCond.notify_all();
+    }
+}
+
+void Prefetcher::m_upload(Slot& slot) const
+{
+    for (std::size_t i = 0; i < slot.Staging.size(); ++i)
+        Compute::Cuda::CopyHostToDevice(
+            slot.TensorData[i].CudaMutableRawPtr(), slot.Staging[i],
+            static_cast<unsigned int>(m_shapes[i].Size() * sizeof(float)));
+}
+} // namespace Sapphire::Util
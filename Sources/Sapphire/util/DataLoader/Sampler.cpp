@@ -0,0 +1,211 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/DataLoader/Sampler.hpp>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Util
+{
+namespace
+{
+constexpr std::size_t OrderCacheSize = 2;
+
+//! Mixes seed and epoch so that adjacent epochs get unrelated streams
+std::uint64_t EpochSeed(std::uint64_t seed, std::size_t epoch)
+{
+    std::uint64_t z = seed + 0x9E3779B97F4A7C15ull * (epoch + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+//! Fisher-Yates shuffle
+//! std::shuffle is not used since its result differs between standard
+//! libraries, while mt19937_64 output is fixed by the standard
+template <typename Iter>
+void Shuffle(Iter begin, Iter end, std::mt19937_64& gen)
+{
+    const auto size = static_cast<std::size_t>(end - begin);
+    for (std::size_t i = size; i > 1; --i)
+        std::swap(begin[i - 1], begin[gen() % i]);
+}
+} // namespace
+
+Sampler::Sampler(std::size_t numRecords, std::size_t batchSize,
+                 SampleMode mode, std::uint64_t seed,
+                 std::size_t firstRecord)
+    : m_numRecords(numRecords),
+      m_batchSize(batchSize),
+      m_mode(mode),
+      m_seed(seed),
+      m_firstRecord(firstRecord)
+{
+    if (batchSize == 0)
+        throw std::invalid_argument(
+            "Util::Sampler - Batch size must be larger than zero");
+}
+
+void Sampler::SetBlockSize(std::size_t blockSize)
+{
+    if (blockSize == 0)
+        throw std::invalid_argument(
+            "Util::Sampler::SetBlockSize - Block size must be larger than "
+            "zero");
+    std::lock_guard lock(m_mtx);
+    m_blockSize = blockSize;
+    m_orderCache.clear();
+}
+
+void Sampler::SetLabels(std::vector<std::uint32_t> labels)
+{
+    if (labels.size() != m_numRecords)
+        throw std::invalid_argument(
+            "Util::Sampler::SetLabels - Number of labels (" +
+            std::to_string(labels.size()) +
+            ") does not match number of records (" +
+            std::to_string(m_numRecords) + ")");
+    std::lock_guard lock(m_mtx);
+    m_labels = std::move(labels);
+    m_orderCache.clear();
+}
+
+void Sampler::SetDropLast(bool dropLast)
+{
+    std::lock_guard lock(m_mtx);
+    m_dropLast = dropLast;
+}
+
+std::size_t Sampler::NumBatches() const
+{
+    std::lock_guard lock(m_mtx);
+    if (m_dropLast)
+        return m_numRecords / m_batchSize;
+    return (m_numRecords + m_batchSize - 1) / m_batchSize;
+}
+
+void Sampler::Batch(std::size_t epoch, std::size_t batchIdx,
+                    std::vector<std::size_t>& dst) const
+{
+    if (batchIdx >= NumBatches())
+        throw std::out_of_range(
+            "Util::Sampler::Batch - Batch index (" + std::to_string(batchIdx) +
+            ") exceeds number of batches (" + std::to_string(NumBatches()) +
+            ")");
+
+    const auto first = batchIdx * m_batchSize;
+    const auto last = std::min(first + m_batchSize, m_numRecords);
+
+    std::lock_guard lock(m_mtx);
+    const auto& order = m_getOrder(epoch);
+    dst.assign(order.begin() + static_cast<std::ptrdiff_t>(first),
+               order.begin() + static_cast<std::ptrdiff_t>(last));
+}
+
+void Sampler::Step(std::size_t step, std::vector<std::size_t>& dst) const
+{
+    const auto numBatches = NumBatches();
+    if (numBatches == 0)
+        throw std::runtime_error(
+            "Util::Sampler::Step - Sampler does not have any batch");
+    Batch(step / numBatches, step % numBatches, dst);
+}
+
+std::vector<std::size_t> Sampler::EpochOrder(std::size_t epoch) const
+{
+    std::lock_guard lock(m_mtx);
+    return m_getOrder(epoch);
+}
+
+const std::vector<std::size_t>& Sampler::m_getOrder(std::size_t epoch) const
+{
+    for (const auto& [cachedEpoch, order] : m_orderCache)
+        if (cachedEpoch == epoch)
+            return order;
+
+    if (m_orderCache.size() >= OrderCacheSize)
+        m_orderCache.pop_front();
+    m_orderCache.emplace_back(epoch, std::vector<std::size_t>());
+    auto& order = m_orderCache.back().second;
+    m_generateOrder(epoch, order);
+    return order;
+}
+
+void Sampler::m_generateOrder(std::size_t epoch,
+                              std::vector<std::size_t>& order) const
+{
+    order.resize(m_numRecords);
+    std::iota(order.begin(), order.end(), m_firstRecord);
+    std::mt19937_64 gen(EpochSeed(m_seed, epoch));
+
+    switch (m_mode)
+    {
+    case SampleMode::Sequential:
+        break;
+    case SampleMode::Shuffle:
+        Shuffle(order.begin(), order.end(), gen);
+        break;
+    case SampleMode::BlockShuffle:
+    {
+        const auto numBlocks = (m_numRecords + m_blockSize - 1) / m_blockSize;
+        std::vector<std::size_t> blocks(numBlocks);
+        std::iota(blocks.begin(), blocks.end(), 0);
+        Shuffle(blocks.begin(), blocks.end(), gen);
+
+        auto iter = order.begin();
+        for (const auto blockIdx : blocks)
+        {
+            const auto first = blockIdx * m_blockSize;
+            const auto last = std::min(first + m_blockSize, m_numRecords);
+            const auto blockBegin = iter;
+            for (auto recordIdx = first; recordIdx < last; ++recordIdx)
+                *iter++ = m_firstRecord + recordIdx;
+            Shuffle(blockBegin, iter, gen);
+        }
+        break;
+    }
+    case SampleMode::Stratified:
+    {
+        if (m_labels.size() != m_numRecords)
+            throw std::runtime_error(
+                "Util::Sampler - Labels must be set for stratified sampling");
+
+        const auto numClasses =
+            m_numRecords == 0
+                ? 0
+                : static_cast<std::size_t>(*std::max_element(
+                      m_labels.begin(), m_labels.end())) + 1;
+        std::vector<std::vector<std::size_t>> classRecords(numClasses);
+        for (std::size_t i = 0; i < m_numRecords; ++i)
+            classRecords[m_labels[i]].emplace_back(m_firstRecord + i);
+
+        //! j-th record of a class with n records is placed at relative
+        //! position (j + offset) / n, so each class is spread uniformly
+        //! over the epoch. Random offsets break ties between classes
+        std::vector<std::pair<double, std::size_t>> keys;
+        keys.reserve(m_numRecords);
+        for (auto& records : classRecords)
+        {
+            Shuffle(records.begin(), records.end(), gen);
+            //! Uniform in [0, 1) from the top 53 bits
+            const auto offset =
+                static_cast<double>(gen() >> 11) * (1.0 / 9007199254740992.0);
+            const auto size = static_cast<double>(records.size());
+            for (std::size_t j = 0; j < records.size(); ++j)
+                keys.emplace_back((static_cast<double>(j) + offset) / size,
+                                  records[j]);
+        }
+        std::sort(keys.begin(), keys.end());
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            order[i] = keys[i].second;
+        break;
+    }
+    }
+}
+} // namespace Sapphire::Util
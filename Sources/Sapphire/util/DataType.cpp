@@ -0,0 +1,114 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/DataType.hpp>
+#include <cmath>
+#include <cstring>
+
+namespace Sapphire
+{
+std::size_t DataTypeSize(DataType dataType)
+{
+    return dataType == DataType::Float32 ? sizeof(float)
+                                         : sizeof(std::uint16_t);
+}
+
+std::string DataTypeToString(DataType dataType)
+{
+    switch (dataType)
+    {
+        case DataType::Float32:
+            return "Float32";
+        case DataType::Float16:
+            return "Float16";
+        case DataType::BFloat16:
+            return "BFloat16";
+    }
+    return "Unknown";
+}
+} // namespace Sapphire
+
+namespace Sapphire::Util
+{
+namespace
+{
+std::uint32_t ToBits(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float FromBits(std::uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+} // namespace
+
+std::uint16_t FloatToHalf(float value)
+{
+    const auto bits = ToBits(value);
+    const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+    auto absBits = bits & 0x7FFFFFFFu;
+
+    //! NaN keeps its upper mantissa bits and is made quiet
+    if (absBits > 0x7F800000u)
+        return sign | 0x7E00u | static_cast<std::uint16_t>((absBits >> 13) &
+                                                            0x3FFu);
+
+    //! Values from the midpoint of the largest half (65504) and 65536 round up
+    if (absBits >= 0x477FF000u)
+        return sign | 0x7C00u;
+
+    //! Subnormal halves are multiples of 2^-24. Adding 0.5 places the value
+    //! where the ulp of float is 2^-24, so the FPU rounds to nearest even
+    if (absBits < 0x38800000u)
+    {
+        constexpr std::uint32_t half = 0x3F000000u;
+        const auto rounded =
+            ToBits(FromBits(absBits) + FromBits(half)) - half;
+        return sign | static_cast<std::uint16_t>(rounded);
+    }
+
+    //! Rebias exponent and round away 13 bits of mantissa to nearest even
+    const auto odd = (absBits >> 13) & 1u;
+    absBits += (static_cast<std::uint32_t>(15 - 127) << 23) + 0xFFFu + odd;
+    return sign | static_cast<std::uint16_t>(absBits >> 13);
+}
+
+float HalfToFloat(std::uint16_t value)
+{
+    const auto sign = static_cast<std::uint32_t>(value & 0x8000u) << 16;
+    const auto exponent = (value >> 10) & 0x1Fu;
+    const auto mantissa = static_cast<std::uint32_t>(value & 0x3FFu);
+
+    if (exponent == 0x1Fu)
+        return FromBits(sign | 0x7F800000u | (mantissa << 13));
+    if (exponent == 0)
+    {
+        const auto magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+    return FromBits(sign | ((exponent + 127 - 15) << 23) | (mantissa << 13));
+}
+
+std::uint16_t FloatToBFloat16(float value)
+{
+    auto bits = ToBits(value);
+    if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+        return static_cast<std::uint16_t>((bits >> 16) | 0x0040u);
+
+    bits += 0x7FFFu + ((bits >> 16) & 1u);
+    return static_cast<std::uint16_t>(bits >> 16);
+}
+
+float BFloat16ToFloat(std::uint16_t value)
+{
+    return FromBits(static_cast<std::uint32_t>(value) << 16);
+}
+} // namespace Sapphire::Util
@@ -0,0 +1,215 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/MappedFile.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Sapphire::Util
+{
+MappedFile::MappedFile(const std::filesystem::path& filePath, MapMode mode)
+    : m_mode(mode)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("MappedFile - Could not open file (" +
+                                 filePath.string() + ")");
+
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    m_size = static_cast<std::size_t>(fileSize.QuadPart);
+    m_fileHandle = file;
+    m_isOpen = true;
+
+    if (m_size == 0)
+        return;
+
+    const bool copyOnWrite = mode == MapMode::CopyOnWrite;
+    HANDLE mapping = CreateFileMappingW(
+        file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0,
+        nullptr);
+    if (mapping == nullptr)
+    {
+        m_close();
+        throw std::runtime_error("MappedFile - Could not map file (" +
+                                 filePath.string() + ")");
+    }
+    m_mappingHandle = mapping;
+    m_data = static_cast<const char*>(
+        MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0,
+                      0, 0));
+    if (m_data == nullptr)
+    {
+        m_close();
+        throw std::runtime_error("MappedFile - Could not map file (" +
+                                 filePath.string() + ")");
+    }
+#else
+    const int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("MappedFile - Could not open file (" +
+                                 filePath.string() + ")");
+
+    struct stat fileStat{};
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("MappedFile - Could not read size of file (" +
+                                 filePath.string() + ")");
+    }
+    m_size = static_cast<std::size_t>(fileStat.st_size);
+    m_isOpen = true;
+
+    if (m_size == 0)
+    {
+        close(fd);
+        return;
+    }
+
+    //! Private mapping never writes back to the file, so it can be writable
+    //! even though the file is opened as read only
+    const int protection = mode == MapMode::CopyOnWrite
+                               ? PROT_READ | PROT_WRITE
+                               : PROT_READ;
+    void* ptr = mmap(nullptr, m_size, protection, MAP_PRIVATE, fd, 0);
+    //! Mapping stays valid after the descriptor is closed
+    close(fd);
+    if (ptr == MAP_FAILED)
+    {
+        m_isOpen = false;
+        m_size = 0;
+        throw std::runtime_error("MappedFile - Could not map file (" +
+                                 filePath.string() + ")");
+    }
+    m_data = static_cast<const char*>(ptr);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    m_close();
+}
+
+MappedFile::MappedFile(MappedFile&& mappedFile) noexcept
+    : m_data(std::exchange(mappedFile.m_data, nullptr)),
+      m_size(std::exchange(mappedFile.m_size, 0)),
+      m_isOpen(std::exchange(mappedFile.m_isOpen, false)),
+      m_mode(mappedFile.m_mode)
+#ifdef _WIN32
+      ,
+      m_fileHandle(std::exchange(mappedFile.m_fileHandle, nullptr)),
+      m_mappingHandle(std::exchange(mappedFile.m_mappingHandle, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& mappedFile) noexcept
+{
+    if (this != &mappedFile)
+    {
+        m_close();
+        m_data = std::exchange(mappedFile.m_data, nullptr);
+        m_size = std::exchange(mappedFile.m_size, 0);
+        m_isOpen = std::exchange(mappedFile.m_isOpen, false);
+        m_mode = mappedFile.m_mode;
+#ifdef _WIN32
+        m_fileHandle = std::exchange(mappedFile.m_fileHandle, nullptr);
+        m_mappingHandle = std::exchange(mappedFile.m_mappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+char* MappedFile::MutableData() const
+{
+    if (m_mode != MapMode::CopyOnWrite)
+        throw std::runtime_error(
+            "MappedFile::MutableData - File is mapped as read only");
+    return const_cast<char*>(m_data);
+}
+
+void MappedFile::Advise(AccessPattern pattern, std::size_t offset,
+                        std::size_t length) const
+{
+#ifndef _WIN32
+    if (m_data == nullptr || offset >= m_size)
+        return;
+    if (length == 0 || offset + length > m_size)
+        length = m_size - offset;
+
+    //! madvise requires page aligned address
+    const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const auto alignedOffset = offset - offset % pageSize;
+
+    int advice = MADV_NORMAL;
+    if (pattern == AccessPattern::Sequential)
+        advice = MADV_SEQUENTIAL;
+    else if (pattern == AccessPattern::Random)
+        advice = MADV_RANDOM;
+
+    madvise(const_cast<char*>(m_data) + alignedOffset,
+            length + (offset - alignedOffset), advice);
+#else
+    static_cast<void>(pattern);
+    static_cast<void>(offset);
+    static_cast<void>(length);
+#endif
+}
+
+void MappedFile::Release(std::size_t offset, std::size_t length) const
+{
+    if (m_data == nullptr || offset >= m_size)
+        return;
+    if (offset + length > m_size)
+        length = m_size - offset;
+
+#ifdef _WIN32
+    //! Unlocking pages that are not locked removes them from the working set
+    VirtualUnlock(const_cast<char*>(m_data) + offset, length);
+#else
+    //! Only whole pages inside the range can be released
+    const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (offset + pageSize - 1) / pageSize * pageSize;
+    const auto end = (offset + length) / pageSize * pageSize;
+    if (begin < end)
+        madvise(const_cast<char*>(m_data) + begin, end - begin,
+                MADV_DONTNEED);
+#endif
+}
+
+void MappedFile::m_close()
+{
+#ifdef _WIN32
+    if (m_data != nullptr)
+        UnmapViewOfFile(m_data);
+    if (m_mappingHandle != nullptr)
+        CloseHandle(m_mappingHandle);
+    if (m_fileHandle != nullptr)
+        CloseHandle(m_fileHandle);
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+#else
+    if (m_data != nullptr)
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+}
+} // namespace Sapphire::Util
@@ -0,0 +1,258 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/Profiler.hpp>
+#include <Sapphire/compute/cudaUtil/Memory.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace Sapphire::Util
+{
+namespace
+{
+std::mutex& EventMutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+std::vector<ProfileEvent>& EventBuffer()
+{
+    static std::vector<ProfileEvent> events;
+    return events;
+}
+
+std::uint32_t CurrentThreadId()
+{
+    static std::atomic<std::uint32_t> threadCount = 0;
+    thread_local const std::uint32_t threadId = threadCount++;
+    return threadId;
+}
+
+thread_local const std::string* CurrentUnitName = nullptr;
+
+std::string EscapeJson(const std::string& str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            escaped += buffer;
+        }
+        else
+            escaped += c;
+    }
+    return escaped;
+}
+
+const char* ModeName(ComputeMode mode)
+{
+    return mode == ComputeMode::Cuda ? "Cuda" : "Host";
+}
+} // namespace
+
+std::atomic<bool> Profiler::m_enabled = false;
+std::atomic<bool> Profiler::m_synchronizeCuda = false;
+
+void Profiler::Enable(bool synchronizeCuda)
+{
+    m_synchronizeCuda = synchronizeCuda;
+    m_enabled = true;
+}
+
+void Profiler::Disable()
+{
+    m_enabled = false;
+}
+
+void Profiler::Clear()
+{
+    std::lock_guard lock(EventMutex());
+    EventBuffer().clear();
+}
+
+void Profiler::Record(ProfileEvent event)
+{
+    std::lock_guard lock(EventMutex());
+    EventBuffer().emplace_back(std::move(event));
+}
+
+std::vector<ProfileEvent> Profiler::Events()
+{
+    std::vector<ProfileEvent> events;
+    {
+        std::lock_guard lock(EventMutex());
+        events = EventBuffer();
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const ProfileEvent& a, const ProfileEvent& b) {
+                         return a.StartNs < b.StartNs;
+                     });
+    return events;
+}
+
+void Profiler::ExportChromeTrace(const std::filesystem::path& filePath)
+{
+    const auto events = Events();
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file.is_open())
+        throw std::runtime_error(
+            "Util::Profiler::ExportChromeTrace - Could not open file (" +
+            filePath.string() + ")");
+
+    //! Trace event format uses microseconds
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        const auto& event = events[i];
+        file << (i == 0 ? "\n" : ",\n") << "{\"name\":\""
+            << EscapeJson(event.Name) << "\",\"cat\":\"" <<
+            ModeName(event.Mode) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" <<
+            event.ThreadId << ",\"ts\":" <<
+            static_cast<double>(event.StartNs) / 1000.0 << ",\"dur\":" <<
+            static_cast<double>(event.DurationNs) / 1000.0 <<
+            ",\"args\":{\"unit\":\"" << EscapeJson(event.Unit) <<
+            "\",\"shapes\":\"" << EscapeJson(event.Shapes) <<
+            "\",\"flops\":" << event.Flops << ",\"bytes\":" << event.Bytes <<
+            "}}";
+    }
+    file << "\n]}\n";
+}
+
+std::string Profiler::Summary()
+{
+    struct Aggregate
+    {
+        std::size_t Calls = 0;
+        std::int64_t TotalNs = 0;
+        double Flops = 0.0;
+        double Bytes = 0.0;
+    };
+
+    //! Back propagation events enclose compute ops, so they are listed but
+    //! excluded from total time
+    std::map<std::pair<std::string, ComputeMode>, Aggregate> aggregates;
+    std::int64_t totalNs = 0;
+    for (const auto& event : Events())
+    {
+        auto& aggregate = aggregates[{ event.Name, event.Mode }];
+        aggregate.Calls += 1;
+        aggregate.TotalNs += event.DurationNs;
+        aggregate.Flops += event.Flops;
+        aggregate.Bytes += event.Bytes;
+        if (event.Name != "BackProp")
+            totalNs += event.DurationNs;
+    }
+
+    std::vector<std::pair<std::pair<std::string, ComputeMode>, Aggregate>>
+        sorted(aggregates.begin(), aggregates.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.TotalNs > b.second.TotalNs;
+    });
+
+    std::ostringstream stream;
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-24s %-5s %8s %12s %12s %8s %10s %10s\n",
+                  "Op", "Dev", "Calls", "Total(ms)", "Avg(us)", "%", "GFLOP/s",
+                  "GB/s");
+    stream << line;
+    for (const auto& [key, aggregate] : sorted)
+    {
+        const auto seconds = static_cast<double>(aggregate.TotalNs) * 1e-9;
+        const auto ratio = totalNs == 0 || key.first == "BackProp"
+                               ? 0.0
+                               : 100.0 * static_cast<double>(aggregate.TotalNs)
+                                 / static_cast<double>(totalNs);
+        std::snprintf(
+            line, sizeof(line),
+            "%-24s %-5s %8zu %12.3f %12.3f %8.2f %10.3f %10.3f\n",
+            key.first.c_str(), ModeName(key.second), aggregate.Calls,
+            seconds * 1e3,
+            seconds * 1e6 / static_cast<double>(aggregate.Calls), ratio,
+            seconds > 0.0 ? aggregate.Flops / seconds * 1e-9 : 0.0,
+            seconds > 0.0 ? aggregate.Bytes / seconds * 1e-9 : 0.0);
+        stream << line;
+    }
+    return stream.str();
+}
+
+std::int64_t Profiler::Now()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+ProfileUnitScope::ProfileUnitScope(const std::string& unitName)
+{
+    if (!Profiler::IsEnabled())
+        return;
+    m_previous = CurrentUnitName;
+    CurrentUnitName = &unitName;
+    m_active = true;
+}
+
+ProfileUnitScope::~ProfileUnitScope()
+{
+    if (m_active)
+        CurrentUnitName = m_previous;
+}
+
+const std::string& ProfileUnitScope::Current()
+{
+    static const std::string empty;
+    return CurrentUnitName ? *CurrentUnitName : empty;
+}
+
+void ProfileScope::Begin(
+    const char* name, double flops,
+    std::initializer_list<const TensorUtil::TensorData*> tensors)
+{
+    m_event.Name = name;
+    m_event.Unit = ProfileUnitScope::Current();
+    m_event.Flops = flops;
+    m_event.ThreadId = CurrentThreadId();
+    for (const auto* tensor : tensors)
+    {
+        if (!m_event.Shapes.empty())
+            m_event.Shapes += ", ";
+        m_event.Shapes += tensor->GetShape().ToString();
+        m_event.Bytes += static_cast<double>(tensor->Size()) *
+                         DataTypeSize(tensor->GetDataType());
+    }
+    if (tensors.size() > 0)
+        m_event.Mode = (*tensors.begin())->Mode();
+
+    if (m_event.Mode == ComputeMode::Cuda && Profiler::SynchronizeCuda())
+        Compute::Cuda::CudaDeviceSynchronize();
+    m_active = true;
+    m_event.StartNs = Profiler::Now();
+}
+
+ProfileScope::~ProfileScope()
+{
+    if (!m_active)
+        return;
+    if (m_event.Mode == ComputeMode::Cuda && Profiler::SynchronizeCuda())
+        Compute::Cuda::CudaDeviceSynchronize();
+    m_event.DurationNs = Profiler::Now() - m_event.StartNs;
+    Profiler::Record(std::move(m_event));
+}
+} // namespace Sapphire::Util
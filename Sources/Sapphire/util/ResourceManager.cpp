@@ -6,14 +6,22 @@
 
 #include <Sapphire/compute/cudaUtil/Memory.hpp>
 #include <Sapphire/util/ResourceManager.hpp>
-#include <Sapphire/compute/cudaUtil/CudaParams.cuh>
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
 #include <thread>
 #include <utility>
 
 namespace Sapphire::Util
 {
+std::mutex ResourceManager::m_mutex;
 unsigned int ResourceManager::m_allocationUnitByteSize = 256;
+std::size_t ResourceManager::m_hostAllocatedByteSize = 0;
+std::size_t ResourceManager::m_cudaAllocatedByteSize = 0;
+std::size_t ResourceManager::m_hostPeakByteSize = 0;
+std::size_t ResourceManager::m_cudaPeakByteSize = 0;
 
 void* AllocHost(std::size_t size)
 {
@@ -37,6 +45,7 @@ void FreeHost(void* ptr)
 
 void* ResourceManager::GetMemoryCuda(size_t byteSize, bool preserve)
 {
+    std::lock_guard lock(m_mutex);
     void* cudaPtr = nullptr;
     const auto allocationSize =
         byteSize / m_allocationUnitByteSize * m_allocationUnitByteSize +
@@ -45,6 +54,7 @@ void* ResourceManager::GetMemoryCuda(size_t byteSize, bool preserve)
     {
         Compute::Cuda::CudaMalloc(&cudaPtr,
                                   static_cast<unsigned int>(allocationSize));
+        m_addAllocatedCuda(allocationSize);
         m_cudaPreservedPool.emplace(reinterpret_cast<std::intptr_t>(cudaPtr),
                                     MemoryChunk(
                                         allocationSize, cudaPtr, 1));
@@ -65,6 +75,7 @@ void* ResourceManager::GetMemoryCuda(size_t byteSize, bool preserve)
     {
         Compute::Cuda::CudaMalloc(&cudaPtr,
                                   static_cast<unsigned int>(allocationSize));
+        m_addAllocatedCuda(allocationSize);
         m_cudaVolatilePool.emplace(reinterpret_cast<std::intptr_t>(cudaPtr),
                                    MemoryChunk(allocationSize, cudaPtr, 1));
     }
@@ -73,6 +84,7 @@ void* ResourceManager::GetMemoryCuda(size_t byteSize, bool preserve)
 
 void* ResourceManager::GetMemoryHost(size_t byteSize, bool preserve)
 {
+    std::lock_guard lock(m_mutex);
     void* dataPtr = nullptr;
     const auto allocationSize =
         byteSize / m_allocationUnitByteSize * m_allocationUnitByteSize +
@@ -80,6 +92,7 @@ void* ResourceManager::GetMemoryHost(size_t byteSize, bool preserve)
     if (preserve)
     {
         dataPtr = AllocHost(allocationSize);
+        m_addAllocatedHost(allocationSize);
         m_hostPreservedPool.emplace(
             reinterpret_cast<std::intptr_t>(dataPtr),
             MemoryChunk(allocationSize, dataPtr, 1));
@@ -97,6 +110,7 @@ void* ResourceManager::GetMemoryHost(size_t byteSize, bool preserve)
     else
     {
         dataPtr = AllocHost(allocationSize);
+        m_addAllocatedHost(allocationSize);
         m_hostVolatilePool.emplace(reinterpret_cast<std::intptr_t>(dataPtr),
                                    MemoryChunk(allocationSize, dataPtr, 1));
     }
@@ -105,6 +119,7 @@ void* ResourceManager::GetMemoryHost(size_t byteSize, bool preserve)
 
 void ResourceManager::FreePreservedHost(void* ptr)
 {
+    std::lock_guard lock(m_mutex);
     auto itr =
         m_hostPreservedPool.find(reinterpret_cast<std::intptr_t>(ptr));
 
@@ -112,26 +127,30 @@ void ResourceManager::FreePreservedHost(void* ptr)
         throw std::runtime_error(
             "ResourceManager::FreePreservedHost - Given ptr to free was not "
             "found");
+    m_hostAllocatedByteSize -= itr->second.ByteSize;
     FreeHost(ptr);
     m_hostPreservedPool.erase(reinterpret_cast<std::intptr_t>(ptr));
 }
 
 void ResourceManager::FreePreservedCuda(void* ptr)
 {
+    std::lock_guard lock(m_mutex);
     auto itr =
-        m_hostPreservedPool.find(reinterpret_cast<std::intptr_t>(ptr));
+        m_cudaPreservedPool.find(reinterpret_cast<std::intptr_t>(ptr));
 
-    if (itr == m_hostPreservedPool.end())
+    if (itr == m_cudaPreservedPool.end())
         throw std::runtime_error(
-            "ResourceManager::FreePreservedHost - Given ptr to free was not "
+            "ResourceManager::FreePreservedCuda - Given ptr to free was not "
             "found");
 
+    m_cudaAllocatedByteSize -= itr->second.ByteSize;
     Compute::Cuda::CudaFree(ptr);
-    m_hostPreservedPool.erase(reinterpret_cast<std::intptr_t>(ptr));
+    m_cudaPreservedPool.erase(reinterpret_cast<std::intptr_t>(ptr));
 }
 
 void ResourceManager::MoveToPreservedHost(void* ptr)
 {
+    std::lock_guard lock(m_mutex);
     auto itr = m_hostVolatilePool.find(reinterpret_cast<std::intptr_t>(ptr));
     if (itr == m_hostVolatilePool.end())
         throw std::runtime_error(
@@ -144,6 +163,7 @@ void ResourceManager::MoveToPreservedHost(void* ptr)
 
 void ResourceManager::MoveToPreservedCuda(void* ptr)
 {
+    std::lock_guard lock(m_mutex);
     auto itr = m_cudaVolatilePool.find(reinterpret_cast<std::intptr_t>(ptr));
     if (itr == m_cudaVolatilePool.end())
         throw std::runtime_error(
@@ -156,6 +176,7 @@ void ResourceManager::MoveToPreservedCuda(void* ptr)
 
 void ResourceManager::MoveToVolatileHost(void* ptr)
 {
+    std::lock_guard lock(m_mutex);
     auto itr = m_hostPreservedPool.find(
         reinterpret_cast<std::intptr_t>(ptr));
     if (itr == m_hostPreservedPool.end())
@@ -169,6 +190,7 @@ void ResourceManager::MoveToVolatileHost(void* ptr)
 
 void ResourceManager::MoveToVolatileCuda(void* ptr)
 {
+    std::lock_guard lock(m_mutex);
     auto itr =
         m_hostVolatilePool.find(reinterpret_cast<std::intptr_t>(ptr));
     if (itr == m_hostVolatilePool.end())
@@ -180,10 +202,36 @@ void ResourceManager::MoveToVolatileCuda(void* ptr)
     m_hostPreservedPool.emplace(temp);
 }
 
+void ResourceManager::FreeVolatileHost(void* ptr)
+{
+    std::lock_guard lock(m_mutex);
+    const auto itr =
+        m_hostVolatilePool.find(reinterpret_cast<std::intptr_t>(ptr));
+    if (itr == m_hostVolatilePool.end())
+        return;
+
+    m_hostFreePool.emplace(itr->second.ByteSize, itr->second);
+    m_hostVolatilePool.erase(itr);
+}
+
+void ResourceManager::FreeVolatileCuda(void* ptr)
+{
+    std::lock_guard lock(m_mutex);
+    const auto itr =
+        m_cudaVolatilePool.find(reinterpret_cast<std::intptr_t>(ptr));
+    if (itr == m_cudaVolatilePool.end())
+        return;
+
+    m_cudaFreePool.emplace(itr->second.ByteSize, itr->second);
+    m_cudaVolatilePool.erase(itr);
+}
+
+#ifdef WITH_CUDA
 Compute::Dense::Cuda::CudnnConv2DMetaData*
 ResourceManager::GetCudnnConvMetaData(
     Compute::Dense::Cuda::ConvConfig convConfig)
 {
+    std::lock_guard lock(m_mutex);
     return m_cudnnConv2DMetaDataPool.at(convConfig);
 }
 
@@ -191,23 +239,27 @@ Compute::Dense::Cuda::CudnnPool2DMetaData*
 ResourceManager::GetCudnnPoolMetaData(
     Compute::Dense::Cuda::PoolConfig poolConfig)
 {
+    std::lock_guard lock(m_mutex);
     return m_cudnnPool2DMetaDataPool.at(poolConfig);
 }
 
 cublasHandle_t* ResourceManager::GetCublasHandle(int deviceId,
                                                  std::thread::id threadId)
 {
+    std::lock_guard lock(m_mutex);
     return m_cublasHandlePool.at(std::make_pair(deviceId, threadId));
 }
 
 cudnnHandle_t* ResourceManager::GetCudnnHandle(int deviceId,
                                                std::thread::id threadId)
 {
+    std::lock_guard lock(m_mutex);
     return m_cudnnHandlePool.at(std::make_pair(deviceId, threadId));
 }
 
 void ResourceManager::AddCublasHandle(int deviceId, std::thread::id threadId)
 {
+    std::lock_guard lock(m_mutex);
     auto* handle = new cublasHandle_t();
     cublasCreate(handle);
     m_cublasHandlePool[std::make_pair(deviceId, threadId)] = handle;
@@ -215,6 +267,7 @@ void ResourceManager::AddCublasHandle(int deviceId, std::thread::id threadId)
 
 void ResourceManager::AddCudnnHandle(int deviceId, std::thread::id threadId)
 {
+    std::lock_guard lock(m_mutex);
     auto* handle = new cudnnHandle_t();
     auto error = cudnnCreate(handle);
     if (error != CUDNN_STATUS_SUCCESS)
@@ -225,6 +278,7 @@ void ResourceManager::AddCudnnHandle(int deviceId, std::thread::id threadId)
 
 void ResourceManager::ClearCudnnConv2DMetaDataPool()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [key, metaData] : m_cudnnConv2DMetaDataPool)
     {
         Compute::Cuda::CudaFree(metaData->ForwardWorkSpace);
@@ -238,6 +292,7 @@ void ResourceManager::ClearCudnnConv2DMetaDataPool()
 
 void ResourceManager::ClearCudnnPool2DMetaDataPool()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [key, metaData] : m_cudnnPool2DMetaDataPool)
     {
         delete metaData;
@@ -247,6 +302,7 @@ void ResourceManager::ClearCudnnPool2DMetaDataPool()
 
 void ResourceManager::ClearCublasHandlePool()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [key, handle] : m_cublasHandlePool)
     {
         cublasDestroy(*handle);
@@ -258,6 +314,7 @@ void ResourceManager::ClearCublasHandlePool()
 
 void ResourceManager::ClearCudnnHandlePool()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [key, handle] : m_cudnnHandlePool)
     {
         cudnnDestroy(*handle);
@@ -266,9 +323,11 @@ void ResourceManager::ClearCudnnHandlePool()
 
     m_cudnnHandlePool.clear();
 }
+#endif
 
 void ResourceManager::Clean()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [key, memoryChunk] : m_hostVolatilePool)
         m_hostFreePool.emplace(memoryChunk.ByteSize, memoryChunk);
     for (auto& [key, memoryChunk] : m_cudaVolatilePool)
@@ -280,10 +339,17 @@ void ResourceManager::Clean()
 
 void ResourceManager::ClearPreservedPool()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [_, memoryChunk] : m_hostPreservedPool)
+    {
+        m_hostAllocatedByteSize -= memoryChunk.ByteSize;
         FreeHost(memoryChunk.Data);
+    }
     for (auto& [_, memoryChunk] : m_cudaPreservedPool)
+    {
+        m_cudaAllocatedByteSize -= memoryChunk.ByteSize;
         Compute::Cuda::CudaFree(memoryChunk.Data);
+    }
 
     m_hostPreservedPool.clear();
     m_cudaPreservedPool.clear();
@@ -291,10 +357,17 @@ void ResourceManager::ClearPreservedPool()
 
 void ResourceManager::ClearVolatilePool()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [key, memoryChunk] : m_hostVolatilePool)
+    {
+        m_hostAllocatedByteSize -= memoryChunk.ByteSize;
         FreeHost(memoryChunk.Data);
+    }
     for (auto& [key, memoryChunk] : m_cudaVolatilePool)
+    {
+        m_cudaAllocatedByteSize -= memoryChunk.ByteSize;
         Compute::Cuda::CudaFree(memoryChunk.Data);
+    }
 
     m_hostVolatilePool.clear();
     m_cudaVolatilePool.clear();
@@ -302,50 +375,83 @@ void ResourceManager::ClearVolatilePool()
 
 void ResourceManager::ClearFreePool()
 {
+    std::lock_guard lock(m_mutex);
     for (auto& [size, memoryChunk] : m_hostFreePool)
+    {
+        m_hostAllocatedByteSize -= memoryChunk.ByteSize;
         FreeHost(memoryChunk.Data);
+    }
     for (auto& [size, memoryChunk] : m_cudaFreePool)
+    {
+        m_cudaAllocatedByteSize -= memoryChunk.ByteSize;
         Compute::Cuda::CudaFree(memoryChunk.Data);
+    }
 
     m_hostFreePool.clear();
     m_cudaFreePool.clear();
 }
 
+void ResourceManager::ResetPeakByteSize()
+{
+    std::lock_guard lock(m_mutex);
+    m_hostPeakByteSize = m_hostAllocatedByteSize;
+    m_cudaPeakByteSize = m_cudaAllocatedByteSize;
+}
+
+void ResourceManager::m_addAllocatedHost(std::size_t byteSize)
+{
+    m_hostAllocatedByteSize += byteSize;
+    m_hostPeakByteSize = std::max(m_hostPeakByteSize, m_hostAllocatedByteSize);
+}
+
+void ResourceManager::m_addAllocatedCuda(std::size_t byteSize)
+{
+    m_cudaAllocatedByteSize += byteSize;
+    m_cudaPeakByteSize = std::max(m_cudaPeakByteSize, m_cudaAllocatedByteSize);
+}
+
 void ResourceManager::ClearAll()
 {
+#ifdef WITH_CUDA
     ClearCudnnConv2DMetaDataPool();
     ClearCudnnPool2DMetaDataPool();
     ClearCublasHandlePool();
     ClearCudnnHandlePool();
+#endif
     ClearPreservedPool();
     ClearVolatilePool();
     ClearFreePool();
 }
 
-
+#ifdef WITH_CUDA
 bool ResourceManager::HasConvConfig(Compute::Dense::Cuda::ConvConfig convConfig)
 {
+    std::lock_guard lock(m_mutex);
     return m_cudnnConv2DMetaDataPool.find(convConfig) !=
            m_cudnnConv2DMetaDataPool.end();
 }
 
 bool ResourceManager::HasPoolConfig(Compute::Dense::Cuda::PoolConfig poolConfig)
 {
+    std::lock_guard lock(m_mutex);
     return m_cudnnPool2DMetaDataPool.find(poolConfig) !=
            m_cudnnPool2DMetaDataPool.end();
 }
 
 bool ResourceManager::HasCublasHandle(int deviceId, std::thread::id tid)
 {
+    std::lock_guard lock(m_mutex);
     return m_cublasHandlePool.find(std::make_pair(deviceId, tid)) !=
            m_cublasHandlePool.end();
 }
 
 bool ResourceManager::HasCudnnHandle(int deviceId, std::thread::id id)
 {
+    std::lock_guard lock(m_mutex);
     return m_cudnnHandlePool.find(std::make_pair(deviceId, id)) !=
            m_cudnnHandlePool.end();
 }
+#endif
 
 std::unordered_map<std::intptr_t, MemoryChunk>
 ResourceManager::m_hostVolatilePool;
@@ -364,6 +470,7 @@ ResourceManager::m_hostPreservedPool;
 std::unordered_map<std::intptr_t, MemoryChunk>
 ResourceManager::m_cudaPreservedPool;
 
+#ifdef WITH_CUDA
 std::unordered_map<Compute::Dense::Cuda::ConvConfig,
                    Compute::Dense::Cuda::CudnnConv2DMetaData*, ConvMetaDataHash>
 ResourceManager::m_cudnnConv2DMetaDataPool;
@@ -379,4 +486,5 @@ ResourceManager::m_cublasHandlePool;
 std::unordered_map<std::pair<int, std::thread::id>, cudnnHandle_t*,
                    DeviceIdTidHash>
 ResourceManager::m_cudnnHandlePool;
+#endif
 } // namespace Sapphire::Util
@@ -0,0 +1,268 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/Serving/InferenceServer.hpp>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+namespace Sapphire::Util
+{
+namespace
+{
+double Percentile(std::vector<double> values, double percentile)
+{
+    if (values.empty())
+        return 0.0;
+    const auto idx = static_cast<std::size_t>(
+        percentile / 100.0 * static_cast<double>(values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + idx, values.end());
+    return values[idx];
+}
+} // namespace
+
+InferenceServer::InferenceServer(Shape sampleShape, const CudaDevice& device,
+                                 ComputeMode mode,
+                                 const SessionFactory& factory,
+                                 std::size_t maxBatchSize,
+                                 std::chrono::microseconds maxLatency,
+                                 int numSessions)
+    : m_sampleShape(std::move(sampleShape)),
+      m_device(device),
+      m_mode(mode),
+      m_maxBatchSize(maxBatchSize),
+      m_maxLatency(maxLatency)
+{
+    if (maxBatchSize < 1 || numSessions < 1)
+        throw std::invalid_argument(
+            "Util::InferenceServer - maxBatchSize and numSessions must be "
+            "larger than zero");
+
+    for (int sessionIdx = 0; sessionIdx < numSessions; ++sessionIdx)
+    {
+        Session session;
+        session.SessionModel = std::make_unique<Model>(
+            "InferenceServer session " + std::to_string(sessionIdx));
+        const ModelScope scope(*session.SessionModel);
+        session.Forward = factory();
+        m_sessions.emplace_back(std::move(session));
+    }
+}
+
+InferenceServer::~InferenceServer()
+{
+    Stop();
+    //! Units of the sessions are destroyed before their models
+    for (auto& session : m_sessions)
+        session.Forward = nullptr;
+}
+
+void InferenceServer::Start()
+{
+    std::lock_guard lock(m_mtx);
+    if (m_running)
+        throw std::runtime_error(
+            "Util::InferenceServer::Start - Already started");
+    m_stop = false;
+    m_running = true;
+    ResetStats();
+    for (std::size_t idx = 0; idx < m_sessions.size(); ++idx)
+        m_workers.emplace_back(&InferenceServer::m_workerLoop, this, idx);
+}
+
+void InferenceServer::Stop()
+{
+    {
+        std::lock_guard lock(m_mtx);
+        m_stop = true;
+        m_running = false;
+    }
+    m_requestCond.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+}
+
+std::future<std::vector<float>> InferenceServer::Submit(
+    std::vector<float> sample)
+{
+    if (sample.size() != SampleSize())
+        throw std::invalid_argument(
+            "Util::InferenceServer::Submit - Sample size mismatch Given size "
+            ": (" + std::to_string(sample.size()) + ") expected size : (" +
+            std::to_string(SampleSize()) + ")");
+
+    Request request;
+    request.Sample = std::move(sample);
+    request.Arrival = Clock::now();
+    auto future = request.Result.get_future();
+    {
+        std::lock_guard lock(m_mtx);
+        if (!m_running)
+            throw std::runtime_error(
+                "Util::InferenceServer::Submit - Server is not running");
+        m_queue.emplace_back(std::move(request));
+    }
+    m_requestCond.notify_one();
+    return future;
+}
+
+InferenceStats InferenceServer::GetStats() const
+{
+    std::lock_guard lock(m_statsMtx);
+    InferenceStats stats;
+    stats.NumRequests = m_numRequests;
+    stats.NumFailed = m_numFailed;
+    stats.NumBatches = m_numBatches;
+    if (m_numBatches > 0)
+        stats.MeanBatchSize = static_cast<double>(m_numRequests) /
+                              static_cast<double>(m_numBatches);
+
+    const std::chrono::duration<double> elapsed = Clock::now() - m_statsBegin;
+    if (elapsed.count() > 0.0)
+        stats.Throughput = static_cast<double>(m_numRequests) /
+                           elapsed.count();
+
+    stats.LatencyP50 = Percentile(m_latencies, 50.0);
+    stats.LatencyP95 = Percentile(m_latencies, 95.0);
+    stats.LatencyP99 = Percentile(m_latencies, 99.0);
+    return stats;
+}
+
+void InferenceServer::ResetStats()
+{
+    std::lock_guard lock(m_statsMtx);
+    m_statsBegin = Clock::now();
+    m_numRequests = 0;
+    m_numFailed = 0;
+    m_numBatches = 0;
+    m_latencies.clear();
+    m_latencyIdx = 0;
+}
+
+void InferenceServer::m_workerLoop(std::size_t sessionIdx)
+{
+    auto& session = m_sessions[sessionIdx];
+    const ModelScope scope(*session.SessionModel);
+
+    while (true)
+    {
+        std::vector<Request> batch;
+        {
+            std::unique_lock lock(m_mtx);
+            m_requestCond.wait(
+                lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+                return;
+
+            //! Waits for the batch to fill until the oldest request is due.
+            //! Requests are flushed without waiting when the server stops
+            const auto deadline = m_queue.front().Arrival + m_maxLatency;
+            m_requestCond.wait_until(lock, deadline, [this]() {
+                return m_stop || m_queue.size() >= m_maxBatchSize;
+            });
+            //! Other workers may have taken the requests while waiting
+            if (m_queue.empty())
+                continue;
+
+            const auto batchSize = std::min(m_queue.size(), m_maxBatchSize);
+            batch.reserve(batchSize);
+            for (std::size_t i = 0; i < batchSize; ++i)
+            {
+                batch.emplace_back(std::move(m_queue.front()));
+                m_queue.pop_front();
+            }
+            if (!m_queue.empty())
+                m_requestCond.notify_one();
+        }
+        m_runBatch(session, batch);
+    }
+}
+
+void InferenceServer::m_runBatch(Session& session, std::vector<Request>& batch)
+{
+    auto& model = ModelManager::CurModel();
+    const auto batchSize = batch.size();
+    const auto sampleSize = SampleSize();
+
+    std::vector<float> input(batchSize * sampleSize);
+    for (std::size_t i = 0; i < batchSize; ++i)
+        std::copy(batch[i].Sample.begin(), batch[i].Sample.end(),
+                  input.begin() + static_cast<std::ptrdiff_t>(i * sampleSize));
+
+    auto shapeVector = m_sampleShape.GetShapeVector();
+    shapeVector.insert(shapeVector.begin(), static_cast<int>(batchSize));
+
+    std::vector<float> output;
+    std::exception_ptr error = nullptr;
+    //! Checkpoint region keeps forward propagation from recording history,
+    //! and releases every tensor created by it when it ends
+    model.BeginCheckpointRegion();
+    try
+    {
+        Tensor x(Shape(shapeVector), m_device, Type::Dense);
+        if (m_mode == ComputeMode::Host)
+            x.ToHost();
+        else
+            x.ToCuda();
+        x.LoadData(input);
+
+        const auto y = session.Forward(x);
+        output = y.GetData();
+        if (output.size() % batchSize != 0)
+            throw std::runtime_error(
+                "Util::InferenceServer - Output size of the session is not "
+                "divisible by the batch size");
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    model.EndCheckpointRegion(-1);
+
+    //! Statistics are recorded before results are delivered, so callers
+    //! always see their own requests in the statistics
+    m_recordBatch(batch, error != nullptr);
+    if (error)
+    {
+        for (auto& request : batch)
+            request.Result.set_exception(error);
+        return;
+    }
+
+    const auto rowSize = output.size() / batchSize;
+    for (std::size_t i = 0; i < batchSize; ++i)
+    {
+        const auto begin = output.begin() +
+                           static_cast<std::ptrdiff_t>(i * rowSize);
+        batch[i].Result.set_value(std::vector<float>(
+            begin, begin + static_cast<std::ptrdiff_t>(rowSize)));
+    }
+}
+
+void InferenceServer::m_recordBatch(const std::vector<Request>& batch,
+                                    bool failed)
+{
+    const auto now = Clock::now();
+    std::lock_guard lock(m_statsMtx);
+    m_numBatches += 1;
+    m_numRequests += batch.size();
+    if (failed)
+        m_numFailed += batch.size();
+
+    for (const auto& request : batch)
+    {
+        const std::chrono::duration<double, std::milli> latency =
+            now - request.Arrival;
+        if (m_latencies.size() < LatencyWindow)
+            m_latencies.emplace_back(latency.count());
+        else
+            m_latencies[m_latencyIdx] = latency.count();
+        m_latencyIdx = (m_latencyIdx + 1) % LatencyWindow;
+    }
+}
+} // namespace Sapphire::Util
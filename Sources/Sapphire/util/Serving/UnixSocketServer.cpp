@@ -0,0 +1,330 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Sapphire/util/Serving/UnixSocketServer.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace Sapphire::Util
+{
+#ifndef _WIN32
+namespace
+{
+//! Broken connections are reported by return value instead of SIGPIPE
+#ifdef MSG_NOSIGNAL
+constexpr int SendFlags = MSG_NOSIGNAL;
+#else
+constexpr int SendFlags = 0;
+#endif
+
+bool ReadAll(int fd, void* data, std::size_t size)
+{
+    auto* ptr = static_cast<char*>(data);
+    while (size > 0)
+    {
+        const auto received = recv(fd, ptr, size, 0);
+        if (received < 0 && errno == EINTR)
+            continue;
+        if (received <= 0)
+            return false;
+        ptr += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+bool WriteAll(int fd, const void* data, std::size_t size)
+{
+    const auto* ptr = static_cast<const char*>(data);
+    while (size > 0)
+    {
+        const auto sent = send(fd, ptr, size, SendFlags);
+        if (sent < 0 && errno == EINTR)
+            continue;
+        if (sent <= 0)
+            return false;
+        ptr += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+bool WriteResponse(int fd, std::uint32_t status, const void* payload,
+                   std::uint32_t count, std::size_t elementSize)
+{
+    const std::uint32_t header[2] = { status, count };
+    return WriteAll(fd, header, sizeof(header)) &&
+           WriteAll(fd, payload, count * elementSize);
+}
+
+bool WriteError(int fd, const std::string& message)
+{
+    return WriteResponse(fd, 1, message.data(),
+                         static_cast<std::uint32_t>(message.size()), 1);
+}
+
+sockaddr_un SocketAddress(const std::string& socketPath)
+{
+    sockaddr_un address{};
+    if (socketPath.size() >= sizeof(address.sun_path))
+        throw std::invalid_argument(
+            "Util::UnixSocketServer - Socket path is too long");
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+    return address;
+}
+
+//! Removes socket file at the path. Other kinds of files are kept
+void RemoveSocketFile(const std::string& socketPath)
+{
+    struct stat status{};
+    if (lstat(socketPath.c_str(), &status) == 0 && S_ISSOCK(status.st_mode))
+        unlink(socketPath.c_str());
+}
+} // namespace
+#endif
+
+UnixSocketServer::UnixSocketServer(InferenceServer& server,
+                                   std::string socketPath)
+    : m_server(server),
+      m_socketPath(std::move(socketPath))
+{
+}
+
+UnixSocketServer::~UnixSocketServer()
+{
+    Stop();
+}
+
+#ifndef _WIN32
+void UnixSocketServer::Start()
+{
+    if (m_listenFd >= 0)
+        throw std::runtime_error(
+            "Util::UnixSocketServer::Start - Already started");
+
+    const auto address = SocketAddress(m_socketPath);
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        throw std::runtime_error(
+            "Util::UnixSocketServer::Start - Failed to create socket");
+
+    RemoveSocketFile(m_socketPath);
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&address),
+             sizeof(address)) != 0 ||
+        listen(fd, SOMAXCONN) != 0)
+    {
+        close(fd);
+        throw std::runtime_error(
+            "Util::UnixSocketServer::Start - Failed to listen on " +
+            m_socketPath);
+    }
+
+    m_listenFd = fd;
+    m_stop = false;
+    m_acceptThread = std::thread(&UnixSocketServer::m_acceptLoop, this);
+}
+
+void UnixSocketServer::Stop()
+{
+    if (m_listenFd < 0)
+        return;
+
+    m_stop = true;
+    //! Shutting down wakes the threads blocked on the sockets
+    shutdown(m_listenFd, SHUT_RDWR);
+    m_acceptThread.join();
+    close(m_listenFd);
+    m_listenFd = -1;
+
+    std::vector<std::thread> connectionThreads;
+    {
+        std::lock_guard lock(m_mtx);
+        for (const auto fd : m_connectionFds)
+            shutdown(fd, SHUT_RDWR);
+        connectionThreads.swap(m_connectionThreads);
+        m_finishedThreads.clear();
+    }
+    for (auto& thread : connectionThreads)
+        thread.join();
+    RemoveSocketFile(m_socketPath);
+}
+
+void UnixSocketServer::m_acceptLoop()
+{
+    while (!m_stop)
+    {
+        const int fd = accept(m_listenFd, nullptr, nullptr);
+        if (fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            return;
+        }
+
+        std::lock_guard lock(m_mtx);
+        if (m_stop)
+        {
+            close(fd);
+            return;
+        }
+        m_reapConnections();
+        m_connectionFds.emplace_back(fd);
+        m_connectionThreads.emplace_back(&UnixSocketServer::m_serveConnection,
+                                         this, fd);
+    }
+}
+
+void UnixSocketServer::m_serveConnection(int connectionFd)
+{
+    const auto sampleSize = m_server.SampleSize();
+    while (true)
+    {
+        std::uint32_t count = 0;
+        if (!ReadAll(connectionFd, &count, sizeof(count)))
+            break;
+        //! Stream cannot be resynchronized after a malformed request
+        if (count != sampleSize)
+        {
+            WriteError(connectionFd,
+                       "Util::UnixSocketServer - Sample size mismatch Given "
+                       "size : (" + std::to_string(count) +
+                       ") expected size : (" + std::to_string(sampleSize) +
+                       ")");
+            break;
+        }
+
+        std::vector<float> sample(count);
+        if (!ReadAll(connectionFd, sample.data(), count * sizeof(float)))
+            break;
+
+        bool sent = false;
+        try
+        {
+            const auto output = m_server.Submit(std::move(sample)).get();
+            sent = WriteResponse(connectionFd, 0, output.data(),
+                                 static_cast<std::uint32_t>(output.size()),
+                                 sizeof(float));
+        }
+        catch (const std::exception& e)
+        {
+            sent = WriteError(connectionFd, e.what());
+        }
+        if (!sent)
+            break;
+    }
+
+    std::lock_guard lock(m_mtx);
+    m_connectionFds.erase(std::find(m_connectionFds.begin(),
+                                    m_connectionFds.end(), connectionFd));
+    close(connectionFd);
+    m_finishedThreads.emplace_back(std::this_thread::get_id());
+}
+
+void UnixSocketServer::m_reapConnections()
+{
+    //! Finished threads only have to return after releasing m_mtx, so joining
+    //! them does not block
+    for (const auto threadId : m_finishedThreads)
+    {
+        const auto itr = std::find_if(
+            m_connectionThreads.begin(), m_connectionThreads.end(),
+            [threadId](const std::thread& thread) {
+                return thread.get_id() == threadId;
+            });
+        if (itr == m_connectionThreads.end())
+            continue;
+        itr->join();
+        m_connectionThreads.erase(itr);
+    }
+    m_finishedThreads.clear();
+}
+
+UnixSocketClient::UnixSocketClient(const std::string& socketPath)
+{
+    const auto address = SocketAddress(socketPath);
+    m_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_fd < 0)
+        throw std::runtime_error(
+            "Util::UnixSocketClient - Failed to create socket");
+    if (connect(m_fd, reinterpret_cast<const sockaddr*>(&address),
+                sizeof(address)) != 0)
+    {
+        close(m_fd);
+        throw std::runtime_error(
+            "Util::UnixSocketClient - Failed to connect to " + socketPath);
+    }
+}
+
+UnixSocketClient::~UnixSocketClient()
+{
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+std::vector<float> UnixSocketClient::Infer(const std::vector<float>& sample)
+{
+    const auto count = static_cast<std::uint32_t>(sample.size());
+    std::uint32_t header[2] = { 0, 0 };
+    if (!WriteAll(m_fd, &count, sizeof(count)) ||
+        !WriteAll(m_fd, sample.data(), sample.size() * sizeof(float)) ||
+        !ReadAll(m_fd, header, sizeof(header)))
+        throw std::runtime_error(
+            "Util::UnixSocketClient::Infer - Connection has been closed");
+
+    const auto [status, size] = header;
+    if (status == 0)
+    {
+        std::vector<float> output(size);
+        if (!ReadAll(m_fd, output.data(), size * sizeof(float)))
+            throw std::runtime_error(
+                "Util::UnixSocketClient::Infer - Connection has been closed");
+        return output;
+    }
+
+    std::string message(size, '\0');
+    if (!ReadAll(m_fd, message.data(), size))
+        throw std::runtime_error(
+            "Util::UnixSocketClient::Infer - Connection has been closed");
+    throw std::runtime_error(message);
+}
+#else
+void UnixSocketServer::Start()
+{
+    throw std::runtime_error(
+        "Util::UnixSocketServer::Start - Not supported on Windows");
+}
+
+void UnixSocketServer::Stop()
+{
+}
+
+UnixSocketClient::UnixSocketClient(const std::string& socketPath)
+{
+    throw std::runtime_error("Util::UnixSocketClient - Not supported on "
+                             "Windows");
+}
+
+UnixSocketClient::~UnixSocketClient() = default;
+
+std::vector<float> UnixSocketClient::Infer(const std::vector<float>& sample)
+{
+    throw std::runtime_error(
+        "Util::UnixSocketClient::Infer - Not supported on Windows");
+}
+#endif
+} // namespace Sapphire::Util
@@ -0,0 +1,181 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_BENCH_BENCHMARK_HPP
+#define SAPPHIRE_BENCH_BENCHMARK_HPP
+
+#include <Sapphire/tensor/TensorData.hpp>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Bench
+{
+//! Summary of measured iteration times in seconds
+struct Statistics
+{
+    double Min = 0.0;
+    double Max = 0.0;
+    double Mean = 0.0;
+    double Median = 0.0;
+    double StdDev = 0.0;
+    double P90 = 0.0;
+    std::size_t Iterations = 0;
+
+    //! Computes statistics of given samples
+    static Statistics Compute(std::vector<double> samples);
+};
+
+//! Peak performance of the machine measured with synthetic kernels
+//! Percent of peak is computed against min(PeakGFlops, intensity *
+//! PeakGBps), which is the attainable performance for the arithmetic
+//! intensity of each benchmark
+struct Roofline
+{
+    double PeakGFlops = 0.0;
+    double PeakGBps = 0.0;
+
+    //! Measures peak host compute throughput with independent FMA chains
+    //! and peak host memory bandwidth with stream triad
+    static Roofline MeasureHost(int numThreads = 0);
+
+    //! Attainable GFLOP/s for given arithmetic intensity (FLOP / byte)
+    [[nodiscard]] double Attainable(double intensity) const;
+};
+
+struct BenchmarkResult
+{
+    std::string Name;
+    std::string Group;
+    std::string Params;
+    ComputeMode Mode = ComputeMode::Host;
+    double Flops = 0.0;
+    double Bytes = 0.0;
+    Statistics Time;
+    double GFlops = 0.0;
+    double GBps = 0.0;
+    double PercentOfPeak = 0.0;
+    //! "compute" if the benchmark is bounded by compute in the roofline,
+    //! "memory" otherwise
+    std::string Bound;
+};
+
+struct BenchmarkConfig
+{
+    std::size_t WarmupIterations = 3;
+    std::size_t MinIterations = 10;
+    std::size_t MaxIterations = 1000;
+    //! Iterations are repeated until this time is spent or MaxIterations is
+    //! reached
+    double MinTimeSeconds = 0.25;
+    //! Only benchmarks whose "group/name" contains this string are run
+    std::string Filter;
+    ComputeMode Mode = ComputeMode::Host;
+
+    //! Batch sizes of end-to-end training benchmarks
+    std::vector<int> BatchSizes = { 32, 64, 128 };
+    //! Training steps excluded from the measurement
+    std::size_t TrainingWarmupSteps = 5;
+    std::size_t TrainingSteps = 50;
+};
+
+//! Result of end-to-end training benchmark on synthetic data
+//! Phase times are summed over measured steps in seconds
+struct TrainingResult
+{
+    std::string Model;
+    int BatchSize = 0;
+    ComputeMode Mode = ComputeMode::Host;
+    std::size_t Steps = 0;
+    double TotalTime = 0.0;
+    double SamplesPerSecond = 0.0;
+    //! Copying batch to the input tensors
+    double DataLoadTime = 0.0;
+    //! Forward propagation including loss
+    double ForwardTime = 0.0;
+    //! Back propagation excluding optimizer
+    double BackwardTime = 0.0;
+    //! Weight updates invoked during back propagation
+    double OptimizerTime = 0.0;
+    //! Clearing the graph and recycling memory, and the rest of the step
+    double OverheadTime = 0.0;
+    //! Peak bytes allocated by ResourceManager during the benchmark
+    std::size_t PeakHostBytes = 0;
+    std::size_t PeakCudaBytes = 0;
+};
+
+//! Runs benchmarks with warmup and repetition, and collects results
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner(BenchmarkConfig config, Roofline roofline);
+
+    [[nodiscard]] const BenchmarkConfig& Config() const
+    {
+        return m_config;
+    }
+
+    [[nodiscard]] const Roofline& GetRoofline() const
+    {
+        return m_roofline;
+    }
+
+    //! Returns true if benchmark with given group and name passes the filter
+    [[nodiscard]] bool Selected(const std::string& group,
+                                const std::string& name) const;
+
+    //! Times op and records its result
+    //! \param flops : floating point operations of single invocation
+    //! \param bytes : minimum bytes moved from/to memory by single invocation
+    //! \param op : op to benchmark. It is invoked on Config().Mode, and cuda
+    //! device is synchronized after each invocation
+    void Run(const std::string& group, const std::string& name,
+             const std::string& params, double flops, double bytes,
+             const std::function<void()>& op);
+
+    [[nodiscard]] const std::vector<BenchmarkResult>& Results() const
+    {
+        return m_results;
+    }
+
+    void AddTrainingResult(TrainingResult result);
+
+    [[nodiscard]] const std::vector<TrainingResult>& TrainingResults() const
+    {
+        return m_trainingResults;
+    }
+
+    //! Prints table of results to stdout
+    void Print() const;
+
+    //! Writes results, roofline and configuration as JSON
+    void WriteJson(const std::filesystem::path& filePath) const;
+
+private:
+    BenchmarkConfig m_config;
+    Roofline m_roofline;
+    std::vector<BenchmarkResult> m_results;
+    std::vector<TrainingResult> m_trainingResults;
+};
+
+//! Waits for queued operations of the device to complete
+void Synchronize(ComputeMode mode);
+
+//! Creates preserved tensor on the configured device filled with normal
+//! distribution
+TensorUtil::TensorData MakeTensor(const Shape& shape, ComputeMode mode);
+
+void GemmBenchmark(BenchmarkRunner& runner);
+void ElementwiseBenchmark(BenchmarkRunner& runner);
+void ConvolutionBenchmark(BenchmarkRunner& runner);
+void ActivationBenchmark(BenchmarkRunner& runner);
+void ReductionBenchmark(BenchmarkRunner& runner);
+void AllocationBenchmark(BenchmarkRunner& runner);
+void TrainingBenchmark(BenchmarkRunner& runner);
+} // namespace Sapphire::Bench
+
+#endif
@@ -0,0 +1,46 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/compute/ActivationOps.hpp>
+
+namespace Sapphire::Bench
+{
+void ActivationBenchmark(BenchmarkRunner& runner)
+{
+    const auto mode = runner.Config().Mode;
+
+    //! (batch, classes) of softmax inputs
+    for (const auto& [rows, cols] : std::vector<std::pair<int, int>>{
+             { 64, 10 }, { 256, 1000 }, { 64, 32000 } })
+    {
+        if (!runner.Selected("Activation", "SoftMax"))
+            break;
+
+        auto y = MakeTensor(Shape({ rows, cols }), mode);
+        const auto x = MakeTensor(Shape({ rows, cols }), mode);
+        const auto size = static_cast<double>(x.Size());
+        //! max, exp, sum and division per element
+        runner.Run("Activation", "SoftMax",
+                   "[" + std::to_string(rows) + "," + std::to_string(cols) +
+                   "]",
+                   4.0 * size, 2.0 * 4.0 * size,
+                   [&]() { Compute::SoftMax(y, x); });
+    }
+
+    for (const int size : { 1 << 16, 1 << 20, 1 << 24 })
+    {
+        if (!runner.Selected("Activation", "ReLU"))
+            break;
+
+        auto y = MakeTensor(Shape({ size }), mode);
+        const auto x = MakeTensor(Shape({ size }), mode);
+        runner.Run("Activation", "ReLU", "size=" + std::to_string(size),
+                   static_cast<double>(size), 2.0 * 4.0 * size,
+                   [&]() { Compute::ReLU(y, x); });
+    }
+}
+} // namespace Sapphire::Bench
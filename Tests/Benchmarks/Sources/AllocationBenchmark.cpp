@@ -0,0 +1,41 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+
+namespace Sapphire::Bench
+{
+void AllocationBenchmark(BenchmarkRunner& runner)
+{
+    const auto mode = runner.Config().Mode;
+    const auto allocate = [mode](std::size_t byteSize) {
+        if (mode == ComputeMode::Cuda)
+            return Util::ResourceManager::GetMemoryCuda(byteSize);
+        return Util::ResourceManager::GetMemoryHost(byteSize);
+    };
+
+    for (const std::size_t byteSize :
+         { std::size_t(4) << 10, std::size_t(1) << 20, std::size_t(64) << 20 })
+    {
+        const auto params = "bytes=" + std::to_string(byteSize);
+
+        //! Runner returns volatile memory to the free pool after each
+        //! iteration, so every allocation after the first one is a pool hit
+        runner.Run("Allocation", "Pooled", params, 0.0, 0.0,
+                   [&]() { static_cast<void>(allocate(byteSize)); });
+
+        //! Free pool is released before each allocation, so each iteration
+        //! pays for one system allocation and one release
+        runner.Run("Allocation", "AllocateAndFree", params, 0.0, 0.0, [&]() {
+            Util::ResourceManager::ClearFreePool();
+            static_cast<void>(allocate(byteSize));
+        });
+    }
+    Util::ResourceManager::Clean();
+    Util::ResourceManager::ClearFreePool();
+}
+} // namespace Sapphire::Bench
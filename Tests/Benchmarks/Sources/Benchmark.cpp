@@ -0,0 +1,376 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/cudaUtil/Memory.hpp>
+#include <Sapphire/util/CpuFeatures.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <omp.h>
+
+namespace Sapphire::Bench
+{
+namespace
+{
+const char* ModeName(ComputeMode mode)
+{
+    return mode == ComputeMode::Cuda ? "cuda" : "host";
+}
+
+std::string EscapeJson(const std::string& str)
+{
+    std::string escaped;
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+} // namespace
+
+void Synchronize(ComputeMode mode)
+{
+#ifdef WITH_CUDA
+    if (mode == ComputeMode::Cuda)
+        Compute::Cuda::CudaDeviceSynchronize();
+#else
+    static_cast<void>(mode);
+#endif
+}
+
+Statistics Statistics::Compute(std::vector<double> samples)
+{
+    Statistics stats;
+    if (samples.empty())
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+    const auto size = samples.size();
+    stats.Iterations = size;
+    stats.Min = samples.front();
+    stats.Max = samples.back();
+    stats.Mean = std::accumulate(samples.begin(), samples.end(), 0.0) /
+                 static_cast<double>(size);
+    stats.Median = size % 2 == 1
+                       ? samples[size / 2]
+                       : (samples[size / 2 - 1] + samples[size / 2]) / 2.0;
+    stats.P90 = samples[std::min(
+        size - 1, static_cast<std::size_t>(0.9 * static_cast<double>(size)))];
+
+    double variance = 0.0;
+    for (const auto sample : samples)
+        variance += (sample - stats.Mean) * (sample - stats.Mean);
+    stats.StdDev =
+        size > 1 ? std::sqrt(variance / static_cast<double>(size - 1)) : 0.0;
+    return stats;
+}
+
+Roofline Roofline::MeasureHost(int numThreads)
+{
+    if (numThreads <= 0)
+        numThreads = omp_get_max_threads();
+
+    Roofline roofline;
+
+    //! Compute peak : each thread updates independent accumulators so that
+    //! FMA latency is hidden and the loop is vectorized
+    {
+        constexpr int numAccumulators = 64;
+        constexpr long iterations = 1 << 22;
+        double best = 0.0;
+        for (int rep = 0; rep < 3; ++rep)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            float sink = 0.0f;
+#pragma omp parallel num_threads(numThreads) reduction(+ : sink)
+            {
+                float acc[numAccumulators];
+                for (int i = 0; i < numAccumulators; ++i)
+                    acc[i] = static_cast<float>(i + omp_get_thread_num());
+                const float a = 0.999999f, b = 1e-7f;
+                for (long it = 0; it < iterations; ++it)
+                {
+#pragma omp simd
+                    for (int i = 0; i < numAccumulators; ++i)
+                        acc[i] = acc[i] * a + b;
+                }
+                for (int i = 0; i < numAccumulators; ++i)
+                    sink += acc[i];
+            }
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            //! Prevent the kernel from being optimized out
+            if (sink == 0.123f)
+                std::cout << sink;
+            const auto flops = 2.0 * numAccumulators *
+                               static_cast<double>(iterations) * numThreads;
+            best = std::max(best, flops / elapsed.count() * 1e-9);
+        }
+        roofline.PeakGFlops = best;
+    }
+
+    //! Memory peak : stream triad over arrays larger than the last level cache
+    {
+        constexpr std::size_t size = 1 << 24;
+        std::vector<float> a(size), b(size, 1.0f), c(size, 2.0f);
+#pragma omp parallel for num_threads(numThreads) schedule(static)
+        for (long i = 0; i < static_cast<long>(size); ++i)
+            a[i] = 0.0f;
+
+        double best = 0.0;
+        for (int rep = 0; rep < 5; ++rep)
+        {
+            const auto start = std::chrono::steady_clock::now();
+#pragma omp parallel for num_threads(numThreads) schedule(static)
+            for (long i = 0; i < static_cast<long>(size); ++i)
+                a[i] = b[i] + 3.0f * c[i];
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            const auto bytes = 3.0 * static_cast<double>(size) * sizeof(float);
+            best = std::max(best, bytes / elapsed.count() * 1e-9);
+        }
+        roofline.PeakGBps = best;
+    }
+
+    return roofline;
+}
+
+double Roofline::Attainable(double intensity) const
+{
+    return std::min(PeakGFlops, intensity * PeakGBps);
+}
+
+BenchmarkRunner::BenchmarkRunner(BenchmarkConfig config, Roofline roofline)
+    : m_config(std::move(config)),
+      m_roofline(roofline)
+{
+}
+
+bool BenchmarkRunner::Selected(const std::string& group,
+                               const std::string& name) const
+{
+    return m_config.Filter.empty() ||
+           (group + "/" + name).find(m_config.Filter) != std::string::npos;
+}
+
+void BenchmarkRunner::Run(const std::string& group, const std::string& name,
+                          const std::string& params, double flops,
+                          double bytes, const std::function<void()>& op)
+{
+    if (!Selected(group, name))
+        return;
+
+    const auto mode = m_config.Mode;
+    for (std::size_t i = 0; i < m_config.WarmupIterations; ++i)
+    {
+        op();
+        Synchronize(mode);
+        Util::ResourceManager::Clean();
+    }
+
+    std::vector<double> samples;
+    double totalTime = 0.0;
+    while (samples.size() < m_config.MaxIterations &&
+           (samples.size() < m_config.MinIterations ||
+            totalTime < m_config.MinTimeSeconds))
+    {
+        const auto start = std::chrono::steady_clock::now();
+        op();
+        Synchronize(mode);
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        //! Scratch buffers of the op are returned to the free pool outside of
+        //! the timed region
+        Util::ResourceManager::Clean();
+        samples.emplace_back(elapsed.count());
+        totalTime += elapsed.count();
+    }
+
+    BenchmarkResult result;
+    result.Name = name;
+    result.Group = group;
+    result.Params = params;
+    result.Mode = mode;
+    result.Flops = flops;
+    result.Bytes = bytes;
+    result.Time = Statistics::Compute(std::move(samples));
+
+    //! Throughput is computed from the median to be robust against outliers
+    const auto seconds = result.Time.Median;
+    result.GFlops = seconds > 0.0 ? flops / seconds * 1e-9 : 0.0;
+    result.GBps = seconds > 0.0 ? bytes / seconds * 1e-9 : 0.0;
+
+    if (mode == ComputeMode::Host && bytes > 0.0)
+    {
+        const auto intensity = flops / bytes;
+        const auto attainable = m_roofline.Attainable(intensity);
+        result.Bound =
+            intensity * m_roofline.PeakGBps < m_roofline.PeakGFlops
+                ? "memory"
+                : "compute";
+        //! Ops without arithmetic are measured against memory bandwidth
+        result.PercentOfPeak =
+            flops > 0.0
+                ? (attainable > 0.0 ? 100.0 * result.GFlops / attainable : 0.0)
+                : (m_roofline.PeakGBps > 0.0
+                       ? 100.0 * result.GBps / m_roofline.PeakGBps
+                       : 0.0);
+    }
+
+    m_results.emplace_back(std::move(result));
+    const auto& last = m_results.back();
+    std::printf("%-12s %-22s %-28s %10.3f us %9.3f GFLOP/s %9.3f GB/s "
+                "%6.1f %%\n",
+                last.Group.c_str(), last.Name.c_str(), last.Params.c_str(),
+                last.Time.Median * 1e6, last.GFlops, last.GBps,
+                last.PercentOfPeak);
+    std::fflush(stdout);
+}
+
+void BenchmarkRunner::AddTrainingResult(TrainingResult result)
+{
+    m_trainingResults.emplace_back(std::move(result));
+    const auto& last = m_trainingResults.back();
+    std::printf("%-12s %-22s batch=%-5d %10.1f samples/s\n", "Training",
+                last.Model.c_str(), last.BatchSize, last.SamplesPerSecond);
+    std::fflush(stdout);
+}
+
+void BenchmarkRunner::Print() const
+{
+    std::printf("\nRoofline : %.2f GFLOP/s, %.2f GB/s, host kernels : %s\n",
+                m_roofline.PeakGFlops, m_roofline.PeakGBps,
+                Util::SimdLevelToString(Util::GetSimdLevel()).c_str());
+    std::printf("%-12s %-22s %-28s %6s %12s %12s %12s %10s %10s %8s %-8s\n",
+                "Group", "Name", "Params", "Dev", "Median(us)", "Mean(us)",
+                "StdDev(us)", "GFLOP/s", "GB/s", "%Peak", "Bound");
+    for (const auto& result : m_results)
+    {
+        std::printf(
+            "%-12s %-22s %-28s %6s %12.3f %12.3f %12.3f %10.3f %10.3f %8.1f "
+            "%-8s\n",
+            result.Group.c_str(), result.Name.c_str(), result.Params.c_str(),
+            ModeName(result.Mode), result.Time.Median * 1e6,
+            result.Time.Mean * 1e6, result.Time.StdDev * 1e6, result.GFlops,
+            result.GBps, result.PercentOfPeak, result.Bound.c_str());
+    }
+
+    if (m_trainingResults.empty())
+        return;
+
+    std::printf("\n%-14s %6s %6s %12s %10s %10s %10s %10s %10s %12s %12s\n",
+                "Model", "Dev", "Batch", "Samples/s", "Load(ms)", "Fwd(ms)",
+                "Bwd(ms)", "Optim(ms)", "Other(ms)", "PeakHost(MB)",
+                "PeakCuda(MB)");
+    for (const auto& result : m_trainingResults)
+    {
+        const auto perStep = 1e3 / static_cast<double>(result.Steps);
+        std::printf(
+            "%-14s %6s %6d %12.1f %10.3f %10.3f %10.3f %10.3f %10.3f %12.2f "
+            "%12.2f\n",
+            result.Model.c_str(), ModeName(result.Mode), result.BatchSize,
+            result.SamplesPerSecond, result.DataLoadTime * perStep,
+            result.ForwardTime * perStep, result.BackwardTime * perStep,
+            result.OptimizerTime * perStep, result.OverheadTime * perStep,
+            static_cast<double>(result.PeakHostBytes) / (1 << 20),
+            static_cast<double>(result.PeakCudaBytes) / (1 << 20));
+    }
+}
+
+void BenchmarkRunner::WriteJson(const std::filesystem::path& filePath) const
+{
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file.is_open())
+        throw std::runtime_error(
+            "BenchmarkRunner::WriteJson - Could not open file (" +
+            filePath.string() + ")");
+
+    file.precision(9);
+    file << "{\n  \"roofline\": {\"peak_gflops\": " << m_roofline.PeakGFlops
+        << ", \"peak_gbps\": " << m_roofline.PeakGBps << "},\n"
+        << "  \"config\": {\"warmup\": " << m_config.WarmupIterations
+        << ", \"min_iterations\": " << m_config.MinIterations
+        << ", \"max_iterations\": " << m_config.MaxIterations
+        << ", \"min_time\": " << m_config.MinTimeSeconds
+        << ", \"threads\": " << omp_get_max_threads()
+        << ", \"simd_level\": \""
+        << Util::SimdLevelToString(Util::GetSimdLevel()) << "\""
+        << ", \"training_warmup\": " << m_config.TrainingWarmupSteps
+        << ", \"training_steps\": " << m_config.TrainingSteps << "},\n"
+        << "  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < m_results.size(); ++i)
+    {
+        const auto& result = m_results[i];
+        file << (i == 0 ? "\n" : ",\n") << "    {\"group\": \""
+            << EscapeJson(result.Group) << "\", \"name\": \""
+            << EscapeJson(result.Name) << "\", \"params\": \""
+            << EscapeJson(result.Params) << "\", \"device\": \""
+            << ModeName(result.Mode) << "\", \"flops\": " << result.Flops
+            << ", \"bytes\": " << result.Bytes
+            << ", \"iterations\": " << result.Time.Iterations
+            << ", \"min_s\": " << result.Time.Min
+            << ", \"max_s\": " << result.Time.Max
+            << ", \"mean_s\": " << result.Time.Mean
+            << ", \"median_s\": " << result.Time.Median
+            << ", \"stddev_s\": " << result.Time.StdDev
+            << ", \"p90_s\": " << result.Time.P90
+            << ", \"gflops\": " << result.GFlops
+            << ", \"gbps\": " << result.GBps
+            << ", \"percent_of_peak\": " << result.PercentOfPeak
+            << ", \"bound\": \"" << result.Bound << "\"}";
+    }
+    file << "\n  ],\n  \"training\": [";
+
+    for (std::size_t i = 0; i < m_trainingResults.size(); ++i)
+    {
+        const auto& result = m_trainingResults[i];
+        file << (i == 0 ? "\n" : ",\n") << "    {\"model\": \""
+            << EscapeJson(result.Model) << "\", \"device\": \""
+            << ModeName(result.Mode) << "\", \"batch_size\": "
+            << result.BatchSize << ", \"steps\": " << result.Steps
+            << ", \"total_s\": " << result.TotalTime
+            << ", \"samples_per_second\": " << result.SamplesPerSecond
+            << ", \"data_load_s\": " << result.DataLoadTime
+            << ", \"forward_s\": " << result.ForwardTime
+            << ", \"backward_s\": " << result.BackwardTime
+            << ", \"optimizer_s\": " << result.OptimizerTime
+            << ", \"overhead_s\": " << result.OverheadTime
+            << ", \"peak_host_bytes\": " << result.PeakHostBytes
+            << ", \"peak_cuda_bytes\": " << result.PeakCudaBytes << "}";
+    }
+    file << "\n  ]\n}\n";
+}
+
+TensorUtil::TensorData MakeTensor(const Shape& shape, ComputeMode mode)
+{
+    //! Tensors are preserved so that they are not recycled when scratch
+    //! buffers are returned to the free pool between iterations
+    if (mode == ComputeMode::Host)
+    {
+        TensorUtil::TensorData tensorData(shape, Type::Dense, true);
+        Compute::Initialize::Normal(tensorData, 0.0f, 1.0f);
+        return tensorData;
+    }
+
+    const CudaDevice cuda(0, "cuda0");
+    TensorUtil::TensorData tensorData(shape, Type::Dense, cuda, true);
+    tensorData.SetMode(ComputeMode::Host);
+    Compute::Initialize::Normal(tensorData, 0.0f, 1.0f);
+    tensorData.ToCuda();
+    tensorData.SetMode(ComputeMode::Cuda);
+    return tensorData;
+}
+} // namespace Sapphire::Bench
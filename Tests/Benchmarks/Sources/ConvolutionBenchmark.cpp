@@ -0,0 +1,132 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/compute/ConvolutionOps.hpp>
+#include <Sapphire/compute/dense/naive/Convolution.hpp>
+#include <array>
+
+namespace Sapphire::Bench
+{
+namespace
+{
+struct ConvShape
+{
+    int N, C, H, W;
+    int K, R, S;
+    int Stride, Padding;
+
+    [[nodiscard]] int OutRows() const
+    {
+        return (H + 2 * Padding - R) / Stride + 1;
+    }
+
+    [[nodiscard]] int OutCols() const
+    {
+        return (W + 2 * Padding - S) / Stride + 1;
+    }
+
+    [[nodiscard]] std::string ToString() const
+    {
+        return "N=" + std::to_string(N) + " C=" + std::to_string(C) + " " +
+               std::to_string(H) + "x" + std::to_string(W) + " K=" +
+               std::to_string(K) + " " + std::to_string(R) + "x" +
+               std::to_string(S) + " s" + std::to_string(Stride);
+    }
+};
+} // namespace
+
+void ConvolutionBenchmark(BenchmarkRunner& runner)
+{
+    const auto mode = runner.Config().Mode;
+
+    //! First shape is the first layer of Conv2DModel in the unit tests
+    const std::vector<ConvShape> shapes = {
+        { 32, 3, 32, 32, 8, 3, 3, 1, 1 },
+        { 32, 1, 28, 28, 8, 3, 3, 1, 0 },
+        { 32, 8, 28, 28, 16, 3, 3, 1, 1 },
+        { 8, 32, 32, 32, 64, 3, 3, 1, 1 },
+        { 8, 64, 32, 32, 64, 1, 1, 1, 0 },
+        { 8, 64, 32, 32, 128, 3, 3, 2, 1 },
+    };
+
+    for (const auto& shape : shapes)
+    {
+        if (!runner.Selected("Convolution", "Im2Col") &&
+            !runner.Selected("Convolution", "Conv2DForward"))
+            break;
+
+        const auto outRows = shape.OutRows(), outCols = shape.OutCols();
+        const auto x = MakeTensor(Shape({ shape.N, shape.C, shape.H, shape.W }),
+                                  mode);
+        const auto filter =
+            MakeTensor(Shape({ shape.K, shape.C, shape.R, shape.S }), mode);
+        auto y = MakeTensor(Shape({ shape.N, shape.K, outRows, outCols }),
+                            mode);
+
+        const auto xSize = static_cast<double>(x.Size());
+        const auto ySize = static_cast<double>(y.Size());
+        const auto patchSize =
+            static_cast<double>(shape.C) * shape.R * shape.S;
+
+        //! Im2Col is only implemented on host
+        if (mode == ComputeMode::Host &&
+            runner.Selected("Convolution", "Im2Col"))
+        {
+            auto matrix = MakeTensor(
+                Shape({ shape.N, shape.C * shape.R * shape.S,
+                        outRows * outCols }),
+                mode);
+            runner.Run("Convolution", "Im2Col", shape.ToString(), 0.0,
+                       4.0 * (xSize + static_cast<double>(matrix.Size())),
+                       [&]() {
+                           Compute::Dense::Naive::Im2Col(
+                               matrix, filter, x, shape.Stride, shape.Stride,
+                               shape.Padding, shape.Padding, 1, 1);
+                       });
+        }
+
+        runner.Run("Convolution", "Conv2DForward", shape.ToString(),
+                   2.0 * ySize * patchSize,
+                   4.0 * (xSize + ySize + static_cast<double>(filter.Size())),
+                   [&]() {
+                       Compute::Conv2DForward(y, x, filter, shape.Stride,
+                                              shape.Stride, 1, 1,
+                                              shape.Padding, shape.Padding);
+                   });
+    }
+
+    //! Pooling with 2x2 window and stride 2
+    for (const auto& [N, C, H, W] :
+         std::vector<std::array<int, 4>>{ { 32, 8, 28, 28 },
+                                          { 32, 16, 32, 32 },
+                                          { 8, 64, 64, 64 } })
+    {
+        if (!runner.Selected("Convolution", "MaxPool2DForward") &&
+            !runner.Selected("Convolution", "AvgPool2DForward"))
+            break;
+
+        const auto x = MakeTensor(Shape({ N, C, H, W }), mode);
+        auto y = MakeTensor(Shape({ N, C, H / 2, W / 2 }), mode);
+        const auto params = "N=" + std::to_string(N) + " C=" +
+                            std::to_string(C) + " " + std::to_string(H) +
+                            "x" + std::to_string(W) + " 2x2";
+        const auto flops = static_cast<double>(y.Size()) * 4.0;
+        const auto bytes = 4.0 * static_cast<double>(x.Size() + y.Size());
+
+        runner.Run("Convolution", "MaxPool2DForward", params, flops, bytes,
+                   [&]() {
+                       Compute::MaxPool2DForward(y, x, 2, 2, 2, 2, 0, 0);
+                   });
+        //! Average pooling is only implemented on cuda
+        if (mode == ComputeMode::Cuda)
+            runner.Run("Convolution", "AvgPool2DForward", params, flops,
+                       bytes, [&]() {
+                           Compute::AvgPool2DForward(y, x, 2, 2, 2, 2, 0, 0);
+                       });
+    }
+}
+} // namespace Sapphire::Bench
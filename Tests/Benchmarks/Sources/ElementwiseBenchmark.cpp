@@ -0,0 +1,90 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/TrigonometricOps.hpp>
+
+namespace Sapphire::Bench
+{
+namespace
+{
+using TensorUtil::TensorData;
+
+struct ElementwiseOp
+{
+    const char* Name;
+    //! Number of tensors read and written per element
+    int NumOperands;
+    std::function<void(TensorData&, const TensorData&, const TensorData&)> Op;
+};
+} // namespace
+
+void ElementwiseBenchmark(BenchmarkRunner& runner)
+{
+    const auto mode = runner.Config().Mode;
+
+    const std::vector<ElementwiseOp> ops = {
+        { "Add", 3,
+          [](TensorData& y, const TensorData& a, const TensorData& b) {
+              Compute::Add(y, a, b);
+          } },
+        { "Dot", 3,
+          [](TensorData& y, const TensorData& a, const TensorData& b) {
+              Compute::Dot(y, a, b);
+          } },
+        { "Scale", 2,
+          [](TensorData& y, const TensorData& a, const TensorData&) {
+              Compute::Scale(y, a, 0.5f);
+          } },
+        { "Pow", 2,
+          [](TensorData& y, const TensorData& a, const TensorData&) {
+              Compute::Pow(y, a, 2.0f);
+          } },
+        { "Tanh", 2,
+          [](TensorData& y, const TensorData& a, const TensorData&) {
+              Compute::Tanh(y, a);
+          } },
+    };
+
+    bool selected = false;
+    for (const auto& op : ops)
+        selected |= runner.Selected("Elementwise", op.Name);
+
+    //! Sizes range from L1 resident to DRAM resident
+    for (const int size : { 1 << 12, 1 << 16, 1 << 20, 1 << 24 })
+    {
+        if (!selected)
+            break;
+
+        const auto elements = static_cast<double>(size);
+        auto y = MakeTensor(Shape({ size }), mode);
+        const auto a = MakeTensor(Shape({ size }), mode);
+        const auto b = MakeTensor(Shape({ size }), mode);
+
+        for (const auto& op : ops)
+            runner.Run("Elementwise", op.Name,
+                       "size=" + std::to_string(size), elements,
+                       op.NumOperands * 4.0 * elements,
+                       [&]() { op.Op(y, a, b); });
+    }
+
+    //! Broadcast of the second operand along the batch dimension
+    if (runner.Selected("Elementwise", "AddBroadcast"))
+    {
+        const int batchSize = 64, rows = 256, cols = 256;
+        const auto outSize = static_cast<double>(batchSize) * rows * cols;
+        auto y = MakeTensor(Shape({ batchSize, rows, cols }), mode);
+        const auto a = MakeTensor(Shape({ batchSize, rows, cols }), mode);
+        const auto b = MakeTensor(Shape({ 1, rows, cols }), mode);
+        runner.Run("Elementwise", "AddBroadcast",
+                   "B=" + std::to_string(batchSize) + " [" +
+                   std::to_string(rows) + "," + std::to_string(cols) + "]",
+                   outSize, 4.0 * (2.0 * outSize + rows * cols),
+                   [&]() { Compute::Add(y, a, b); });
+    }
+}
+} // namespace Sapphire::Bench
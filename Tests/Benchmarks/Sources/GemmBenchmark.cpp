@@ -0,0 +1,62 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <array>
+
+namespace Sapphire::Bench
+{
+void GemmBenchmark(BenchmarkRunner& runner)
+{
+    const auto mode = runner.Config().Mode;
+
+    //! Square shapes, and shapes taken from the Linear layers of the models
+    //! in the unit tests (batch x in x out)
+    const std::vector<std::array<int, 3>> shapes = {
+        { 64, 64, 64 }, { 128, 128, 128 }, { 256, 256, 256 },
+        { 512, 512, 512 }, { 64, 100, 784 }, { 64, 10, 100 },
+        { 1024, 64, 1024 }, { 32, 1024, 1024 }
+    };
+
+    for (const auto& [M, N, K] : shapes)
+    {
+        if (!runner.Selected("Gemm", "Gemm"))
+            break;
+
+        const std::string params = "M=" + std::to_string(M) + " N=" +
+                                   std::to_string(N) + " K=" +
+                                   std::to_string(K);
+        auto y = MakeTensor(Shape({ M, N }), mode);
+        const auto a = MakeTensor(Shape({ M, K }), mode);
+        const auto b = MakeTensor(Shape({ K, N }), mode);
+
+        const auto flops = 2.0 * M * N * K;
+        const auto bytes = 4.0 * (static_cast<double>(M) * K +
+                                  static_cast<double>(K) * N +
+                                  static_cast<double>(M) * N);
+        runner.Run("Gemm", "Gemm", params, flops, bytes,
+                   [&]() { Compute::Gemm(y, a, b); });
+    }
+
+    //! Batched Gemm with broadcast of the second operand
+    const int batchSize = 16, M = 128, N = 128, K = 128;
+    if (runner.Selected("Gemm", "GemmBroadcast"))
+    {
+        auto y = MakeTensor(Shape({ batchSize, M, N }), mode);
+        const auto a = MakeTensor(Shape({ batchSize, M, K }), mode);
+        const auto b = MakeTensor(Shape({ 1, K, N }), mode);
+        const auto flops = 2.0 * batchSize * M * N * K;
+        const auto bytes =
+            4.0 * (static_cast<double>(batchSize) * (M * K + M * N) + K * N);
+        runner.Run("Gemm", "GemmBroadcast",
+                   "B=" + std::to_string(batchSize) + " M=" +
+                   std::to_string(M) + " N=" + std::to_string(N) + " K=" +
+                   std::to_string(K),
+                   flops, bytes, [&]() { Compute::Gemm(y, a, b); });
+    }
+}
+} // namespace Sapphire::Bench
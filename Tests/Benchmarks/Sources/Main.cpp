@@ -0,0 +1,128 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+void PrintUsage(const char* program)
+{
+    std::printf(
+        "Usage : %s [options]\n"
+        "  --filter <str>        Runs benchmarks whose group/name contains str\n"
+        "  --json <path>         Writes results as JSON to path\n"
+        "  --cuda                Runs benchmarks on cuda device 0\n"
+        "  --warmup <n>          Warmup iterations (default 3)\n"
+        "  --min-iterations <n>  Minimum timed iterations (default 10)\n"
+        "  --max-iterations <n>  Maximum timed iterations (default 1000)\n"
+        "  --min-time <sec>      Minimum timed duration (default 0.25)\n"
+        "  --peak-gflops <v>     Uses given peak instead of measuring it\n"
+        "  --peak-gbps <v>       Uses given bandwidth instead of measuring it\n"
+        "  --batch-sizes <list>  Comma separated batch sizes of training "
+        "benchmarks\n"
+        "                        (default 32,64,128)\n"
+        "  --training-warmup <n> Training steps excluded from measurement "
+        "(default 5)\n"
+        "  --training-steps <n>  Measured training steps (default 50)\n",
+        program);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    using namespace Sapphire;
+
+    Bench::BenchmarkConfig config;
+    std::string jsonPath;
+    double peakGFlops = 0.0, peakGBps = 0.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const auto hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue)
+            config.Filter = argv[++i];
+        else if (arg == "--json" && hasValue)
+            jsonPath = argv[++i];
+        else if (arg == "--cuda")
+            config.Mode = ComputeMode::Cuda;
+        else if (arg == "--warmup" && hasValue)
+            config.WarmupIterations = std::stoul(argv[++i]);
+        else if (arg == "--min-iterations" && hasValue)
+            config.MinIterations = std::stoul(argv[++i]);
+        else if (arg == "--max-iterations" && hasValue)
+            config.MaxIterations = std::stoul(argv[++i]);
+        else if (arg == "--min-time" && hasValue)
+            config.MinTimeSeconds = std::stod(argv[++i]);
+        else if (arg == "--peak-gflops" && hasValue)
+            peakGFlops = std::stod(argv[++i]);
+        else if (arg == "--peak-gbps" && hasValue)
+            peakGBps = std::stod(argv[++i]);
+        else if (arg == "--batch-sizes" && hasValue)
+        {
+            config.BatchSizes.clear();
+            std::stringstream list(argv[++i]);
+            std::string batchSize;
+            while (std::getline(list, batchSize, ','))
+                config.BatchSizes.emplace_back(std::stoi(batchSize));
+        }
+        else if (arg == "--training-warmup" && hasValue)
+            config.TrainingWarmupSteps = std::stoul(argv[++i]);
+        else if (arg == "--training-steps" && hasValue)
+            config.TrainingSteps = std::stoul(argv[++i]);
+        else
+        {
+            PrintUsage(argv[0]);
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+#ifndef WITH_CUDA
+    if (config.Mode == ComputeMode::Cuda)
+    {
+        std::cerr << "SapphireBench was built without cuda" << std::endl;
+        return 1;
+    }
+#endif
+
+    auto roofline = Bench::Roofline::MeasureHost();
+    if (peakGFlops > 0.0)
+        roofline.PeakGFlops = peakGFlops;
+    if (peakGBps > 0.0)
+        roofline.PeakGBps = peakGBps;
+    std::printf("Measured roofline : %.2f GFLOP/s, %.2f GB/s\n\n",
+                roofline.PeakGFlops, roofline.PeakGBps);
+
+    Bench::BenchmarkRunner runner(config, roofline);
+    try
+    {
+        Bench::GemmBenchmark(runner);
+        Bench::ElementwiseBenchmark(runner);
+        Bench::ConvolutionBenchmark(runner);
+        Bench::ActivationBenchmark(runner);
+        Bench::ReductionBenchmark(runner);
+        Bench::AllocationBenchmark(runner);
+        Bench::TrainingBenchmark(runner);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Benchmark failed : " << e.what() << std::endl;
+        return 1;
+    }
+
+    runner.Print();
+    if (!jsonPath.empty())
+        runner.WriteJson(jsonPath);
+
+    Util::ResourceManager::ClearAll();
+    return 0;
+}
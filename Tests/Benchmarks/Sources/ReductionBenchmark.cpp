@@ -0,0 +1,39 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+
+namespace Sapphire::Bench
+{
+void ReductionBenchmark(BenchmarkRunner& runner)
+{
+    const auto mode = runner.Config().Mode;
+
+    for (const auto& [rows, cols] : std::vector<std::pair<int, int>>{
+             { 256, 1024 }, { 4096, 4096 }, { 64, 65536 } })
+    {
+        if (!runner.Selected("Reduction", "Mean"))
+            break;
+
+        const auto x = MakeTensor(Shape({ rows, cols }), mode);
+        auto yRows = MakeTensor(Shape({ rows, 1 }), mode);
+        auto yCols = MakeTensor(Shape({ 1, cols }), mode);
+        const auto size = static_cast<double>(x.Size());
+        const auto params =
+            "[" + std::to_string(rows) + "," + std::to_string(cols) + "]";
+
+        //! Reduction along contiguous dimension
+        runner.Run("Reduction", "Mean", params + " dim=1", size,
+                   4.0 * (size + rows),
+                   [&]() { Compute::Mean(yRows, x, 1); });
+        //! Reduction along strided dimension
+        runner.Run("Reduction", "Mean", params + " dim=0", size,
+                   4.0 * (size + cols),
+                   [&]() { Compute::Mean(yCols, x, 0); });
+    }
+}
+} // namespace Sapphire::Bench
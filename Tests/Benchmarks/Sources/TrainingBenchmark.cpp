@@ -0,0 +1,244 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Benchmark.hpp>
+#include <Sapphire/Sapphire.hpp>
+#include <chrono>
+#include <random>
+
+namespace Sapphire::Bench
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double>(end - start).count();
+}
+
+//! Forwards updates to the given optimizer and measures time spent on them
+class TimedOptimizer : public Optimizer::Optimizer
+{
+public:
+    TimedOptimizer(Optimizer& optimizer, ComputeMode mode)
+        : m_optimizer(optimizer),
+          m_mode(mode)
+    {
+    }
+
+    void operator()(TensorUtil::TensorData& z, const TensorUtil::TensorData& dz,
+                    std::string name) override
+    {
+        const auto start = Clock::now();
+        m_optimizer(z, dz, std::move(name));
+        Synchronize(m_mode);
+        Elapsed += Seconds(start, Clock::now());
+    }
+
+    void operator()(TensorUtil::TensorData& z,
+                    const TensorUtil::RowSparseData& dz,
+                    std::string name) override
+    {
+        const auto start = Clock::now();
+        m_optimizer(z, dz, std::move(name));
+        Synchronize(m_mode);
+        Elapsed += Seconds(start, Clock::now());
+    }
+
+    double Elapsed = 0.0;
+
+private:
+    Optimizer& m_optimizer;
+    ComputeMode m_mode;
+};
+
+//! Same layers as Test::MnistLinear
+class MnistLinearNetwork
+{
+public:
+    static constexpr int NumClasses = 10;
+
+    [[nodiscard]] static Shape InputShape(int batchSize)
+    {
+        return Shape({ batchSize, 784 });
+    }
+
+    Tensor operator()(Tensor x)
+    {
+        auto tensor = F::ReLU(m_fc0(x));
+        tensor = m_fc1(tensor);
+        return F::SoftMax(tensor);
+    }
+
+private:
+    NN::Linear m_fc0 = NN::Linear(784, 100);
+    NN::Linear m_fc1 = NN::Linear(100, 10);
+};
+
+//! Same layers as Test::Conv2DModelTest
+class Conv2DNetwork
+{
+public:
+    static constexpr int NumClasses = 10;
+
+    [[nodiscard]] static Shape InputShape(int batchSize)
+    {
+        return Shape({ batchSize, 3, 32, 32 });
+    }
+
+    Tensor operator()(Tensor x)
+    {
+        const auto batchSize = x.GetShape().At(0);
+        auto tensor = F::MaxPool2D(F::ReLU(m_conv0(x)), std::make_pair(2, 2),
+                                   std::make_pair(2, 2));
+        tensor = F::MaxPool2D(F::ReLU(m_conv1(tensor)), std::make_pair(2, 2),
+                              std::make_pair(2, 2));
+        tensor.Reshape(
+            Shape({ batchSize, tensor.GetShape().Size() / batchSize }));
+        tensor = F::ReLU(m_fc0(tensor));
+        tensor = F::ReLU(m_fc1(tensor));
+        tensor = m_fc2(tensor);
+        return F::SoftMax(tensor);
+    }
+
+private:
+    NN::Conv2D m_conv0 = NN::Conv2D(6, 3, std::make_pair(5, 5),
+                                    std::make_pair(1, 1), std::make_pair(0, 0),
+                                    std::make_pair(1, 1), false);
+    NN::Conv2D m_conv1 = NN::Conv2D(16, 6, std::make_pair(5, 5),
+                                    std::make_pair(1, 1), std::make_pair(0, 0),
+                                    std::make_pair(1, 1), false);
+    NN::Linear m_fc0 = NN::Linear(16 * 5 * 5, 120);
+    NN::Linear m_fc1 = NN::Linear(120, 84);
+    NN::Linear m_fc2 = NN::Linear(84, 10);
+};
+
+//! Number of distinct synthetic batches cycled through during the benchmark
+constexpr int NumSyntheticBatches = 8;
+
+template <typename Network>
+TrainingResult RunTraining(const std::string& name, int batchSize,
+                           const BenchmarkConfig& config)
+{
+    const auto mode = config.Mode;
+    const auto inputShape = Network::InputShape(batchSize);
+
+    //! Synthetic data is generated with fixed seed so that runs are
+    //! reproducible
+    std::mt19937 gen(42);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    std::uniform_int_distribution<int> classDist(0, Network::NumClasses - 1);
+    std::vector<std::vector<float>> inputs(NumSyntheticBatches);
+    std::vector<std::vector<float>> labels(NumSyntheticBatches);
+    for (int i = 0; i < NumSyntheticBatches; ++i)
+    {
+        inputs[i].resize(inputShape.Size());
+        for (auto& value : inputs[i])
+            value = normal(gen);
+        labels[i].assign(batchSize * Network::NumClasses, 0.0f);
+        for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+            labels[i][batchIdx * Network::NumClasses + classDist(gen)] = 1.0f;
+    }
+
+    //! Memory of the previous benchmarks is released so that peak memory
+    //! only covers this model
+    Util::ResourceManager::ClearAll();
+    const auto hostBaseline = Util::ResourceManager::GetAllocatedByteSizeHost();
+    const auto cudaBaseline = Util::ResourceManager::GetAllocatedByteSizeCuda();
+    Util::ResourceManager::ResetPeakByteSize();
+
+    const auto modelName = "Bench" + name + std::to_string(batchSize) +
+                           (mode == ComputeMode::Cuda ? "Cuda" : "Host");
+    ModelManager::AddModel(modelName);
+    ModelManager::SetCurrentModel(modelName);
+
+    Network network;
+
+    //! Host mode does not require cuda device
+    const auto makeInput = [mode](const Shape& shape) {
+        if (mode == ComputeMode::Host)
+            return Tensor(shape, true);
+        return Tensor(shape, CudaDevice(0, "cuda0"), Type::Dense, true);
+    };
+    const auto x = makeInput(inputShape);
+    const auto label = makeInput(Shape({ batchSize, Network::NumClasses }));
+
+    Optimizer::SGD sgd(0.001f);
+    TimedOptimizer optimizer(sgd, mode);
+    ModelManager::CurModel().SetOptimizer(&optimizer);
+
+    TrainingResult result;
+    result.Model = name;
+    result.BatchSize = batchSize;
+    result.Mode = mode;
+    result.Steps = config.TrainingSteps;
+
+    const auto totalSteps = config.TrainingWarmupSteps + config.TrainingSteps;
+    for (std::size_t step = 0; step < totalSteps; ++step)
+    {
+        const auto batchIdx = step % NumSyntheticBatches;
+        optimizer.Elapsed = 0.0;
+
+        const auto start = Clock::now();
+        x.LoadData(inputs[batchIdx]);
+        label.LoadData(labels[batchIdx]);
+        Synchronize(mode);
+        const auto loaded = Clock::now();
+
+        auto y = network(x);
+        const auto loss = NN::Loss::CrossEntropy(y, label);
+        Synchronize(mode);
+        const auto forwarded = Clock::now();
+
+        ModelManager::CurModel().BackProp(loss);
+        Synchronize(mode);
+        const auto backwarded = Clock::now();
+
+        ModelManager::CurModel().Clear();
+        Util::ResourceManager::Clean();
+        const auto end = Clock::now();
+
+        if (step < config.TrainingWarmupSteps)
+            continue;
+
+        result.DataLoadTime += Seconds(start, loaded);
+        result.ForwardTime += Seconds(loaded, forwarded);
+        result.BackwardTime +=
+            Seconds(forwarded, backwarded) - optimizer.Elapsed;
+        result.OptimizerTime += optimizer.Elapsed;
+        result.OverheadTime += Seconds(backwarded, end);
+        result.TotalTime += Seconds(start, end);
+    }
+
+    result.SamplesPerSecond =
+        result.TotalTime > 0.0
+            ? static_cast<double>(batchSize) *
+              static_cast<double>(result.Steps) / result.TotalTime
+            : 0.0;
+    result.PeakHostBytes =
+        Util::ResourceManager::GetPeakByteSizeHost() - hostBaseline;
+    result.PeakCudaBytes =
+        Util::ResourceManager::GetPeakByteSizeCuda() - cudaBaseline;
+
+    Util::ResourceManager::ClearAll();
+    return result;
+}
+} // namespace
+
+void TrainingBenchmark(BenchmarkRunner& runner)
+{
+    for (const auto batchSize : runner.Config().BatchSizes)
+    {
+        if (runner.Selected("Training", "MnistLinear"))
+            runner.AddTrainingResult(RunTraining<MnistLinearNetwork>(
+                "MnistLinear", batchSize, runner.Config()));
+        if (runner.Selected("Training", "Conv2DModel"))
+            runner.AddTrainingResult(RunTraining<Conv2DNetwork>(
+                "Conv2DModel", batchSize, runner.Config()));
+    }
+}
+} // namespace Sapphire::Bench
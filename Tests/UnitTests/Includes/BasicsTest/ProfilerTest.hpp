@@ -0,0 +1,15 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_PROFILER_TEST_HPP
+#define SAPPHIRE_TEST_PROFILER_TEST_HPP
+
+namespace Sapphire::Test
+{
+void ProfilerTest(bool print);
+}
+
+#endif
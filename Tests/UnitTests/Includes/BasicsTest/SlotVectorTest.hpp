@@ -0,0 +1,17 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_SLOT_VECTOR_TEST_HPP
+#define SAPPHIRE_TEST_SLOT_VECTOR_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Checks keys, reuse of erased slots and stability of references of
+//! SlotVector, and that descriptors of cleared model are invalidated
+void SlotVectorTest(bool print);
+}
+
+#endif
@@ -0,0 +1,16 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_BINARY_LOADER_TEST_HPP
+#define SAPPHIRE_TEST_BINARY_LOADER_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Writes records to temporary file and loads them back with BinaryLoader
+void BinaryLoaderTest(bool print);
+}
+
+#endif
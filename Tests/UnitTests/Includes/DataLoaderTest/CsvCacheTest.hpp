@@ -0,0 +1,17 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_CSV_CACHE_TEST_HPP
+#define SAPPHIRE_TEST_CSV_CACHE_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Parses generated csv file in parallel, converts it to binary cache and
+//! reopens the cache
+void CsvCacheTest(bool print);
+}
+
+#endif
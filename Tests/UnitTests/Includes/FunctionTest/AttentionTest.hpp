@@ -0,0 +1,20 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_ATTENTION_TEST_HPP
+#define SAPPHIRE_TEST_ATTENTION_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares fused attention and its back propagation with attention
+//! computed from the full score matrix in double precision
+void AttentionKernelTest(bool print);
+
+//! Back propagates F::ScaledDotProductAttention over batches of heads
+void AttentionFunctionalTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
@@ -0,0 +1,23 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_BLOCK_SPARSE_TEST_HPP
+#define SAPPHIRE_TEST_BLOCK_SPARSE_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Converts dense and CSR matrix to block sparse matrix and back to dense
+void BlockSparseConversionTest(int blockRows, int blockCols, bool print);
+
+//! Compares block sparse Gemm with dense Gemm on the host
+void BlockSparseGemmTest(int blockRows, int blockCols, bool print);
+
+//! Checks pruned Linear unit keeps pruned blocks zero, and its output matches
+//! dense computation with the pruned weight
+void BlockSparseLinearPruneTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
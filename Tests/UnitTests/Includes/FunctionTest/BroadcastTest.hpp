@@ -15,6 +15,10 @@ void BroadcastWithOneDimension(bool print);
 void BroadcastWithMissingDimension(bool print);
 
 void BroadcastMixed(bool print);
+
+//! Broadcasts (1, C, 1, 1) tensor over (N, C, H, W) tensor with elementwise
+//! ops on host, and compares the results with explicit loops
+void HostChannelBroadcastTest(bool print);
 } // namespace Sapphire::Test
 
 #endif  // Sapphire_BROADCASTTEST_HPP
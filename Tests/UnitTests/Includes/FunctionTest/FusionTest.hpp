@@ -0,0 +1,20 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_FUSION_TEST_HPP
+#define SAPPHIRE_TEST_FUSION_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares fused bias and activation kernels with separate operations
+void FusedKernelTest(bool print);
+
+//! Compares Linear, Conv2D and Add with fused activation to the units
+//! followed by F::ReLU, in both forward and back propagation
+void FusedUnitTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
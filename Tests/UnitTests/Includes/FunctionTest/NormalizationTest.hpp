@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_NORMALIZATION_TEST_HPP
+#define SAPPHIRE_TEST_NORMALIZATION_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares batch and layer normalization kernels with two pass statistics
+//! and numerical gradients computed in double precision
+void NormalizationKernelTest(bool print);
+
+//! Trains BatchNorm2D and LayerNorm units, folds BatchNorm2D into Conv2D, and
+//! saves running statistics in a checkpoint
+void NormalizationUnitTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
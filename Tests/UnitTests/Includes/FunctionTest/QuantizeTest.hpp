@@ -0,0 +1,23 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_QUANTIZE_TEST_HPP
+#define SAPPHIRE_TEST_QUANTIZE_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares int8 gemm with Float32 result on every instruction set available
+//! on this machine
+void Int8GemmTest(bool print);
+
+//! Compares int8 convolution with Conv2DForward
+void Int8Conv2DTest(bool print);
+
+//! Calibrates and quantizes Linear and Conv2D units
+void QuantizedUnitTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
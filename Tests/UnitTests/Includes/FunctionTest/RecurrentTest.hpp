@@ -0,0 +1,20 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_RECURRENT_TEST_HPP
+#define SAPPHIRE_TEST_RECURRENT_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares fused LSTM and GRU with cells computed gate by gate, and their
+//! back propagation with numerical gradients, in double precision
+void RecurrentKernelTest(bool print);
+
+//! Back propagates LSTM and GRU units and updates their weights
+void RecurrentUnitTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
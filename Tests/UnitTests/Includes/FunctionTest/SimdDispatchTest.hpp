@@ -0,0 +1,17 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_SIMD_DISPATCH_TEST_HPP
+#define SAPPHIRE_TEST_SIMD_DISPATCH_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Compares host kernels of every instruction set available on this machine
+//! with scalar kernels
+void SimdDispatchTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
@@ -0,0 +1,18 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_BACKPROP_MEMORY_TEST_HPP
+#define SAPPHIRE_TEST_BACKPROP_MEMORY_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Trains deep stack of units with and without releasing intermediate
+//! tensors during back propagation, and compares trained weights and peak
+//! memory
+void EarlyReleaseTest(bool print);
+}
+
+#endif
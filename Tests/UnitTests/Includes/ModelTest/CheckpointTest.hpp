@@ -0,0 +1,17 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_CHECKPOINT_TEST_HPP
+#define SAPPHIRE_TEST_CHECKPOINT_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Saves weights and optimizer state, and restores or maps them into new units
+//! Reduced precision weights and views are saved and restored as well
+void CheckpointTest(bool print);
+}
+
+#endif
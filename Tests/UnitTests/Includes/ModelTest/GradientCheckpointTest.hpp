@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_GRADIENT_CHECKPOINT_TEST_HPP
+#define SAPPHIRE_TEST_GRADIENT_CHECKPOINT_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Trains deep stack of units with and without checkpoint regions, and
+//! compares trained weights and peak memory
+void RecomputeTest(bool print);
+
+//! Trains BatchNorm2D inside and outside of checkpoint region, and checks
+//! running statistics are updated once per step in both of them
+void BatchNormRecomputeTest(bool print);
+}
+
+#endif
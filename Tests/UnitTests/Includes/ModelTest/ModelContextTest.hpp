@@ -0,0 +1,17 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_MODEL_CONTEXT_TEST_HPP
+#define SAPPHIRE_TEST_MODEL_CONTEXT_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Trains separate models from multiple threads at once, and compares them
+//! with the same models trained one by one
+void ConcurrentModelTest(bool print);
+}
+
+#endif
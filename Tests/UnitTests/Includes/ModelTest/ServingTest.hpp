@@ -0,0 +1,21 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_SERVING_TEST_HPP
+#define SAPPHIRE_TEST_SERVING_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Submits requests from multiple threads to InferenceServer, and compares
+//! their outputs with forward propagation of each sample alone
+//! Also checks that requests are coalesced by batch size and deadline
+void InferenceServerTest(bool print);
+
+//! Sends requests from synthetic clients over a local Unix domain socket
+void UnixSocketServingTest(bool print);
+}
+
+#endif
@@ -0,0 +1,29 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_REDUCED_PRECISION_TEST_HPP
+#define SAPPHIRE_TEST_REDUCED_PRECISION_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Checks rounding of scalar conversions, and compares vectorized
+//! conversions of every available simd level with them
+void HalfConversionTest(bool print);
+
+//! Compares Gemm and elementwise operations on Float16 and BFloat16 data with
+//! the same operations on Float32 copies of it
+void ReducedGemmTest(bool print);
+
+//! Checks that updates smaller than precision of the weight accumulate in the
+//! master weight
+void MixedPrecisionTest(bool print);
+
+//! Trains Linear units holding Float16 and BFloat16 weights through
+//! Model::BackProp with MixedPrecision, and compares them with a Float32 unit
+void MixedPrecisionLinearTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
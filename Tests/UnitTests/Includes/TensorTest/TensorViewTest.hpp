@@ -0,0 +1,20 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef SAPPHIRE_TEST_TENSOR_VIEW_TEST_HPP
+#define SAPPHIRE_TEST_TENSOR_VIEW_TEST_HPP
+
+namespace Sapphire::Test
+{
+//! Tests whether views share data with the original tensorData and follow
+//! its layout
+void TensorViewTest(bool print);
+
+//! Compares Gemm on transposed views with Gemm on transposed copies
+void TransposedGemmTest(bool print);
+} // namespace Sapphire::Test
+
+#endif
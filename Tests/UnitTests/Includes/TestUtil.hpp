@@ -18,6 +18,7 @@
 #include <iostream>
 #include <doctest.h>
 #include <type_traits>
+#include <vector>
 #include <iostream>
 
 #define FP_EQUAL_THRESHOLD 0.1
@@ -80,6 +81,17 @@ void CheckNoneZeroEquality(const TPtrA ptrA, const TPtrB ptrB, unsigned size,
 void CheckNoneZero(const float* ptr, unsigned size,
                    bool print);
 
+//! Returns data uniformly distributed in [low, high)
+std::vector<float> RandomData(std::mt19937& gen, std::size_t size,
+                              float low = -1.0f, float high = 1.0f);
+
+//! Returns host tensorData holding given data
+TensorUtil::TensorData CreateData(const Shape& shape,
+                                  const std::vector<float>& data);
+
+//! Returns largest absolute difference between elements of a and b
+float MaxDifference(const std::vector<float>& a, const std::vector<float>& b);
+
 template <typename Func>
 void TestWithTwoArgumentsWithSameShape(bool print, float equalThreshold,
                                        Func function)
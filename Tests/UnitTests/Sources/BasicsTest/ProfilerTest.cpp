@@ -0,0 +1,86 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <BasicsTest/ProfilerTest.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/util/Profiler.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void ProfilerTest(bool print)
+{
+    const int m = 16, k = 32, n = 8;
+    TensorUtil::TensorData a(Shape({ m, k }), Type::Dense);
+    TensorUtil::TensorData b(Shape({ k, n }), Type::Dense);
+    TensorUtil::TensorData y(Shape({ m, n }), Type::Dense);
+
+    Util::Profiler::Disable();
+    Util::Profiler::Clear();
+
+    //! Nothing is recorded while disabled
+    Compute::Initialize::Ones(a);
+    CHECK(Util::Profiler::Events().empty());
+
+    Util::Profiler::Enable();
+    Compute::Initialize::Ones(b);
+    Compute::Gemm(y, a, b);
+    {
+        const std::string unitName = "TestUnit";
+        SAPPHIRE_PROFILE_UNIT(unitName);
+        Compute::Add(y, y, y);
+    }
+    Util::Profiler::Disable();
+    Compute::Add(y, y, y);
+
+    const auto events = Util::Profiler::Events();
+
+#ifdef WITH_PROFILER
+    REQUIRE(events.size() == 3);
+    CHECK(events[0].Name == "Ones");
+    CHECK(events[1].Name == "Gemm");
+    CHECK(events[1].Flops == 2.0 * m * n * k);
+    CHECK(events[1].Bytes ==
+        static_cast<double>((m * n + m * k + k * n) * sizeof(float)));
+    CHECK(events[1].Shapes == y.GetShape().ToString() + ", " +
+        a.GetShape().ToString() + ", " + b.GetShape().ToString());
+    CHECK(events[1].Mode == ComputeMode::Host);
+    CHECK(events[1].Unit.empty());
+    CHECK(events[2].Name == "Add");
+    CHECK(events[2].Unit == "TestUnit");
+    for (std::size_t i = 1; i < events.size(); ++i)
+        CHECK(events[i].StartNs >= events[i - 1].StartNs);
+
+    const auto tracePath =
+        std::filesystem::temp_directory_path() / "sapphire_profiler_test.json";
+    Util::Profiler::ExportChromeTrace(tracePath);
+    std::ifstream traceFile(tracePath);
+    std::stringstream trace;
+    trace << traceFile.rdbuf();
+    CHECK(trace.str().find("\"traceEvents\"") != std::string::npos);
+    CHECK(trace.str().find("\"name\":\"Gemm\"") != std::string::npos);
+    CHECK(trace.str().find("\"unit\":\"TestUnit\"") != std::string::npos);
+    traceFile.close();
+    std::filesystem::remove(tracePath);
+
+    const auto summary = Util::Profiler::Summary();
+    CHECK(summary.find("Gemm") != std::string::npos);
+    if (print)
+        std::cout << summary << std::endl;
+#else
+    CHECK(events.empty());
+#endif
+
+    Util::Profiler::Clear();
+    CHECK(Util::Profiler::Events().empty());
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,113 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <BasicsTest/SlotVectorTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <Sapphire/util/SlotVector.hpp>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+#include "doctest.h"
+
+namespace Sapphire::Test
+{
+void SlotVectorTest(bool print)
+{
+    Util::SlotVector<std::string> slots;
+    CHECK(slots.NextKey() == 0);
+    const auto first = slots.Insert("first");
+    const auto second = slots.Insert("second");
+    CHECK(first == 0);
+    CHECK(second == 1);
+    CHECK(slots.At(second) == "second");
+
+    //! References stay valid while new pages are allocated
+    const auto* firstPtr = &slots.At(first);
+    std::vector<Util::SlotVector<std::string>::Key> keys;
+    for (int idx = 0; idx < 4 * Util::SlotVector<std::string>::PageSize; ++idx)
+        keys.emplace_back(slots.Insert(std::to_string(idx)));
+    CHECK(&slots.At(first) == firstPtr);
+    CHECK(slots.Size() == keys.size() + 2);
+
+    //! Erased slot is reused with a new key once enough slots are free, and
+    //! its old key is invalid
+    slots.Erase(first);
+    CHECK(!slots.Contains(first));
+    CHECK_THROWS(static_cast<void>(slots.At(first)));
+    std::vector<Util::SlotVector<std::string>::Key> fillers;
+    for (std::size_t idx = 1; idx < Util::SlotVector<std::string>::MinFreeSlots;
+         ++idx)
+    {
+        fillers.emplace_back(slots.Insert("filler"));
+        slots.Erase(fillers.back());
+    }
+    const auto reused = slots.Insert("reused");
+    CHECK(reused != first);
+    CHECK((reused & (Util::SlotVector<std::string>::MaxSize - 1)) == first);
+    CHECK(!slots.Contains(first));
+    CHECK(slots.At(reused) == "reused");
+    CHECK_THROWS(static_cast<void>(slots.At(-1)));
+
+    for (const auto filler : fillers)
+        CHECK(!slots.Contains(filler));
+
+    //! Slots are retired when their generation is exhausted, so stale keys
+    //! stay invalid however many times the slots are erased and reused
+    using CycledVector = Util::SlotVector<std::string, 2>;
+    CycledVector cycled;
+    const auto staleKey = cycled.Insert("stale");
+    cycled.Erase(staleKey);
+    std::set<CycledVector::Key> issuedKeys = { staleKey };
+    int staleMatches = 0;
+    for (std::size_t idx = 0;
+         idx < 4 * (CycledVector::MaxGeneration + 1) *
+         CycledVector::MinFreeSlots; ++idx)
+    {
+        const auto key = cycled.Insert("cycled");
+        if (!issuedKeys.emplace(key).second || cycled.Contains(staleKey))
+            ++staleMatches;
+        cycled.Erase(key);
+    }
+    CHECK(staleMatches == 0);
+
+    //! Keys given by ForEach address the same values
+    std::size_t count = 0;
+    slots.ForEach([&](auto key, const std::string& value) {
+        CHECK(&slots.At(key) == &value);
+        ++count;
+    });
+    CHECK(count == slots.Size());
+
+    slots.EraseIf([](const std::string& value) { return value.size() == 1; });
+    CHECK(slots.Size() == keys.size() + 2 - 10);
+    CHECK(!slots.Contains(keys[9]));
+    CHECK(slots.Contains(keys[10]));
+    slots.Clear();
+    CHECK(slots.Size() == 0);
+    CHECK(!slots.Contains(second));
+
+    //! Descriptors of tensors are invalidated when the model is cleared,
+    //! while preserved ones are kept
+    ModelManager::AddModel("SlotVectorTest");
+    const ModelScope scope("SlotVectorTest");
+    Tensor preserved(Shape({ 2, 3 }), true);
+    preserved.LoadData({ 1, 2, 3, 4, 5, 6 });
+    Tensor stale(Shape({ 2, 3 }));
+    ModelManager::CurModel().Clear();
+    Tensor fresh(Shape({ 2, 3 }));
+    if (print)
+        std::cout << "Stale key : " << stale.TensorDescriptorKey()
+            << " Fresh key : " << fresh.TensorDescriptorKey() << std::endl;
+    CHECK(fresh.TensorDescriptorKey() != stale.TensorDescriptorKey());
+    CHECK_THROWS(static_cast<void>(stale.GetData()));
+    CHECK(preserved.GetData()[5] == 6.0f);
+
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
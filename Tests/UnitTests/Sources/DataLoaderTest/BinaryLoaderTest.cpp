@@ -0,0 +1,88 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <DataLoaderTest/BinaryLoaderTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/util/DataLoader/BinaryLoader.hpp>
+#include <Sapphire/util/FileManager.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <iostream>
+
+namespace Sapphire::Test
+{
+void BinaryLoaderTest(bool print)
+{
+    //! Each record has 1 label byte followed by 16 data bytes
+    constexpr std::size_t headerSize = 5;
+    constexpr std::size_t recordSize = 17;
+    constexpr std::size_t numRecords = 10;
+
+    std::vector<std::uint8_t> fileData(headerSize + recordSize * numRecords);
+    for (std::size_t i = 0; i < fileData.size(); ++i)
+        fileData[i] = static_cast<std::uint8_t>(i % 251);
+
+    const auto filePath =
+        std::filesystem::temp_directory_path() / "SapphireBinaryLoaderTest.bin";
+    WriteToFile(filePath.string(), fileData.data(), fileData.size());
+
+    ModelManager::AddModel("binary loader test model");
+    ModelManager::SetCurrentModel("binary loader test model");
+
+    {
+        Util::BinaryLoader<std::uint8_t> loader(
+            filePath, headerSize, recordSize * numRecords, 3, recordSize);
+        CHECK(loader.NumRecords() == numRecords);
+        CHECK(loader.Data()[0] == fileData[headerSize]);
+
+        const std::vector<std::size_t> batches = { 9, 0, 4 };
+
+        //! Plain gather
+        std::vector<std::uint8_t> gathered(batches.size() * 16);
+        loader.Gather(gathered.data(), batches, 1, 16);
+        for (std::size_t batchIdx = 0; batchIdx < batches.size(); ++batchIdx)
+            for (std::size_t i = 0; i < 16; ++i)
+                CHECK(gathered[batchIdx * 16 + i] ==
+                    fileData[headerSize + batches[batchIdx] * recordSize +
+                             1 + i]);
+
+        //! Fused conversion and normalization into the tensor
+        Tensor x(Shape({ 3, 16 }), true);
+        loader.LoadData(x, batches, 1, 16, 1.0f / 255.0f, -0.5f);
+        const auto xData = x.GetData();
+        for (std::size_t i = 0; i < xData.size(); ++i)
+        {
+            const auto expected =
+                static_cast<float>(gathered[i]) / 255.0f - 0.5f;
+            if (print)
+                std::cout << "loaded : " << xData[i] << " expected : "
+                    << expected << std::endl;
+            CHECK(std::abs(xData[i] - expected) < 1e-6f);
+        }
+
+        //! Records outside of the file must be rejected
+        CHECK_THROWS(loader.Gather(gathered.data(), { numRecords }, 1, 16));
+
+        //! Preprocess with std::function
+        Tensor label(Shape({ 3, 1 }), true);
+        loader.LoadData(label, batches, 0, 0,
+                        [](std::vector<std::uint8_t> data) {
+                            return std::vector<float>(data.begin(),
+                                                      data.end());
+                        });
+        const auto labelData = label.GetData();
+        for (std::size_t batchIdx = 0; batchIdx < batches.size(); ++batchIdx)
+            CHECK(labelData[batchIdx] ==
+                static_cast<float>(
+                    fileData[headerSize + batches[batchIdx] * recordSize]));
+    }
+
+    std::filesystem::remove(filePath);
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,103 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <DataLoaderTest/CsvCacheTest.hpp>
+#include <Sapphire/util/DataLoader/CsvCache.hpp>
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace Sapphire::Test
+{
+void CsvCacheTest(bool print)
+{
+    constexpr std::size_t numLines = 1000;
+    constexpr std::size_t numColumns = 13;
+
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto csvPath = directory / "SapphireCsvCacheTest.csv";
+    const auto cachePath = directory / "SapphireCsvCacheTest.bin";
+    std::filesystem::remove(cachePath);
+
+    auto expected = [](std::size_t lineIdx, std::size_t colIdx) {
+        return static_cast<int>(lineIdx * 31 + colIdx * 7) % 256 -
+               static_cast<int>(colIdx);
+    };
+
+    {
+        //! Header line, Windows line endings and an empty line are included
+        std::ofstream file(csvPath, std::ios::binary | std::ios::trunc);
+        file << "label";
+        for (std::size_t colIdx = 1; colIdx < numColumns; ++colIdx)
+            file << ",pixel" << colIdx;
+        file << "\r\n";
+        for (std::size_t lineIdx = 1; lineIdx < numLines; ++lineIdx)
+        {
+            for (std::size_t colIdx = 0; colIdx < numColumns; ++colIdx)
+                file << (colIdx == 0 ? "" : ",") << expected(lineIdx, colIdx);
+            file << (lineIdx % 2 ? "\r\n" : "\n");
+            if (lineIdx == numLines / 2)
+                file << "\n";
+        }
+    }
+
+    const std::vector<std::size_t> lineIndices = { 1, 500, 501, 999, 0 };
+    std::vector<int> gathered(lineIndices.size() * (numColumns - 1));
+
+    {
+        const Util::CsvLoader<int> csvLoader(csvPath, 7);
+        CHECK(csvLoader.GetLineSize() == numLines);
+        CHECK(csvLoader.GetColumnSize() == numColumns);
+        //! Header fields are not numbers
+        CHECK(csvLoader.Row(0)[0] == 0);
+        for (std::size_t lineIdx = 1; lineIdx < numLines; ++lineIdx)
+            for (std::size_t colIdx = 0; colIdx < numColumns; ++colIdx)
+                CHECK(csvLoader.Row(lineIdx)[colIdx] ==
+                      expected(lineIdx, colIdx));
+
+        //! Result does not depend on number of threads
+        const Util::CsvLoader<int> singleThreaded(csvPath, 1);
+        CHECK(singleThreaded.Data() == csvLoader.Data());
+
+        csvLoader.Gather(gathered.data(), lineIndices, 1, numColumns - 1);
+        CHECK_THROWS(static_cast<void>(csvLoader.Row(numLines)));
+    }
+
+    for (int run = 0; run < 2; ++run)
+    {
+        //! First run converts the csv file, second run reuses the cache
+        const auto binaryLoader =
+            Util::OpenCsvCache<int>(csvPath, cachePath, 4);
+        CHECK(binaryLoader->NumRecords() == numLines);
+
+        std::vector<int> fromCache(gathered.size());
+        binaryLoader->Gather(fromCache.data(), lineIndices, 1, numColumns - 1);
+        CHECK(fromCache == gathered);
+
+        if (print)
+            std::cout << "run " << run << " record 1, column 1 : "
+                << fromCache[0] << std::endl;
+    }
+
+    {
+        //! Cache is usable without the source file
+        std::filesystem::remove(csvPath);
+        const auto binaryLoader =
+            Util::OpenCsvCache<int>(csvPath, cachePath, 4);
+        CHECK(binaryLoader->NumRecords() == numLines);
+    }
+
+    {
+        std::ofstream file(csvPath, std::ios::binary | std::ios::trunc);
+        file << "1,2,3\n4,5\n";
+    }
+    CHECK_THROWS(Util::CsvLoader<int>(csvPath, 2));
+
+    std::filesystem::remove(csvPath);
+    std::filesystem::remove(cachePath);
+}
+}
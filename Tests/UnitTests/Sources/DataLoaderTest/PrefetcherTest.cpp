@@ -0,0 +1,88 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <DataLoaderTest/PrefetcherTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/util/DataLoader/Prefetcher.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <doctest/doctest.h>
+#include <iostream>
+
+namespace Sapphire::Test
+{
+void PrefetcherTest(bool print)
+{
+    constexpr std::size_t numBatches = 20;
+    const Shape xShape({ 4, 8 });
+    const Shape labelShape({ 4, 1 });
+
+    ModelManager::AddModel("prefetcher test model");
+    ModelManager::SetCurrentModel("prefetcher test model");
+
+    const CudaDevice device;
+
+    auto fill = [xShape, labelShape](std::size_t batchIdx,
+                                     const std::vector<float*>& buffers) {
+        for (int i = 0; i < xShape.Size(); ++i)
+            buffers[0][i] = static_cast<float>(batchIdx * 1000 + i);
+        for (int i = 0; i < labelShape.Size(); ++i)
+            buffers[1][i] = static_cast<float>(batchIdx);
+    };
+
+    auto checkInOrder = [&](const CudaDevice& batchDevice, ComputeMode mode) {
+        Util::Prefetcher prefetcher({ xShape, labelShape }, batchDevice, mode,
+                                    numBatches, fill, 3, 3);
+        CHECK_THROWS(prefetcher.Next());
+        prefetcher.Start();
+
+        for (std::size_t batchIdx = 0; batchIdx < numBatches; ++batchIdx)
+        {
+            const auto batch = prefetcher.Next();
+            REQUIRE(batch.size() == 2);
+            const auto x = batch[0].GetData();
+            const auto label = batch[1].GetData();
+            for (int i = 0; i < xShape.Size(); ++i)
+                CHECK(x[i] == static_cast<float>(batchIdx * 1000 + i));
+            for (int i = 0; i < labelShape.Size(); ++i)
+                CHECK(label[i] == static_cast<float>(batchIdx));
+
+            if (print)
+                std::cout << "batch " << batchIdx << " x[0] : " << x[0]
+                    << std::endl;
+        }
+
+        //! Every batch has been consumed
+        CHECK(prefetcher.Next().empty());
+    };
+
+    checkInOrder(device, ComputeMode::Host);
+#ifdef WITH_CUDA
+    //! Batches are uploaded by the workers
+    checkInOrder(CudaDevice(0, "cuda0"), ComputeMode::Cuda);
+#endif
+
+    {
+        //! Errors in the fill function are delivered to the training thread
+        auto failingFill = [fill](std::size_t batchIdx,
+                                  const std::vector<float*>& buffers) {
+            if (batchIdx == 3)
+                throw std::runtime_error("PrefetcherTest - Failed to load");
+            fill(batchIdx, buffers);
+        };
+
+        Util::Prefetcher prefetcher({ xShape, labelShape }, device,
+                                    ComputeMode::Host, numBatches, failingFill,
+                                    2, 2);
+        prefetcher.Start();
+        for (int batchIdx = 0; batchIdx < 3; ++batchIdx)
+            CHECK(prefetcher.Next().size() == 2);
+        CHECK_THROWS(prefetcher.Next());
+        prefetcher.Stop();
+    }
+
+    Util::ResourceManager::ClearAll();
+}
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <DataLoaderTest/SamplerTest.hpp>
+#include <Sapphire/util/DataLoader/Sampler.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Checks that the order visits every record in [first, first + size) once
+bool IsPermutation(std::vector<std::size_t> order, std::size_t first,
+                   std::size_t size)
+{
+    std::vector<std::size_t> expected(size);
+    std::iota(expected.begin(), expected.end(), first);
+    std::sort(order.begin(), order.end());
+    return order == expected;
+}
+}
+
+void SamplerTest(bool print)
+{
+    constexpr std::size_t numRecords = 1003;
+    constexpr std::size_t batchSize = 32;
+    constexpr std::size_t firstRecord = 5;
+
+    for (const auto mode : { Util::SampleMode::Sequential,
+                             Util::SampleMode::Shuffle,
+                             Util::SampleMode::BlockShuffle })
+    {
+        const Util::Sampler sampler(numRecords, batchSize, mode, 42,
+                                    firstRecord);
+        const Util::Sampler sameSeed(numRecords, batchSize, mode, 42,
+                                     firstRecord);
+        CHECK(sampler.NumBatches() == (numRecords + batchSize - 1) / batchSize);
+
+        for (std::size_t epoch = 0; epoch < 3; ++epoch)
+        {
+            const auto order = sampler.EpochOrder(epoch);
+            CHECK(IsPermutation(order, firstRecord, numRecords));
+            CHECK(order == sameSeed.EpochOrder(epoch));
+
+            //! Batches are consecutive slices of the epoch order
+            std::vector<std::size_t> batch;
+            std::vector<std::size_t> concatenated;
+            for (std::size_t batchIdx = 0; batchIdx < sampler.NumBatches();
+                 ++batchIdx)
+            {
+                sampler.Step(epoch * sampler.NumBatches() + batchIdx, batch);
+                concatenated.insert(concatenated.end(), batch.begin(),
+                                    batch.end());
+            }
+            CHECK(concatenated == order);
+        }
+
+        if (mode == Util::SampleMode::Sequential)
+            CHECK(sampler.EpochOrder(0) == sampler.EpochOrder(1));
+        else
+        {
+            CHECK(sampler.EpochOrder(0) != sampler.EpochOrder(1));
+            const Util::Sampler otherSeed(numRecords, batchSize, mode, 43,
+                                          firstRecord);
+            CHECK(sampler.EpochOrder(0) != otherSeed.EpochOrder(0));
+        }
+    }
+
+    {
+        //! Each block of adjacent records is visited contiguously
+        constexpr std::size_t blockSize = 64;
+        Util::Sampler sampler(numRecords, batchSize,
+                              Util::SampleMode::BlockShuffle, 7);
+        sampler.SetBlockSize(blockSize);
+        const auto order = sampler.EpochOrder(0);
+        for (std::size_t i = 0; i < order.size(); i += blockSize)
+        {
+            const auto last = std::min(i + blockSize, order.size());
+            const auto blockIdx = order[i] / blockSize;
+            for (auto j = i; j < last; ++j)
+                CHECK(order[j] / blockSize == blockIdx);
+        }
+    }
+
+    {
+        //! Every batch holds classes in proportion to the dataset
+        constexpr std::size_t numClasses = 4;
+        std::vector<std::uint32_t> labels(numRecords);
+        for (std::size_t i = 0; i < numRecords; ++i)
+            labels[i] = i % 8 == 0 ? 0 : static_cast<std::uint32_t>(
+                            1 + i % (numClasses - 1));
+
+        Util::Sampler sampler(numRecords, batchSize,
+                              Util::SampleMode::Stratified, 3);
+        CHECK_THROWS(static_cast<void>(sampler.EpochOrder(0)));
+        sampler.SetLabels(labels);
+        sampler.SetDropLast(true);
+        CHECK(sampler.NumBatches() == numRecords / batchSize);
+        CHECK(IsPermutation(sampler.EpochOrder(0), 0, numRecords));
+
+        std::vector<std::size_t> classCount(numClasses, 0);
+        for (const auto label : labels)
+            classCount[label] += 1;
+
+        std::vector<std::size_t> batch;
+        for (std::size_t batchIdx = 0; batchIdx < sampler.NumBatches();
+             ++batchIdx)
+        {
+            sampler.Batch(1, batchIdx, batch);
+            std::vector<std::size_t> batchCount(numClasses, 0);
+            for (const auto recordIdx : batch)
+                batchCount[labels[recordIdx]] += 1;
+            for (std::size_t classIdx = 0; classIdx < numClasses; ++classIdx)
+            {
+                const auto expected = static_cast<double>(batchSize) *
+                                      static_cast<double>(
+                                          classCount[classIdx]) /
+                                      static_cast<double>(numRecords);
+                CHECK(static_cast<double>(batchCount[classIdx]) >=
+                      expected - 1.0);
+                CHECK(static_cast<double>(batchCount[classIdx]) <=
+                      expected + 1.0);
+            }
+            if (print && batchIdx == 0)
+                for (std::size_t classIdx = 0; classIdx < numClasses;
+                     ++classIdx)
+                    std::cout << "class " << classIdx << " : "
+                        << batchCount[classIdx] << std::endl;
+        }
+    }
+
+    {
+        //! Concurrent queries over epoch boundaries give same batches
+        const Util::Sampler sampler(numRecords, batchSize,
+                                    Util::SampleMode::Shuffle, 11);
+        const auto numSteps = sampler.NumBatches() * 4;
+        std::vector<std::vector<std::size_t>> batches(numSteps);
+        std::vector<std::thread> threads;
+        for (std::size_t threadIdx = 0; threadIdx < 4; ++threadIdx)
+            threads.emplace_back([&sampler, &batches, numSteps, threadIdx]() {
+                for (auto step = threadIdx; step < numSteps; step += 4)
+                    sampler.Step(step, batches[step]);
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        std::vector<std::size_t> expected;
+        for (std::size_t step = 0; step < numSteps; ++step)
+        {
+            sampler.Step(step, expected);
+            CHECK(batches[step] == expected);
+        }
+    }
+}
+}
@@ -0,0 +1,250 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <FunctionTest/AttentionTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/AttentionOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Forward/Functional/Attention.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+struct AttentionSize
+{
+    int NumMatrices;
+    int QueryLength;
+    int KeyLength;
+    int Depth;
+    int ValueDepth;
+};
+
+struct AttentionResult
+{
+    std::vector<float> Y;
+    std::vector<float> DQuery;
+    std::vector<float> DKey;
+    std::vector<float> DValue;
+};
+
+//! Attention and its gradients computed from the full score and probability
+//! matrices in double precision
+AttentionResult ReferenceAttention(const AttentionSize& size,
+                                   const std::vector<float>& query,
+                                   const std::vector<float>& key,
+                                   const std::vector<float>& value,
+                                   const std::vector<float>& dy, bool causal)
+{
+    const auto [numMatrices, Lq, Lk, D, Dv] = size;
+    const double scale = 1.0 / std::sqrt(static_cast<double>(D));
+    AttentionResult result{ std::vector<float>(numMatrices * Lq * Dv),
+                            std::vector<float>(query.size()),
+                            std::vector<float>(key.size()),
+                            std::vector<float>(value.size()) };
+
+    for (int m = 0; m < numMatrices; ++m)
+    {
+        const float* q = query.data() + m * Lq * D;
+        const float* k = key.data() + m * Lk * D;
+        const float* v = value.data() + m * Lk * Dv;
+        const float* g = dy.data() + m * Lq * Dv;
+
+        std::vector<double> prob(Lq * Lk, 0.0);
+        for (int i = 0; i < Lq; ++i)
+        {
+            double maxScore = -std::numeric_limits<double>::infinity();
+            std::vector<double> score(Lk);
+            for (int j = 0; j < Lk; ++j)
+            {
+                score[j] = 0.0;
+                for (int d = 0; d < D; ++d)
+                    score[j] += static_cast<double>(q[i * D + d]) *
+                        k[j * D + d] * scale;
+                if (!causal || j <= i + Lk - Lq)
+                    maxScore = std::max(maxScore, score[j]);
+            }
+            double sum = 0.0;
+            for (int j = 0; j < Lk; ++j)
+                if (!causal || j <= i + Lk - Lq)
+                {
+                    prob[i * Lk + j] = std::exp(score[j] - maxScore);
+                    sum += prob[i * Lk + j];
+                }
+            for (int j = 0; j < Lk; ++j)
+                prob[i * Lk + j] = sum > 0.0 ? prob[i * Lk + j] / sum : 0.0;
+        }
+
+        for (int i = 0; i < Lq; ++i)
+        {
+            for (int e = 0; e < Dv; ++e)
+            {
+                double out = 0.0;
+                for (int j = 0; j < Lk; ++j)
+                    out += prob[i * Lk + j] * v[j * Dv + e];
+                result.Y[(m * Lq + i) * Dv + e] = static_cast<float>(out);
+            }
+
+            //! dScore = P * (dP - sum(dP * P)) where dP = dy * value^T
+            std::vector<double> dProb(Lk);
+            double weighted = 0.0;
+            for (int j = 0; j < Lk; ++j)
+            {
+                dProb[j] = 0.0;
+                for (int e = 0; e < Dv; ++e)
+                    dProb[j] += static_cast<double>(g[i * Dv + e]) *
+                        v[j * Dv + e];
+                weighted += dProb[j] * prob[i * Lk + j];
+            }
+            for (int j = 0; j < Lk; ++j)
+            {
+                const double p = prob[i * Lk + j];
+                const double dScore = p * (dProb[j] - weighted) * scale;
+                for (int e = 0; e < Dv; ++e)
+                    result.DValue[(m * Lk + j) * Dv + e] +=
+                        static_cast<float>(p * g[i * Dv + e]);
+                for (int d = 0; d < D; ++d)
+                {
+                    result.DQuery[(m * Lq + i) * D + d] +=
+                        static_cast<float>(dScore * k[j * D + d]);
+                    result.DKey[(m * Lk + j) * D + d] +=
+                        static_cast<float>(dScore * q[i * D + d]);
+                }
+            }
+        }
+    }
+    return result;
+}
+} // namespace
+
+void AttentionKernelTest(bool print)
+{
+    std::mt19937 gen(31);
+    //! Lengths are not multiples of tile sizes, and queries outnumber keys in
+    //! the last case, leaving rows without any key under the causal mask
+    const std::vector<AttentionSize> sizes = { { 2, 70, 90, 8, 6 },
+                                               { 1, 129, 129, 16, 16 },
+                                               { 3, 40, 7, 4, 5 } };
+    for (const auto& size : sizes)
+        for (const bool causal : { false, true })
+        {
+            const auto [numMatrices, Lq, Lk, D, Dv] = size;
+            const Shape qShape({ numMatrices, Lq, D });
+            const Shape kShape({ numMatrices, Lk, D });
+            const Shape vShape({ numMatrices, Lk, Dv });
+            const Shape yShape({ numMatrices, Lq, Dv });
+            const auto queryData = RandomData(gen, qShape.Size(), -2.0f,
+                                              2.0f);
+            const auto keyData = RandomData(gen, kShape.Size(), -2.0f, 2.0f);
+            const auto valueData = RandomData(gen, vShape.Size(), -1.0f,
+                                              1.0f);
+            const auto dyData = RandomData(gen, yShape.Size(), -1.0f, 1.0f);
+            const auto expected = ReferenceAttention(
+                size, queryData, keyData, valueData, dyData, causal);
+
+            const auto query = CreateData(qShape, queryData);
+            const auto key = CreateData(kShape, keyData);
+            const auto value = CreateData(vShape, valueData);
+            TensorUtil::TensorData y(yShape, Type::Dense);
+            TensorUtil::TensorData logSumExp(Shape({ numMatrices, Lq }),
+                                             Type::Dense);
+            const float scale = 1.0f / std::sqrt(static_cast<float>(D));
+            Compute::AttentionForward(y, logSumExp, query, key, value, scale,
+                                      causal);
+
+            //! Gradients are accumulated
+            TensorUtil::TensorData dQuery(qShape, Type::Dense);
+            TensorUtil::TensorData dKey(kShape, Type::Dense);
+            TensorUtil::TensorData dValue(vShape, Type::Dense);
+            Compute::Initialize::Zeros(dQuery);
+            Compute::Initialize::Zeros(dKey);
+            Compute::Initialize::Ones(dValue);
+            const auto dy = CreateData(yShape, dyData);
+            Compute::AttentionBackward(dQuery, dKey, dValue, dy, query, key,
+                                       value, y, logSumExp, scale, causal);
+            auto dValueData = dValue.GetDataCopy();
+            for (auto& element : dValueData)
+                element -= 1.0f;
+
+            const float forwardError =
+                MaxDifference(y.GetDataCopy(), expected.Y);
+            const float backwardError = std::max(
+                { MaxDifference(dQuery.GetDataCopy(), expected.DQuery),
+                  MaxDifference(dKey.GetDataCopy(), expected.DKey),
+                  MaxDifference(dValueData, expected.DValue) });
+            if (print)
+                std::cout << "Attention (" << Lq << ", " << Lk
+                    << (causal ? ", causal" : "") << ") forward error : "
+                    << forwardError << ", backward error : "
+                    << backwardError << std::endl;
+            CHECK(forwardError < 1e-5f);
+            CHECK(backwardError < 1e-4f);
+        }
+
+    const auto query = CreateData(Shape({ 2, 4, 3 }),
+                                  std::vector<float>(24, 1.0f));
+    const auto key = CreateData(Shape({ 2, 5, 4 }),
+                                std::vector<float>(40, 1.0f));
+    TensorUtil::TensorData y(Shape({ 2, 4, 3 }), Type::Dense);
+    TensorUtil::TensorData logSumExp(Shape({ 2, 4 }), Type::Dense);
+    CHECK_THROWS(Compute::AttentionForward(y, logSumExp, query, key, key,
+                                           1.0f, false));
+
+    Util::ResourceManager::ClearAll();
+}
+
+void AttentionFunctionalTest(bool print)
+{
+    const ModelScope scope(ModelManager::AddModel("AttentionFunctionalTest"));
+    std::mt19937 gen(37);
+    //! Back propagation requires an optimizer even without trainable data
+    Optimizer::SGD sgd(0.0f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    //! (batch, heads, length, depth)
+    const AttentionSize size{ 2 * 3, 33, 33, 8, 8 };
+    const Shape shape({ 2, 3, size.QueryLength, size.Depth });
+    const auto queryData = RandomData(gen, shape.Size(), -1.0f, 1.0f);
+    const auto keyData = RandomData(gen, shape.Size(), -1.0f, 1.0f);
+    const auto valueData = RandomData(gen, shape.Size(), -1.0f, 1.0f);
+    const auto dyData = RandomData(gen, shape.Size(), -1.0f, 1.0f);
+    const auto expected = ReferenceAttention(size, queryData, keyData,
+                                             valueData, dyData, true);
+
+    Tensor query(shape, true), key(shape, true), value(shape, true);
+    query.LoadData(queryData);
+    key.LoadData(keyData);
+    value.LoadData(valueData);
+    const auto y = F::ScaledDotProductAttention(query, key, value, true);
+    CHECK(y.GetShape() == shape);
+    const auto yData = y.GetData();
+    y.LoadGradient(dyData);
+    ModelManager::CurModel().BackProp(y);
+
+    const float error = std::max(
+        { MaxDifference(yData, expected.Y),
+          MaxDifference(query.GetGradient(), expected.DQuery),
+          MaxDifference(key.GetGradient(), expected.DKey),
+          MaxDifference(value.GetGradient(), expected.DValue) });
+    if (print)
+        std::cout << "Max error of F::ScaledDotProductAttention : " << error
+            << std::endl;
+    CHECK(error < 1e-4f);
+
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
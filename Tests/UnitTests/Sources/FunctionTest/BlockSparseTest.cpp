@@ -0,0 +1,249 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <FunctionTest/BlockSparseTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/sparse/BlockSparse.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/tensor/TensorData.hpp>
+#include <Sapphire/util/Checkpoint.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+namespace Sapphire::Test
+{
+void BlockSparseConversionTest(int blockRows, int blockCols, bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 16);
+
+    const auto m = static_cast<uint32_t>(distribution(gen) * blockRows);
+    const auto n = static_cast<uint32_t>(distribution(gen) * blockCols);
+    constexpr uint32_t numMatrices = 3;
+
+    std::vector<float> dense(m * n * numMatrices);
+    InitIntegerDenseMatrix(dense.data(), m, n, n, numMatrices, 0.9f);
+    dense[0] = 1.0f;
+
+    //! Dense -> block sparse -> dense
+    BlockSparseMatrix* fromDense = nullptr;
+    Compute::CreateBlockSparseMatrixWithDenseMatrix(
+        &fromDense, dense.data(), m, n, n, blockRows, blockCols, numMatrices);
+    std::vector<float> result(dense.size(), -1.0f);
+    Compute::ConvertBlockSparseMatrixToDenseMatrix(result.data(), fromDense, n,
+                                                   numMatrices);
+    CheckNoneZeroEquality(dense.data(), result.data(),
+                          static_cast<unsigned>(dense.size()), print);
+
+    //! Build CSR representation of the same matrices
+    std::vector<std::vector<float>> values(numMatrices);
+    std::vector<std::vector<uint32_t>> columns(numMatrices);
+    std::vector<std::vector<uint32_t>> rows(numMatrices);
+    std::vector<SparseMatrix> csr(numMatrices);
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+    {
+        rows[matrixIdx].emplace_back(0);
+        for (uint32_t row = 0; row < m; ++row)
+        {
+            for (uint32_t col = 0; col < n; ++col)
+            {
+                const auto value = dense[matrixIdx * m * n + row * n + col];
+                if (value == 0.0f)
+                    continue;
+                values[matrixIdx].emplace_back(value);
+                columns[matrixIdx].emplace_back(col);
+            }
+            rows[matrixIdx].emplace_back(
+                static_cast<uint32_t>(values[matrixIdx].size()));
+        }
+        csr[matrixIdx].V = values[matrixIdx].data();
+        csr[matrixIdx].COL = columns[matrixIdx].data();
+        csr[matrixIdx].ROW = rows[matrixIdx].data();
+        csr[matrixIdx].NNZ = static_cast<uint32_t>(values[matrixIdx].size());
+        csr[matrixIdx].M = m;
+        csr[matrixIdx].N = n;
+    }
+
+    //! CSR -> block sparse -> dense
+    BlockSparseMatrix* fromSparse = nullptr;
+    Compute::CreateBlockSparseMatrixWithSparseMatrix(
+        &fromSparse, csr.data(), blockRows, blockCols, numMatrices);
+    for (uint32_t matrixIdx = 0; matrixIdx < numMatrices; ++matrixIdx)
+        CHECK(fromSparse[matrixIdx].NNZB == fromDense[matrixIdx].NNZB);
+
+    std::fill(result.begin(), result.end(), -1.0f);
+    Compute::ConvertBlockSparseMatrixToDenseMatrix(result.data(), fromSparse,
+                                                   n, numMatrices);
+    CheckNoneZeroEquality(dense.data(), result.data(),
+                          static_cast<unsigned>(dense.size()), print);
+
+    Compute::DeepFreeBlockSparseHost(fromDense, numMatrices);
+    Compute::DeepFreeBlockSparseHost(fromSparse, numMatrices);
+}
+
+void BlockSparseGemmTest(int blockRows, int blockCols, bool print)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> distribution(1, 16);
+
+    const int M = distribution(gen) * 10;
+    const int K = distribution(gen) * blockRows;
+    const int N = distribution(gen) * blockCols;
+
+    TensorUtil::TensorData A(Shape({ M, K }), Type::Dense);
+    TensorUtil::TensorData B(Shape({ K, N }), Type::Dense);
+    TensorUtil::TensorData Out(Shape({ M, N }), Type::Dense);
+    Compute::Initialize::Normal(A, 0, 1);
+    Compute::Initialize::Normal(B, 0, 1);
+
+    //! Prune 80% of the blocks and write pruned values back to B
+    BlockSparseMatrix* sparseB = nullptr;
+    Compute::PruneDenseMatrixToBlockSparse(
+        &sparseB, B.HostRawPtr(), K, N, N, blockRows, blockCols, 0.8f);
+    Compute::ConvertBlockSparseMatrixToDenseMatrix(B.HostMutableRawPtr(),
+                                                   sparseB, N, 1);
+
+    const auto numBlocks = (K / blockRows) * (N / blockCols);
+    CHECK(sparseB->NNZB == static_cast<uint32_t>(
+        std::ceil(static_cast<double>(numBlocks) * (1.0 - 0.8))));
+
+    //! Dense Gemm with pruned matrix
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, A, B);
+    std::vector<float> denseResult(Out.HostRawPtr(),
+                                   Out.HostRawPtr() + M * N);
+
+    //! Block sparse Gemm
+    Compute::Initialize::Zeros(Out);
+    Compute::Gemm(Out, A, *sparseB);
+
+    CheckNoneZeroEquality(denseResult.data(), Out.HostRawPtr(), M * N, print,
+                          1e-3f);
+
+    Compute::DeepFreeBlockSparseHost(sparseB, 1);
+    Util::ResourceManager::ClearAll();
+}
+
+void BlockSparseLinearPruneTest(bool print)
+{
+    ModelManager::AddModel("BlockSparseLinearPruneTest");
+    ModelManager::SetCurrentModel("BlockSparseLinearPruneTest");
+
+    constexpr int batchSize = 10;
+    constexpr int inputs = 64;
+    constexpr int outputs = 32;
+
+    NN::Linear linear(inputs, outputs);
+    linear.Prune(0.75f, { 4, 4 });
+    CHECK(linear.IsPruned());
+
+    //! Count zero blocks of the pruned weight
+    const auto weightData = linear.GetWeight().GetData();
+    int zeroBlocks = 0;
+    for (int blockRowIdx = 0; blockRowIdx < inputs / 4; ++blockRowIdx)
+        for (int blockColIdx = 0; blockColIdx < outputs / 4; ++blockColIdx)
+        {
+            bool isZero = true;
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    if (weightData[(blockRowIdx * 4 + r) * outputs +
+                                   blockColIdx * 4 + c] != 0.0f)
+                        isZero = false;
+            zeroBlocks += isZero ? 1 : 0;
+        }
+    CHECK(zeroBlocks == (inputs / 4) * (outputs / 4) * 3 / 4);
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> xData(batchSize * inputs);
+    for (auto& data : xData)
+        data = dist(gen);
+
+    Tensor x(Shape({ batchSize, inputs }), true);
+    x.LoadData(xData);
+
+    //! Compute expected result with dense weight
+    const auto expectedOutput = [&](const std::vector<float>& weight) {
+        const auto biasData = linear.GetBias().GetData();
+        std::vector<float> expected(batchSize * outputs);
+        for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+            for (int outIdx = 0; outIdx < outputs; ++outIdx)
+            {
+                float sum = biasData[outIdx];
+                for (int inIdx = 0; inIdx < inputs; ++inIdx)
+                    sum += xData[batchIdx * inputs + inIdx] *
+                        weight[inIdx * outputs + outIdx];
+                expected[batchIdx * outputs + outIdx] = sum;
+            }
+        return expected;
+    };
+
+    Optimizer::SGD sgd(0.1f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+    auto y = linear(x);
+    auto expected = expectedOutput(weightData);
+    CheckNoneZeroEquality(expected.data(), y.GetData().data(),
+                          batchSize * outputs, print, 1e-3f);
+
+    //! Blocks follow the weight updated by the optimizer
+    y.LoadGradient(std::vector<float>(batchSize * outputs, 1.0f));
+    ModelManager::CurModel().BackProp(y);
+    const auto updated = linear(x);
+    const auto updatedWeight = linear.GetWeight().GetData();
+    CHECK(updatedWeight != weightData);
+    for (std::size_t i = 0; i < weightData.size(); ++i)
+        if (weightData[i] == 0.0f)
+            CHECK(updatedWeight[i] == 0.0f);
+    expected = expectedOutput(updatedWeight);
+    CheckNoneZeroEquality(expected.data(), updated.GetData().data(),
+                          batchSize * outputs, print, 1e-3f);
+
+    //! Weights written by LoadData and checkpoints are synced as well
+    const auto checkSynced = [&](const std::vector<float>& written) {
+        const auto output = linear(x);
+        auto syncedWeight = linear.GetWeight().GetData();
+        for (std::size_t i = 0; i < weightData.size(); ++i)
+            CHECK(syncedWeight[i] ==
+                (weightData[i] == 0.0f ? 0.0f : written[i]));
+        expected = expectedOutput(syncedWeight);
+        CheckNoneZeroEquality(expected.data(), output.GetData().data(),
+                              batchSize * outputs, print, 1e-3f);
+    };
+
+    std::vector<float> loaded(weightData.size());
+    for (auto& data : loaded)
+        data = dist(gen);
+    linear.GetWeight().LoadData(loaded);
+    checkSynced(loaded);
+
+    const auto filePath = std::filesystem::temp_directory_path() /
+                          "SapphireBlockSparseTest.ckpt";
+    Util::SaveCheckpoint(filePath, { &linear });
+    linear.GetWeight().LoadData(updatedWeight);
+    checkSynced(updatedWeight);
+    Util::LoadCheckpoint(filePath, { &linear });
+    checkSynced(loaded);
+    linear.GetWeight().LoadData(updatedWeight);
+    checkSynced(updatedWeight);
+    Util::MapCheckpoint(filePath, { &linear });
+    checkSynced(loaded);
+    std::filesystem::remove(filePath);
+
+    ModelManager::CurModel().SetOptimizer(nullptr);
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
@@ -12,8 +12,12 @@
 #include <Sapphire/util/CudaDevice.hpp>
 #include <Sapphire/util/ResourceManager.hpp>
 #include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <random>
+#include <vector>
 
 namespace Sapphire::Test
 {
@@ -200,4 +204,54 @@ void BroadcastMixed(bool print)
 
     delete[] cpuGemmResult;
 }
+
+void HostChannelBroadcastTest(bool print)
+{
+    constexpr int N = 2, C = 3, H = 4, W = 5;
+    const Shape shapeX({ N, C, H, W });
+    const Shape shapeBias({ 1, C, 1, 1 });
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> distrib(-1.0f, 1.0f);
+    std::vector<float> xData(shapeX.Size()), biasData(shapeBias.Size());
+    for (auto& value : xData)
+        value = distrib(gen);
+    for (auto& value : biasData)
+        value = distrib(gen);
+
+    TensorUtil::TensorData x(shapeX, Type::Dense);
+    TensorUtil::TensorData bias(shapeBias, Type::Dense);
+    TensorUtil::TensorData y(shapeX, Type::Dense);
+    x.SetData(xData);
+    bias.SetData(biasData);
+
+    const auto check = [&](const std::vector<float>& result, auto op) {
+        float maxError = 0.0f;
+        for (int n = 0; n < N; ++n)
+            for (int c = 0; c < C; ++c)
+                for (int i = 0; i < H * W; ++i)
+                {
+                    const auto idx = (n * C + c) * H * W + i;
+                    maxError = std::max(
+                        maxError,
+                        std::abs(result[idx] - op(xData[idx], biasData[c])));
+                }
+        if (print)
+            std::cout << "Max error : " << maxError << std::endl;
+        CHECK(maxError < 1e-6f);
+    };
+
+    Compute::Add(y, x, bias);
+    check(y.GetDataCopy(), [](float a, float b) { return a + b; });
+
+    Compute::Sub(y, x, bias);
+    check(y.GetDataCopy(), [](float a, float b) { return a - b; });
+
+    Compute::Dot(y, x, bias);
+    check(y.GetDataCopy(), [](float a, float b) { return a * b; });
+
+    //! Broadcast operand may come first
+    Compute::Add(y, bias, x);
+    check(y.GetDataCopy(), [](float a, float b) { return b + a; });
+}
 } // namespace Sapphire::Test
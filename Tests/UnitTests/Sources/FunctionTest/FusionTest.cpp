@@ -0,0 +1,274 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <FunctionTest/FusionTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/ActivationOps.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/ConvolutionOps.hpp>
+#include <Sapphire/compute/FusedOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/operations/Forward/Conv2D.hpp>
+#include <Sapphire/operations/Forward/Functional/MathForward.hpp>
+#include <Sapphire/operations/Forward/Functional/ReLU.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Results of forward and back propagation of a unit
+struct UnitResult
+{
+    std::vector<float> Output;
+    std::vector<std::vector<float>> Gradients;
+    std::vector<std::vector<float>> Weights;
+};
+
+//! Runs forward(inputs) in its own model, and back propagates gradient given
+//! to the output
+UnitResult RunUnit(const std::string& modelName,
+                   const std::vector<Shape>& inputShapes,
+                   const std::function<Tensor(std::vector<Tensor>&)>& forward,
+                   const std::function<std::vector<Tensor>()>& weights)
+{
+    const ModelScope scope(ModelManager::AddModel(modelName));
+    //! Every run is given the same inputs and gradient
+    std::mt19937 gen(5);
+    Optimizer::SGD sgd(0.1f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    std::vector<Tensor> inputs;
+    for (const auto& shape : inputShapes)
+    {
+        inputs.emplace_back(shape);
+        inputs.back().LoadData(RandomData(gen, shape.Size()));
+    }
+
+    UnitResult result;
+    const auto output = forward(inputs);
+    result.Output = output.GetData();
+    output.LoadGradient(RandomData(gen, result.Output.size()));
+    ModelManager::CurModel().BackProp(output);
+
+    for (const auto& input : inputs)
+        result.Gradients.emplace_back(input.GetGradient());
+    for (const auto& weight : weights())
+        result.Weights.emplace_back(weight.GetData());
+
+    ModelManager::CurModel().SetOptimizer(nullptr);
+    ModelManager::CurModel().Clear();
+    return result;
+}
+
+void CompareResults(const std::string& name, const UnitResult& separate,
+                    const UnitResult& fused, bool print)
+{
+    float maxError = MaxDifference(separate.Output, fused.Output);
+    for (std::size_t i = 0; i < separate.Gradients.size(); ++i)
+        maxError = std::max(maxError, MaxDifference(separate.Gradients[i],
+                                                    fused.Gradients[i]));
+    for (std::size_t i = 0; i < separate.Weights.size(); ++i)
+        maxError = std::max(maxError, MaxDifference(separate.Weights[i],
+                                                    fused.Weights[i]));
+    //! Gradient must have been propagated to the inputs
+    CHECK(std::any_of(fused.Gradients[0].begin(), fused.Gradients[0].end(),
+                      [](float value) { return value != 0.0f; }));
+    if (print)
+        std::cout << "Max error of fused " << name << " : " << maxError
+            << std::endl;
+    CHECK(maxError < 1e-4f);
+}
+} // namespace
+
+void FusedKernelTest(bool print)
+{
+    std::mt19937 gen(3);
+    //! Output spans several row blocks of LinearActivation
+    const int M = 1000, N = 37, K = 19;
+    const auto x = CreateData(Shape({ M, K }), RandomData(gen, M * K));
+    const auto weight =
+        CreateData(Shape({ K, N }), RandomData(gen, K * N));
+    const auto bias = CreateData(Shape({ 1, N }), RandomData(gen, N));
+
+    for (const auto activation :
+         { Compute::Activation::None, Compute::Activation::ReLU })
+    {
+        TensorUtil::TensorData expected(Shape({ M, N }), Type::Dense);
+        Compute::Initialize::Zeros(expected);
+        Compute::Gemm(expected, x, weight);
+        Compute::Add(expected, expected, bias);
+        if (activation == Compute::Activation::ReLU)
+            Compute::ReLU(expected, expected);
+
+        TensorUtil::TensorData y(Shape({ M, N }), Type::Dense);
+        Compute::LinearActivation(y, x, weight, bias, activation);
+        const auto error = MaxDifference(y.GetDataCopy(),
+                                         expected.GetDataCopy());
+        if (print)
+            std::cout << "Max error of LinearActivation : " << error
+                << std::endl;
+        CHECK(error < 1e-4f);
+    }
+
+    //! Bias along channels of (N, C, H, W)
+    const Shape imageShape({ 2, 3, 4, 5 });
+    const auto image = RandomData(gen, imageShape.Size());
+    const auto channelBias = CreateData(Shape({ 1, 3, 1, 1 }),
+                                        RandomData(gen, 3));
+    auto expected = CreateData(imageShape, image);
+    Compute::Add(expected, expected, channelBias);
+    Compute::ReLU(expected, expected);
+    auto y = CreateData(imageShape, image);
+    Compute::BiasActivation(y, channelBias, Compute::Activation::ReLU);
+    CHECK(MaxDifference(y.GetDataCopy(), expected.GetDataCopy()) < 1e-6f);
+
+    const auto wrongBias =
+        CreateData(Shape({ 3, 4, 1 }), RandomData(gen, 12));
+    CHECK_THROWS(Compute::BiasActivation(y, wrongBias,
+                                         Compute::Activation::ReLU));
+
+    //! Convolution with stride, dilation and padding, with and without bias
+    const Shape xShape({ 3, 2, 9, 8 }), filterShape({ 4, 2, 3, 2 });
+    const Shape convShape({ 3, 4, 5, 8 });
+    const auto convX = CreateData(xShape, RandomData(gen, xShape.Size()));
+    const auto filter =
+        CreateData(filterShape, RandomData(gen, filterShape.Size()));
+    const auto filterBias = CreateData(Shape({ 1, 4, 1, 1 }),
+                                       RandomData(gen, 4));
+    for (const bool useBias : { true, false })
+        for (const auto activation :
+             { Compute::Activation::None, Compute::Activation::ReLU })
+        {
+            TensorUtil::TensorData expectedConv(convShape, Type::Dense);
+            Compute::Initialize::Zeros(expectedConv);
+            Compute::Conv2DForward(expectedConv, convX, filter, 2, 1, 1, 2, 1,
+                                   1);
+            if (useBias)
+                Compute::Add(expectedConv, expectedConv, filterBias);
+            if (activation == Compute::Activation::ReLU)
+                Compute::ReLU(expectedConv, expectedConv);
+
+            TensorUtil::TensorData conv(convShape, Type::Dense);
+            if (useBias)
+                Compute::Conv2DActivation(conv, convX, filter, filterBias,
+                                          activation, 2, 1, 1, 2, 1, 1);
+            else
+                Compute::Conv2DActivation(conv, convX, filter, activation, 2,
+                                          1, 1, 2, 1, 1);
+            const auto error = MaxDifference(conv.GetDataCopy(),
+                                             expectedConv.GetDataCopy());
+            if (print)
+                std::cout << "Max error of Conv2DActivation : " << error
+                    << std::endl;
+            CHECK(error < 1e-4f);
+        }
+
+    //! Activation of sum
+    const auto a =
+        CreateData(imageShape, RandomData(gen, imageShape.Size()));
+    const auto b =
+        CreateData(imageShape, RandomData(gen, imageShape.Size()));
+    TensorUtil::TensorData sum(imageShape, Type::Dense);
+    Compute::Add(sum, a, b);
+    Compute::ReLU(sum, sum);
+    TensorUtil::TensorData fusedSum(imageShape, Type::Dense);
+    Compute::AddActivation(fusedSum, a, b, Compute::Activation::ReLU);
+    CHECK(fusedSum.GetDataCopy() == sum.GetDataCopy());
+
+    Util::ResourceManager::ClearAll();
+}
+
+void FusedUnitTest(bool print)
+{
+    std::mt19937 gen(3);
+    constexpr int batchSize = 6, inputs = 20, outputs = 12;
+
+    //! Linear followed by ReLU
+    const auto linearWeight = RandomData(gen, inputs * outputs);
+    const auto linearBias = RandomData(gen, outputs);
+    auto runLinear = [&](const std::string& modelName, bool fuse) {
+        std::unique_ptr<NN::Linear> linear;
+        return RunUnit(
+            modelName, { Shape({ batchSize, inputs }) },
+            [&](std::vector<Tensor>& x) {
+                linear = std::make_unique<NN::Linear>(inputs, outputs);
+                linear->GetWeight().LoadData(linearWeight);
+                linear->GetBias().LoadData(linearBias);
+                if (fuse)
+                {
+                    linear->FuseActivation(Compute::Activation::ReLU);
+                    return (*linear)(x[0]);
+                }
+                return F::ReLU((*linear)(x[0]));
+            },
+            [&] {
+                return std::vector<Tensor>{ linear->GetWeight(),
+                                            linear->GetBias() };
+            });
+    };
+    CompareResults("Linear", runLinear("FusedUnitTest linear", false),
+                   runLinear("FusedUnitTest fused linear", true), print);
+
+    //! Conv2D with bias followed by ReLU
+    constexpr int channels = 3, filters = 4, rows = 7, cols = 6;
+    const auto filterData = RandomData(gen, filters * channels * 3 * 3);
+    const auto convBias = RandomData(gen, filters);
+    auto runConv = [&](const std::string& modelName, bool fuse) {
+        std::unique_ptr<NN::Conv2D> conv;
+        return RunUnit(
+            modelName, { Shape({ 2, channels, rows, cols }) },
+            [&](std::vector<Tensor>& x) {
+                conv = std::make_unique<NN::Conv2D>(
+                    filters, channels, std::make_pair(3, 3),
+                    std::make_pair(1, 1), std::make_pair(1, 1),
+                    std::make_pair(1, 1), true);
+                conv->GetFilter().LoadData(filterData);
+                conv->GetBias().LoadData(convBias);
+                if (fuse)
+                {
+                    conv->FuseActivation(Compute::Activation::ReLU);
+                    return (*conv)(x[0]);
+                }
+                return F::ReLU((*conv)(x[0]));
+            },
+            [&] {
+                return std::vector<Tensor>{ conv->GetFilter(),
+                                            conv->GetBias() };
+            });
+    };
+    CompareResults("Conv2D", runConv("FusedUnitTest conv", false),
+                   runConv("FusedUnitTest fused conv", true), print);
+
+    //! Residual connection
+    const Shape shape({ batchSize, outputs });
+    auto runAdd = [&](const std::string& modelName, bool fuse) {
+        return RunUnit(
+            modelName, { shape, shape },
+            [&](std::vector<Tensor>& x) {
+                return fuse ? F::AddReLU(x[0], x[1])
+                            : F::ReLU(F::Add(x[0], x[1]));
+            },
+            [] { return std::vector<Tensor>(); });
+    };
+    CompareResults("Add", runAdd("FusedUnitTest add", false),
+                   runAdd("FusedUnitTest fused add", true), print);
+
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
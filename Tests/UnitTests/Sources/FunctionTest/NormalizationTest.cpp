@@ -0,0 +1,373 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <FunctionTest/NormalizationTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/NormalizationOps.hpp>
+#include <Sapphire/operations/Forward/BatchNorm2D.hpp>
+#include <Sapphire/operations/Forward/Conv2D.hpp>
+#include <Sapphire/operations/Forward/LayerNorm.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/Checkpoint.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Normalizes groups of x given by group(index) with two pass statistics
+//! in double precision, and applies gamma and beta given by param(index)
+std::vector<double> ReferenceNormalize(
+    const std::vector<double>& x, std::size_t numGroups,
+    const std::function<std::size_t(std::size_t)>& group,
+    const std::function<std::size_t(std::size_t)>& param,
+    const std::vector<double>& gamma, const std::vector<double>& beta,
+    double epsilon)
+{
+    std::vector<double> sum(numGroups, 0.0), squareSum(numGroups, 0.0),
+        count(numGroups, 0.0);
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        sum[group(i)] += x[i];
+        count[group(i)] += 1.0;
+    }
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        const double deviation = x[i] - sum[group(i)] / count[group(i)];
+        squareSum[group(i)] += deviation * deviation;
+    }
+
+    std::vector<double> y(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        const auto g = group(i);
+        y[i] = (x[i] - sum[g] / count[g]) /
+               std::sqrt(squareSum[g] / count[g] + epsilon) *
+               gamma[param(i)] + beta[param(i)];
+    }
+    return y;
+}
+
+//! Gradients of sum(dy * y) with respect to x, gamma and beta by central
+//! differences of ReferenceNormalize
+struct ReferenceGradients
+{
+    std::vector<float> Dx;
+    std::vector<float> DGamma;
+    std::vector<float> DBeta;
+};
+
+ReferenceGradients NumericalGradients(
+    const std::vector<float>& x, const std::vector<float>& dy,
+    std::size_t numGroups,
+    const std::function<std::size_t(std::size_t)>& group,
+    const std::function<std::size_t(std::size_t)>& param,
+    const std::vector<float>& gamma, const std::vector<float>& beta,
+    double epsilon)
+{
+    std::vector<double> xd(x.begin(), x.end());
+    std::vector<double> gammaD(gamma.begin(), gamma.end());
+    std::vector<double> betaD(beta.begin(), beta.end());
+    auto loss = [&] {
+        const auto y = ReferenceNormalize(xd, numGroups, group, param, gammaD,
+                                          betaD, epsilon);
+        double result = 0.0;
+        for (std::size_t i = 0; i < y.size(); ++i)
+            result += dy[i] * y[i];
+        return result;
+    };
+    constexpr double delta = 1e-5;
+    auto derivative = [&](double& value) {
+        const double original = value;
+        value = original + delta;
+        const double upper = loss();
+        value = original - delta;
+        const double lower = loss();
+        value = original;
+        return static_cast<float>((upper - lower) / (2 * delta));
+    };
+
+    ReferenceGradients gradients;
+    for (auto& value : xd)
+        gradients.Dx.emplace_back(derivative(value));
+    for (auto& value : gammaD)
+        gradients.DGamma.emplace_back(derivative(value));
+    for (auto& value : betaD)
+        gradients.DBeta.emplace_back(derivative(value));
+    return gradients;
+}
+} // namespace
+
+void NormalizationKernelTest(bool print)
+{
+    std::mt19937 gen(7);
+    constexpr float epsilon = 1e-5f;
+
+    //! Batch normalization of (N, C, H, W) with a large offset, where sum of
+    //! squares in single precision loses the variance
+    const int N = 3, C = 4, H = 5, W = 6;
+    const Shape xShape({ N, C, H, W });
+    auto xData = RandomData(gen, xShape.Size(), -1.0f, 1.0f);
+    for (auto& value : xData)
+        value += 1000.0f;
+    const auto gammaData = RandomData(gen, C, 0.5f, 1.5f);
+    const auto betaData = RandomData(gen, C, -0.5f, 0.5f);
+    const auto dyData = RandomData(gen, xShape.Size(), -1.0f, 1.0f);
+
+    const auto x = CreateData(xShape, xData);
+    const auto gamma = CreateData(Shape({ C }), gammaData);
+    const auto beta = CreateData(Shape({ C }), betaData);
+    TensorUtil::TensorData y(xShape, Type::Dense);
+    TensorUtil::TensorData savedMean(Shape({ C }), Type::Dense);
+    TensorUtil::TensorData savedInvStd(Shape({ C }), Type::Dense);
+    auto runningMean = CreateData(Shape({ C }), std::vector<float>(C, 0.0f));
+    auto runningVar = CreateData(Shape({ C }), std::vector<float>(C, 1.0f));
+    constexpr float momentum = 0.25f;
+    Compute::BatchNormForward(y, savedMean, savedInvStd, runningMean,
+                              runningVar, x, gamma, beta, momentum, epsilon);
+
+    const auto channelOf = [=](std::size_t i) {
+        return i / (H * W) % C;
+    };
+    const std::vector<double> xDouble(xData.begin(), xData.end());
+    const auto expected = ReferenceNormalize(
+        xDouble, C, channelOf, channelOf,
+        std::vector<double>(gammaData.begin(), gammaData.end()),
+        std::vector<double>(betaData.begin(), betaData.end()), epsilon);
+    const auto result = y.GetDataCopy();
+    float forwardError = 0.0f;
+    for (std::size_t i = 0; i < result.size(); ++i)
+        forwardError =
+            std::max(forwardError,
+                     std::abs(result[i] - static_cast<float>(expected[i])));
+    if (print)
+        std::cout << "Max error of BatchNormForward : " << forwardError
+            << std::endl;
+    CHECK(forwardError < 1e-3f);
+
+    //! Running statistics use unbiased variance
+    const auto mean = savedMean.GetDataCopy();
+    const auto newRunningMean = runningMean.GetDataCopy();
+    const auto newRunningVar = runningVar.GetDataCopy();
+    const auto invStd = savedInvStd.GetDataCopy();
+    const float count = static_cast<float>(N * H * W);
+    for (int channelIdx = 0; channelIdx < C; ++channelIdx)
+    {
+        const float variance =
+            1.0f / (invStd[channelIdx] * invStd[channelIdx]) - epsilon;
+        CHECK(std::abs(newRunningMean[channelIdx] -
+                       momentum * mean[channelIdx]) < 1e-3f);
+        CHECK(std::abs(newRunningVar[channelIdx] -
+                       (1.0f - momentum + momentum * variance * count /
+                        (count - 1.0f))) < 1e-3f);
+    }
+
+    //! Inference with running statistics equal to the batch statistics
+    //! reproduces training
+    std::vector<float> batchVar(C);
+    for (int channelIdx = 0; channelIdx < C; ++channelIdx)
+        batchVar[channelIdx] =
+            1.0f / (invStd[channelIdx] * invStd[channelIdx]) - epsilon;
+    TensorUtil::TensorData inferenceY(xShape, Type::Dense);
+    Compute::BatchNormInference(inferenceY, x, gamma, beta, savedMean,
+                                CreateData(Shape({ C }), batchVar), epsilon);
+    CHECK(MaxDifference(inferenceY.GetDataCopy(), result) < 1e-3f);
+
+    //! Back propagation accumulates to dx
+    const auto dy = CreateData(xShape, dyData);
+    auto dx = CreateData(xShape, std::vector<float>(xShape.Size(), 1.0f));
+    TensorUtil::TensorData dGamma(Shape({ C }), Type::Dense);
+    TensorUtil::TensorData dBeta(Shape({ C }), Type::Dense);
+    Compute::BatchNormBackward(dx, dGamma, dBeta, dy, x, gamma, savedMean,
+                               savedInvStd);
+
+    //! Numerical gradients are taken around zero mean, since the gradient
+    //! does not depend on the offset
+    auto centered = xData;
+    for (auto& value : centered)
+        value -= 1000.0f;
+    const auto batchGradients = NumericalGradients(
+        centered, dyData, C, channelOf, channelOf, gammaData, betaData,
+        epsilon);
+    auto dxResult = dx.GetDataCopy();
+    for (auto& value : dxResult)
+        value -= 1.0f;
+    const float batchError =
+        std::max({ MaxDifference(dxResult, batchGradients.Dx),
+                   MaxDifference(dGamma.GetDataCopy(), batchGradients.DGamma),
+                   MaxDifference(dBeta.GetDataCopy(), batchGradients.DBeta) });
+    if (print)
+        std::cout << "Max error of BatchNormBackward : " << batchError
+            << std::endl;
+    CHECK(batchError < 1e-3f);
+
+    //! Layer normalization over the last two dimensions
+    const int rows = 7, D0 = 3, D1 = 5;
+    const Shape layerShape({ rows, D0, D1 });
+    const auto layerX = RandomData(gen, layerShape.Size(), -2.0f, 3.0f);
+    const auto layerGamma = RandomData(gen, D0 * D1, 0.5f, 1.5f);
+    const auto layerBeta = RandomData(gen, D0 * D1, -0.5f, 0.5f);
+    const auto layerDy = RandomData(gen, layerShape.Size(), -1.0f, 1.0f);
+
+    const auto lx = CreateData(layerShape, layerX);
+    const auto lGamma = CreateData(Shape({ D0, D1 }), layerGamma);
+    const auto lBeta = CreateData(Shape({ D0, D1 }), layerBeta);
+    TensorUtil::TensorData ly(layerShape, Type::Dense);
+    TensorUtil::TensorData rowMean(Shape({ rows }), Type::Dense);
+    TensorUtil::TensorData rowInvStd(Shape({ rows }), Type::Dense);
+    Compute::LayerNormForward(ly, rowMean, rowInvStd, lx, lGamma, lBeta,
+                              epsilon);
+
+    const auto rowOf = [=](std::size_t i) { return i / (D0 * D1); };
+    const auto elementOf = [=](std::size_t i) { return i % (D0 * D1); };
+    const auto layerExpected = ReferenceNormalize(
+        std::vector<double>(layerX.begin(), layerX.end()), rows, rowOf,
+        elementOf, std::vector<double>(layerGamma.begin(), layerGamma.end()),
+        std::vector<double>(layerBeta.begin(), layerBeta.end()), epsilon);
+    CHECK(MaxDifference(ly.GetDataCopy(),
+                        std::vector<float>(layerExpected.begin(),
+                                           layerExpected.end())) < 1e-4f);
+
+    auto ldx = CreateData(layerShape,
+                          std::vector<float>(layerShape.Size(), 0.0f));
+    TensorUtil::TensorData lDGamma(Shape({ D0, D1 }), Type::Dense);
+    TensorUtil::TensorData lDBeta(Shape({ D0, D1 }), Type::Dense);
+    Compute::LayerNormBackward(ldx, lDGamma, lDBeta,
+                               CreateData(layerShape, layerDy), lx, lGamma,
+                               rowMean, rowInvStd);
+    const auto layerGradients = NumericalGradients(
+        layerX, layerDy, rows, rowOf, elementOf, layerGamma, layerBeta,
+        epsilon);
+    const float layerError =
+        std::max({ MaxDifference(ldx.GetDataCopy(), layerGradients.Dx),
+                   MaxDifference(lDGamma.GetDataCopy(), layerGradients.DGamma),
+                   MaxDifference(lDBeta.GetDataCopy(), layerGradients.DBeta) });
+    if (print)
+        std::cout << "Max error of LayerNormBackward : " << layerError
+            << std::endl;
+    CHECK(layerError < 2e-3f);
+
+    TensorUtil::TensorData wrongGamma(Shape({ D1 + 1 }), Type::Dense);
+    CHECK_THROWS(Compute::LayerNormForward(ly, rowMean, rowInvStd, lx,
+                                           wrongGamma, lBeta, epsilon));
+
+    Util::ResourceManager::ClearAll();
+}
+
+void NormalizationUnitTest(bool print)
+{
+    const ModelScope scope(ModelManager::AddModel("NormalizationUnitTest"));
+    std::mt19937 gen(11);
+    Optimizer::SGD sgd(0.1f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    constexpr int batchSize = 4, channels = 3, filters = 5, rows = 6,
+                  cols = 6;
+    const Shape imageShape({ batchSize, channels, rows, cols });
+    NN::Conv2D conv(filters, channels, { 3, 3 }, { 1, 1 }, { 1, 1 },
+                    { 1, 1 }, false);
+    NN::BatchNorm2D batchNorm(filters, 0.5f);
+
+    //! Training updates running statistics and trainable parameters
+    for (int step = 0; step < 3; ++step)
+    {
+        Tensor x(imageShape, true);
+        x.LoadData(RandomData(gen, imageShape.Size(), -1.0f, 1.0f));
+        auto convY = conv(x);
+        const auto y = batchNorm(convY);
+        y.LoadGradient(RandomData(gen, y.GetShape().Size(), -1.0f, 1.0f));
+        ModelManager::CurModel().BackProp(y);
+
+        const auto gradient = x.GetGradient();
+        CHECK(std::any_of(gradient.begin(), gradient.end(),
+                          [](float value) { return value != 0.0f; }));
+        ModelManager::CurModel().Clear();
+    }
+    const auto gamma = batchNorm.GetGamma().GetData();
+    CHECK(std::any_of(gamma.begin(), gamma.end(),
+                      [](float value) { return value != 1.0f; }));
+    const auto runningVar = batchNorm.GetRunningVar().GetData();
+    CHECK(std::any_of(runningVar.begin(), runningVar.end(),
+                      [](float value) { return value != 1.0f; }));
+
+    //! Running statistics are saved with trainable tensors
+    const auto filePath = std::filesystem::temp_directory_path() /
+                          "SapphireNormalizationTest.ckpt";
+    Util::SaveCheckpoint(filePath, { &batchNorm });
+    {
+        NN::BatchNorm2D restored(batchNorm.GetName(), filters);
+        Util::LoadCheckpoint(filePath, { &restored });
+        CHECK(restored.GetRunningMean().GetData() ==
+              batchNorm.GetRunningMean().GetData());
+        CHECK(restored.GetRunningVar().GetData() ==
+              batchNorm.GetRunningVar().GetData());
+        CHECK(restored.GetGamma().GetData() == gamma);
+    }
+    std::filesystem::remove(filePath);
+
+    //! Folding into the filter and bias computes the same as inference
+    batchNorm.SetTraining(false);
+    Tensor x(imageShape, true);
+    x.LoadData(RandomData(gen, imageShape.Size(), -1.0f, 1.0f));
+    auto convY = conv(x);
+    const auto expected = batchNorm(convY).GetData();
+
+    conv.FoldBatchNorm(batchNorm);
+    CHECK(batchNorm.IsFolded());
+    CHECK_THROWS(conv.FoldBatchNorm(batchNorm));
+    auto foldedY = conv(x);
+    const auto folded = batchNorm(foldedY);
+    CHECK(folded.TensorDescriptorKey() == foldedY.TensorDescriptorKey());
+    const float foldError = MaxDifference(folded.GetData(), expected);
+    if (print)
+        std::cout << "Max error of folded BatchNorm2D : " << foldError
+            << std::endl;
+    CHECK(foldError < 1e-4f);
+    ModelManager::CurModel().Clear();
+
+    //! Layer normalization of each sample
+    constexpr int features = 16;
+    NN::LayerNorm layerNorm(Shape({ features }));
+    Tensor input(Shape({ batchSize, features }), true);
+    input.LoadData(RandomData(gen, batchSize * features, -3.0f, 5.0f));
+    const auto output = layerNorm(input);
+    const auto normalized = output.GetData();
+    for (int rowIdx = 0; rowIdx < batchSize; ++rowIdx)
+    {
+        double sum = 0.0, squareSum = 0.0;
+        for (int i = 0; i < features; ++i)
+        {
+            sum += normalized[rowIdx * features + i];
+            squareSum += normalized[rowIdx * features + i] *
+                normalized[rowIdx * features + i];
+        }
+        CHECK(std::abs(sum / features) < 1e-4);
+        CHECK(std::abs(squareSum / features - 1.0) < 1e-3);
+    }
+    output.LoadGradient(RandomData(gen, batchSize * features, -1.0f, 1.0f));
+    ModelManager::CurModel().BackProp(output);
+    const auto inputGradient = input.GetGradient();
+    CHECK(std::any_of(inputGradient.begin(), inputGradient.end(),
+                      [](float value) { return value != 0.0f; }));
+
+    Tensor wrongInput(Shape({ batchSize, features + 1 }), true);
+    CHECK_THROWS(layerNorm(wrongInput));
+
+    ModelManager::CurModel().SetOptimizer(nullptr);
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
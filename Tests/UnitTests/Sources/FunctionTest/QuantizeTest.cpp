@@ -0,0 +1,264 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <FunctionTest/QuantizeTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/ConvolutionOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/QuantizeOps.hpp>
+#include <Sapphire/operations/Forward/Conv2D.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/util/CpuFeatures.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+float MaxAbs(const std::vector<float>& data)
+{
+    float result = 0.0f;
+    for (const auto value : data)
+        result = std::max(result, std::abs(value));
+    return result;
+}
+} // namespace
+
+void Int8GemmTest(bool print)
+{
+    //! Sizes are not multiples of packing depth and width to cover padding
+    const int M = 13, N = 45, K = 37;
+    //! Activations are asymmetric to use the zero point
+    std::mt19937 gen(42);
+    const auto xData = RandomData(gen, M * K, -1.0f, 2.0f);
+    auto weightData = RandomData(gen, K * N, -0.5f, 0.5f);
+    //! Channel of zeros
+    for (int kIdx = 0; kIdx < K; ++kIdx)
+        weightData[kIdx * N + 3] = 0.0f;
+    const auto biasData = RandomData(gen, N, -1.0f, 1.0f);
+
+    auto x = CreateData(Shape({ M, K }), xData);
+    auto weight = CreateData(Shape({ K, N }), weightData);
+    auto bias = CreateData(Shape({ N }), biasData);
+
+    Compute::RangeObserver observer;
+    CHECK(observer.Empty());
+    observer.Observe(x);
+    const auto params = observer.GetParams();
+    CHECK(params.ZeroPoint > 0);
+
+    const Compute::Int8Weight int8Weight(weight, false);
+    CHECK(int8Weight.Inputs() == K);
+    CHECK(int8Weight.Outputs() == N);
+    CHECK(int8Weight.GetColumnSums()[3] == 0);
+    const auto& scales = int8Weight.GetScales();
+
+    //! Error of each product is bounded by quantization steps of activation
+    //! and weight
+    std::vector<float> expected(M * N), errorBound(M * N);
+    for (int mIdx = 0; mIdx < M; ++mIdx)
+        for (int nIdx = 0; nIdx < N; ++nIdx)
+        {
+            float sum = biasData[nIdx], bound = 1e-4f;
+            for (int kIdx = 0; kIdx < K; ++kIdx)
+            {
+                const auto a = xData[mIdx * K + kIdx];
+                const auto w = weightData[kIdx * N + nIdx];
+                sum += a * w;
+                bound += std::abs(a) * scales[nIdx] / 2 +
+                    std::abs(w) * params.Scale +
+                    params.Scale * scales[nIdx] / 2;
+            }
+            expected[mIdx * N + nIdx] = sum;
+            errorBound[mIdx * N + nIdx] = bound + 1e-4f * std::abs(sum);
+        }
+
+    const auto initialLevel = Util::GetSimdLevel();
+    std::vector<float> scalarResult;
+    for (const auto level : { Util::SimdLevel::Scalar, Util::SimdLevel::Avx2,
+                              Util::SimdLevel::Avx512 })
+    {
+        if (!Util::IsSimdLevelAvailable(level))
+            continue;
+        if (print)
+            std::cout << "Testing int8 gemm on "
+                << Util::SimdLevelToString(level) << std::endl;
+        Util::SetSimdLevel(level);
+
+        TensorUtil::TensorData y(Shape({ M, N }), Type::Dense);
+        Compute::GemmInt8(y, x, int8Weight, bias, params);
+        const auto result = y.GetDataCopy();
+
+        TensorUtil::TensorData yReLU(Shape({ M, N }), Type::Dense);
+        Compute::GemmInt8(yReLU, x, int8Weight, bias, params, true);
+        const auto resultReLU = yReLU.GetDataCopy();
+
+        for (int i = 0; i < M * N; ++i)
+        {
+            CHECK(std::abs(result[i] - expected[i]) <= errorBound[i]);
+            CHECK(resultReLU[i] == std::max(result[i], 0.0f));
+        }
+
+        //! Accumulation in int32 is exact, and epilogues round the same way
+        if (level == Util::SimdLevel::Scalar)
+            scalarResult = result;
+        else
+            for (int i = 0; i < M * N; ++i)
+                CHECK(result[i] == scalarResult[i]);
+    }
+    Util::SetSimdLevel(initialLevel);
+
+    //! Without bias
+    TensorUtil::TensorData y(Shape({ M, N }), Type::Dense);
+    Compute::GemmInt8(y, x, int8Weight, params);
+    const auto result = y.GetDataCopy();
+    for (int i = 0; i < M * N; ++i)
+        CHECK(std::abs(result[i] + biasData[i % N] - expected[i]) <=
+              errorBound[i]);
+
+    TensorUtil::TensorData wrongShape(Shape({ M, N + 1 }), Type::Dense);
+    CHECK_THROWS(Compute::GemmInt8(wrongShape, x, int8Weight, params));
+
+    Util::ResourceManager::ClearAll();
+}
+
+void Int8Conv2DTest(bool print)
+{
+    const int batchSize = 2, xChannels = 3, yChannels = 5;
+    const int xRows = 9, xCols = 8, filterRows = 3, filterCols = 2;
+    const int strideRow = 2, strideCol = 1, rowPadding = 1, colPadding = 1;
+    const int dilationRow = 1, dilationCol = 2;
+    const int yRows =
+        (xRows + 2 * rowPadding - dilationRow * (filterRows - 1) - 1) /
+        strideRow + 1;
+    const int yCols =
+        (xCols + 2 * colPadding - dilationCol * (filterCols - 1) - 1) /
+        strideCol + 1;
+
+    std::mt19937 gen(42);
+    const auto xData =
+        RandomData(gen, batchSize * xChannels * xRows * xCols, -1.0f, 1.0f);
+    const auto filterData = RandomData(
+        gen, yChannels * xChannels * filterRows * filterCols, -0.5f, 0.5f);
+    const auto biasData = RandomData(gen, yChannels, -1.0f, 1.0f);
+
+    auto x = CreateData(Shape({ batchSize, xChannels, xRows, xCols }), xData);
+    auto filter = CreateData(
+        Shape({ yChannels, xChannels, filterRows, filterCols }), filterData);
+    auto bias = CreateData(Shape({ yChannels }), biasData);
+    const Shape yShape({ batchSize, yChannels, yRows, yCols });
+
+    TensorUtil::TensorData expectedY(yShape, Type::Dense);
+    Compute::Initialize::Zeros(expectedY);
+    Compute::Conv2DForward(expectedY, x, filter, strideRow, strideCol,
+                           dilationRow, dilationCol, rowPadding, colPadding);
+    auto expected = expectedY.GetDataCopy();
+    const int unitSize = yRows * yCols;
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        expected[i] += biasData[(i / unitSize) % yChannels];
+
+    Compute::RangeObserver observer;
+    observer.Observe(x);
+    const auto params = observer.GetParams();
+    const Compute::Int8Weight int8Filter(filter, true);
+    CHECK(int8Filter.Outputs() == yChannels);
+    CHECK(int8Filter.Inputs() == xChannels * filterRows * filterCols);
+
+    TensorUtil::TensorData y(yShape, Type::Dense);
+    Compute::Conv2DInt8(y, x, int8Filter, bias, params, strideRow, strideCol,
+                        dilationRow, dilationCol, rowPadding, colPadding);
+    const auto result = y.GetDataCopy();
+
+    //! Bound of error of every product
+    const auto& scales = int8Filter.GetScales();
+    const float maxWeightScale = *std::max_element(scales.begin(),
+                                                   scales.end());
+    const float bound =
+        static_cast<float>(int8Filter.Inputs()) *
+        (MaxAbs(xData) * maxWeightScale / 2 + MaxAbs(filterData) *
+         params.Scale + params.Scale * maxWeightScale / 2) + 1e-4f;
+
+    float maxError = 0.0f;
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        maxError = std::max(maxError, std::abs(result[i] - expected[i]));
+    if (print)
+        std::cout << "Max error of int8 convolution : " << maxError
+            << " (bound : " << bound << ")" << std::endl;
+    CHECK(maxError <= bound);
+    CHECK(maxError <= 0.02f * MaxAbs(expected));
+
+    Util::ResourceManager::ClearAll();
+}
+
+void QuantizedUnitTest(bool print)
+{
+    ModelManager::AddModel("QuantizedUnitTest");
+    ModelManager::SetCurrentModel("QuantizedUnitTest");
+
+    constexpr int batchSize = 8;
+    constexpr int inputs = 64;
+    constexpr int outputs = 32;
+
+    NN::Linear linear(inputs, outputs);
+    CHECK_THROWS(linear.Quantize());
+
+    std::mt19937 gen(42);
+    Tensor x(Shape({ batchSize, inputs }), true);
+    x.LoadData(RandomData(gen, batchSize * inputs, -1.0f, 1.0f));
+    const auto expected = linear(x).GetData();
+
+    //! Calibrate on sample batches
+    linear.Calibrate();
+    for (int batchIdx = 0; batchIdx < 3; ++batchIdx)
+    {
+        Tensor sample(Shape({ batchSize, inputs }), true);
+        sample.LoadData(RandomData(gen, batchSize * inputs, -1.0f, 1.0f));
+        static_cast<void>(linear(sample));
+    }
+    linear.Quantize();
+    CHECK(linear.IsQuantized());
+
+    const auto result = linear(x).GetData();
+    float maxError = 0.0f;
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        maxError = std::max(maxError, std::abs(result[i] - expected[i]));
+    if (print)
+        std::cout << "Max error of quantized Linear : " << maxError
+            << std::endl;
+    CHECK(maxError <= 0.05f * MaxAbs(expected));
+
+    constexpr int channels = 3, filters = 4, rows = 8, cols = 8;
+    NN::Conv2D conv2D(filters, channels, { 3, 3 }, { 1, 1 }, { 1, 1 },
+                      { 1, 1 }, true);
+    Tensor image(Shape({ 2, channels, rows, cols }), true);
+    image.LoadData(RandomData(gen, 2 * channels * rows * cols, 0.0f, 1.0f));
+    const auto expectedImage = conv2D(image).GetData();
+
+    conv2D.Calibrate();
+    static_cast<void>(conv2D(image));
+    conv2D.Quantize();
+    CHECK(conv2D.IsQuantized());
+
+    const auto resultImage = conv2D(image).GetData();
+    float maxImageError = 0.0f;
+    for (std::size_t i = 0; i < expectedImage.size(); ++i)
+        maxImageError = std::max(
+            maxImageError, std::abs(resultImage[i] - expectedImage[i]));
+    if (print)
+        std::cout << "Max error of quantized Conv2D : " << maxImageError
+            << std::endl;
+    CHECK(maxImageError <= 0.05f * MaxAbs(expectedImage));
+
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
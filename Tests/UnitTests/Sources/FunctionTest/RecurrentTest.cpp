@@ -0,0 +1,381 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <FunctionTest/RecurrentTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/RecurrentOps.hpp>
+#include <Sapphire/operations/Forward/GRU.hpp>
+#include <Sapphire/operations/Forward/LSTM.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+constexpr int steps = 4, batchSize = 3, inputSize = 5, hiddenSize = 4;
+
+double Sigmoid(double x)
+{
+    return 1.0 / (1.0 + std::exp(-x));
+}
+
+//! Returns sum of a row of x (inputs) multiplied by column col of weight in
+//! (inputs, cols) layout
+double Dot(const double* x, const std::vector<double>& weight, int inputs,
+           int cols, int col)
+{
+    double result = 0.0;
+    for (int k = 0; k < inputs; ++k)
+        result += x[k] * weight[k * cols + col];
+    return result;
+}
+
+//! LSTM computed gate by gate. params are x, weightIh, weightHh and bias
+std::vector<double> ReferenceLstm(
+    const std::vector<std::vector<double>>& params)
+{
+    const auto& x = params[0];
+    const auto& weightIh = params[1];
+    const auto& weightHh = params[2];
+    const auto& bias = params[3];
+    constexpr int H = hiddenSize, cols = 4 * hiddenSize;
+
+    std::vector<double> y(steps * batchSize * H);
+    std::vector<double> hidden(batchSize * H, 0.0), cell(batchSize * H, 0.0);
+    for (int t = 0; t < steps; ++t)
+    {
+        auto newHidden = hidden;
+        for (int n = 0; n < batchSize; ++n)
+        {
+            const double* in = x.data() + (t * batchSize + n) * inputSize;
+            const double* prev = hidden.data() + n * H;
+            auto gate = [&](int col) {
+                return Dot(in, weightIh, inputSize, cols, col) +
+                       Dot(prev, weightHh, H, cols, col) + bias[col];
+            };
+            for (int j = 0; j < H; ++j)
+            {
+                const double i = Sigmoid(gate(j));
+                const double f = Sigmoid(gate(H + j));
+                const double g = std::tanh(gate(2 * H + j));
+                const double o = Sigmoid(gate(3 * H + j));
+                cell[n * H + j] = f * cell[n * H + j] + i * g;
+                newHidden[n * H + j] = o * std::tanh(cell[n * H + j]);
+            }
+        }
+        hidden = newHidden;
+        std::copy(hidden.begin(), hidden.end(),
+                  y.begin() + t * batchSize * H);
+    }
+    return y;
+}
+
+//! GRU computed gate by gate. params are x, weightIh, weightHh, biasIh and
+//! biasHh
+std::vector<double> ReferenceGru(
+    const std::vector<std::vector<double>>& params)
+{
+    const auto& x = params[0];
+    const auto& weightIh = params[1];
+    const auto& weightHh = params[2];
+    const auto& biasIh = params[3];
+    const auto& biasHh = params[4];
+    constexpr int H = hiddenSize, cols = 3 * hiddenSize;
+
+    std::vector<double> y(steps * batchSize * H);
+    std::vector<double> hidden(batchSize * H, 0.0);
+    for (int t = 0; t < steps; ++t)
+    {
+        auto newHidden = hidden;
+        for (int n = 0; n < batchSize; ++n)
+        {
+            const double* in = x.data() + (t * batchSize + n) * inputSize;
+            const double* prev = hidden.data() + n * H;
+            for (int j = 0; j < H; ++j)
+            {
+                auto inputGate = [&](int col) {
+                    return Dot(in, weightIh, inputSize, cols, col) +
+                           biasIh[col];
+                };
+                auto hiddenGate = [&](int col) {
+                    return Dot(prev, weightHh, H, cols, col) + biasHh[col];
+                };
+                const double r = Sigmoid(inputGate(j) + hiddenGate(j));
+                const double z =
+                    Sigmoid(inputGate(H + j) + hiddenGate(H + j));
+                const double nGate = std::tanh(inputGate(2 * H + j) +
+                                               r * hiddenGate(2 * H + j));
+                newHidden[n * H + j] = (1.0 - z) * nGate + z * prev[j];
+            }
+        }
+        hidden = newHidden;
+        std::copy(hidden.begin(), hidden.end(),
+                  y.begin() + t * batchSize * H);
+    }
+    return y;
+}
+
+using Reference = std::function<std::vector<double>(
+    const std::vector<std::vector<double>>&)>;
+
+std::vector<std::vector<double>> ToDouble(
+    const std::vector<std::vector<float>>& params)
+{
+    std::vector<std::vector<double>> result;
+    for (const auto& param : params)
+        result.emplace_back(param.begin(), param.end());
+    return result;
+}
+
+std::vector<float> ToFloat(const std::vector<double>& data)
+{
+    return { data.begin(), data.end() };
+}
+
+//! Gradients of sum(dy * y) with respect to every parameter by central
+//! differences of reference
+std::vector<std::vector<float>> NumericalGradients(
+    const Reference& reference, const std::vector<std::vector<float>>& params,
+    const std::vector<float>& dy)
+{
+    auto paramsD = ToDouble(params);
+    auto loss = [&] {
+        const auto y = reference(paramsD);
+        double result = 0.0;
+        for (std::size_t i = 0; i < y.size(); ++i)
+            result += dy[i] * y[i];
+        return result;
+    };
+
+    constexpr double delta = 1e-5;
+    std::vector<std::vector<float>> gradients;
+    for (auto& param : paramsD)
+    {
+        std::vector<float> gradient;
+        for (auto& value : param)
+        {
+            const double original = value;
+            value = original + delta;
+            const double upper = loss();
+            value = original - delta;
+            const double lower = loss();
+            value = original;
+            gradient.emplace_back(
+                static_cast<float>((upper - lower) / (2 * delta)));
+        }
+        gradients.emplace_back(std::move(gradient));
+    }
+    return gradients;
+}
+
+//! Random x, weights and biases of a recurrent layer with numGates gates
+std::vector<std::vector<float>> RandomParams(std::mt19937& gen, int numGates,
+                                             int numBiases)
+{
+    const int cols = numGates * hiddenSize;
+    std::vector<std::vector<float>> params = {
+        RandomData(gen, steps * batchSize * inputSize, -1.0f, 1.0f),
+        RandomData(gen, inputSize * cols, -0.5f, 0.5f),
+        RandomData(gen, hiddenSize * cols, -0.5f, 0.5f)
+    };
+    for (int idx = 0; idx < numBiases; ++idx)
+        params.emplace_back(RandomData(gen, cols, -0.5f, 0.5f));
+    return params;
+}
+
+void CheckGradient(const std::string& name, const std::vector<float>& result,
+                   const std::vector<float>& expected, bool print)
+{
+    const float error = MaxDifference(result, expected);
+    if (print)
+        std::cout << "Max error of " << name << " : " << error << std::endl;
+    CHECK(error < 1e-3f);
+}
+} // namespace
+
+void RecurrentKernelTest(bool print)
+{
+    std::mt19937 gen(17);
+    const Shape xShape({ steps, batchSize, inputSize });
+    const Shape yShape({ steps, batchSize, hiddenSize });
+    const auto dyData = RandomData(gen, yShape.Size(), -1.0f, 1.0f);
+
+    //! LSTM
+    {
+        const auto params = RandomParams(gen, 4, 1);
+        const auto expected = ReferenceLstm(ToDouble(params));
+        const auto gradients =
+            NumericalGradients(ReferenceLstm, params, dyData);
+
+        const auto x = CreateData(xShape, params[0]);
+        const auto weightIh =
+            CreateData(Shape({ inputSize, 4 * hiddenSize }), params[1]);
+        const auto weightHh =
+            CreateData(Shape({ hiddenSize, 4 * hiddenSize }), params[2]);
+        const auto bias = CreateData(Shape({ 4 * hiddenSize }), params[3]);
+        TensorUtil::TensorData y(yShape, Type::Dense);
+        TensorUtil::TensorData gates(
+            Shape({ steps, batchSize, 4 * hiddenSize }), Type::Dense);
+        TensorUtil::TensorData cells(yShape, Type::Dense);
+        Compute::LstmForward(y, gates, cells, x, weightIh, weightHh, bias);
+
+        const float forwardError =
+            MaxDifference(y.GetDataCopy(), ToFloat(expected));
+        if (print)
+            std::cout << "Max error of LSTM forward : " << forwardError
+                << std::endl;
+        CHECK(forwardError < 1e-5f);
+
+        //! dx is accumulated, and gradients of weights are overwritten
+        TensorUtil::TensorData dx(xShape, Type::Dense);
+        TensorUtil::TensorData dWeightIh(weightIh.GetShape(), Type::Dense);
+        TensorUtil::TensorData dWeightHh(weightHh.GetShape(), Type::Dense);
+        TensorUtil::TensorData dBias(bias.GetShape(), Type::Dense);
+        Compute::Initialize::Ones(dx);
+        Compute::Initialize::Ones(dWeightIh);
+        const auto dy = CreateData(yShape, dyData);
+        Compute::LstmBackward(dx, dWeightIh, dWeightHh, dBias, dy, x, y,
+                              weightIh, weightHh, gates, cells);
+
+        auto dxData = dx.GetDataCopy();
+        for (auto& value : dxData)
+            value -= 1.0f;
+        CheckGradient("LSTM dx", dxData, gradients[0], print);
+        CheckGradient("LSTM dWeightIh", dWeightIh.GetDataCopy(),
+                      gradients[1], print);
+        CheckGradient("LSTM dWeightHh", dWeightHh.GetDataCopy(),
+                      gradients[2], print);
+        CheckGradient("LSTM dBias", dBias.GetDataCopy(), gradients[3],
+                      print);
+
+        TensorUtil::TensorData wrongGates(yShape, Type::Dense);
+        CHECK_THROWS(Compute::LstmForward(y, wrongGates, cells, x, weightIh,
+                                          weightHh, bias));
+        CHECK_THROWS(Compute::LstmForward(y, gates, cells, x, weightHh,
+                                          weightHh, bias));
+    }
+
+    //! GRU
+    {
+        const auto params = RandomParams(gen, 3, 2);
+        const auto expected = ReferenceGru(ToDouble(params));
+        const auto gradients =
+            NumericalGradients(ReferenceGru, params, dyData);
+
+        const auto x = CreateData(xShape, params[0]);
+        const auto weightIh =
+            CreateData(Shape({ inputSize, 3 * hiddenSize }), params[1]);
+        const auto weightHh =
+            CreateData(Shape({ hiddenSize, 3 * hiddenSize }), params[2]);
+        const auto biasIh = CreateData(Shape({ 3 * hiddenSize }), params[3]);
+        const auto biasHh = CreateData(Shape({ 3 * hiddenSize }), params[4]);
+        TensorUtil::TensorData y(yShape, Type::Dense);
+        TensorUtil::TensorData gates(
+            Shape({ steps, batchSize, 4 * hiddenSize }), Type::Dense);
+        Compute::GruForward(y, gates, x, weightIh, weightHh, biasIh, biasHh);
+
+        const float forwardError =
+            MaxDifference(y.GetDataCopy(), ToFloat(expected));
+        if (print)
+            std::cout << "Max error of GRU forward : " << forwardError
+                << std::endl;
+        CHECK(forwardError < 1e-5f);
+
+        TensorUtil::TensorData dx(xShape, Type::Dense);
+        TensorUtil::TensorData dWeightIh(weightIh.GetShape(), Type::Dense);
+        TensorUtil::TensorData dWeightHh(weightHh.GetShape(), Type::Dense);
+        TensorUtil::TensorData dBiasIh(biasIh.GetShape(), Type::Dense);
+        TensorUtil::TensorData dBiasHh(biasHh.GetShape(), Type::Dense);
+        Compute::Initialize::Zeros(dx);
+        const auto dy = CreateData(yShape, dyData);
+        Compute::GruBackward(dx, dWeightIh, dWeightHh, dBiasIh, dBiasHh, dy,
+                             x, y, weightIh, weightHh, gates);
+
+        CheckGradient("GRU dx", dx.GetDataCopy(), gradients[0], print);
+        CheckGradient("GRU dWeightIh", dWeightIh.GetDataCopy(),
+                      gradients[1], print);
+        CheckGradient("GRU dWeightHh", dWeightHh.GetDataCopy(),
+                      gradients[2], print);
+        CheckGradient("GRU dBiasIh", dBiasIh.GetDataCopy(), gradients[3],
+                      print);
+        CheckGradient("GRU dBiasHh", dBiasHh.GetDataCopy(), gradients[4],
+                      print);
+    }
+
+    Util::ResourceManager::ClearAll();
+}
+
+void RecurrentUnitTest(bool print)
+{
+    const ModelScope scope(ModelManager::AddModel("RecurrentUnitTest"));
+    std::mt19937 gen(23);
+    constexpr float learningRate = 0.1f;
+    Optimizer::SGD sgd(learningRate);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    const Shape xShape({ steps, batchSize, inputSize });
+    const auto xData = RandomData(gen, xShape.Size(), -1.0f, 1.0f);
+    const auto dyData =
+        RandomData(gen, steps * batchSize * hiddenSize, -1.0f, 1.0f);
+
+    //! Gradient of x and update of the weights match numerical gradients of
+    //! the weights before the update
+    auto checkUnit = [&](const std::string& name, const Reference& reference,
+                         std::vector<Tensor> params, auto& unit) {
+        std::vector<std::vector<float>> paramData = { xData };
+        for (const auto& param : params)
+            paramData.emplace_back(param.GetData());
+        const auto gradients = NumericalGradients(reference, paramData,
+                                                  dyData);
+
+        Tensor x(xShape, true);
+        x.LoadData(xData);
+        const auto y = unit(x);
+        CHECK(y.GetShape() == Shape({ steps, batchSize, hiddenSize }));
+        y.LoadGradient(dyData);
+        ModelManager::CurModel().BackProp(y);
+
+        CheckGradient(name + " dx", x.GetGradient(), gradients[0], print);
+        for (std::size_t idx = 0; idx < params.size(); ++idx)
+        {
+            auto update = params[idx].GetData();
+            for (std::size_t i = 0; i < update.size(); ++i)
+                update[i] = (paramData[idx + 1][i] - update[i]) /
+                            learningRate;
+            CheckGradient(name + " update", update, gradients[idx + 1],
+                          print);
+        }
+        ModelManager::CurModel().Clear();
+
+        Tensor wrongX(Shape({ steps, batchSize, inputSize + 1 }), true);
+        CHECK_THROWS(unit(wrongX));
+    };
+
+    NN::LSTM lstm(inputSize, hiddenSize);
+    checkUnit("LSTM", ReferenceLstm,
+              { lstm.GetWeightIh(), lstm.GetWeightHh(), lstm.GetBias() },
+              lstm);
+
+    NN::GRU gru(inputSize, hiddenSize);
+    checkUnit("GRU", ReferenceGru,
+              { gru.GetWeightIh(), gru.GetWeightHh(), gru.GetBiasIh(),
+                gru.GetBiasHh() },
+              gru);
+
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,109 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <FunctionTest/SimdDispatchTest.hpp>
+#include <Sapphire/compute/dense/naive/NaiveBasic.hpp>
+#include <Sapphire/compute/dense/naive/NaiveGemm.hpp>
+#include <Sapphire/util/CpuFeatures.hpp>
+#include <TestUtil.hpp>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Runs host kernels on given inputs and returns concatenated outputs
+std::vector<float> RunKernels(const std::vector<float>& a,
+                              const std::vector<float>& b,
+                              unsigned int numMatrices, unsigned int M,
+                              unsigned int N, unsigned int K)
+{
+    const auto sizeOut = numMatrices * M * N;
+    //! Gemm accumulates to the output
+    std::vector<float> gemm(sizeOut, 1.0f);
+    Compute::Dense::Naive::Gemm(sizeOut, gemm.data(), a.data(), b.data(), M,
+                                N, K);
+
+    //! Elementwise kernels run on the first sizeOut elements of a and b
+    std::vector<float> add(sizeOut), sub(sizeOut), dot(sizeOut);
+    std::vector<float> scale(sizeOut), relu(sizeOut);
+    Compute::Dense::Naive::Add(sizeOut, add.data(), a.data(), b.data(), 0,
+                               false, false);
+    Compute::Dense::Naive::Sub(sizeOut, sub.data(), a.data(), b.data(), 0,
+                               false, false);
+    Compute::Dense::Naive::Dot(sizeOut, dot.data(), a.data(), b.data(), 0,
+                               false, false);
+    Compute::Dense::Naive::Scale(scale.data(), a.data(), 0.5f, sizeOut);
+    Compute::Dense::Naive::ReLU(relu.data(), a.data(), sizeOut);
+
+    std::vector<float> result;
+    for (const auto* output : { &gemm, &add, &sub, &dot, &scale, &relu })
+        result.insert(result.end(), output->begin(), output->end());
+    return result;
+}
+} // namespace
+
+void SimdDispatchTest(bool print)
+{
+    const auto initialLevel = Util::GetSimdLevel();
+    if (print)
+        std::cout << "Cpu supports "
+            << Util::SimdLevelToString(
+                Util::CpuFeatures::Host().SupportedLevel())
+            << ", dispatched to " << Util::SimdLevelToString(initialLevel)
+            << std::endl;
+
+    for (const auto level : { Util::SimdLevel::Scalar, Util::SimdLevel::Avx2,
+                              Util::SimdLevel::Avx512 })
+        CHECK(Util::SimdLevelFromString(Util::SimdLevelToString(level)) ==
+              level);
+    CHECK(Util::IsSimdLevelAvailable(Util::SimdLevel::Scalar));
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    //! Sizes are not multiples of vector width to cover remainders
+    std::uniform_int_distribution<unsigned int> distribution(1, 50);
+
+    for (int loop = 0; loop < 5; ++loop)
+    {
+        const unsigned int numMatrices = 2;
+        const auto M = distribution(gen);
+        const auto N = distribution(gen);
+        const auto K = distribution(gen);
+
+        //! Inputs are large enough for both Gemm and elementwise kernels
+        const auto size = numMatrices * std::max({ M * K, K * N, M * N });
+        std::vector<float> a(size), b(size);
+        InitIntegerDenseMatrix(a.data(), 1, size, size, 1, 0.1f);
+        InitIntegerDenseMatrix(b.data(), 1, size, size, 1, 0.1f);
+
+        Util::SetSimdLevel(Util::SimdLevel::Scalar);
+        const auto expected = RunKernels(a, b, numMatrices, M, N, K);
+
+        for (const auto level : { Util::SimdLevel::Avx2,
+                                  Util::SimdLevel::Avx512 })
+        {
+            if (!Util::IsSimdLevelAvailable(level))
+                continue;
+            if (print)
+                std::cout << "Testing " << Util::SimdLevelToString(level)
+                    << " (M : " << M << ", N : " << N << ", K : " << K
+                    << ")" << std::endl;
+            Util::SetSimdLevel(level);
+            const auto result = RunKernels(a, b, numMatrices, M, N, K);
+            //! Inputs are small integers, so results are exact
+            CheckNoneZeroEquality(expected.data(), result.data(),
+                                  static_cast<unsigned>(expected.size()),
+                                  false);
+        }
+    }
+
+    Util::SetSimdLevel(initialLevel);
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,121 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <ModelTest/BackPropMemoryTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Forward/Functional/ReLU.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/Loss/MSE.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <doctest/doctest.h>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+constexpr int BatchSize = 32;
+constexpr int Features = 64;
+constexpr int Depth = 6;
+constexpr int Steps = 3;
+
+struct TrainResult
+{
+    std::vector<float> Weight;
+    std::size_t PeakByteSize;
+    bool HiddenReleased;
+};
+
+//! Trains the stack for Steps without cleaning the volatile pool, so memory
+//! of a step can only be reused by later steps if it was released
+TrainResult Train(const std::string& modelName, bool release)
+{
+    const ModelScope scope(ModelManager::AddModel(modelName));
+    ModelManager::CurModel().SetReleaseOnBackProp(release);
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> distribution(-0.2f, 0.2f);
+    auto randomData = [&](std::size_t size) {
+        std::vector<float> data(size);
+        for (auto& value : data)
+            value = distribution(gen);
+        return data;
+    };
+
+    std::vector<NN::Linear> layers;
+    for (int idx = 0; idx < Depth; ++idx)
+    {
+        layers.emplace_back(Features, Features);
+        layers.back().GetWeight().LoadData(randomData(Features * Features));
+        layers.back().GetBias().LoadData(randomData(Features));
+    }
+    Optimizer::SGD sgd(0.01f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    Util::ResourceManager::Clean();
+    Util::ResourceManager::ClearFreePool();
+    const auto baseByteSize = Util::ResourceManager::GetAllocatedByteSizeHost();
+    Util::ResourceManager::ResetPeakByteSize();
+
+    TrainResult result{};
+    for (int step = 0; step < Steps; ++step)
+    {
+        Tensor x(Shape({ BatchSize, Features }));
+        Tensor label(Shape({ BatchSize, Features }));
+        x.LoadData(randomData(BatchSize * Features));
+        label.LoadData(randomData(BatchSize * Features));
+
+        Tensor hidden = F::ReLU(layers[0](x));
+        Tensor tensor = hidden;
+        for (int idx = 1; idx < Depth; ++idx)
+            tensor = F::ReLU(layers[idx](tensor));
+        const auto loss = NN::Loss::MSE(tensor, label);
+        ModelManager::CurModel().BackProp(loss);
+
+        //! Inputs created by the user are kept
+        CHECK(x.GetData().size() == BatchSize * Features);
+        try
+        {
+            static_cast<void>(hidden.GetData());
+            result.HiddenReleased = false;
+        }
+        catch (const std::out_of_range&)
+        {
+            result.HiddenReleased = true;
+        }
+        ModelManager::CurModel().Clear();
+    }
+
+    result.PeakByteSize =
+        Util::ResourceManager::GetPeakByteSizeHost() - baseByteSize;
+    result.Weight = layers[0].GetWeight().GetData();
+    ModelManager::CurModel().SetOptimizer(nullptr);
+    return result;
+}
+} // namespace
+
+void EarlyReleaseTest(bool print)
+{
+    const auto kept = Train("EarlyReleaseTest kept", false);
+    const auto released = Train("EarlyReleaseTest released", true);
+
+    if (print)
+        std::cout << "Peak memory without release : " << kept.PeakByteSize
+            << " bytes, with release : " << released.PeakByteSize
+            << " bytes" << std::endl;
+
+    CHECK(!kept.HiddenReleased);
+    CHECK(released.HiddenReleased);
+    CHECK(released.Weight == kept.Weight);
+    CHECK(released.PeakByteSize < kept.PeakByteSize);
+
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,190 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <ModelTest/CheckpointTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/Initializers/Initialize.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/Checkpoint.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <doctest/doctest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+namespace Sapphire::Test
+{
+void CheckpointTest(bool print)
+{
+    const auto filePath =
+        std::filesystem::temp_directory_path() / "SapphireCheckpointTest.ckpt";
+
+    ModelManager::AddModel("checkpoint test model");
+    ModelManager::SetCurrentModel("checkpoint test model");
+
+    NN::Linear fc0("fc0", 6, 4);
+    NN::Linear fc1("fc1", 4, 2);
+    Optimizer::SGD sgd(0.125f);
+
+    const auto fc0Weight = fc0.GetWeight().GetData();
+    const auto fc1Bias = fc1.GetBias().GetData();
+
+    Util::SaveCheckpoint(filePath, { &fc0, &fc1 }, &sgd);
+
+    {
+        const Util::CheckpointReader reader(filePath);
+        CHECK(reader.Entries().size() == 5);
+        CHECK(reader.GetEntry("fc0/weight").TensorShape == Shape({ 6, 4 }));
+        CHECK(reader.GetEntry("fc1/bias").TensorShape == Shape({ 2 }));
+        for (const auto& entry : reader.Entries())
+        {
+            CHECK(entry.Offset % Util::CheckpointAlignment == 0);
+            CHECK(reinterpret_cast<std::uintptr_t>(reader.Data(entry.Name)) %
+                  Util::CheckpointAlignment == 0);
+            if (print)
+                std::cout << entry.Name << " " << entry.TensorShape.ToString()
+                    << " offset : " << entry.Offset << std::endl;
+        }
+        CHECK(reader.Data("Optimizer/LearningRate")[0] == 0.125f);
+        CHECK_THROWS(static_cast<void>(reader.GetEntry("fc2/weight")));
+    }
+
+    {
+        //! Units created with same names restore the saved tensors
+        NN::Linear restored0("fc0", 6, 4);
+        NN::Linear restored1("fc1", 4, 2);
+        Optimizer::SGD restoredSgd(1.0f);
+        Util::LoadCheckpoint(filePath, { &restored0, &restored1 },
+                             &restoredSgd);
+
+        const auto weight = restored0.GetWeight().GetData();
+        const auto bias = restored1.GetBias().GetData();
+        for (std::size_t i = 0; i < fc0Weight.size(); ++i)
+            CHECK(weight[i] == fc0Weight[i]);
+        for (std::size_t i = 0; i < fc1Bias.size(); ++i)
+            CHECK(bias[i] == fc1Bias[i]);
+        CHECK(restoredSgd.GetState().at("LearningRate")[0] == 0.125f);
+
+        //! Shapes must match
+        NN::Linear mismatched("fc0", 4, 4);
+        CHECK_THROWS(Util::LoadCheckpoint(filePath, { &mismatched }));
+    }
+
+    {
+        //! Mapped units share payloads of the file instead of copying them
+        std::unique_ptr<NN::Linear> mapped0, mapped1;
+        {
+            const Initialize::SkipInitializationScope skipScope;
+            mapped0 = std::make_unique<NN::Linear>("fc0", 6, 4);
+            mapped1 = std::make_unique<NN::Linear>("fc1", 4, 2);
+        }
+        CHECK(!Initialize::SkipInitializationScope::IsActive());
+        CHECK(mapped0->GetWeight().GetData()[0] == 0.0f);
+
+        //! Shallow copies made before mapping keep their memory
+        mapped0->GetWeight().ToHost();
+        const auto weightKey = mapped0->GetWeight().TensorDescriptorKey();
+        auto unmapped = ModelManager::CurModel()
+                        .GetDescriptor(weightKey)
+                        .GetForwardData();
+        Util::MapCheckpoint(filePath, { mapped0.get(), mapped1.get() });
+        CHECK(!unmapped.IsMapped());
+        CHECK(unmapped.GetDataCopy() ==
+              std::vector<float>(fc0Weight.size(), 0.0f));
+
+        CHECK(ModelManager::CurModel()
+              .GetDescriptor(weightKey)
+              .GetForwardData()
+              .IsMapped());
+
+        const auto weight = mapped0->GetWeight().GetData();
+        for (std::size_t i = 0; i < fc0Weight.size(); ++i)
+            CHECK(weight[i] == fc0Weight[i]);
+
+        //! Writes stay private to the process and never reach the file
+        mapped0->GetWeight().LoadData(std::vector<float>(weight.size(), 3.0f));
+        CHECK(mapped0->GetWeight().GetData()[0] == 3.0f);
+        const Util::CheckpointReader reader(filePath);
+        CHECK(reader.Data("fc0/weight")[0] == fc0Weight[0]);
+    }
+
+    {
+        //! Reduced precision weights are saved in their own data type, and
+        //! views are saved in row major order of the view
+        const auto reducedPath = std::filesystem::temp_directory_path() /
+                                 "SapphireCheckpointReducedTest.ckpt";
+        auto& model = ModelManager::CurModel();
+        NN::Linear reduced("reduced", 6, 4);
+        reduced.GetWeight().LoadData(fc0Weight);
+        reduced.SetWeightDataType(DataType::BFloat16);
+        const auto reducedWeight = reduced.GetWeight().GetData();
+        const auto reducedBias = reduced.GetBias().GetData();
+
+        Util::CheckpointWriter writer;
+        for (const auto& [name, tensor] : reduced.GetTrainableTensors())
+            writer.Add("reduced/" + name,
+                       model.GetDescriptor(tensor.TensorDescriptorKey())
+                            .GetForwardData());
+        writer.Add("view", model.GetDescriptor(
+                                    fc0.GetWeight().TensorDescriptorKey())
+                               .GetForwardData()
+                               .TransposeView());
+        writer.Write(reducedPath);
+
+        {
+            const Util::CheckpointReader reader(reducedPath);
+            const auto& entry = reader.GetEntry("reduced/weight");
+            CHECK(entry.DataType == Util::CheckpointDataType::BFloat16);
+            CHECK(entry.ByteSize == 6 * 4 * sizeof(std::uint16_t));
+            CHECK_THROWS(static_cast<void>(reader.Data("reduced/weight")));
+
+            CHECK(reader.GetEntry("view").TensorShape == Shape({ 4, 6 }));
+            const auto* view = reader.Data("view");
+            for (int i = 0; i < 6; ++i)
+                for (int j = 0; j < 4; ++j)
+                    CHECK(view[j * 6 + i] == fc0Weight[i * 4 + j]);
+        }
+
+        //! Payloads are converted to data type of the units
+        NN::Linear restored("reduced", 6, 4);
+        Util::LoadCheckpoint(reducedPath, { &restored });
+        CHECK(restored.GetWeight().GetDataType() == DataType::Float32);
+        CHECK(restored.GetWeight().GetData() == reducedWeight);
+        CHECK(restored.GetBias().GetData() == reducedBias);
+
+        NN::Linear restoredReduced("reduced", 6, 4);
+        restoredReduced.SetWeightDataType(DataType::BFloat16);
+        Util::LoadCheckpoint(reducedPath, { &restoredReduced });
+        CHECK(restoredReduced.GetWeight().GetData() == reducedWeight);
+
+        //! Only payloads stored in the same data type can be mapped
+        CHECK_THROWS(Util::MapCheckpoint(reducedPath, { &restored }));
+        NN::Linear mapped("reduced", 6, 4);
+        mapped.SetWeightDataType(DataType::BFloat16);
+        Util::MapCheckpoint(reducedPath, { &mapped });
+        CHECK(model.GetDescriptor(mapped.GetWeight().TensorDescriptorKey())
+                   .GetForwardData()
+                   .IsMapped());
+        CHECK(mapped.GetWeight().GetData() == reducedWeight);
+        CHECK(mapped.GetBias().GetData() == reducedBias);
+
+        std::filesystem::remove(reducedPath);
+    }
+
+    {
+        //! Truncated checkpoints are rejected
+        const auto fileSize = std::filesystem::file_size(filePath);
+        std::filesystem::resize_file(filePath, fileSize - 1);
+        CHECK_THROWS(Util::CheckpointReader{ filePath });
+    }
+
+    std::filesystem::remove(filePath);
+    Util::ResourceManager::ClearAll();
+}
+}
@@ -17,11 +17,18 @@ void Conv2DModelTest(
     float learningRate, bool hostMode, int epochs)
 {
     std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution dist(0, batchSize - 1);
     Util::BinaryLoader<std::uint8_t> dataLoader(std::move(filePath), 3073,
                                                 3073 * 9999, batchSize, 3073);
 
+    //! Shuffles blocks of adjacent records so that each batch reads only a
+    //! few regions of the mapped file
+    auto sampler = std::make_shared<Util::Sampler>(
+        dataLoader.NumRecords(), batchSize, Util::SampleMode::BlockShuffle,
+        rd());
+    sampler->SetBlockSize(4 * batchSize);
+    sampler->SetDropLast(true);
+    dataLoader.SetSampler(sampler);
+
     ModelManager::AddModel("SimpleConv2DModel");
     ModelManager::SetCurrentModel("SimpleConv2DModel");
 
@@ -53,17 +60,6 @@ void Conv2DModelTest(
     Optimizer::SGD sgd(learningRate);
     ModelManager::CurModel().SetOptimizer(&sgd);
 
-    auto dataPreProcess =
-        [batchSize](std::vector<std::uint8_t> data) -> std::vector<float> {
-        std::vector<float> outData(batchSize * 32 * 32 * 3);
-        if (data.size() > static_cast<std::size_t>(32 * 32 * 3) * batchSize)
-            throw std::runtime_error(
-                "dataPreProcess - given data was larger than expected");
-        for (std::size_t i = 0; i < data.size(); ++i)
-            outData[i] = static_cast<float>(data[i]) / 255.0f;
-        return outData;
-    };
-
     auto labelOneHot =
         [batchSize](std::vector<std::uint8_t> label) -> std::vector<float> {
         std::vector oneHot(batchSize * 10, 0.0f);
@@ -81,12 +77,10 @@ void Conv2DModelTest(
 
     for (int epoch = 0; epoch < epochs; ++epoch)
     {
-        for (auto& elem : batches)
-        {
-            elem = dist(gen);
-        }
+        sampler->Step(epoch, batches);
 
-        dataLoader.LoadData(x, batches, 1, 32 * 32 * 3, dataPreProcess);
+        //! Pixels are normalized to [0, 1] while they are gathered
+        dataLoader.LoadData(x, batches, 1, 32 * 32 * 3, 1.0f / 255.0f, 0.0f);
         dataLoader.LoadData(label, batches, 0, 0, labelOneHot);
 
         //! Load data to x and label here
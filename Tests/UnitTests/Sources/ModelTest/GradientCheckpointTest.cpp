@@ -0,0 +1,192 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <ModelTest/GradientCheckpointTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Forward/BatchNorm2D.hpp>
+#include <Sapphire/operations/Forward/CheckpointRegion.hpp>
+#include <Sapphire/operations/Forward/Functional/ReLU.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/Loss/MSE.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+constexpr int BatchSize = 32;
+constexpr int Features = 64;
+constexpr int Depth = 9;
+constexpr int RegionSize = 3;
+constexpr int Steps = 3;
+
+struct TrainResult
+{
+    std::vector<std::vector<float>> Weights;
+    std::size_t PeakByteSize;
+};
+
+TrainResult Train(const std::string& modelName, bool checkpoint)
+{
+    const ModelScope scope(ModelManager::AddModel(modelName));
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> distribution(-0.2f, 0.2f);
+    auto randomData = [&](std::size_t size) {
+        std::vector<float> data(size);
+        for (auto& value : data)
+            value = distribution(gen);
+        return data;
+    };
+
+    std::vector<NN::Linear> layers;
+    for (int idx = 0; idx < Depth; ++idx)
+    {
+        layers.emplace_back(Features, Features);
+        layers.back().GetWeight().LoadData(randomData(Features * Features));
+        layers.back().GetBias().LoadData(randomData(Features));
+    }
+
+    //! Each region holds RegionSize units of the stack
+    std::vector<NN::CheckpointRegion> regions;
+    for (int begin = 0; begin < Depth; begin += RegionSize)
+        regions.emplace_back([&layers, begin](const Tensor& x) {
+            Tensor tensor = x;
+            for (int idx = begin; idx < begin + RegionSize; ++idx)
+                tensor = F::ReLU(layers[idx](tensor));
+            return tensor;
+        });
+
+    Optimizer::SGD sgd(0.01f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    Util::ResourceManager::Clean();
+    Util::ResourceManager::ClearFreePool();
+    const auto baseByteSize = Util::ResourceManager::GetAllocatedByteSizeHost();
+    Util::ResourceManager::ResetPeakByteSize();
+
+    for (int step = 0; step < Steps; ++step)
+    {
+        Tensor x(Shape({ BatchSize, Features }));
+        Tensor label(Shape({ BatchSize, Features }));
+        x.LoadData(randomData(BatchSize * Features));
+        label.LoadData(randomData(BatchSize * Features));
+
+        Tensor tensor = x;
+        if (checkpoint)
+            for (auto& region : regions)
+                tensor = region(tensor);
+        else
+            for (auto& layer : layers)
+                tensor = F::ReLU(layer(tensor));
+        const auto loss = NN::Loss::MSE(tensor, label);
+        ModelManager::CurModel().BackProp(loss);
+        ModelManager::CurModel().Clear();
+    }
+
+    TrainResult result{};
+    result.PeakByteSize =
+        Util::ResourceManager::GetPeakByteSizeHost() - baseByteSize;
+    for (auto& layer : layers)
+        result.Weights.emplace_back(layer.GetWeight().GetData());
+    ModelManager::CurModel().SetOptimizer(nullptr);
+    return result;
+}
+
+//! Trains BatchNorm2D followed by ReLU, and returns running mean, running
+//! variance, gamma, beta and gradient of the input of the last step
+std::vector<std::vector<float>> TrainBatchNorm(const std::string& modelName,
+                                               bool checkpoint)
+{
+    const ModelScope scope(ModelManager::AddModel(modelName));
+    std::mt19937 gen(13);
+    const Shape shape({ 4, 3, 5, 5 });
+    NN::BatchNorm2D batchNorm(3);
+    NN::CheckpointRegion region(
+        [&batchNorm](const Tensor& x) {
+            Tensor tensor = x;
+            return F::ReLU(batchNorm(tensor));
+        });
+
+    Optimizer::SGD sgd(0.01f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    std::vector<float> inputGradient;
+    for (int step = 0; step < Steps; ++step)
+    {
+        Tensor x(shape);
+        x.LoadData(RandomData(gen, shape.Size(), 0.0f, 2.0f));
+        Tensor tensor = x;
+        const auto y = checkpoint ? region(x) : F::ReLU(batchNorm(tensor));
+        y.LoadGradient(RandomData(gen, shape.Size()));
+        ModelManager::CurModel().BackProp(y);
+        CHECK(!ModelManager::CurModel().IsRecomputing());
+        inputGradient = x.GetGradient();
+        ModelManager::CurModel().Clear();
+    }
+
+    ModelManager::CurModel().SetOptimizer(nullptr);
+    return { batchNorm.GetRunningMean().GetData(),
+             batchNorm.GetRunningVar().GetData(),
+             batchNorm.GetGamma().GetData(), batchNorm.GetBeta().GetData(),
+             inputGradient };
+}
+} // namespace
+
+void RecomputeTest(bool print)
+{
+    const auto stored = Train("RecomputeTest stored", false);
+    const auto recomputed = Train("RecomputeTest recomputed", true);
+
+    if (print)
+        std::cout << "Peak memory without checkpoint : "
+            << stored.PeakByteSize << " bytes, with checkpoint : "
+            << recomputed.PeakByteSize << " bytes" << std::endl;
+
+    CHECK(recomputed.Weights == stored.Weights);
+    CHECK(recomputed.PeakByteSize < stored.PeakByteSize);
+
+    //! Output of the region must be computed inside the region
+    {
+        const ModelScope scope(ModelManager::AddModel("RecomputeTest invalid"));
+        NN::CheckpointRegion identity([](const Tensor& x) { return x; });
+        const Tensor x(Shape({ BatchSize, Features }));
+        CHECK_THROWS(identity(x));
+        CHECK(ModelManager::CurModel().IsRecordingHistory());
+        ModelManager::CurModel().Clear();
+    }
+
+    Util::ResourceManager::ClearAll();
+}
+
+void BatchNormRecomputeTest(bool print)
+{
+    const auto stored = TrainBatchNorm("BatchNormRecomputeTest stored", false);
+    const auto recomputed =
+        TrainBatchNorm("BatchNormRecomputeTest recomputed", true);
+
+    float maxError = 0.0f;
+    for (std::size_t idx = 0; idx < stored.size(); ++idx)
+        maxError = std::max(maxError,
+                            MaxDifference(stored[idx], recomputed[idx]));
+    if (print)
+        std::cout << "Max error of BatchNorm2D in checkpoint region : "
+            << maxError << std::endl;
+    CHECK(maxError < 1e-6f);
+    //! Statistics of the inputs have moved the running mean from zero
+    CHECK(stored[0][0] > 0.1f);
+
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
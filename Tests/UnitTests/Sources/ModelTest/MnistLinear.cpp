@@ -16,9 +16,12 @@ void MnistLinear(std::filesystem::path filePath, int batchSize,
                  int epochs, bool hostMode)
 {
     std::random_device rd;
-    std::mt19937 gen(rd());
-    Util::CsvLoader<int> dataLoader(filePath);
-    std::uniform_int_distribution<int> dist(1, dataLoader.GetLineSize() - 1);
+    const auto seed = rd();
+    //! Csv file is parsed only once, and later runs map the binary cache
+    auto cachePath = filePath;
+    cachePath.replace_extension(".cache");
+    const auto dataLoader = Util::OpenCsvCache<int>(filePath, cachePath,
+                                                    batchSize);
 
     ModelManager::AddModel("MnistLinear");
     ModelManager::SetCurrentModel("MnistLinear");
@@ -28,54 +31,48 @@ void MnistLinear(std::filesystem::path filePath, int batchSize,
     NN::Linear fc0(784, 100);
     NN::Linear fc1(100, 10);
 
-    Tensor x(Shape({ batchSize, 784 }), gpu, Type::Dense, true);
-    Tensor label(Shape({ batchSize, 10 }), gpu, Type::Dense, true);
-
-    if (hostMode)
-    {
-        x.ToHost();
-        label.ToHost();
-    }
-
     Optimizer::SGD sgd(learningRate);
     ModelManager::CurModel().SetOptimizer(&sgd);
 
-    auto labelOneHot = [batchSize
-        ](std::vector<int> label) -> std::vector<float> {
-
-        std::vector oneHot(10 * batchSize, 0.0f);
-        for (int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    //! Every epoch visits each record once in shuffled order
+    //! First line of the file is the header, so it is excluded
+    auto sampler = std::make_shared<Util::Sampler>(
+        dataLoader->NumRecords() - 1, batchSize, Util::SampleMode::Shuffle,
+        seed, 1);
+    sampler->SetDropLast(true);
+    dataLoader->SetSampler(sampler);
+
+    //! Runs on worker threads. Gathers the batch and builds one-hot labels
+    //! without touching the model
+    auto loadBatch = [&loader = *dataLoader, batchSize](
+        std::size_t step, const std::vector<float*>& buffers) {
+        loader.GatherNormalizedBatch(buffers[0], step, 1, 784, 1.0f / 255.0f,
+                                     0.0f);
+
+        std::vector<int> label(batchSize);
+        loader.GatherBatch(label.data(), step, 0, 0);
+        std::fill(buffers[1], buffers[1] + 10 * batchSize, 0.0f);
+        for (int i = 0; i < batchSize; ++i)
         {
-            const auto idx = label.at(batchIdx);
+            const auto idx = label[i];
             if (idx >= 10 || idx < 0)
                 throw std::runtime_error("labelOneHot - idx out of range");
-            oneHot.at(batchIdx * 10 + idx) = 1.0f;
+            buffers[1][i * 10 + idx] = 1.0f;
         }
-        return oneHot;
     };
 
-    auto dataPreProcess = [batchSize](
-        std::vector<int> data) -> std::vector<float> {
-        std::vector<float> outData(batchSize * 784);
-        if (data.size() > static_cast<std::size_t>(784) * batchSize)
-            throw std::runtime_error(
-                "dataPreProcess - given data was larger than expected");
-        for (std::size_t i = 0; i < data.size(); ++i)
-            outData[i] =
-                static_cast<float>(data[i]) / 255.0f;
-        return outData;
-    };
+    //! Two workers fill triple buffered inputs while the model computes
+    Util::Prefetcher prefetcher(
+        { Shape({ batchSize, 784 }), Shape({ batchSize, 10 }) }, gpu,
+        hostMode ? ComputeMode::Host : ComputeMode::Cuda, epochs, loadBatch,
+        2, 3);
+    prefetcher.Start();
 
     for (int epoch = 0; epoch < epochs; ++epoch)
     {
-        std::vector<std::size_t> batches(batchSize);
-        for (auto& elem : batches)
-        {
-            elem = dist(gen);
-        }
-
-        dataLoader.LoadData(x, batches, 1, 784, dataPreProcess);
-        dataLoader.LoadData(label, batches, 0, 0, labelOneHot);
+        auto inputs = prefetcher.Next();
+        auto& x = inputs.at(0);
+        auto& label = inputs.at(1);
 
         auto tensor = F::ReLU(fc0(x));
         tensor = fc1(tensor);
@@ -0,0 +1,123 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <ModelTest/ModelContextTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/Loss/MSE.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+constexpr int BatchSize = 4;
+constexpr int Inputs = 8;
+constexpr int Outputs = 4;
+constexpr int Steps = 5;
+
+//! Trains Linear with data generated from seed on the model of given name,
+//! and returns the trained weight
+std::vector<float> Train(const std::string& modelName, unsigned int seed)
+{
+    const ModelScope scope(ModelManager::AddModel(modelName));
+    std::mt19937 gen(seed);
+
+    NN::Linear fc(Inputs, Outputs);
+    fc.GetWeight().LoadData(RandomData(gen, Inputs * Outputs));
+    fc.GetBias().LoadData(RandomData(gen, Outputs));
+    Optimizer::SGD sgd(0.1f);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    for (int step = 0; step < Steps; ++step)
+    {
+        Tensor x(Shape({ BatchSize, Inputs }));
+        Tensor label(Shape({ BatchSize, Outputs }));
+        x.LoadData(RandomData(gen, BatchSize * Inputs));
+        label.LoadData(RandomData(gen, BatchSize * Outputs));
+
+        const auto loss = NN::Loss::MSE(fc(x), label);
+        ModelManager::CurModel().BackProp(loss);
+        ModelManager::CurModel().Clear();
+    }
+
+    const auto weight = fc.GetWeight().GetData();
+    ModelManager::CurModel().SetOptimizer(nullptr);
+    return weight;
+}
+} // namespace
+
+void ConcurrentModelTest(bool print)
+{
+    constexpr int numThreads = 4;
+
+    //! Threads start without current model
+    bool hasModel = true;
+    bool threw = false;
+    std::thread([&]() {
+        hasModel = ModelManager::HasCurModel();
+        try
+        {
+            static_cast<void>(ModelManager::CurModel());
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+    }).join();
+    CHECK(!hasModel);
+    CHECK(threw);
+
+    //! Scopes restore the previous model
+    auto& outer = ModelManager::AddModel("ModelContextTest outer");
+    auto& inner = ModelManager::AddModel("ModelContextTest inner");
+    ModelManager::SetCurrentModel(outer);
+    {
+        const ModelScope scope("ModelContextTest inner");
+        CHECK(&ModelManager::CurModel() == &inner);
+    }
+    CHECK(&ModelManager::CurModel() == &outer);
+    CHECK_THROWS(ModelScope("ModelContextTest unknown"));
+    CHECK(&ModelManager::CurModel() == &outer);
+
+    std::vector<std::vector<float>> expected(numThreads);
+    for (int idx = 0; idx < numThreads; ++idx)
+        expected[idx] = Train("ModelContextTest reference" +
+                              std::to_string(idx), idx);
+
+    std::vector<std::vector<float>> results(numThreads);
+    std::vector<std::thread> threads;
+    for (int idx = 0; idx < numThreads; ++idx)
+        threads.emplace_back([&results, idx]() {
+            results[idx] = Train("ModelContextTest thread" +
+                                 std::to_string(idx), idx);
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int idx = 0; idx < numThreads; ++idx)
+    {
+        if (print)
+            std::cout << "Thread " << idx << " weight[0] : "
+                << results[idx][0] << " (expected : " << expected[idx][0]
+                << ")" << std::endl;
+        CHECK(results[idx] == expected[idx]);
+    }
+    //! Models of different seeds are trained separately
+    CHECK(results[0] != results[1]);
+    CHECK(&ModelManager::CurModel() == &outer);
+
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,258 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <ModelTest/ServingTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <Sapphire/util/Serving/InferenceServer.hpp>
+#include <Sapphire/util/Serving/UnixSocketServer.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+constexpr int Inputs = 8;
+constexpr int Outputs = 4;
+constexpr int NumClients = 4;
+constexpr int RequestsPerClient = 16;
+
+//! Sessions of Linear with given parameters
+Util::InferenceServer::SessionFactory LinearSession(
+    const std::vector<float>& weight, const std::vector<float>& bias)
+{
+    return [weight, bias]() -> Util::InferenceServer::ForwardFunction {
+        auto fc = std::make_shared<NN::Linear>(Inputs, Outputs);
+        fc->GetWeight().LoadData(weight);
+        fc->GetBias().LoadData(bias);
+        return [fc](Tensor& x) { return (*fc)(x); };
+    };
+}
+
+//! Forward propagates each sample alone
+std::vector<std::vector<float>> Reference(
+    const std::vector<std::vector<float>>& samples,
+    const std::vector<float>& weight, const std::vector<float>& bias)
+{
+    //! Model is discarded with the preserved weights, so tensors of previous
+    //! calls are not cleared after their memory has been released
+    Model model("ServingTest reference");
+    const ModelScope scope(model);
+    NN::Linear fc(Inputs, Outputs);
+    fc.GetWeight().LoadData(weight);
+    fc.GetBias().LoadData(bias);
+
+    std::vector<std::vector<float>> outputs;
+    for (const auto& sample : samples)
+    {
+        Tensor x(Shape({ 1, Inputs }));
+        x.LoadData(sample);
+        outputs.emplace_back(fc(x).GetData());
+        ModelManager::CurModel().Clear();
+    }
+    return outputs;
+}
+
+void CheckOutputs(const std::vector<std::vector<float>>& outputs,
+                  const std::vector<std::vector<float>>& expected)
+{
+    REQUIRE(outputs.size() == expected.size());
+    for (std::size_t i = 0; i < outputs.size(); ++i)
+    {
+        REQUIRE(outputs[i].size() == expected[i].size());
+        for (std::size_t j = 0; j < outputs[i].size(); ++j)
+            CHECK(TestEquality(outputs[i][j], expected[i][j]));
+    }
+}
+
+void PrintStats(const Util::InferenceStats& stats)
+{
+    std::cout << "requests : " << stats.NumRequests << " batches : "
+        << stats.NumBatches << " mean batch size : " << stats.MeanBatchSize
+        << " throughput : " << stats.Throughput << "/s" << std::endl;
+    std::cout << "latency p50 : " << stats.LatencyP50 << "ms p95 : "
+        << stats.LatencyP95 << "ms p99 : " << stats.LatencyP99 << "ms"
+        << std::endl;
+}
+} // namespace
+
+void InferenceServerTest(bool print)
+{
+    constexpr int numRequests = NumClients * RequestsPerClient;
+    const CudaDevice device;
+    std::mt19937 gen(42);
+    const auto weight = RandomData(gen, Inputs * Outputs);
+    const auto bias = RandomData(gen, Outputs);
+
+    std::vector<std::vector<float>> samples;
+    for (int i = 0; i < numRequests; ++i)
+        samples.emplace_back(RandomData(gen, Inputs));
+    const auto expected = Reference(samples, weight, bias);
+
+    //! Requests from concurrent clients are scattered back to their callers
+    {
+        Util::InferenceServer server(
+            Shape({ Inputs }), device, ComputeMode::Host,
+            LinearSession(weight, bias), 8, std::chrono::milliseconds(2), 2);
+        server.Start();
+
+        std::vector<std::vector<float>> outputs(numRequests);
+        std::vector<std::thread> clients;
+        for (int clientIdx = 0; clientIdx < NumClients; ++clientIdx)
+            clients.emplace_back([&, clientIdx]() {
+                std::vector<std::future<std::vector<float>>> futures;
+                const int begin = clientIdx * RequestsPerClient;
+                for (int i = begin; i < begin + RequestsPerClient; ++i)
+                    futures.emplace_back(server.Submit(samples[i]));
+                for (int i = 0; i < RequestsPerClient; ++i)
+                    outputs[begin + i] = futures[i].get();
+            });
+        for (auto& client : clients)
+            client.join();
+        CheckOutputs(outputs, expected);
+
+        const auto stats = server.GetStats();
+        if (print)
+            PrintStats(stats);
+        CHECK(stats.NumRequests == numRequests);
+        CHECK(stats.NumFailed == 0);
+        CHECK(stats.NumBatches >= numRequests / 8);
+        CHECK(stats.NumBatches <= numRequests);
+        CHECK(stats.Throughput > 0.0);
+        CHECK(stats.LatencyP50 <= stats.LatencyP95);
+        CHECK(stats.LatencyP95 <= stats.LatencyP99);
+
+        CHECK_THROWS(server.Submit(std::vector<float>(Inputs + 1)));
+        server.Stop();
+        CHECK_THROWS(server.Submit(samples[0]));
+    }
+
+    //! Full batch is taken without waiting for the deadline, and partial
+    //! batch is taken at the deadline
+    {
+        constexpr auto maxLatency = std::chrono::milliseconds(100);
+        Util::InferenceServer server(Shape({ Inputs }), device,
+                                     ComputeMode::Host,
+                                     LinearSession(weight, bias), 8,
+                                     maxLatency);
+        server.Start();
+
+        std::vector<std::future<std::vector<float>>> futures;
+        for (int i = 0; i < 8; ++i)
+            futures.emplace_back(server.Submit(samples[i]));
+        for (auto& future : futures)
+            future.get();
+        auto stats = server.GetStats();
+        CHECK(stats.NumBatches == 1);
+        CHECK(stats.MeanBatchSize == 8.0);
+        CHECK(stats.LatencyP99 < 100.0);
+
+        server.ResetStats();
+        futures.clear();
+        for (int i = 0; i < 3; ++i)
+            futures.emplace_back(server.Submit(samples[i]));
+        for (auto& future : futures)
+            future.get();
+        stats = server.GetStats();
+        if (print)
+            PrintStats(stats);
+        CHECK(stats.NumBatches == 1);
+        CHECK(stats.NumRequests == 3);
+        CHECK(stats.LatencyP50 >= 90.0);
+    }
+
+    //! Exception of forward propagation is delivered to every request of
+    //! the batch
+    {
+        Util::InferenceServer server(
+            Shape({ Inputs }), device, ComputeMode::Host,
+            []() -> Util::InferenceServer::ForwardFunction {
+                return [](Tensor&) -> Tensor {
+                    throw std::runtime_error("session failure");
+                };
+            },
+            4, std::chrono::milliseconds(1));
+        server.Start();
+        auto future = server.Submit(samples[0]);
+        CHECK_THROWS(future.get());
+        server.Stop();
+        CHECK(server.GetStats().NumFailed == 1);
+    }
+
+    Util::ResourceManager::ClearAll();
+}
+
+void UnixSocketServingTest(bool print)
+{
+    constexpr int numRequests = NumClients * RequestsPerClient;
+    const CudaDevice device;
+    std::mt19937 gen(7);
+    const auto weight = RandomData(gen, Inputs * Outputs);
+    const auto bias = RandomData(gen, Outputs);
+
+    std::vector<std::vector<float>> samples;
+    for (int i = 0; i < numRequests; ++i)
+        samples.emplace_back(RandomData(gen, Inputs));
+    const auto expected = Reference(samples, weight, bias);
+
+    const auto socketPath =
+        (std::filesystem::temp_directory_path() / "SapphireServingTest.sock")
+        .string();
+
+    {
+        Util::InferenceServer server(
+            Shape({ Inputs }), device, ComputeMode::Host,
+            LinearSession(weight, bias), 8, std::chrono::milliseconds(2), 2);
+        Util::UnixSocketServer socketServer(server, socketPath);
+        server.Start();
+        socketServer.Start();
+
+        std::vector<std::vector<float>> outputs(numRequests);
+        std::vector<std::thread> clients;
+        for (int clientIdx = 0; clientIdx < NumClients; ++clientIdx)
+            clients.emplace_back([&, clientIdx]() {
+                Util::UnixSocketClient client(socketPath);
+                const int begin = clientIdx * RequestsPerClient;
+                for (int i = begin; i < begin + RequestsPerClient; ++i)
+                    outputs[i] = client.Infer(samples[i]);
+            });
+        for (auto& client : clients)
+            client.join();
+        CheckOutputs(outputs, expected);
+
+        const auto stats = server.GetStats();
+        if (print)
+            PrintStats(stats);
+        CHECK(stats.NumRequests == numRequests);
+        CHECK(stats.NumFailed == 0);
+
+        //! Malformed request is answered with an error
+        Util::UnixSocketClient client(socketPath);
+        CHECK_THROWS(client.Infer(std::vector<float>(Inputs + 1)));
+
+        socketServer.Stop();
+        CHECK(!std::filesystem::exists(socketPath));
+        CHECK_THROWS(Util::UnixSocketClient{ socketPath });
+
+        //! Files that are not sockets are never removed
+        std::ofstream(socketPath) << "not a socket";
+        CHECK_THROWS(socketServer.Start());
+        CHECK(std::filesystem::is_regular_file(socketPath));
+        std::filesystem::remove(socketPath);
+    }
+
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
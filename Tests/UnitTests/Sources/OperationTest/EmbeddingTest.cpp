@@ -0,0 +1,128 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <OperationTest/EmbeddingTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/operations/Forward/Embedding.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <doctest/doctest.h>
+#include <iostream>
+#include <set>
+
+namespace Sapphire::Test
+{
+void TestEmbedding(bool print)
+{
+    constexpr int numEmbeddings = 100;
+    constexpr int embeddingDim = 8;
+    constexpr float learningRate = 0.1f;
+    //! Index 7 is looked up twice to check gradient accumulation
+    const std::vector<float> indexData = { 7, 3, 7, 42, 99, 0 };
+    const std::set<int> touchedRows = { 0, 3, 7, 42, 99 };
+
+    ModelManager::AddModel("embedding test model");
+    ModelManager::SetCurrentModel("embedding test model");
+    const CudaDevice gpu(0, "cuda0");
+
+    Tensor indices(Shape({ 2, 3 }), gpu, Type::Dense, true);
+    indices.LoadData(indexData);
+
+    NN::Embedding embedding(numEmbeddings, embeddingDim);
+    const auto weightData = embedding.GetWeight().GetData();
+
+    Optimizer::SGD sgd(learningRate);
+    ModelManager::CurModel().SetOptimizer(&sgd);
+
+    auto y = embedding(indices);
+    CHECK(y.GetShape() == Shape({ 2, 3, embeddingDim }));
+
+    //! Forward result must be the looked up rows
+    const auto yData = y.GetData();
+    for (std::size_t i = 0; i < indexData.size(); ++i)
+        for (int col = 0; col < embeddingDim; ++col)
+            CHECK(TestEquality(
+                yData[i * embeddingDim + col],
+                weightData[static_cast<int>(indexData[i]) * embeddingDim +
+                           col]));
+
+    std::vector<float> gradient(yData.size(), 1.0f);
+    y.LoadGradient(gradient);
+    ModelManager::CurModel().BackProp(y);
+
+    //! Only looked up rows should be updated
+    const auto updatedData = embedding.GetWeight().GetData();
+    for (int row = 0; row < numEmbeddings; ++row)
+    {
+        float expectedDelta = 0.0f;
+        for (const auto index : indexData)
+            if (static_cast<int>(index) == row)
+                expectedDelta += learningRate;
+        CHECK((expectedDelta > 0.0f) == (touchedRows.count(row) > 0));
+
+        for (int col = 0; col < embeddingDim; ++col)
+        {
+            const auto idx = row * embeddingDim + col;
+            if (print && expectedDelta > 0.0f)
+                std::cout << "row : " << row << " before : " << weightData[idx]
+                    << " after : " << updatedData[idx] << std::endl;
+            CHECK(std::abs(weightData[idx] - expectedDelta - updatedData[idx])
+                < 1e-5f);
+        }
+    }
+
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+
+void TestEmbeddingBag(bool print)
+{
+    constexpr int numEmbeddings = 50;
+    constexpr int embeddingDim = 4;
+    constexpr int bagSize = 3;
+    const std::vector<float> indexData = { 1, 2, 3, 4, 4, 49 };
+
+    ModelManager::AddModel("embedding bag test model");
+    ModelManager::SetCurrentModel("embedding bag test model");
+    const CudaDevice gpu(0, "cuda0");
+
+    Tensor indices(Shape({ 2, bagSize }), gpu, Type::Dense, true);
+    indices.LoadData(indexData);
+
+    NN::Embedding sumBag(numEmbeddings, embeddingDim, NN::EmbeddingBag::Sum);
+    NN::Embedding meanBag(numEmbeddings, embeddingDim,
+                          NN::EmbeddingBag::Mean);
+    meanBag.GetWeight().LoadData(sumBag.GetWeight().GetData());
+    const auto weightData = sumBag.GetWeight().GetData();
+
+    auto sumY = sumBag(indices);
+    auto meanY = meanBag(indices);
+    CHECK(sumY.GetShape() == Shape({ 2, embeddingDim }));
+
+    const auto sumData = sumY.GetData();
+    const auto meanData = meanY.GetData();
+    for (int bagIdx = 0; bagIdx < 2; ++bagIdx)
+        for (int col = 0; col < embeddingDim; ++col)
+        {
+            float expected = 0.0f;
+            for (int i = 0; i < bagSize; ++i)
+                expected += weightData[static_cast<int>(
+                                           indexData[bagIdx * bagSize + i]) *
+                                       embeddingDim + col];
+            const auto idx = bagIdx * embeddingDim + col;
+            if (print)
+                std::cout << "sum : " << sumData[idx] << " mean : "
+                    << meanData[idx] << " expected sum : " << expected
+                    << std::endl;
+            CHECK(std::abs(sumData[idx] - expected) < 1e-5f);
+            CHECK(std::abs(meanData[idx] - expected / bagSize) < 1e-5f);
+        }
+
+    ModelManager::CurModel().Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
@@ -0,0 +1,328 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <TensorTest/ReducedPrecisionTest.hpp>
+#include <Sapphire/Model.hpp>
+#include <Sapphire/compute/ActivationOps.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/dense/naive/ReducedPrecision.hpp>
+#include <Sapphire/operations/Forward/Linear.hpp>
+#include <Sapphire/operations/optimizers/MixedPrecision.hpp>
+#include <Sapphire/operations/optimizers/SGD.hpp>
+#include <Sapphire/util/CpuFeatures.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+constexpr Util::SimdLevel Levels[] = { Util::SimdLevel::Scalar,
+                                       Util::SimdLevel::Avx2,
+                                       Util::SimdLevel::Avx512 };
+
+//! Results in Float32 are compared with relative error of accumulation
+void CheckClose(const std::vector<float>& expected,
+                const std::vector<float>& result, float tolerance)
+{
+    CHECK(expected.size() == result.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        CHECK(std::abs(expected[i] - result[i]) <=
+              tolerance * (1.0f + std::abs(expected[i])));
+}
+} // namespace
+
+void HalfConversionTest(bool print)
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    CHECK(Util::FloatToHalf(1.0f) == 0x3C00);
+    CHECK(Util::FloatToHalf(-2.0f) == 0xC000);
+    CHECK(Util::FloatToHalf(65504.0f) == 0x7BFF);
+    //! Midpoint of 65504 and 65536 rounds to even, which is infinity
+    CHECK(Util::FloatToHalf(65520.0f) == 0x7C00);
+    CHECK(Util::FloatToHalf(infinity) == 0x7C00);
+    CHECK(Util::FloatToHalf(std::ldexp(1.0f, -24)) == 0x0001);
+    CHECK(Util::FloatToHalf(std::ldexp(1.0f, -26)) == 0x0000);
+    //! 1 + 2^-11 is the midpoint of 1 and next half. It rounds to even 1
+    CHECK(Util::FloatToHalf(1.0f + std::ldexp(1.0f, -11)) == 0x3C00);
+    CHECK(Util::FloatToHalf(1.0f + 3 * std::ldexp(1.0f, -11)) == 0x3C02);
+    CHECK(std::isnan(Util::HalfToFloat(Util::FloatToHalf(std::nanf("")))));
+    CHECK(Util::HalfToFloat(0x0001) == std::ldexp(1.0f, -24));
+    CHECK(Util::HalfToFloat(0xFBFF) == -65504.0f);
+
+    CHECK(Util::FloatToBFloat16(1.0f) == 0x3F80);
+    CHECK(Util::FloatToBFloat16(1.0f + std::ldexp(1.0f, -8)) == 0x3F80);
+    CHECK(Util::FloatToBFloat16(1.0f + 3 * std::ldexp(1.0f, -8)) == 0x3F82);
+    CHECK(Util::BFloat16ToFloat(0xC040) == -3.0f);
+    CHECK(std::isnan(
+        Util::BFloat16ToFloat(Util::FloatToBFloat16(std::nanf("")))));
+
+    //! Random normal values and boundaries of both types
+    std::mt19937 gen(42);
+    auto data = RandomData(gen, 1000, -70000.0f, 70000.0f);
+    for (const float value : { 0.0f, -0.0f, 65504.0f, 65520.0f, infinity,
+                               -infinity, std::ldexp(1.0f, -24),
+                               std::ldexp(1.0f, -15), 1e-3f,
+                               std::numeric_limits<float>::max() })
+        data.emplace_back(value);
+    const auto size = static_cast<unsigned int>(data.size());
+
+    const auto initialLevel = Util::GetSimdLevel();
+    for (const auto level : Levels)
+    {
+        if (!Util::IsSimdLevelAvailable(level))
+            continue;
+        if (print)
+            std::cout << "Testing conversions on "
+                << Util::SimdLevelToString(level) << std::endl;
+        Util::SetSimdLevel(level);
+
+        for (const auto dataType : { DataType::Float16, DataType::BFloat16 })
+        {
+            std::vector<std::uint16_t> converted(size);
+            std::vector<float> restored(size);
+            Compute::Dense::Naive::Convert(converted.data(), dataType,
+                                           data.data(), DataType::Float32,
+                                           size);
+            Compute::Dense::Naive::Convert(restored.data(), DataType::Float32,
+                                           converted.data(), dataType, size);
+
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                const auto expected = dataType == DataType::Float16
+                                          ? Util::FloatToHalf(data[i])
+                                          : Util::FloatToBFloat16(data[i]);
+                const auto expectedValue =
+                    dataType == DataType::Float16
+                        ? Util::HalfToFloat(expected)
+                        : Util::BFloat16ToFloat(expected);
+                CHECK(converted[i] == expected);
+                CHECK((restored[i] == expectedValue ||
+                       (std::isnan(restored[i]) && std::isnan(expectedValue))));
+            }
+        }
+    }
+    Util::SetSimdLevel(initialLevel);
+}
+
+void ReducedGemmTest(bool print)
+{
+    const auto initialLevel = Util::GetSimdLevel();
+    //! Sizes are not multiples of vector width to cover remainders
+    const int M = 7, N = 37, K = 19;
+    std::mt19937 gen(42);
+    const auto dataA = RandomData(gen, M * K);
+    const auto dataB = RandomData(gen, K * N);
+    const auto dataY = RandomData(gen, M * N);
+
+    for (const auto level : Levels)
+    {
+        if (!Util::IsSimdLevelAvailable(level))
+            continue;
+        Util::SetSimdLevel(level);
+
+        for (const auto dataType : { DataType::Float16, DataType::BFloat16 })
+        {
+            if (print)
+                std::cout << "Testing " << DataTypeToString(dataType)
+                    << " Gemm on " << Util::SimdLevelToString(level)
+                    << std::endl;
+
+            const auto a = CreateData(Shape({ M, K }), dataA);
+            const auto b = CreateData(Shape({ K, N }), dataB);
+            const auto reducedB = b.ConvertTo(dataType);
+            //! Reference multiplies Float32 copy of rounded b
+            const auto roundedB = reducedB.ConvertTo(DataType::Float32);
+            CHECK(reducedB.GetDataType() == dataType);
+            CHECK(reducedB.HostRawPtr() == nullptr);
+
+            auto expected = CreateData(Shape({ M, N }), dataY);
+            Compute::Gemm(expected, a, roundedB);
+            auto result = CreateData(Shape({ M, N }), dataY);
+            Compute::Gemm(result, a, reducedB);
+            CheckClose(expected.GetDataCopy(), result.GetDataCopy(), 1e-5f);
+
+            //! Transposed view of reduced data
+            const auto bTransposed =
+                CreateData(Shape({ N, K }), dataB).ConvertTo(dataType);
+            auto expectedTransposed = CreateData(Shape({ M, N }), dataY);
+            Compute::Gemm(expectedTransposed, a,
+                          bTransposed.ConvertTo(DataType::Float32)
+                          .TransposeView());
+            auto resultTransposed = CreateData(Shape({ M, N }), dataY);
+            Compute::Gemm(resultTransposed, a, bTransposed.TransposeView());
+            CheckClose(expectedTransposed.GetDataCopy(),
+                       resultTransposed.GetDataCopy(), 1e-5f);
+
+            //! Elementwise operations read and write reduced data in place
+            const auto x = CreateData(Shape({ M, N }), dataY);
+            const auto reducedX = x.ConvertTo(dataType);
+            auto roundedX = reducedX.ConvertTo(DataType::Float32);
+            TensorUtil::TensorData sum(Shape({ M, N }), Type::Dense,
+                                       dataType);
+            Compute::Add(sum, reducedX, roundedX);
+            TensorUtil::TensorData expectedSum(Shape({ M, N }), Type::Dense);
+            Compute::Add(expectedSum, roundedX, roundedX);
+            CHECK(sum.GetDataCopy() ==
+                  expectedSum.ConvertTo(dataType).GetDataCopy());
+
+            TensorUtil::TensorData relu(Shape({ M, N }), Type::Dense);
+            Compute::ReLU(relu, reducedX);
+            const auto reluData = relu.GetDataCopy();
+            const auto roundedData = roundedX.GetDataCopy();
+            for (std::size_t i = 0; i < reluData.size(); ++i)
+                CHECK(reluData[i] ==
+                      (roundedData[i] > 0.0f ? roundedData[i] : 0.0f));
+        }
+    }
+
+    Util::SetSimdLevel(initialLevel);
+    Util::ResourceManager::ClearAll();
+}
+
+void MixedPrecisionTest(bool print)
+{
+    //! Updates of 1e-4 are below half of ulp of BFloat16 around 1 (2^-8)
+    const float learningRate = 1.0f;
+    const int numSteps = 100;
+    const std::vector<float> gradientData(16, 1e-4f);
+
+    Optimizer::SGD sgd(learningRate);
+    Optimizer::MixedPrecision mixedPrecision(&sgd);
+
+    auto gradient = CreateData(Shape({ 4, 4 }), gradientData);
+    auto weight = CreateData(Shape({ 4, 4 }), std::vector<float>(16, 1.0f))
+        .ConvertTo(DataType::BFloat16, true);
+    auto directWeight = weight.CreateCopy();
+
+    for (int step = 0; step < numSteps; ++step)
+    {
+        mixedPrecision(weight, gradient, "weight");
+        sgd(directWeight, gradient, "weight");
+    }
+
+    const auto expected = 1.0f - numSteps * learningRate * 1e-4f;
+    auto master = mixedPrecision.GetMasterWeight(weight);
+    const auto masterData = master.GetDataCopy();
+    const auto weightData = weight.GetDataCopy();
+    const auto directData = directWeight.GetDataCopy();
+    if (print)
+        std::cout << "Master : " << masterData[0] << " Weight : "
+            << weightData[0] << " Without master : " << directData[0]
+            << std::endl;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        CHECK(std::abs(masterData[i] - expected) < 1e-5f);
+        CHECK(weightData[i] ==
+              Util::BFloat16ToFloat(Util::FloatToBFloat16(masterData[i])));
+        //! Each update is rounded away without the master weight
+        CHECK(directData[i] == 1.0f);
+    }
+
+    //! Float32 weights are updated directly
+    auto fullWeight = CreateData(Shape({ 4, 4 }),
+                                 std::vector<float>(16, 1.0f));
+    mixedPrecision(fullWeight, gradient, "weight");
+    CHECK(std::abs(fullWeight.GetDataCopy()[0] - (1.0f - 1e-4f)) < 1e-7f);
+    CHECK_THROWS(static_cast<void>(mixedPrecision.GetMasterWeight(fullWeight)));
+
+    Util::ResourceManager::ClearAll();
+}
+
+void MixedPrecisionLinearTest(bool print)
+{
+    ModelManager::AddModel("MixedPrecisionLinearTest");
+    ModelManager::SetCurrentModel("MixedPrecisionLinearTest");
+    auto& model = ModelManager::CurModel();
+
+    constexpr int batchSize = 8;
+    constexpr int inputs = 16;
+    constexpr int outputs = 8;
+    constexpr int numSteps = 10;
+    std::mt19937 gen(42);
+    const auto xData = RandomData(gen, batchSize * inputs);
+    const auto target = RandomData(gen, batchSize * outputs, -0.5f, 0.5f);
+
+    //! Trains given unit on squared error to the target for one step
+    const auto train = [&](NN::Linear& linear, Optimizer::Optimizer* optimizer)
+    {
+        model.SetOptimizer(optimizer);
+        Tensor x(Shape({ batchSize, inputs }), true);
+        x.LoadData(xData);
+        auto y = linear(x);
+        const auto output = y.GetData();
+        auto gradient = output;
+        for (std::size_t i = 0; i < gradient.size(); ++i)
+            gradient[i] -= target[i];
+        y.LoadGradient(gradient);
+        model.BackProp(y);
+        return output;
+    };
+
+    for (const auto dataType : { DataType::Float16, DataType::BFloat16 })
+    {
+        Optimizer::SGD sgd(0.05f);
+        Optimizer::MixedPrecision mixedPrecision(&sgd);
+
+        NN::Linear reference(inputs, outputs);
+        NN::Linear reduced(inputs, outputs);
+        const auto initialWeight = reference.GetWeight().GetData();
+        reduced.GetWeight().LoadData(initialWeight);
+        reduced.GetBias().LoadData(reference.GetBias().GetData());
+        reduced.SetWeightDataType(dataType);
+        CHECK(reduced.GetWeight().GetDataType() == dataType);
+        CHECK(reduced.GetBias().GetDataType() == dataType);
+        CHECK(reference.GetWeight().GetDataType() == DataType::Float32);
+
+        std::vector<float> referenceOutput, reducedOutput;
+        for (int step = 0; step < numSteps; ++step)
+        {
+            referenceOutput = train(reference, &sgd);
+            reducedOutput = train(reduced, &mixedPrecision);
+        }
+        CheckClose(referenceOutput, reducedOutput, 2e-2f);
+
+        //! Master weight follows the Float32 unit, and the weight is rounded
+        //! from it
+        const auto weightData =
+            model.GetDescriptor(reduced.GetWeight().TensorDescriptorKey())
+                 .GetForwardData();
+        CHECK(weightData.GetDataType() == dataType);
+        auto master = mixedPrecision.GetMasterWeight(weightData);
+        const auto masterData = master.GetDataCopy();
+        const auto referenceWeight = reference.GetWeight().GetData();
+        const auto reducedWeight = reduced.GetWeight().GetData();
+        CHECK(referenceWeight != initialWeight);
+        CheckClose(referenceWeight, masterData, 1e-2f);
+        for (std::size_t i = 0; i < masterData.size(); ++i)
+        {
+            const auto rounded =
+                dataType == DataType::Float16
+                    ? Util::HalfToFloat(Util::FloatToHalf(masterData[i]))
+                    : Util::BFloat16ToFloat(
+                        Util::FloatToBFloat16(masterData[i]));
+            CHECK(reducedWeight[i] == rounded);
+        }
+
+        if (print)
+            std::cout << DataTypeToString(dataType) << " output : "
+                << reducedOutput[0] << " Float32 output : "
+                << referenceOutput[0] << std::endl;
+    }
+
+    model.SetOptimizer(nullptr);
+    model.Clear();
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
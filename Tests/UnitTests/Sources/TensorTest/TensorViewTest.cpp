@@ -0,0 +1,167 @@
+// Copyright (c) 2021, Justin Kim
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <TensorTest/TensorViewTest.hpp>
+#include <Sapphire/compute/ActivationOps.hpp>
+#include <Sapphire/compute/BasicOps.hpp>
+#include <Sapphire/compute/Initialize.hpp>
+#include <Sapphire/compute/TrigonometricOps.hpp>
+#include <Sapphire/util/ResourceManager.hpp>
+#include <TestUtil.hpp>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace Sapphire::Test
+{
+namespace
+{
+//! Creates host tensorData filled with 0, 1, 2, ...
+TensorUtil::TensorData CreateSequence(const Shape& shape)
+{
+    TensorUtil::TensorData tensorData(shape, Type::Dense);
+    std::vector<float> data(shape.Size());
+    std::iota(data.begin(), data.end(), 0.0f);
+    tensorData.SetData(data);
+    return tensorData;
+}
+} // namespace
+
+void TensorViewTest(bool print)
+{
+    //! (2 x 3 x 4) tensor
+    auto x = CreateSequence(Shape({ 2, 3, 4 }));
+    CHECK(x.IsContiguous());
+    CHECK(x.GetStrides() == std::vector<int>({ 12, 4, 1 }));
+
+    //! Slicing along the batch keeps data contiguous
+    auto batch = x.NarrowView(0, 1, 1);
+    CHECK(batch.IsContiguous());
+    CHECK(batch.HostRawPtr() == x.HostRawPtr() + 12);
+    CHECK(batch.GetDataCopy()[0] == 12.0f);
+
+    //! Transposed view shares data and reads elements in transposed order
+    auto transposed = x.TransposeView();
+    CHECK(transposed.GetShape() == Shape({ 2, 4, 3 }));
+    CHECK(!transposed.IsContiguous());
+    CHECK(transposed.IsTransposed());
+    CHECK(transposed.HostRawPtr() == x.HostRawPtr());
+
+    const auto transposedData = transposed.GetDataCopy();
+    for (int batchIdx = 0; batchIdx < 2; ++batchIdx)
+        for (int row = 0; row < 4; ++row)
+            for (int col = 0; col < 3; ++col)
+            {
+                const auto value =
+                    transposedData[batchIdx * 12 + row * 3 + col];
+                if (print)
+                    std::cout << value << " ";
+                CHECK(value == static_cast<float>(
+                    batchIdx * 12 + col * 4 + row));
+            }
+    if (print)
+        std::cout << std::endl;
+
+    //! Narrowing inner dimension produces a strided view
+    auto columns = x.NarrowView(-1, 1, 2);
+    CHECK(!columns.IsContiguous());
+    CHECK(columns.GetDataCopy() ==
+        std::vector<float>({ 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22 }));
+
+    //! Writing to a view writes to the original data
+    auto column = x.NarrowView(2, 3, 1);
+    column.SetData(std::vector<float>(6, -1.0f));
+    const auto written = x.GetDataCopy();
+    for (int i = 0; i < 24; ++i)
+        CHECK(written[i] == (i % 4 == 3 ? -1.0f : static_cast<float>(i)));
+
+    //! Contiguous copy is independent from the view
+    auto copy = columns.Contiguous();
+    CHECK(copy.IsContiguous());
+    CHECK(copy.HostRawPtr() != x.HostRawPtr());
+    CHECK(copy.GetDataCopy() == columns.GetDataCopy());
+    CHECK(x.Contiguous().HostRawPtr() == x.HostRawPtr());
+
+    //! Expand, squeeze and unsqueeze only change the shape
+    auto expanded = batch.ExpandView(4);
+    CHECK(expanded.GetShape() == Shape({ 1, 1, 3, 4 }));
+    CHECK(expanded.IsContiguous());
+    auto squeezed = expanded.SqueezeView();
+    CHECK(squeezed.GetShape() == Shape({ 3, 4 }));
+    CHECK(squeezed.HostRawPtr() == batch.HostRawPtr());
+    CHECK(squeezed.UnSqueezeView(1).GetShape() == Shape({ 3, 1, 4 }));
+    CHECK(batch.SqueezeView(0).GetShape() == Shape({ 3, 4 }));
+    CHECK(batch.SqueezeView(1).GetShape() == batch.GetShape());
+
+    //! Elementwise operations copy views that are not contiguous
+    TensorUtil::TensorData y(columns.GetShape(), Type::Dense);
+    Compute::Scale(y, columns, 2.0f);
+    auto expected = columns.GetDataCopy();
+    const auto result = y.GetDataCopy();
+    for (std::size_t i = 0; i < result.size(); ++i)
+        CHECK(result[i] == expected[i] * 2.0f);
+
+    //! Views that are not contiguous are rejected as outputs
+    const auto before = x.GetDataCopy();
+    CHECK_THROWS(Compute::Scale(columns, y, 2.0f));
+    CHECK_THROWS(Compute::Add(columns, y, y));
+    CHECK_THROWS(Compute::ReLU(transposed, transposed.Contiguous()));
+    CHECK_THROWS(Compute::Cos(columns, y));
+    CHECK(x.GetDataCopy() == before);
+
+    CHECK_THROWS(static_cast<void>(x.NarrowView(1, 2, 2)));
+    CHECK_THROWS(static_cast<void>(x.SqueezeView(3)));
+    CHECK_THROWS(transposed.Reshape(Shape({ 24 })));
+
+    Util::ResourceManager::ClearAll();
+}
+
+void TransposedGemmTest(bool print)
+{
+    const auto numMatrices = 3;
+    const auto M = 7;
+    const auto N = 19;
+    const auto K = 11;
+
+    //! Data of a and b stored in transposed layout
+    TensorUtil::TensorData aT(Shape({ numMatrices, K, M }), Type::Dense);
+    TensorUtil::TensorData bT(Shape({ numMatrices, N, K }), Type::Dense);
+    Compute::Initialize::Normal(aT, 0.0f, 1.0f);
+    Compute::Initialize::Normal(bT, 0.0f, 1.0f);
+
+    //! Copies of a and b in row major order
+    TensorUtil::TensorData a(Shape({ numMatrices, M, K }), Type::Dense);
+    TensorUtil::TensorData b(Shape({ numMatrices, K, N }), Type::Dense);
+    Compute::Transpose(a, aT);
+    Compute::Transpose(b, bT);
+
+    const Shape outShape({ numMatrices, M, N });
+    const auto aView = aT.TransposeView();
+    const auto bView = bT.TransposeView();
+    const std::vector<std::pair<const TensorUtil::TensorData*,
+                                const TensorUtil::TensorData*>> inputs = {
+        { &aView, &b }, { &a, &bView }, { &aView, &bView }
+    };
+
+    TensorUtil::TensorData expected(outShape, Type::Dense);
+    Compute::Initialize::Zeros(expected);
+    Compute::Gemm(expected, a, b);
+    const auto expectedData = expected.GetDataCopy();
+
+    for (const auto& [lhs, rhs] : inputs)
+    {
+        TensorUtil::TensorData out(outShape, Type::Dense);
+        Compute::Initialize::Zeros(out);
+        Compute::Gemm(out, *lhs, *rhs);
+        const auto outData = out.GetDataCopy();
+        CheckNoneZeroEquality(outData.data(), expectedData.data(),
+                              static_cast<unsigned int>(outData.size()),
+                              print, 1e-4f);
+    }
+
+    Util::ResourceManager::ClearAll();
+}
+} // namespace Sapphire::Test
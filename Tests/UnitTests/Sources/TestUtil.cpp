@@ -10,6 +10,7 @@
 #include <doctest.h>
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 
 namespace Sapphire::Test
 {
@@ -109,4 +110,31 @@ void CheckNoneZero(const float* ptr, unsigned size,
         CHECK(pass);
     }
 }
+
+std::vector<float> RandomData(std::mt19937& gen, std::size_t size, float low,
+                              float high)
+{
+    std::uniform_real_distribution<float> distribution(low, high);
+    std::vector<float> data(size);
+    for (auto& value : data)
+        value = distribution(gen);
+    return data;
+}
+
+TensorUtil::TensorData CreateData(const Shape& shape,
+                                  const std::vector<float>& data)
+{
+    TensorUtil::TensorData tensorData(shape, Type::Dense);
+    tensorData.SetData(data);
+    return tensorData;
+}
+
+float MaxDifference(const std::vector<float>& a, const std::vector<float>& b)
+{
+    CHECK(a.size() == b.size());
+    float result = 0.0f;
+    for (std::size_t i = 0; i < std::min(a.size(), b.size()); ++i)
+        result = std::max(result, std::abs(a[i] - b[i]));
+    return result;
+}
 } // namespace Sapphire::Test
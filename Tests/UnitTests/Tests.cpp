@@ -8,12 +8,20 @@
 
 #include <FunctionTest/BroadcastTest.hpp>
 #include <FunctionTest/GemmTest.hpp>
+#include <FunctionTest/BlockSparseTest.hpp>
+#include <FunctionTest/SimdDispatchTest.hpp>
+#include <FunctionTest/QuantizeTest.hpp>
+#include <FunctionTest/FusionTest.hpp>
+#include <FunctionTest/NormalizationTest.hpp>
+#include <FunctionTest/RecurrentTest.hpp>
+#include <FunctionTest/AttentionTest.hpp>
 #include <Sapphire/Tests/CudaFunctionalityTest.cuh>
 #include <BasicsTest/SimpleTest.hpp>
 #include <OperationTest/MathTest.hpp>
 #include <OperationTest/MeanTest.hpp>
 #include <OperationTest/MSETest.hpp>
 #include <OperationTest/LinearTest.hpp>
+#include <OperationTest/EmbeddingTest.hpp>
 #include <OperationTest/Conv2DTest.hpp>
 #include <OperationTest/SoftmaxTest.hpp>
 #include <OperationTest/MaxPool2DTest.hpp>
@@ -21,8 +29,21 @@
 #include <ModelTest/Conv2DModel.hpp>
 #include <ModelTest/MnistLinear.hpp>
 #include <BasicsTest/TransposeTest.hpp>
+#include <BasicsTest/ProfilerTest.hpp>
+#include <BasicsTest/SlotVectorTest.hpp>
 #include <TensorTest/TensorFunctionalityTest.hpp>
+#include <TensorTest/TensorViewTest.hpp>
+#include <TensorTest/ReducedPrecisionTest.hpp>
 #include <DataLoaderTest/CsvLoaderTest.hpp>
+#include <DataLoaderTest/BinaryLoaderTest.hpp>
+#include <DataLoaderTest/PrefetcherTest.hpp>
+#include <DataLoaderTest/CsvCacheTest.hpp>
+#include <DataLoaderTest/SamplerTest.hpp>
+#include <ModelTest/CheckpointTest.hpp>
+#include <ModelTest/ModelContextTest.hpp>
+#include <ModelTest/BackPropMemoryTest.hpp>
+#include <ModelTest/GradientCheckpointTest.hpp>
+#include <ModelTest/ServingTest.hpp>
 #include <FunctionTest/Conv2DTest.hpp>
 #include <Sapphire/compute/TrigonometricOps.hpp>
 #include <Sapphire/compute/BasicOps.hpp>
@@ -32,6 +53,31 @@
 #include <iostream>
 #include "doctest.h"
 
+//! Tests running on host only
+#define MappedDataLoaderTest
+#define CsvCacheConversionTest
+#define EpochSamplerTest
+#define PrefetchingLoaderTest
+#define ModelCheckpointTest
+#define OpProfilerTest
+#define HostBroadcastTest
+#define HostSimdTest
+#define StridedViewTest
+#define HostReducedPrecisionTest
+#define HostQuantizeTest
+#define ThreadLocalModelTest
+#define DescriptorSlotTest
+#define BackPropReleaseTest
+#define ActivationRecomputeTest
+#define HostFusionTest
+#define HostNormalizationTest
+#define HostRecurrentTest
+#define HostAttentionTest
+#define BlockSparseTest
+#define BatchedServingTest
+
+//! Tests comparing host results with cuda
+#ifdef WITH_CUDA
 #define GraphTest
 // #define DataLoaderTest
 #define TrainTest
@@ -44,6 +90,7 @@
 #define ConvolutionTest
 #define BasicGraphTest
 // #define ModelTest
+#endif
 
 namespace Sapphire::Test
 {
@@ -237,6 +284,214 @@ TEST_CASE("Gemm Broadcast Test")
 }
 #endif
 
+#ifdef HostBroadcastTest
+TEST_CASE("Host Broadcast Test")
+{
+    std::cout << "Testing broadcast of (1, C, 1, 1) over (N, C, H, W)"
+        << std::endl;
+    HostChannelBroadcastTest(false);
+    Util::ResourceManager::ClearAll();
+}
+#endif
+
+#ifdef BlockSparseTest
+TEST_CASE("Block Sparse Test")
+{
+    constexpr int testLoops = 3;
+    const std::pair<int, int> blockSizes[] = {
+        { 4, 4 }, { 8, 1 }, { 16, 1 }, { 1, 8 }, { 2, 3 }
+    };
+
+    SUBCASE("Conversion")
+    {
+        for (const auto& [blockRows, blockCols] : blockSizes)
+            for (int i = 0; i < testLoops; ++i)
+                BlockSparseConversionTest(blockRows, blockCols, false);
+    }
+
+    SUBCASE("Block sparse Gemm")
+    {
+        for (const auto& [blockRows, blockCols] : blockSizes)
+        {
+            std::cout << "Block sparse Gemm (" << blockRows << ", "
+                << blockCols << ")" << std::endl;
+            for (int i = 0; i < testLoops; ++i)
+                BlockSparseGemmTest(blockRows, blockCols, false);
+        }
+    }
+
+    SUBCASE("Linear pruning")
+    {
+        std::cout << "Linear pruning" << std::endl;
+        BlockSparseLinearPruneTest(false);
+    }
+}
+#endif
+
+#ifdef HostSimdTest
+TEST_CASE("Simd Dispatch Test")
+{
+    std::cout << "Testing simd dispatch" << std::endl;
+    SimdDispatchTest(false);
+}
+#endif
+
+#ifdef StridedViewTest
+TEST_CASE("Strided View Test")
+{
+    SUBCASE("Views")
+    {
+        std::cout << "Testing tensorData views" << std::endl;
+        TensorViewTest(false);
+    }
+
+    SUBCASE("Gemm with transposed views")
+    {
+        std::cout << "Testing Gemm with transposed views" << std::endl;
+        TransposedGemmTest(false);
+    }
+}
+#endif
+
+#ifdef HostReducedPrecisionTest
+TEST_CASE("Reduced Precision Test")
+{
+    SUBCASE("Conversions")
+    {
+        std::cout << "Testing Float16 and BFloat16 conversions" << std::endl;
+        HalfConversionTest(false);
+    }
+
+    SUBCASE("Operations on reduced precision data")
+    {
+        std::cout << "Testing Gemm on Float16 and BFloat16 data" << std::endl;
+        ReducedGemmTest(false);
+    }
+
+    SUBCASE("Master weights")
+    {
+        std::cout << "Testing mixed precision optimizer" << std::endl;
+        MixedPrecisionTest(false);
+    }
+
+    SUBCASE("Training reduced precision units")
+    {
+        std::cout << "Testing Linear with reduced precision weights"
+            << std::endl;
+        MixedPrecisionLinearTest(false);
+    }
+}
+#endif
+
+#ifdef HostQuantizeTest
+TEST_CASE("Int8 Quantization Test")
+{
+    SUBCASE("Int8 Gemm")
+    {
+        std::cout << "Testing int8 gemm" << std::endl;
+        Int8GemmTest(false);
+    }
+
+    SUBCASE("Int8 Convolution")
+    {
+        std::cout << "Testing int8 convolution" << std::endl;
+        Int8Conv2DTest(false);
+    }
+
+    SUBCASE("Quantized units")
+    {
+        std::cout << "Testing quantized Linear and Conv2D" << std::endl;
+        QuantizedUnitTest(false);
+    }
+}
+#endif
+
+#ifdef HostFusionTest
+TEST_CASE("Operator Fusion Test")
+{
+    SUBCASE("Fused kernels")
+    {
+        std::cout << "Testing fused bias and activation kernels" << std::endl;
+        FusedKernelTest(false);
+    }
+
+    SUBCASE("Fused units")
+    {
+        std::cout << "Testing units with fused activation" << std::endl;
+        FusedUnitTest(false);
+    }
+}
+#endif
+
+#ifdef HostNormalizationTest
+TEST_CASE("Normalization Test")
+{
+    SUBCASE("Normalization kernels")
+    {
+        std::cout << "Testing batch and layer normalization kernels"
+            << std::endl;
+        NormalizationKernelTest(false);
+    }
+
+    SUBCASE("Normalization units")
+    {
+        std::cout << "Testing BatchNorm2D, LayerNorm and folding" << std::endl;
+        NormalizationUnitTest(false);
+    }
+}
+#endif
+
+#ifdef HostRecurrentTest
+TEST_CASE("Recurrent Test")
+{
+    SUBCASE("Recurrent kernels")
+    {
+        std::cout << "Testing fused LSTM and GRU kernels" << std::endl;
+        RecurrentKernelTest(false);
+    }
+
+    SUBCASE("Recurrent units")
+    {
+        std::cout << "Testing LSTM and GRU units" << std::endl;
+        RecurrentUnitTest(false);
+    }
+}
+#endif
+
+#ifdef HostAttentionTest
+TEST_CASE("Attention Test")
+{
+    SUBCASE("Attention kernels")
+    {
+        std::cout << "Testing fused attention kernels" << std::endl;
+        AttentionKernelTest(false);
+    }
+
+    SUBCASE("Attention functional")
+    {
+        std::cout << "Testing F::ScaledDotProductAttention" << std::endl;
+        AttentionFunctionalTest(false);
+    }
+}
+#endif
+
+#ifdef BatchedServingTest
+TEST_CASE("Serving Test")
+{
+    SUBCASE("In-process queue")
+    {
+        std::cout << "Testing batched inference server" << std::endl;
+        InferenceServerTest(false);
+    }
+
+    SUBCASE("Unix socket")
+    {
+        std::cout << "Testing inference over unix domain socket" << std::endl;
+        UnixSocketServingTest(false);
+    }
+}
+#endif
+
 #ifdef InitializeTest
 TEST_CASE("InitializeTest")
 {
@@ -356,6 +611,13 @@ TEST_CASE("BasicGraphTest")
         TestLinear(false);
     }
 
+    SUBCASE("EmbeddingTest")
+    {
+        std::cout << "Embedding" << std::endl;
+        TestEmbedding(false);
+        TestEmbeddingBag(false);
+    }
+
     SUBCASE("CudaConv2DTest")
     {
         std::cout << "Conv2D" << std::endl;
@@ -394,6 +656,97 @@ TEST_CASE("Data Loader Test")
 }
 #endif
 
+#ifdef MappedDataLoaderTest
+TEST_CASE("Binary Loader Test")
+{
+    std::cout << "Testing binary loader" << std::endl;
+    BinaryLoaderTest(false);
+}
+#endif
+
+#ifdef PrefetchingLoaderTest
+TEST_CASE("Prefetcher Test")
+{
+    std::cout << "Testing prefetcher" << std::endl;
+    PrefetcherTest(false);
+}
+#endif
+
+#ifdef CsvCacheConversionTest
+TEST_CASE("Csv Cache Test")
+{
+    std::cout << "Testing csv cache" << std::endl;
+    CsvCacheTest(false);
+}
+#endif
+
+#ifdef EpochSamplerTest
+TEST_CASE("Sampler Test")
+{
+    std::cout << "Testing sampler" << std::endl;
+    SamplerTest(false);
+}
+#endif
+
+#ifdef ModelCheckpointTest
+TEST_CASE("Checkpoint Test")
+{
+    std::cout << "Testing checkpoint" << std::endl;
+    CheckpointTest(false);
+}
+#endif
+
+#ifdef ThreadLocalModelTest
+TEST_CASE("Model Context Test")
+{
+    std::cout << "Testing models driven by multiple threads" << std::endl;
+    ConcurrentModelTest(false);
+}
+#endif
+
+#ifdef DescriptorSlotTest
+TEST_CASE("Slot Vector Test")
+{
+    std::cout << "Testing slot vector" << std::endl;
+    SlotVectorTest(false);
+}
+#endif
+
+#ifdef BackPropReleaseTest
+TEST_CASE("Early Release Test")
+{
+    std::cout << "Testing release of tensors during back propagation"
+        << std::endl;
+    EarlyReleaseTest(false);
+}
+#endif
+
+#ifdef ActivationRecomputeTest
+TEST_CASE("Gradient Checkpoint Test")
+{
+    SUBCASE("Recomputation")
+    {
+        std::cout << "Testing recomputation of checkpoint regions"
+            << std::endl;
+        RecomputeTest(false);
+    }
+
+    SUBCASE("BatchNorm2D in checkpoint region")
+    {
+        std::cout << "Testing BatchNorm2D in checkpoint regions" << std::endl;
+        BatchNormRecomputeTest(false);
+    }
+}
+#endif
+
+#ifdef OpProfilerTest
+TEST_CASE("Profiler Test")
+{
+    std::cout << "Testing profiler" << std::endl;
+    ProfilerTest(false);
+}
+#endif
+
 #ifdef TrainTest
 TEST_CASE("train test")
 {